@@ -36,6 +36,9 @@
 #ifdef __AVX__
 #define TEST_AVX
 #endif
+#ifdef __AVX512F__
+#define TEST_AVX512
+#endif
 #endif
 
 #ifdef ETL_MKL_MODE
@@ -186,6 +189,12 @@ using small_kernel_policy_2d = NARY_POLICY(
 #define AVX_SECTION_FUNCTOR(name, ...)
 #endif
 
+#ifdef TEST_AVX512
+#define AVX512_SECTION_FUNCTOR(name, ...) , CPM_SECTION_FUNCTOR(name, __VA_ARGS__)
+#else
+#define AVX512_SECTION_FUNCTOR(name, ...)
+#endif
+
 #ifdef TEST_MKL
 #define MKL_SECTION_FUNCTOR(name, ...) , CPM_SECTION_FUNCTOR(name, __VA_ARGS__)
 #else
@@ -215,3 +224,27 @@ using small_kernel_policy_2d = NARY_POLICY(
 #else
 #define CUDNN_SECTION_FUNCTOR(name, ...)
 #endif
+
+/*!
+ * \brief Apply the unary operator Op on each element of a into r, using
+ * the vector implementation V instead of the default vector mode.
+ *
+ * This makes it possible to compare the different vector modes of an
+ * operator inside a single binary.
+ */
+template <typename V, template <typename> class Op, typename T>
+void vec_unary_helper(const etl::dyn_vector<T>& a, etl::dyn_vector<T>& r) {
+    static constexpr size_t vec_size = V::template traits<T>::size;
+
+    const size_t n = etl::size(a);
+
+    size_t i = 0;
+
+    for (; i + vec_size - 1 < n; i += vec_size) {
+        V::storeu(r.memory_start() + i, Op<T>::template load<V>(V::loadu(a.memory_start() + i)));
+    }
+
+    for (; i < n; ++i) {
+        r[i] = Op<T>::apply(a[i]);
+    }
+}
@@ -218,21 +218,25 @@ CPM_BENCH() {
 }
 
 //Bench exp
-CPM_BENCH() {
-    CPM_TWO_PASS_NS(
-        "sexp [std][exp][s]",
-        [](size_t d){ return std::make_tuple(svec(d), svec(d)); },
-        [](svec& a, svec& r){ r = exp(a); },
-        [](size_t d){ return 100 * d; }
-        );
+CPM_DIRECT_SECTION_TWO_PASS_NS_F("sexp [std][exp][s]",
+    FLOPS([](size_t d){ return 100 * d; }),
+    CPM_SECTION_INIT([](size_t d){ return std::make_tuple(svec(d), svec(d)); }),
+    CPM_SECTION_FUNCTOR("default", [](svec& a, svec& r){ r = exp(a); })
+    SSE_SECTION_FUNCTOR("sse", [](svec& a, svec& r){ vec_unary_helper<etl::sse_vec, etl::exp_unary_op>(a, r); })
+    AVX_SECTION_FUNCTOR("avx", [](svec& a, svec& r){ vec_unary_helper<etl::avx_vec, etl::exp_unary_op>(a, r); })
+    AVX512_SECTION_FUNCTOR("avx512", [](svec& a, svec& r){ vec_unary_helper<etl::avx512_vec, etl::exp_unary_op>(a, r); })
+)
 
-    CPM_TWO_PASS_NS(
-        "dexp [std][exp][d]",
-        [](size_t d){ return std::make_tuple(dvec(d), dvec(d)); },
-        [](dvec& a, dvec& r){ r = exp(a); },
-        [](size_t d){ return 100 * d; }
-        );
+CPM_DIRECT_SECTION_TWO_PASS_NS_F("dexp [std][exp][d]",
+    FLOPS([](size_t d){ return 100 * d; }),
+    CPM_SECTION_INIT([](size_t d){ return std::make_tuple(dvec(d), dvec(d)); }),
+    CPM_SECTION_FUNCTOR("default", [](dvec& a, dvec& r){ r = exp(a); })
+    SSE_SECTION_FUNCTOR("sse", [](dvec& a, dvec& r){ vec_unary_helper<etl::sse_vec, etl::exp_unary_op>(a, r); })
+    AVX_SECTION_FUNCTOR("avx", [](dvec& a, dvec& r){ vec_unary_helper<etl::avx_vec, etl::exp_unary_op>(a, r); })
+    AVX512_SECTION_FUNCTOR("avx512", [](dvec& a, dvec& r){ vec_unary_helper<etl::avx512_vec, etl::exp_unary_op>(a, r); })
+)
 
+CPM_BENCH() {
     CPM_TWO_PASS_NS(
         "sexp_expr [std][exp][s]",
         [](size_t d){ return std::make_tuple(svec(d), svec(d), svec(d)); },
@@ -242,25 +246,28 @@ CPM_BENCH() {
 }
 
 //Bench log
-CPM_BENCH() {
-    CPM_TWO_PASS_NS(
-        "slog [std][log][s]",
-        [](size_t d){ return std::make_tuple(svec(d), svec(d)); },
-        [](svec& a, svec& r){ r = log(a); },
-        [](size_t d){ return 100 * d; }
-        );
+CPM_DIRECT_SECTION_TWO_PASS_NS_F("slog [std][log][s]",
+    FLOPS([](size_t d){ return 100 * d; }),
+    CPM_SECTION_INIT([](size_t d){ return std::make_tuple(svec(d), svec(d)); }),
+    CPM_SECTION_FUNCTOR("default", [](svec& a, svec& r){ r = log(a); })
+    SSE_SECTION_FUNCTOR("sse", [](svec& a, svec& r){ vec_unary_helper<etl::sse_vec, etl::log_unary_op>(a, r); })
+    AVX_SECTION_FUNCTOR("avx", [](svec& a, svec& r){ vec_unary_helper<etl::avx_vec, etl::log_unary_op>(a, r); })
+    AVX512_SECTION_FUNCTOR("avx512", [](svec& a, svec& r){ vec_unary_helper<etl::avx512_vec, etl::log_unary_op>(a, r); })
+)
 
-    CPM_TWO_PASS_NS(
-        "dlog [std][log][d]",
-        [](size_t d){ return std::make_tuple(dvec(d), dvec(d)); },
-        [](dvec& a, dvec& r){ r = log(a); },
-        [](size_t d){ return 100 * d; }
-        );
-}
+CPM_DIRECT_SECTION_TWO_PASS_NS_F("dlog [std][log][d]",
+    FLOPS([](size_t d){ return 100 * d; }),
+    CPM_SECTION_INIT([](size_t d){ return std::make_tuple(dvec(d), dvec(d)); }),
+    CPM_SECTION_FUNCTOR("default", [](dvec& a, dvec& r){ r = log(a); })
+    SSE_SECTION_FUNCTOR("sse", [](dvec& a, dvec& r){ vec_unary_helper<etl::sse_vec, etl::log_unary_op>(a, r); })
+    AVX_SECTION_FUNCTOR("avx", [](dvec& a, dvec& r){ vec_unary_helper<etl::avx_vec, etl::log_unary_op>(a, r); })
+    AVX512_SECTION_FUNCTOR("avx512", [](dvec& a, dvec& r){ vec_unary_helper<etl::avx512_vec, etl::log_unary_op>(a, r); })
+)
 
 CPM_DIRECT_SECTION_TWO_PASS_NS_P("ssum [std][sum][s]", dot_policy,
     CPM_SECTION_INIT([](size_t d1){ return std::make_tuple(svec(d1)); }),
     CPM_SECTION_FUNCTOR("default", [](svec& a){ float_ref += etl::sum(a); }),
+    CPM_SECTION_FUNCTOR("accurate", [](svec& a){ float_ref += etl::accurate_sum(a); }),
     CPM_SECTION_FUNCTOR("std", [](svec& a){ SELECTED_SECTION(etl::sum_impl::STD){ float_ref += etl::sum(a); } })
     VEC_SECTION_FUNCTOR("vec", [](svec& a){ SELECTED_SECTION(etl::sum_impl::VEC){ float_ref += etl::sum(a); } })
     BLAS_SECTION_FUNCTOR("blas", [](svec& a){ SELECTED_SECTION(etl::sum_impl::BLAS){ float_ref += etl::sum(a); } })
@@ -270,6 +277,7 @@ CPM_DIRECT_SECTION_TWO_PASS_NS_P("ssum [std][sum][s]", dot_policy,
 CPM_DIRECT_SECTION_TWO_PASS_NS_P("dsum [std][sum][d]", dot_policy,
     CPM_SECTION_INIT([](size_t d1){ return std::make_tuple(dvec(d1)); }),
     CPM_SECTION_FUNCTOR("default", [](dvec& a){ double_ref += etl::sum(a); }),
+    CPM_SECTION_FUNCTOR("accurate", [](dvec& a){ double_ref += etl::accurate_sum(a); }),
     CPM_SECTION_FUNCTOR("std", [](dvec& a){ SELECTED_SECTION(etl::sum_impl::STD){ double_ref += etl::sum(a); } })
     VEC_SECTION_FUNCTOR("vec", [](dvec& a){ SELECTED_SECTION(etl::sum_impl::VEC){ double_ref += etl::sum(a); } })
     BLAS_SECTION_FUNCTOR("blas", [](dvec& a){ SELECTED_SECTION(etl::sum_impl::BLAS){ float_ref += etl::sum(a); } })
@@ -299,6 +307,7 @@ CPM_DIRECT_SECTION_TWO_PASS_NS_P("strans [transpose][s]", trans_policy,
     CPM_SECTION_INIT([](size_t d1, size_t d2){ return std::make_tuple(smat(d1,d2), smat(d2,d1)); }),
     CPM_SECTION_FUNCTOR("default", [](smat& a, smat& r){ r = transpose(a); }),
     CPM_SECTION_FUNCTOR("std", [](smat& a, smat& r){ r = selected_helper(etl::transpose_impl::STD, transpose(a)); })
+    VEC_SECTION_FUNCTOR("vec", [](smat& a, smat& r){ r = selected_helper(etl::transpose_impl::VEC, transpose(a)); })
     BLAS_SECTION_FUNCTOR("blas", [](smat& a, smat& r){ r = selected_helper(etl::transpose_impl::MKL, transpose(a)); })
     CUBLAS_SECTION_FUNCTOR("cublas", [](smat& a, smat& r){ r = selected_helper(etl::transpose_impl::CUBLAS, transpose(a)); })
 )
@@ -307,6 +316,7 @@ CPM_DIRECT_SECTION_TWO_PASS_NS_P("inplace_strans [transpose][s]", trans_policy,
     CPM_SECTION_INIT([](size_t d1, size_t d2){ return std::make_tuple(smat(d1,d2)); }),
     CPM_SECTION_FUNCTOR("default", [](smat& r){ r.transpose_inplace(); }),
     CPM_SECTION_FUNCTOR("std", [](smat& r){ SELECTED_SECTION(etl::transpose_impl::STD){ r.transpose_inplace(); } })
+    VEC_SECTION_FUNCTOR("vec", [](smat& r){ SELECTED_SECTION(etl::transpose_impl::VEC){ r.transpose_inplace(); } })
     BLAS_SECTION_FUNCTOR("blas", [](smat& r){ SELECTED_SECTION(etl::transpose_impl::MKL){ r.transpose_inplace(); } })
     CUBLAS_SECTION_FUNCTOR("cublas", [](smat& r){ SELECTED_SECTION(etl::transpose_impl::CUBLAS){ r.transpose_inplace(); } })
 )
@@ -318,6 +328,9 @@ CPM_DIRECT_SECTION_TWO_PASS_NS_F("a = sigmoid(b) (s) [std][sigmoid][d]",
     CPM_SECTION_FUNCTOR("default", [](svec& a, svec& b){ a = etl::sigmoid(b); }),
     CPM_SECTION_FUNCTOR("fast", [](svec& a, svec& b){ a = etl::fast_sigmoid(b); }),
     CPM_SECTION_FUNCTOR("hard", [](svec& a, svec& b){ a = etl::hard_sigmoid(b); })
+    SSE_SECTION_FUNCTOR("sse", [](svec& a, svec& b){ vec_unary_helper<etl::sse_vec, etl::sigmoid_unary_op>(b, a); })
+    AVX_SECTION_FUNCTOR("avx", [](svec& a, svec& b){ vec_unary_helper<etl::avx_vec, etl::sigmoid_unary_op>(b, a); })
+    AVX512_SECTION_FUNCTOR("avx512", [](svec& a, svec& b){ vec_unary_helper<etl::avx512_vec, etl::sigmoid_unary_op>(b, a); })
 )
 
 CPM_DIRECT_SECTION_TWO_PASS_NS_F("a = sigmoid(b) (d) [std][sigmoid][d]",
@@ -326,6 +339,9 @@ CPM_DIRECT_SECTION_TWO_PASS_NS_F("a = sigmoid(b) (d) [std][sigmoid][d]",
     CPM_SECTION_FUNCTOR("default", [](dvec& a, dvec& b){ a = etl::sigmoid(b); }),
     CPM_SECTION_FUNCTOR("fast", [](dvec& a, dvec& b){ a = etl::fast_sigmoid(b); }),
     CPM_SECTION_FUNCTOR("hard", [](dvec& a, dvec& b){ a = etl::hard_sigmoid(b); })
+    SSE_SECTION_FUNCTOR("sse", [](dvec& a, dvec& b){ vec_unary_helper<etl::sse_vec, etl::sigmoid_unary_op>(b, a); })
+    AVX_SECTION_FUNCTOR("avx", [](dvec& a, dvec& b){ vec_unary_helper<etl::avx_vec, etl::sigmoid_unary_op>(b, a); })
+    AVX512_SECTION_FUNCTOR("avx512", [](dvec& a, dvec& b){ vec_unary_helper<etl::avx512_vec, etl::sigmoid_unary_op>(b, a); })
 )
 
 #ifdef ETL_EXTENDED_BENCH
@@ -101,3 +101,33 @@ CPM_DIRECT_BENCH_TWO_PASS_NS_P(
         }
     }
 )
+
+CPM_DIRECT_BENCH_TWO_PASS_NS_P(
+    NARY_POLICY(VALUES_POLICY(10, 20, 30, 40, 40), VALUES_POLICY(12, 20, 24, 24, 32)), // K, NH
+    "conv_rbm_pmp_h_batch_32 [crbm][pmp]",
+    [](size_t k, size_t nh) {
+        return std::make_tuple(dmat4(32UL, k, nh, nh), dmat4(32UL, k, nh, nh)); },
+    [](dmat4& a, dmat4& h) {
+        h = etl::p_max_pool_h<2, 2>(a);
+    }
+)
+
+CPM_DIRECT_BENCH_TWO_PASS_NS_P(
+    NARY_POLICY(VALUES_POLICY(10, 20, 30, 40, 40), VALUES_POLICY(12, 20, 24, 24, 32)), // K, NH
+    "conv_rbm_pmp_p_batch_32 [crbm][pmp]",
+    [](size_t k, size_t nh) {
+        return std::make_tuple(dmat4(32UL, k, nh, nh), dmat4(32UL, k, nh / 2, nh / 2)); },
+    [](dmat4& a, dmat4& p) {
+        p = etl::p_max_pool_p<2, 2>(a);
+    }
+)
+
+CPM_DIRECT_BENCH_TWO_PASS_NS_P(
+    NARY_POLICY(VALUES_POLICY(10, 20, 30, 40, 40), VALUES_POLICY(12, 20, 24, 24, 32)), // K, NH
+    "conv_rbm_dyn_pmp_h_batch_32 [crbm][pmp]",
+    [](size_t k, size_t nh) {
+        return std::make_tuple(dmat4(32UL, k, nh, nh), dmat4(32UL, k, nh, nh)); },
+    [](dmat4& a, dmat4& h) {
+        h = etl::p_max_pool_h(a, 2, 2);
+    }
+)
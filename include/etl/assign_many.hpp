@@ -0,0 +1,185 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Fused evaluation of several element-wise assignments.
+ *
+ * The assignments are evaluated block by block: each block of each
+ * assignment is evaluated before the next block, in the order of the
+ * assignments. The inputs shared by several expressions are therefore
+ * read from the cache, instead of being streamed once per assignment.
+ */
+
+#pragma once
+
+namespace etl {
+
+/*!
+ * \brief A deferred assignment of an expression to a container, to be
+ * evaluated by etl::assign_many.
+ *
+ * \tparam L The type of the container
+ * \tparam E The type of the expression
+ */
+template <typename L, typename E>
+struct deferred_assign {
+    L lhs; ///< The container to assign to
+    E rhs; ///< The expression to assign
+};
+
+/*!
+ * \brief Create a deferred assignment of rhs to lhs, to be evaluated by
+ * etl::assign_many
+ * \param lhs The container to assign to
+ * \param rhs The expression to assign
+ * \return The deferred assignment
+ */
+template <typename L, typename E>
+deferred_assign<L, detail::build_type<E>> assign(L&& lhs, E&& rhs) {
+    static_assert(all_etl_expr<L, E>, "etl::assign can only be used on ETL expressions");
+
+    return {std::forward<L>(lhs), std::forward<E>(rhs)};
+}
+
+namespace detail {
+
+/*!
+ * \brief The number of elements of the blocks of assign_many
+ */
+static constexpr size_t assign_many_block = 1024;
+
+/*!
+ * \brief Evaluate the range [first, last) of the given assignment, with
+ * vectorized code. first must be a multiple of the block size.
+ * \param assignment The assignment to evaluate
+ * \param first The first element of the range
+ * \param last The last element of the range (exclusive)
+ */
+template <typename L, typename E, cpp_enable_iff(are_vectorizable<E, L>)>
+ETL_STRONG_INLINE(void) assign_range(deferred_assign<L, E>& assignment, size_t first, size_t last) {
+    static constexpr auto V = select_vector_mode<E, L>();
+
+    using vect_impl = typename get_vector_impl<V>::type;
+    using IT        = typename get_intrinsic_traits<V>::template type<value_t<L>>;
+
+    auto& lhs = assignment.lhs;
+    auto& rhs = assignment.rhs;
+
+    auto* lhs_mem = lhs.memory_start();
+
+    size_t i = first;
+
+    for (; i + 4 * IT::size - 1 < last; i += 4 * IT::size) {
+        lhs.template store<vect_impl>(rhs.template load<vect_impl>(i + 0 * IT::size), i + 0 * IT::size);
+        lhs.template store<vect_impl>(rhs.template load<vect_impl>(i + 1 * IT::size), i + 1 * IT::size);
+        lhs.template store<vect_impl>(rhs.template load<vect_impl>(i + 2 * IT::size), i + 2 * IT::size);
+        lhs.template store<vect_impl>(rhs.template load<vect_impl>(i + 3 * IT::size), i + 3 * IT::size);
+    }
+
+    for (; i + IT::size - 1 < last; i += IT::size) {
+        lhs.template store<vect_impl>(rhs.template load<vect_impl>(i), i);
+    }
+
+    for (; i < last; ++i) {
+        lhs_mem[i] = rhs.read_flat(i);
+    }
+}
+
+/*!
+ * \copydoc assign_range
+ */
+template <typename L, typename E, cpp_disable_iff(are_vectorizable<E, L>)>
+ETL_STRONG_INLINE(void) assign_range(deferred_assign<L, E>& assignment, size_t first, size_t last) {
+    auto* lhs_mem = assignment.lhs.memory_start();
+
+    for (size_t i = first; i < last; ++i) {
+        lhs_mem[i] = assignment.rhs.read_flat(i);
+    }
+}
+
+/*!
+ * \brief Evaluate the blocks [first, last) of the given assignments.
+ *
+ * The assignments are taken by value: the local copies of the
+ * expressions cannot alias the memory of the containers, which lets the
+ * compiler keep their scalars in registers.
+ *
+ * \param first The first block
+ * \param last The last block (exclusive)
+ * \param n The number of elements
+ * \param assignments The assignments to evaluate
+ */
+template <typename... L, typename... E>
+void assign_blocks(size_t first, size_t last, size_t n, deferred_assign<L, E>... assignments) {
+    for (size_t b = first; b < last; ++b) {
+        const size_t block      = b * assign_many_block;
+        const size_t block_last = std::min(block + assign_many_block, n);
+
+        cpp::for_each_in([block, block_last](auto& assignment) {
+            assign_range(assignment, block, block_last);
+        }, assignments...);
+    }
+}
+
+} //end of namespace detail
+
+/*!
+ * \brief Evaluate several element-wise assignments in a single traversal.
+ *
+ * The result is the same as the one of the assignments evaluated in
+ * order. An expression can use the result of a previous assignment.
+ *
+ * \code{.cpp}
+ * etl::assign_many(
+ *     etl::assign(m, beta1 * m + (1.0f - beta1) * g),
+ *     etl::assign(v, beta2 * v + (1.0f - beta2) * (g >> g)),
+ *     etl::assign(w, w - lr * (m / (etl::sqrt(v) + eps))));
+ * \endcode
+ *
+ * \param assignments The assignments to evaluate
+ */
+template <typename... L, typename... E>
+void assign_many(deferred_assign<L, E>... assignments) {
+    static_assert(sizeof...(L) > 0, "assign_many needs at least one assignment");
+    static_assert(and_v<(decay_traits<E>::is_linear)...>, "assign_many only supports element-wise expressions");
+    static_assert(and_v<(is_dma<L>)...>, "assign_many can only assign to containers with direct memory access");
+
+    size_t n = 0;
+
+    cpp::for_each_in([&n](auto& assignment) {
+        n = etl::size(assignment.lhs);
+    }, assignments...);
+
+    cpp::for_each_in([n](auto& assignment) {
+        cpp_assert(etl::size(assignment.lhs) == n, "assign_many needs containers of the same size");
+        cpp_assert(etl::size(assignment.rhs) == n, "Invalid size for assign_many");
+        cpp_unused(n);
+
+        standard_evaluator::pre_assign_rhs(assignment.rhs);
+
+        safe_ensure_cpu_up_to_date(assignment.rhs);
+        safe_ensure_cpu_up_to_date(assignment.lhs);
+    }, assignments...);
+
+    // The work is split by blocks so that all the blocks stay aligned
+
+    auto batch_fun = [&](size_t first, size_t last) {
+        detail::assign_blocks(first, last, n, assignments...);
+    };
+
+    const size_t blocks = (n + detail::assign_many_block - 1) / detail::assign_many_block;
+
+    engine_dispatch_1d(batch_fun, 0, blocks, engine_select_parallel(n, parallel_threshold) && and_v<(is_thread_safe<E>)...>);
+
+    cpp::for_each_in([](auto& assignment) {
+        assignment.lhs.validate_cpu();
+        assignment.lhs.invalidate_gpu();
+    }, assignments...);
+}
+
+} //end of namespace etl
@@ -0,0 +1,588 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file avx512_exp.hpp
+ * \brief AVX-512 implementation of exp, log and of the functions built on
+ * them (log1p, tanh, sinh, cosh), and of sin and cos
+ *
+ * The polynomials are the same Cephes approximations as the ones used
+ * for SSE and AVX. AVX-512F makes the range reduction simpler: the
+ * exponent and mantissa are directly extracted with getexp/getmant
+ * (denormals included) and scalef builds the 2^n scaling without
+ * overflowing the intermediate results.
+ *
+ * Only AVX-512F instructions are used: the floating point bitwise
+ * operations of AVX-512DQ are replaced by their integer counterparts.
+ */
+
+#pragma once
+
+#ifdef __AVX512F__
+
+#include <limits>
+
+#include <immintrin.h>
+
+#include "etl/inline.hpp"
+
+#define ETL_INLINE_VEC_512 ETL_STATIC_INLINE(__m512)
+#define ETL_INLINE_VEC_512D ETL_STATIC_INLINE(__m512d)
+
+namespace etl {
+
+namespace detail {
+
+/*!
+ * \brief Evaluate a polynomial of degree N with Horner's scheme
+ * \param x The vector of values
+ * \param c The coefficients, starting with the highest degree
+ * \return a vector containing the values of the polynomial
+ */
+template <size_t N>
+ETL_INLINE_VEC_512D polevl512_pd(__m512d x, const double (&c)[N]) {
+    auto r = _mm512_set1_pd(c[0]);
+
+    for (size_t i = 1; i < N; ++i) {
+        r = _mm512_fmadd_pd(r, x, _mm512_set1_pd(c[i]));
+    }
+
+    return r;
+}
+
+/*!
+ * \copydoc polevl512_pd
+ */
+template <size_t N>
+ETL_INLINE_VEC_512 polevl512_ps(__m512 x, const float (&c)[N]) {
+    auto r = _mm512_set1_ps(c[0]);
+
+    for (size_t i = 1; i < N; ++i) {
+        r = _mm512_fmadd_ps(r, x, _mm512_set1_ps(c[i]));
+    }
+
+    return r;
+}
+
+/*!
+ * \brief Return the absolute value of m with the sign of x
+ * \param m The vector of magnitudes, all positive
+ * \param x The vector of signs
+ */
+ETL_INLINE_VEC_512D copysign512_pd(__m512d m, __m512d x) {
+    auto sign = _mm512_and_epi64(_mm512_castpd_si512(x), _mm512_set1_epi64(0x8000000000000000LL));
+    return _mm512_castsi512_pd(_mm512_or_epi64(_mm512_castpd_si512(m), sign));
+}
+
+/*!
+ * \copydoc copysign512_pd
+ */
+ETL_INLINE_VEC_512 copysign512_ps(__m512 m, __m512 x) {
+    auto sign = _mm512_and_epi32(_mm512_castps_si512(x), _mm512_set1_epi32(0x80000000));
+    return _mm512_castsi512_ps(_mm512_or_epi32(_mm512_castps_si512(m), sign));
+}
+
+} //end of namespace detail
+
+/*!
+ * \brief AVX-512-Vectorized exponential in double-precision
+ *
+ * The maximum error is 2 ULP. The results saturate to zero and
+ * infinity outside of [-745, 709.78].
+ *
+ * \param x The vector of numbers to compute the exponential from
+ * \return a vector containing the exponential of the input vector values
+ */
+ETL_INLINE_VEC_512D exp512_pd(__m512d x) {
+    static constexpr double P[] = {1.26177193074810590878E-4, 3.02994407707441961300E-2, 9.99999999999999999910E-1};
+    static constexpr double Q[] = {3.00198505138664455042E-6, 2.52448340349684104192E-3, 2.27265548208155028766E-1, 2.00000000000000000009E0};
+
+    // The constant is the first operand so that NaN are propagated
+    x = _mm512_min_pd(_mm512_set1_pd(7.1e2), x);
+    x = _mm512_max_pd(_mm512_set1_pd(-7.46e2), x);
+
+    // Express e^x = e^g 2^n = e^g e^(n log(2)) = e^(g + n log(2))
+    auto px = _mm512_roundscale_pd(_mm512_mul_pd(x, _mm512_set1_pd(1.4426950408889634073599)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+
+    x = _mm512_fnmadd_pd(px, _mm512_set1_pd(6.93145751953125E-1), x);
+    x = _mm512_fnmadd_pd(px, _mm512_set1_pd(1.42860682030941723212E-6), x);
+
+    // Rational approximation of e^g = 1 + 2 * g * P(g^2) / (Q(g^2) - g * P(g^2))
+    auto xx = _mm512_mul_pd(x, x);
+    auto p  = _mm512_mul_pd(x, detail::polevl512_pd(xx, P));
+    auto q  = detail::polevl512_pd(xx, Q);
+
+    x = _mm512_div_pd(p, _mm512_sub_pd(q, p));
+    x = _mm512_add_pd(_mm512_set1_pd(1.0), _mm512_add_pd(x, x));
+
+    return _mm512_scalef_pd(x, px);
+}
+
+/*!
+ * \brief AVX-512-Vectorized exponential in single-precision
+ *
+ * The maximum error is 1 ULP. Contrary to the SSE and AVX versions,
+ * the denormal results are computed.
+ *
+ * \param x The vector of numbers to compute the exponential from
+ * \return a vector containing the exponential of the input vector values
+ */
+ETL_INLINE_VEC_512 exp512_ps(__m512 x) {
+    static constexpr float P[] = {1.9875691500E-4f, 1.3981999507E-3f, 8.3334519073E-3f, 4.1665795894E-2f, 1.6666665459E-1f, 5.0000001201E-1f};
+
+    // The constant is the first operand so that NaN are propagated
+    x = _mm512_min_ps(_mm512_set1_ps(89.0f), x);
+    x = _mm512_max_ps(_mm512_set1_ps(-104.0f), x);
+
+    // Express e^x = e^g 2^n = e^g e^(n log(2)) = e^(g + n log(2))
+    auto fx = _mm512_roundscale_ps(_mm512_mul_ps(x, _mm512_set1_ps(1.44269504088896341f)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+
+    x = _mm512_fnmadd_ps(fx, _mm512_set1_ps(0.693359375f), x);
+    x = _mm512_fnmadd_ps(fx, _mm512_set1_ps(-2.12194440e-4f), x);
+
+    // e^g = 1 + g + g^2 * P(g)
+    auto z = _mm512_mul_ps(x, x);
+    auto y = _mm512_fmadd_ps(detail::polevl512_ps(x, P), z, x);
+    y      = _mm512_add_ps(y, _mm512_set1_ps(1.0f));
+
+    return _mm512_scalef_ps(y, fx);
+}
+
+/*!
+ * \brief AVX-512-Vectorized logarithm in double-precision
+ *
+ * The maximum error is 1 ULP.
+ *
+ * \param x The vector of numbers to compute the logarithm from
+ * \return a vector containing the logarithm of the input vector values
+ */
+ETL_INLINE_VEC_512D log512_pd(__m512d x) {
+    static constexpr double P[] = {1.01875663804580931796E-4, 4.97494994976747001425E-1, 4.70579119878881725854E0,
+                                   1.44989225341610930846E1, 1.79368678507819816313E1, 7.70838733755885391666E0};
+    static constexpr double Q[] = {1.0, 1.12873587189167450590E1, 4.52279145837532221105E1, 8.29875266912776603211E1,
+                                   7.11544750618563894466E1, 2.31251620126765340583E1};
+
+    // Decompose x into m * 2^e with m in [sqrt(0.5), sqrt(2)[
+    auto e = _mm512_getexp_pd(x);
+    auto m = _mm512_getmant_pd(x, _MM_MANT_NORM_1_2, _MM_MANT_SIGN_zero);
+
+    auto large = _mm512_cmp_pd_mask(m, _mm512_set1_pd(1.41421356237309504880), _CMP_GE_OQ);
+    e          = _mm512_mask_add_pd(e, large, e, _mm512_set1_pd(1.0));
+    m          = _mm512_mask_mul_pd(m, large, m, _mm512_set1_pd(0.5));
+    m          = _mm512_sub_pd(m, _mm512_set1_pd(1.0));
+
+    // log(1 + m) = m - m^2 / 2 + m^3 * P(m) / Q(m)
+    auto z = _mm512_mul_pd(m, m);
+    auto y = _mm512_mul_pd(_mm512_mul_pd(m, z), _mm512_div_pd(detail::polevl512_pd(m, P), detail::polevl512_pd(m, Q)));
+
+    y = _mm512_fnmadd_pd(e, _mm512_set1_pd(2.121944400546905827679e-4), y);
+    y = _mm512_fnmadd_pd(z, _mm512_set1_pd(0.5), y);
+
+    auto r = _mm512_fmadd_pd(e, _mm512_set1_pd(0.693359375), _mm512_add_pd(m, y));
+
+    // Handle the special values
+    r = _mm512_mask_blend_pd(_mm512_cmp_pd_mask(x, _mm512_set1_pd(std::numeric_limits<double>::infinity()), _CMP_EQ_OQ), r, x);
+    r = _mm512_mask_blend_pd(_mm512_cmp_pd_mask(x, _mm512_setzero_pd(), _CMP_EQ_OQ), r, _mm512_set1_pd(-std::numeric_limits<double>::infinity()));
+    r = _mm512_mask_blend_pd(_mm512_cmp_pd_mask(x, _mm512_setzero_pd(), _CMP_NGE_UQ), r, _mm512_set1_pd(std::numeric_limits<double>::quiet_NaN()));
+
+    return r;
+}
+
+/*!
+ * \brief AVX-512-Vectorized logarithm in single-precision
+ *
+ * The maximum error is 1 ULP.
+ *
+ * \param x The vector of numbers to compute the logarithm from
+ * \return a vector containing the logarithm of the input vector values
+ */
+ETL_INLINE_VEC_512 log512_ps(__m512 x) {
+    static constexpr float P[] = {7.0376836292E-2f, -1.1514610310E-1f, 1.1676998740E-1f, -1.2420140846E-1f, 1.4249322787E-1f,
+                                  -1.6668057665E-1f, 2.0000714765E-1f, -2.4999993993E-1f, 3.3333331174E-1f};
+
+    // Decompose x into m * 2^e with m in [sqrt(0.5), sqrt(2)[
+    auto e = _mm512_getexp_ps(x);
+    auto m = _mm512_getmant_ps(x, _MM_MANT_NORM_1_2, _MM_MANT_SIGN_zero);
+
+    auto large = _mm512_cmp_ps_mask(m, _mm512_set1_ps(1.41421356237309504880f), _CMP_GE_OQ);
+    e          = _mm512_mask_add_ps(e, large, e, _mm512_set1_ps(1.0f));
+    m          = _mm512_mask_mul_ps(m, large, m, _mm512_set1_ps(0.5f));
+    m          = _mm512_sub_ps(m, _mm512_set1_ps(1.0f));
+
+    // log(1 + m) = m - m^2 / 2 + m^3 * P(m)
+    auto z = _mm512_mul_ps(m, m);
+    auto y = _mm512_mul_ps(_mm512_mul_ps(m, z), detail::polevl512_ps(m, P));
+
+    y = _mm512_fnmadd_ps(e, _mm512_set1_ps(2.12194440e-4f), y);
+    y = _mm512_fnmadd_ps(z, _mm512_set1_ps(0.5f), y);
+
+    auto r = _mm512_fmadd_ps(e, _mm512_set1_ps(0.693359375f), _mm512_add_ps(m, y));
+
+    // Handle the special values
+    r = _mm512_mask_blend_ps(_mm512_cmp_ps_mask(x, _mm512_set1_ps(std::numeric_limits<float>::infinity()), _CMP_EQ_OQ), r, x);
+    r = _mm512_mask_blend_ps(_mm512_cmp_ps_mask(x, _mm512_setzero_ps(), _CMP_EQ_OQ), r, _mm512_set1_ps(-std::numeric_limits<float>::infinity()));
+    r = _mm512_mask_blend_ps(_mm512_cmp_ps_mask(x, _mm512_setzero_ps(), _CMP_NGE_UQ), r, _mm512_set1_ps(std::numeric_limits<float>::quiet_NaN()));
+
+    return r;
+}
+
+/*!
+ * \brief AVX-512-Vectorized log(1 + x) in double-precision, for x > -1
+ *
+ * The maximum error is 2 ULP.
+ *
+ * \param x The vector of numbers to compute log(1 + x) from
+ * \return a vector containing log(1 + x) of the input vector values
+ */
+ETL_INLINE_VEC_512D log1p512_pd(__m512d x) {
+    const auto one = _mm512_set1_pd(1.0);
+
+    // log(1 + x) = log(u) * x / (u - 1) cancels the rounding error of 1 + x
+    auto u = _mm512_add_pd(one, x);
+    auto d = _mm512_sub_pd(u, one);
+    auto r = _mm512_mul_pd(log512_pd(u), _mm512_div_pd(x, d));
+
+    return _mm512_mask_blend_pd(_mm512_cmp_pd_mask(d, _mm512_setzero_pd(), _CMP_EQ_OQ), r, x);
+}
+
+/*!
+ * \brief AVX-512-Vectorized log(1 + x) in single-precision, for x > -1
+ *
+ * The maximum error is 2 ULP.
+ *
+ * \param x The vector of numbers to compute log(1 + x) from
+ * \return a vector containing log(1 + x) of the input vector values
+ */
+ETL_INLINE_VEC_512 log1p512_ps(__m512 x) {
+    const auto one = _mm512_set1_ps(1.0f);
+
+    // log(1 + x) = log(u) * x / (u - 1) cancels the rounding error of 1 + x
+    auto u = _mm512_add_ps(one, x);
+    auto d = _mm512_sub_ps(u, one);
+    auto r = _mm512_mul_ps(log512_ps(u), _mm512_div_ps(x, d));
+
+    return _mm512_mask_blend_ps(_mm512_cmp_ps_mask(d, _mm512_setzero_ps(), _CMP_EQ_OQ), r, x);
+}
+
+/*!
+ * \brief AVX-512-Vectorized hyperbolic tangent in double-precision
+ *
+ * The maximum error is 2 ULP.
+ *
+ * \param x The vector of numbers to compute the hyperbolic tangent from
+ * \return a vector containing the hyperbolic tangent of the input vector values
+ */
+ETL_INLINE_VEC_512D tanh512_pd(__m512d x) {
+    static constexpr double P[] = {-9.64399179425052238628E-1, -9.92877231001918586564E1, -1.61468768441708447952E3};
+    static constexpr double Q[] = {1.0, 1.12811678491632931402E2, 2.23548839060100448583E3, 4.84406305325125486048E3};
+
+    auto ax = _mm512_abs_pd(x);
+
+    // Small values: x + x^3 * P(x^2) / Q(x^2)
+    auto z     = _mm512_mul_pd(x, x);
+    auto small = _mm512_fmadd_pd(_mm512_mul_pd(x, z), _mm512_div_pd(detail::polevl512_pd(z, P), detail::polevl512_pd(z, Q)), x);
+
+    // Large values: 1 - 2 / (exp(2x) + 1)
+    auto e     = exp512_pd(_mm512_min_pd(_mm512_set1_pd(80.0), _mm512_add_pd(ax, ax)));
+    auto large = _mm512_sub_pd(_mm512_set1_pd(1.0), _mm512_div_pd(_mm512_set1_pd(2.0), _mm512_add_pd(e, _mm512_set1_pd(1.0))));
+
+    return _mm512_mask_blend_pd(_mm512_cmp_pd_mask(ax, _mm512_set1_pd(0.625), _CMP_LT_OQ), detail::copysign512_pd(large, x), small);
+}
+
+/*!
+ * \brief AVX-512-Vectorized hyperbolic tangent in single-precision
+ *
+ * The maximum error is 1 ULP.
+ *
+ * \param x The vector of numbers to compute the hyperbolic tangent from
+ * \return a vector containing the hyperbolic tangent of the input vector values
+ */
+ETL_INLINE_VEC_512 tanh512_ps(__m512 x) {
+    static constexpr float P[] = {-5.70498872745E-3f, 2.06390887954E-2f, -5.37397155531E-2f, 1.33314422036E-1f, -3.33332819422E-1f};
+
+    auto ax = _mm512_abs_ps(x);
+
+    // Small values: x + x^3 * P(x^2)
+    auto z     = _mm512_mul_ps(x, x);
+    auto small = _mm512_fmadd_ps(_mm512_mul_ps(x, z), detail::polevl512_ps(z, P), x);
+
+    // Large values: 1 - 2 / (exp(2x) + 1)
+    auto e     = exp512_ps(_mm512_min_ps(_mm512_set1_ps(40.0f), _mm512_add_ps(ax, ax)));
+    auto large = _mm512_sub_ps(_mm512_set1_ps(1.0f), _mm512_div_ps(_mm512_set1_ps(2.0f), _mm512_add_ps(e, _mm512_set1_ps(1.0f))));
+
+    return _mm512_mask_blend_ps(_mm512_cmp_ps_mask(ax, _mm512_set1_ps(0.625f), _CMP_LT_OQ), detail::copysign512_ps(large, x), small);
+}
+
+/*!
+ * \brief AVX-512-Vectorized hyperbolic sinus in double-precision
+ *
+ * The maximum error is 4 ULP.
+ *
+ * \param x The vector of numbers to compute the hyperbolic sinus from
+ * \return a vector containing the hyperbolic sinus of the input vector values
+ */
+ETL_INLINE_VEC_512D sinh512_pd(__m512d x) {
+    static constexpr double P[] = {-7.89474443963537015605E-1, -1.63725857525983828727E2, -1.15614435765005216044E4, -3.51754964808151394800E5};
+    static constexpr double Q[] = {1.0, -2.77711081420602794433E2, 3.61578279834431989373E4, -2.11052978884890840399E6};
+
+    auto ax = _mm512_abs_pd(x);
+
+    // Small values: x + x^3 * P(x^2) / Q(x^2)
+    auto z     = _mm512_mul_pd(x, x);
+    auto small = _mm512_fmadd_pd(_mm512_mul_pd(x, z), _mm512_div_pd(detail::polevl512_pd(z, P), detail::polevl512_pd(z, Q)), x);
+
+    // Large values: (e^x - e^-x) / 2, computed in two halves to avoid the premature overflow
+    auto h     = exp512_pd(_mm512_mul_pd(ax, _mm512_set1_pd(0.5)));
+    auto large = _mm512_sub_pd(_mm512_mul_pd(_mm512_mul_pd(h, _mm512_set1_pd(0.5)), h), _mm512_div_pd(_mm512_div_pd(_mm512_set1_pd(0.5), h), h));
+
+    return _mm512_mask_blend_pd(_mm512_cmp_pd_mask(ax, _mm512_set1_pd(1.0), _CMP_LE_OQ), detail::copysign512_pd(large, x), small);
+}
+
+/*!
+ * \brief AVX-512-Vectorized hyperbolic sinus in single-precision
+ *
+ * The maximum error is 4 ULP.
+ *
+ * \param x The vector of numbers to compute the hyperbolic sinus from
+ * \return a vector containing the hyperbolic sinus of the input vector values
+ */
+ETL_INLINE_VEC_512 sinh512_ps(__m512 x) {
+    static constexpr float P[] = {2.03721912945E-4f, 8.33028376239E-3f, 1.66667160211E-1f};
+
+    auto ax = _mm512_abs_ps(x);
+
+    // Small values: x + x^3 * P(x^2)
+    auto z     = _mm512_mul_ps(x, x);
+    auto small = _mm512_fmadd_ps(_mm512_mul_ps(x, z), detail::polevl512_ps(z, P), x);
+
+    // Large values: (e^x - e^-x) / 2, computed in two halves to avoid the premature overflow
+    auto h     = exp512_ps(_mm512_mul_ps(ax, _mm512_set1_ps(0.5f)));
+    auto large = _mm512_sub_ps(_mm512_mul_ps(_mm512_mul_ps(h, _mm512_set1_ps(0.5f)), h), _mm512_div_ps(_mm512_div_ps(_mm512_set1_ps(0.5f), h), h));
+
+    return _mm512_mask_blend_ps(_mm512_cmp_ps_mask(ax, _mm512_set1_ps(1.0f), _CMP_LE_OQ), detail::copysign512_ps(large, x), small);
+}
+
+/*!
+ * \brief AVX-512-Vectorized hyperbolic cosinus in double-precision
+ *
+ * The maximum error is 4 ULP.
+ *
+ * \param x The vector of numbers to compute the hyperbolic cosinus from
+ * \return a vector containing the hyperbolic cosinus of the input vector values
+ */
+ETL_INLINE_VEC_512D cosh512_pd(__m512d x) {
+    // (e^x + e^-x) / 2, computed in two halves to avoid the premature overflow
+    auto h = exp512_pd(_mm512_mul_pd(_mm512_abs_pd(x), _mm512_set1_pd(0.5)));
+    return _mm512_add_pd(_mm512_mul_pd(_mm512_mul_pd(h, _mm512_set1_pd(0.5)), h), _mm512_div_pd(_mm512_div_pd(_mm512_set1_pd(0.5), h), h));
+}
+
+/*!
+ * \brief AVX-512-Vectorized hyperbolic cosinus in single-precision
+ *
+ * The maximum error is 3 ULP.
+ *
+ * \param x The vector of numbers to compute the hyperbolic cosinus from
+ * \return a vector containing the hyperbolic cosinus of the input vector values
+ */
+ETL_INLINE_VEC_512 cosh512_ps(__m512 x) {
+    // (e^x + e^-x) / 2, computed in two halves to avoid the premature overflow
+    auto h = exp512_ps(_mm512_mul_ps(_mm512_abs_ps(x), _mm512_set1_ps(0.5f)));
+    return _mm512_add_ps(_mm512_mul_ps(_mm512_mul_ps(h, _mm512_set1_ps(0.5f)), h), _mm512_div_ps(_mm512_div_ps(_mm512_set1_ps(0.5f), h), h));
+}
+
+namespace detail {
+
+/*!
+ * \brief Evaluate the core of the Cephes double-precision sin/cos
+ *
+ * \param x The absolute values of the input
+ * \param y The even octant of x
+ * \param cos_mask The mask of the elements for which the cosinus polynomial must be used
+ *
+ * \return The polynomial approximation of the reduced sinus or cosinus
+ */
+ETL_INLINE_VEC_512D sincos_poly512_pd(__m512d x, __m512d y, __mmask8 cos_mask) {
+    static constexpr double sincof[] = {1.58962301576546568060E-10, -2.50507477628578072866E-8, 2.75573136213857245213E-6,
+                                        -1.98412698295895385996E-4, 8.33333333332211858878E-3, -1.66666666666666307295E-1};
+    static constexpr double coscof[] = {-1.13585365213876817300E-11, 2.08757008419747316778E-9, -2.75573141792967388112E-7,
+                                        2.48015872888517045348E-5, -1.38888888888730564116E-3, 4.16666666666665929218E-2};
+
+    // Extended precision modular arithmetic
+    x = _mm512_fnmadd_pd(y, _mm512_set1_pd(7.85398125648498535156E-1), x);
+    x = _mm512_fnmadd_pd(y, _mm512_set1_pd(3.77489470793079817668E-8), x);
+    x = _mm512_fnmadd_pd(y, _mm512_set1_pd(2.69515142907905952645E-15), x);
+
+    auto z = _mm512_mul_pd(x, x);
+
+    // cos(x) = 1 - z / 2 + z^2 * P(z)
+    auto c = _mm512_fmadd_pd(_mm512_mul_pd(z, z), polevl512_pd(z, coscof), _mm512_fnmadd_pd(z, _mm512_set1_pd(0.5), _mm512_set1_pd(1.0)));
+
+    // sin(x) = x + x * z * P(z)
+    auto s = _mm512_fmadd_pd(_mm512_mul_pd(x, z), polevl512_pd(z, sincof), x);
+
+    return _mm512_mask_blend_pd(cos_mask, s, c);
+}
+
+/*!
+ * \copydoc sincos_poly512_pd
+ */
+ETL_INLINE_VEC_512 sincos_poly512_ps(__m512 x, __m512 y, __mmask16 cos_mask) {
+    static constexpr float sincof[] = {-1.9515295891E-4f, 8.3321608736E-3f, -1.6666654611E-1f};
+    static constexpr float coscof[] = {2.443315711809948E-005f, -1.388731625493765E-003f, 4.166664568298827E-002f};
+
+    // Extended precision modular arithmetic
+    x = _mm512_fnmadd_ps(y, _mm512_set1_ps(0.78515625f), x);
+    x = _mm512_fnmadd_ps(y, _mm512_set1_ps(2.4187564849853515625e-4f), x);
+    x = _mm512_fnmadd_ps(y, _mm512_set1_ps(3.77489497744594108e-8f), x);
+
+    auto z = _mm512_mul_ps(x, x);
+
+    // cos(x) = 1 - z / 2 + z^2 * P(z)
+    auto c = _mm512_fmadd_ps(_mm512_mul_ps(z, z), polevl512_ps(z, coscof), _mm512_fnmadd_ps(z, _mm512_set1_ps(0.5f), _mm512_set1_ps(1.0f)));
+
+    // sin(x) = x + x * z * P(z)
+    auto s = _mm512_fmadd_ps(_mm512_mul_ps(x, z), polevl512_ps(z, sincof), x);
+
+    return _mm512_mask_blend_ps(cos_mask, s, c);
+}
+
+/*!
+ * \brief Compute the even octant of each element of the vector
+ * \param x The absolute values of the input
+ * \param j The octant modulo 8
+ * \return the even octant
+ */
+ETL_INLINE_VEC_512D octant512_pd(__m512d x, __m512d& j) {
+    static constexpr int floor = _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC;
+
+    auto y = _mm512_roundscale_pd(_mm512_mul_pd(x, _mm512_set1_pd(1.27323954473516268615)), floor);
+    y      = _mm512_add_pd(y, _mm512_fnmadd_pd(_mm512_set1_pd(2.0), _mm512_roundscale_pd(_mm512_mul_pd(y, _mm512_set1_pd(0.5)), floor), y));
+
+    j = _mm512_fnmadd_pd(_mm512_set1_pd(8.0), _mm512_roundscale_pd(_mm512_mul_pd(y, _mm512_set1_pd(0.125)), floor), y);
+
+    return y;
+}
+
+/*!
+ * \brief Compute the even octant of each element of the vector
+ * \param x The absolute values of the input
+ * \return the even octant, as integers
+ */
+ETL_STATIC_INLINE(__m512i) octant512_ps(__m512 x) {
+    auto j = _mm512_cvttps_epi32(_mm512_mul_ps(x, _mm512_set1_ps(1.27323954473516f)));
+    return _mm512_and_epi32(_mm512_add_epi32(j, _mm512_set1_epi32(1)), _mm512_set1_epi32(~1));
+}
+
+} //end of namespace detail
+
+/*!
+ * \brief AVX-512-Vectorized sinus in double-precision
+ *
+ * The maximum error is 2 ULP for |x| < 2^30. The precision degrades
+ * for larger values.
+ *
+ * \param x The vector of numbers to compute the sinus from
+ * \return a vector containing the sinus of the input vector values
+ */
+ETL_INLINE_VEC_512D sin512_pd(__m512d x) {
+    const auto sign_bit = _mm512_set1_epi64(0x8000000000000000LL);
+
+    auto sign = _mm512_and_epi64(_mm512_castpd_si512(x), sign_bit);
+    x         = _mm512_abs_pd(x);
+
+    __m512d j;
+    auto y = detail::octant512_pd(x, j);
+
+    // Reflect in x axis
+    auto upper = _mm512_cmp_pd_mask(j, _mm512_set1_pd(4.0), _CMP_GE_OQ);
+    sign       = _mm512_mask_xor_epi64(sign, upper, sign, sign_bit);
+    j          = _mm512_mask_sub_pd(j, upper, j, _mm512_set1_pd(4.0));
+
+    auto r = detail::sincos_poly512_pd(x, y, _mm512_cmp_pd_mask(j, _mm512_set1_pd(2.0), _CMP_EQ_OQ));
+
+    return _mm512_castsi512_pd(_mm512_xor_epi64(_mm512_castpd_si512(r), sign));
+}
+
+/*!
+ * \brief AVX-512-Vectorized sinus in single-precision
+ *
+ * The maximum error is 2 ULP for |x| < 16 and 5 ULP for |x| < 100. The
+ * precision degrades for larger values.
+ *
+ * \param x The vector of numbers to compute the sinus from
+ * \return a vector containing the sinus of the input vector values
+ */
+ETL_INLINE_VEC_512 sin512_ps(__m512 x) {
+    auto sign = _mm512_and_epi32(_mm512_castps_si512(x), _mm512_set1_epi32(0x80000000));
+    x         = _mm512_abs_ps(x);
+
+    auto j = detail::octant512_ps(x);
+
+    // Reflect in x axis
+    sign = _mm512_xor_epi32(sign, _mm512_slli_epi32(_mm512_and_epi32(j, _mm512_set1_epi32(4)), 29));
+
+    auto r = detail::sincos_poly512_ps(x, _mm512_cvtepi32_ps(j), _mm512_test_epi32_mask(j, _mm512_set1_epi32(2)));
+
+    return _mm512_castsi512_ps(_mm512_xor_epi32(_mm512_castps_si512(r), sign));
+}
+
+/*!
+ * \brief AVX-512-Vectorized cosinus in double-precision
+ *
+ * The maximum error is 2 ULP for |x| < 2^30. The precision degrades
+ * for larger values.
+ *
+ * \param x The vector of numbers to compute the cosinus from
+ * \return a vector containing the cosinus of the input vector values
+ */
+ETL_INLINE_VEC_512D cos512_pd(__m512d x) {
+    const auto sign_bit = _mm512_set1_epi64(0x8000000000000000LL);
+
+    x = _mm512_abs_pd(x);
+
+    __m512d j;
+    auto y = detail::octant512_pd(x, j);
+
+    auto upper = _mm512_cmp_pd_mask(j, _mm512_set1_pd(4.0), _CMP_GE_OQ);
+    j          = _mm512_mask_sub_pd(j, upper, j, _mm512_set1_pd(4.0));
+
+    auto sin_octant = _mm512_cmp_pd_mask(j, _mm512_set1_pd(2.0), _CMP_EQ_OQ);
+    auto sign       = _mm512_maskz_mov_epi64(upper ^ sin_octant, sign_bit);
+
+    auto r = detail::sincos_poly512_pd(x, y, __mmask8(~sin_octant));
+
+    return _mm512_castsi512_pd(_mm512_xor_epi64(_mm512_castpd_si512(r), sign));
+}
+
+/*!
+ * \brief AVX-512-Vectorized cosinus in single-precision
+ *
+ * The maximum error is 2 ULP for |x| < 16 and 5 ULP for |x| < 100. The
+ * precision degrades for larger values.
+ *
+ * \param x The vector of numbers to compute the cosinus from
+ * \return a vector containing the cosinus of the input vector values
+ */
+ETL_INLINE_VEC_512 cos512_ps(__m512 x) {
+    x = _mm512_abs_ps(x);
+
+    auto j = detail::octant512_ps(x);
+    auto y = _mm512_cvtepi32_ps(j);
+
+    // cos(x) = sin(x + Pi / 2)
+    j = _mm512_sub_epi32(j, _mm512_set1_epi32(2));
+
+    auto sign = _mm512_slli_epi32(_mm512_andnot_epi32(j, _mm512_set1_epi32(4)), 29);
+
+    auto r = detail::sincos_poly512_ps(x, y, _mm512_test_epi32_mask(j, _mm512_set1_epi32(2)));
+
+    return _mm512_castsi512_ps(_mm512_xor_epi32(_mm512_castps_si512(r), sign));
+}
+
+} //end of namespace etl
+
+#endif //__AVX512F__
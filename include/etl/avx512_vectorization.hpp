@@ -19,6 +19,7 @@
 #include <immintrin.h>
 
 #include "etl/inline.hpp"
+#include "etl/avx512_exp.hpp"
 
 #ifdef VECT_DEBUG
 #include <iostream>
@@ -27,7 +28,7 @@
 #define ETL_INLINE_VEC_VOID ETL_STATIC_INLINE(void)
 #define ETL_INLINE_VEC_512 ETL_STATIC_INLINE(__m512)
 #define ETL_INLINE_VEC_512D ETL_STATIC_INLINE(__m512d)
-#define ETL_OUT_VEC_2512ETL_OUT_INLINE(__m512)
+#define ETL_OUT_VEC_512 ETL_OUT_INLINE(__m512)
 #define ETL_OUT_VEC_512D ETL_OUT_INLINE(__m512d)
 
 namespace etl {
@@ -500,74 +501,76 @@ struct avx512_vec {
      * \brief Multiply the two given vectors
      */
     template <bool Complex = false>
-    ETL_INLINE_VEC_512 mul(__m512 lhs, __m512 rhs) {
+    ETL_TMP_INLINE(__m512) mul(__m512 lhs, __m512 rhs) {
         return _mm512_mul_ps(lhs, rhs);
     }
 
-    /*!
-     * \brief Multiply the two given vectors
-     */
-    template <>
-    ETL_INLINE_VEC_512 mul<true>(__m512 lhs, __m512 rhs) {
-        cpp_unreachable("Not yet implemented");
-        return lhs;
-    }
-
     /*!
      * \brief Multiply the two given complex vectors
      */
     template <bool Complex = false>
-    ETL_INLINE_VEC_512D mul(__m512d lhs, __m512d rhs) {
+    ETL_TMP_INLINE(__m512d) mul(__m512d lhs, __m512d rhs) {
         return _mm512_mul_pd(lhs, rhs);
     }
 
     /*!
-     * \brief Multiply the two given complex vectors
+     * \brief Divide the two given vectors
      */
-    template <>
-    ETL_INLINE_VEC_512D mul<true>(__m512d lhs, __m512d rhs) {
-        cpp_unreachable("Not yet implemented");
-        return lhs;
+    template <bool Complex = false>
+    ETL_TMP_INLINE(__m512) div(__m512 lhs, __m512 rhs) {
+        return _mm512_div_ps(lhs, rhs);
     }
 
     /*!
      * \brief Divide the two given vectors
      */
     template <bool Complex = false>
-    ETL_INLINE_VEC_512 div(__m512 lhs, __m512 rhs) {
-        return _mm512_div_ps(lhs, rhs);
+    ETL_TMP_INLINE(__m512d) div(__m512d lhs, __m512d rhs) {
+        return _mm512_div_pd(lhs, rhs);
     }
 
     /*!
-     * \brief Divide the two given vectors
+     * \brief Fused-Multiply Add of the three given vectors
      */
-    template <>
-    ETL_INLINE_VEC_512 div<true>(__m512 lhs, __m512 rhs) {
-        cpp_unreachable("Not yet implemented");
-        return lhs;
+    ETL_INLINE_VEC_512 fmadd(__m512 a, __m512 b, __m512 c) {
+        return _mm512_fmadd_ps(a, b, c);
     }
 
     /*!
-     * \brief Divide the two given vectors
+     * \brief Fused-Multiply Add of the three given vectors
      */
-    template <bool Complex = false>
-    ETL_INLINE_VEC_512D div(__m512d lhs, __m512d rhs) {
-        return _mm512_div_pd(lhs, rhs);
+    ETL_INLINE_VEC_512D fmadd(__m512d a, __m512d b, __m512d c) {
+        return _mm512_fmadd_pd(a, b, c);
     }
 
     /*!
-     * \brief Divide the two given vectors
+     * \brief Perform an horizontal sum of the given vector.
+     * \param in The input vector type
+     * \return the horizontal sum of the vector
      */
-    template <>
-    ETL_INLINE_VEC_512D div<true>(__m512d lhs, __m512d rhs) {
-        cpp_unreachable("Not yet implemented");
-        return lhs;
+    ETL_STATIC_INLINE(float) hadd(__m512 in) {
+        return _mm512_reduce_add_ps(in);
     }
 
-#ifdef __INTEL_COMPILER
+    /*!
+     * \brief Perform an horizontal sum of the given vector.
+     * \param in The input vector type
+     * \return the horizontal sum of the vector
+     */
+    ETL_STATIC_INLINE(double) hadd(__m512d in) {
+        return _mm512_reduce_add_pd(in);
+    }
+
+    /*!
+     * \brief Return a packed vector of zeroes of the given type
+     */
+    template <typename T>
+    ETL_TMP_INLINE(typename avx512_intrinsic_traits<T>::intrinsic_type) zero();
 
     //Exponential
 
+#ifdef __INTEL_COMPILER
+
     /*!
      * \brief Compute the exponentials of each element of the given vector
      */
@@ -582,8 +585,28 @@ struct avx512_vec {
         return _mm512_exp_ps(x);
     }
 
+#else
+
+    /*!
+     * \brief Compute the exponentials of each element of the given vector
+     */
+    ETL_INLINE_VEC_512D exp(__m512d x) {
+        return etl::exp512_pd(x);
+    }
+
+    /*!
+     * \brief Compute the exponentials of each element of the given vector
+     */
+    ETL_INLINE_VEC_512 exp(__m512 x) {
+        return etl::exp512_ps(x);
+    }
+
+#endif
+
     //Logarithm
 
+#ifdef __INTEL_COMPILER
+
     /*!
      * \brief Compute the logarithm of each element of the given vector
      */
@@ -598,6 +621,303 @@ struct avx512_vec {
         return _mm512_log_ps(x);
     }
 
+#else
+
+    /*!
+     * \brief Compute the logarithm of each element of the given vector
+     */
+    ETL_INLINE_VEC_512D log(__m512d x) {
+        return etl::log512_pd(x);
+    }
+
+    /*!
+     * \brief Compute the logarithm of each element of the given vector
+     */
+    ETL_INLINE_VEC_512 log(__m512 x) {
+        return etl::log512_ps(x);
+    }
+
+#endif
+
+    // log(1 + x)
+
+    /*!
+     * \brief Compute log(1 + x) of each element of the given vector
+     */
+    ETL_INLINE_VEC_512D log1p(__m512d x) {
+        return etl::log1p512_pd(x);
+    }
+
+    /*!
+     * \brief Compute log(1 + x) of each element of the given vector
+     */
+    ETL_INLINE_VEC_512 log1p(__m512 x) {
+        return etl::log1p512_ps(x);
+    }
+
+    // Trigonometric functions
+
+    /*!
+     * \brief Compute the sinus of each element of the given vector
+     */
+    ETL_INLINE_VEC_512D sin(__m512d x) {
+        return etl::sin512_pd(x);
+    }
+
+    /*!
+     * \brief Compute the sinus of each element of the given vector
+     */
+    ETL_INLINE_VEC_512 sin(__m512 x) {
+        return etl::sin512_ps(x);
+    }
+
+    /*!
+     * \brief Compute the cosinus of each element of the given vector
+     */
+    ETL_INLINE_VEC_512D cos(__m512d x) {
+        return etl::cos512_pd(x);
+    }
+
+    /*!
+     * \brief Compute the cosinus of each element of the given vector
+     */
+    ETL_INLINE_VEC_512 cos(__m512 x) {
+        return etl::cos512_ps(x);
+    }
+
+    // Hyperbolic functions
+
+    /*!
+     * \brief Compute the hyperbolic tangent of each element of the given vector
+     */
+    ETL_INLINE_VEC_512D tanh(__m512d x) {
+        return etl::tanh512_pd(x);
+    }
+
+    /*!
+     * \brief Compute the hyperbolic tangent of each element of the given vector
+     */
+    ETL_INLINE_VEC_512 tanh(__m512 x) {
+        return etl::tanh512_ps(x);
+    }
+
+    /*!
+     * \brief Compute the hyperbolic sinus of each element of the given vector
+     */
+    ETL_INLINE_VEC_512D sinh(__m512d x) {
+        return etl::sinh512_pd(x);
+    }
+
+    /*!
+     * \brief Compute the hyperbolic sinus of each element of the given vector
+     */
+    ETL_INLINE_VEC_512 sinh(__m512 x) {
+        return etl::sinh512_ps(x);
+    }
+
+    /*!
+     * \brief Compute the hyperbolic cosinus of each element of the given vector
+     */
+    ETL_INLINE_VEC_512D cosh(__m512d x) {
+        return etl::cosh512_pd(x);
+    }
+
+    /*!
+     * \brief Compute the hyperbolic cosinus of each element of the given vector
+     */
+    ETL_INLINE_VEC_512 cosh(__m512 x) {
+        return etl::cosh512_ps(x);
+    }
+
+    //Rounding
+
+    /*!
+     * \brief Round up each values of the vector and return them
+     */
+    ETL_INLINE_VEC_512 round_up(__m512 x) {
+        return _mm512_roundscale_ps(x, (_MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC));
+    }
+
+    /*!
+     * \brief Round up each values of the vector and return them
+     */
+    ETL_INLINE_VEC_512D round_up(__m512d x) {
+        return _mm512_roundscale_pd(x, (_MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC));
+    }
+
+    /*!
+     * \brief Round down each values of the vector and return them
+     */
+    ETL_INLINE_VEC_512 round_down(__m512 x) {
+        return _mm512_roundscale_ps(x, (_MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC));
+    }
+
+    /*!
+     * \brief Round down each values of the vector and return them
+     */
+    ETL_INLINE_VEC_512D round_down(__m512d x) {
+        return _mm512_roundscale_pd(x, (_MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC));
+    }
+
+    // Comparisons
+    //
+    // The comparisons return the native AVX-512 bit masks, one bit
+    // per lane.
+
+    /*!
+     * \brief Compare each element of the two vectors for equality
+     */
+    ETL_STATIC_INLINE(__mmask16) equal(__m512 lhs, __m512 rhs) {
+        return _mm512_cmp_ps_mask(lhs, rhs, _CMP_EQ_OQ);
+    }
+
+    /*!
+     * \brief Compare each element of the two vectors for equality
+     */
+    ETL_STATIC_INLINE(__mmask8) equal(__m512d lhs, __m512d rhs) {
+        return _mm512_cmp_pd_mask(lhs, rhs, _CMP_EQ_OQ);
+    }
+
+    /*!
+     * \brief Compare each element of the two vectors for inequality
+     */
+    ETL_STATIC_INLINE(__mmask16) not_equal(__m512 lhs, __m512 rhs) {
+        return _mm512_cmp_ps_mask(lhs, rhs, _CMP_NEQ_UQ);
+    }
+
+    /*!
+     * \brief Compare each element of the two vectors for inequality
+     */
+    ETL_STATIC_INLINE(__mmask8) not_equal(__m512d lhs, __m512d rhs) {
+        return _mm512_cmp_pd_mask(lhs, rhs, _CMP_NEQ_UQ);
+    }
+
+    /*!
+     * \brief Test if each element of lhs is less than the element of rhs
+     */
+    ETL_STATIC_INLINE(__mmask16) less(__m512 lhs, __m512 rhs) {
+        return _mm512_cmp_ps_mask(lhs, rhs, _CMP_LT_OQ);
+    }
+
+    /*!
+     * \brief Test if each element of lhs is less than the element of rhs
+     */
+    ETL_STATIC_INLINE(__mmask8) less(__m512d lhs, __m512d rhs) {
+        return _mm512_cmp_pd_mask(lhs, rhs, _CMP_LT_OQ);
+    }
+
+    /*!
+     * \brief Test if each element of lhs is less than or equal to the element of rhs
+     */
+    ETL_STATIC_INLINE(__mmask16) less_equal(__m512 lhs, __m512 rhs) {
+        return _mm512_cmp_ps_mask(lhs, rhs, _CMP_LE_OQ);
+    }
+
+    /*!
+     * \brief Test if each element of lhs is less than or equal to the element of rhs
+     */
+    ETL_STATIC_INLINE(__mmask8) less_equal(__m512d lhs, __m512d rhs) {
+        return _mm512_cmp_pd_mask(lhs, rhs, _CMP_LE_OQ);
+    }
+
+    /*!
+     * \brief Test if each element of lhs is greater than the element of rhs
+     */
+    ETL_STATIC_INLINE(__mmask16) greater(__m512 lhs, __m512 rhs) {
+        return _mm512_cmp_ps_mask(lhs, rhs, _CMP_GT_OQ);
+    }
+
+    /*!
+     * \brief Test if each element of lhs is greater than the element of rhs
+     */
+    ETL_STATIC_INLINE(__mmask8) greater(__m512d lhs, __m512d rhs) {
+        return _mm512_cmp_pd_mask(lhs, rhs, _CMP_GT_OQ);
+    }
+
+    /*!
+     * \brief Test if each element of lhs is greater than or equal to the element of rhs
+     */
+    ETL_STATIC_INLINE(__mmask16) greater_equal(__m512 lhs, __m512 rhs) {
+        return _mm512_cmp_ps_mask(lhs, rhs, _CMP_GE_OQ);
+    }
+
+    /*!
+     * \brief Test if each element of lhs is greater than or equal to the element of rhs
+     */
+    ETL_STATIC_INLINE(__mmask8) greater_equal(__m512d lhs, __m512d rhs) {
+        return _mm512_cmp_pd_mask(lhs, rhs, _CMP_GE_OQ);
+    }
+
+    /*!
+     * \brief Compute the logical and of two masks
+     */
+    ETL_STATIC_INLINE(__mmask16) mask_and(__mmask16 lhs, __mmask16 rhs) {
+        return lhs & rhs;
+    }
+
+    /*!
+     * \brief Compute the logical and of two masks
+     */
+    ETL_STATIC_INLINE(__mmask8) mask_and(__mmask8 lhs, __mmask8 rhs) {
+        return lhs & rhs;
+    }
+
+    /*!
+     * \brief Compute the logical or of two masks
+     */
+    ETL_STATIC_INLINE(__mmask16) mask_or(__mmask16 lhs, __mmask16 rhs) {
+        return lhs | rhs;
+    }
+
+    /*!
+     * \brief Compute the logical or of two masks
+     */
+    ETL_STATIC_INLINE(__mmask8) mask_or(__mmask8 lhs, __mmask8 rhs) {
+        return lhs | rhs;
+    }
+
+    /*!
+     * \brief Compute the logical xor of two masks
+     */
+    ETL_STATIC_INLINE(__mmask16) mask_xor(__mmask16 lhs, __mmask16 rhs) {
+        return lhs ^ rhs;
+    }
+
+    /*!
+     * \brief Compute the logical xor of two masks
+     */
+    ETL_STATIC_INLINE(__mmask8) mask_xor(__mmask8 lhs, __mmask8 rhs) {
+        return lhs ^ rhs;
+    }
+
+    /*!
+     * \brief Select the elements of a where the mask is set and the elements of b elsewhere
+     */
+    ETL_INLINE_VEC_512 select(__mmask16 mask, __m512 a, __m512 b) {
+        return _mm512_mask_blend_ps(mask, b, a);
+    }
+
+    /*!
+     * \brief Select the elements of a where the mask is set and the elements of b elsewhere
+     */
+    ETL_INLINE_VEC_512D select(__mmask8 mask, __m512d a, __m512d b) {
+        return _mm512_mask_blend_pd(mask, b, a);
+    }
+
+    /*!
+     * \brief Store a mask as booleans at the given (unaligned) memory position
+     */
+    ETL_INLINE_VEC_VOID store_mask(bool* memory, __mmask16 mask) {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(memory), _mm512_cvtepi32_epi8(_mm512_maskz_set1_epi32(mask, 1)));
+    }
+
+    /*!
+     * \brief Store a mask as booleans at the given (unaligned) memory position
+     */
+    ETL_INLINE_VEC_VOID store_mask(bool* memory, __mmask8 mask) {
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(memory), _mm512_cvtepi64_epi8(_mm512_maskz_set1_epi64(mask, 1)));
+    }
+
     //Min
 
     /*!
@@ -629,8 +949,6 @@ struct avx512_vec {
     ETL_INLINE_VEC_512 max(__m512 lhs, __m512 rhs) {
         return _mm512_max_ps(lhs, rhs);
     }
-
-#endif //__INTEL_COMPILER
 };
 
 /*!
@@ -669,6 +987,22 @@ ETL_OUT_VEC_512D avx512_vec::div<true>(__m512d lhs, __m512d rhs) {
     return lhs;
 }
 
+/*!
+ * \copydoc avx512_vec::zero
+ */
+template <>
+ETL_OUT_VEC_512 avx512_vec::zero<float>() {
+    return _mm512_setzero_ps();
+}
+
+/*!
+ * \copydoc avx512_vec::zero
+ */
+template <>
+ETL_OUT_VEC_512D avx512_vec::zero<double>() {
+    return _mm512_setzero_pd();
+}
+
 } //end of namespace etl
 
 #endif //__AVX512F__
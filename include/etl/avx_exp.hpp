@@ -239,86 +239,99 @@ ETL_PS_256_CONST(cephes_exp_p3, 4.1665795894E-2);
 ETL_PS_256_CONST(cephes_exp_p4, 1.6666665459E-1);
 ETL_PS_256_CONST(cephes_exp_p5, 5.0000001201E-1);
 
+namespace detail {
+
 /*!
- * \brief AVX-Vectorized exponential in double-precision
- * \param x The vector of numbers to compute the exponential from
- * \return a vector containing the exponential of the input vector values
+ * \brief Evaluate a polynomial of degree N with Horner's scheme
+ * \param x The vector of values
+ * \param c The coefficients, starting with the highest degree
+ * \return a vector containing the values of the polynomial
  */
-ETL_INLINE_VEC_256D exp256_pd(__m256d x) {
-    auto t1 = _mm256_mul_pd(x, _mm256_set1_pd(1.44269504088896340736));
-    auto r = _mm256_round_pd(t1, 8);
+template <size_t N>
+ETL_INLINE_VEC_256D polevl256_pd(__m256d x, const double (&c)[N]) {
+    auto r = _mm256_set1_pd(c[0]);
 
+    for (size_t i = 1; i < N; ++i) {
 #ifdef __FMA__
-    x = _mm256_fnmadd_pd(r, _mm256_set1_pd(0.693145751953125), x);
-    x = _mm256_fnmadd_pd(r, _mm256_set1_pd(1.42860682030941723212E-6), x);
+        r = _mm256_fmadd_pd(r, x, _mm256_set1_pd(c[i]));
 #else
-    auto t3 = _mm256_mul_pd(r, _mm256_set1_pd(0.693145751953125));
-    x = _mm256_sub_pd(x, t3);
-    auto t4 = _mm256_mul_pd(r, _mm256_set1_pd(1.42860682030941723212E-6));
-    x = _mm256_sub_pd(x, t4);
+        r = _mm256_add_pd(_mm256_mul_pd(r, x), _mm256_set1_pd(c[i]));
 #endif
+    }
+
+    return r;
+}
 
-    auto x2 = _mm256_mul_pd(x, x);
-    auto x4 = _mm256_mul_pd(x2, x2);
-    auto x8 = _mm256_mul_pd(x4, x4);
+/*!
+ * \copydoc polevl256_pd
+ */
+template <size_t N>
+ETL_INLINE_VEC_256 polevl256_ps(__m256 x, const float (&c)[N]) {
+    auto r = _mm256_set1_ps(c[0]);
 
+    for (size_t i = 1; i < N; ++i) {
 #ifdef __FMA__
-    auto pt1 = _mm256_fmadd_pd(_mm256_set1_pd(1.0/6227020800.0), x, _mm256_set1_pd(1.0/479001600.0));
-    auto pt2 = _mm256_fmadd_pd(_mm256_set1_pd(1.0/39916800.0), x, _mm256_set1_pd(1.0/3628800.0));
-    auto pt3 = _mm256_fmadd_pd(_mm256_set1_pd(1.0/362880.0), x, _mm256_set1_pd(1.0/40320.0));
-    auto pt4 = _mm256_fmadd_pd(_mm256_set1_pd(1.0/5040.0), x, _mm256_set1_pd(1.0/720.0));
-    auto pt5 = _mm256_fmadd_pd(_mm256_set1_pd(1.0/120.0), x, _mm256_set1_pd(1.0/24.0));
-    auto pt6 = _mm256_fmadd_pd(_mm256_set1_pd(1.0/6.0), x, _mm256_set1_pd(1.0/2.0));
-
-    auto pt7 = _mm256_fmadd_pd(pt2, x2, pt3);
-    auto pt8 = _mm256_fmadd_pd(pt4, x2, pt5);
-    auto pt9 = _mm256_fmadd_pd(pt6, x2, x);
-    auto pt10 = _mm256_fmadd_pd(pt1, x4, pt7);
-    auto pt11 = _mm256_fmadd_pd(pt8, x4, pt9);
-
-    auto z = _mm256_fmadd_pd(pt10, x8, pt11);
+        r = _mm256_fmadd_ps(r, x, _mm256_set1_ps(c[i]));
 #else
-    auto pt1 = _mm256_add_pd(_mm256_mul_pd(_mm256_set1_pd(1.0/6227020800.0), x), _mm256_set1_pd(1.0/479001600.0));
-    auto pt2 = _mm256_add_pd(_mm256_mul_pd(_mm256_set1_pd(1.0/39916800.0), x), _mm256_set1_pd(1.0/3628800.0));
-    auto pt3 = _mm256_add_pd(_mm256_mul_pd(_mm256_set1_pd(1.0/362880.0), x), _mm256_set1_pd(1.0/40320.0));
-    auto pt4 = _mm256_add_pd(_mm256_mul_pd(_mm256_set1_pd(1.0/5040.0), x), _mm256_set1_pd(1.0/720.0));
-    auto pt5 = _mm256_add_pd(_mm256_mul_pd(_mm256_set1_pd(1.0/120.0), x), _mm256_set1_pd(1.0/24.0));
-    auto pt6 = _mm256_add_pd(_mm256_mul_pd(_mm256_set1_pd(1.0/6.0), x), _mm256_set1_pd(1.0/2.0));
-
-    auto pt7 = _mm256_add_pd(_mm256_mul_pd(pt2, x2), pt3);
-    auto pt8 = _mm256_add_pd(_mm256_mul_pd(pt4, x2), pt5);
-    auto pt9 = _mm256_add_pd(_mm256_mul_pd(pt6, x2), x);
-    auto pt10 = _mm256_add_pd(_mm256_mul_pd(pt1, x4), pt7);
-    auto pt11 = _mm256_add_pd(_mm256_mul_pd(pt8, x4), pt9);
-
-    auto z = _mm256_add_pd(_mm256_mul_pd(pt10, x8), pt11);
+        r = _mm256_add_ps(_mm256_mul_ps(r, x), _mm256_set1_ps(c[i]));
 #endif
+    }
 
-    __m256d a = r + _mm256_set1_pd(1023.0 + 4503599627370496.0);
-    __m256i b = _mm256_castpd_si256(a);
+    return r;
+}
 
-#ifdef __AVX2__
-    __m256i c = _mm256_slli_epi64(b, 52);
-#else
-    // This sucks ass, so much...
+/*!
+ * \brief Compute 2^n for each element of the vector
+ * \param n The integer exponents, in [-1022, 1023]
+ * \return a vector containing 2^n
+ */
+ETL_INLINE_VEC_256D pow2_256_pd(__m128i n) {
+    n = _mm_slli_epi32(_mm_add_epi32(n, _mm_set1_epi32(1023)), 20);
 
-    auto a1 = _mm256_castsi256_si128(b);
-    auto a2 = _mm256_extractf128_si256(b, 1);
+    auto lo = _mm_castsi128_pd(_mm_unpacklo_epi32(_mm_setzero_si128(), n));
+    auto hi = _mm_castsi128_pd(_mm_unpackhi_epi32(_mm_setzero_si128(), n));
 
-    auto s = _mm_set_epi32(0, 52, 0, 52);
-    auto b1 = _mm_sll_epi64( a1, s);
-    auto b2 = _mm_sll_epi64( a2, s);
+    return _mm256_insertf128_pd(_mm256_castpd128_pd256(lo), hi, 1);
+}
 
-    __m256i c  =  _mm256_castsi128_si256 ( b1 );
-    c =  _mm256_insertf128_si256 (  c, b2, 1 );
-#endif
+} //end of namespace detail
 
-    __m256d n2 = _mm256_castsi256_pd(c);
+/*!
+ * \brief AVX-Vectorized exponential in double-precision
+ *
+ * The maximum error is 2 ULP. The results saturate to zero and
+ * infinity outside of [-745, 709.78].
+ *
+ * \param x The vector of numbers to compute the exponential from
+ * \return a vector containing the exponential of the input vector values
+ */
+ETL_INLINE_VEC_256D exp256_pd(__m256d x) {
+    static constexpr double P[] = {1.26177193074810590878E-4, 3.02994407707441961300E-2, 9.99999999999999999910E-1};
+    static constexpr double Q[] = {3.00198505138664455042E-6, 2.52448340349684104192E-3, 2.27265548208155028766E-1, 2.00000000000000000009E0};
+
+    x = _mm256_min_pd(x, _mm256_set1_pd(7.09782712893383996843e2));
+    x = _mm256_max_pd(x, _mm256_set1_pd(-7.45133219101941108420e2));
+
+    // Express e^x = e^g 2^n = e^g e^(n log(2)) = e^(g + n log(2))
+    auto px = _mm256_floor_pd(_mm256_add_pd(_mm256_mul_pd(x, _mm256_set1_pd(1.4426950408889634073599)), _mm256_set1_pd(0.5)));
+    auto n  = _mm256_cvtpd_epi32(px);
+
+    x = _mm256_sub_pd(x, _mm256_mul_pd(px, _mm256_set1_pd(6.93145751953125E-1)));
+    x = _mm256_sub_pd(x, _mm256_mul_pd(px, _mm256_set1_pd(1.42860682030941723212E-6)));
 
-    auto t5 = _mm256_add_pd(z, _mm256_set1_pd(1.0));
-    z = _mm256_mul_pd(t5, n2);
+    // Rational approximation of e^g = 1 + 2 * g * P(g^2) / (Q(g^2) - g * P(g^2))
+    auto xx = _mm256_mul_pd(x, x);
+    auto p  = _mm256_mul_pd(x, detail::polevl256_pd(xx, P));
+    auto q  = detail::polevl256_pd(xx, Q);
 
-    return z;
+    x = _mm256_div_pd(p, _mm256_sub_pd(q, p));
+    x = _mm256_add_pd(_mm256_set1_pd(1.0), _mm256_add_pd(x, x));
+
+    // Multiply by 2^n in two steps so that denormals and large values are not lost
+    auto n1 = _mm_srai_epi32(n, 1);
+    auto n2 = _mm_sub_epi32(n, n1);
+
+    return _mm256_mul_pd(_mm256_mul_pd(x, detail::pow2_256_pd(n1)), detail::pow2_256_pd(n2));
 }
 
 /*!
@@ -667,6 +680,349 @@ ETL_INLINE_VEC_256 cos256_ps(__m256 x) { // any x
     return y;
 }
 
+/*
+ * The following functions are not part of the original avx_mathfun
+ * and are based on the Cephes Math Library by Stephen L. Moshier.
+ *
+ * The error bounds are given for the range of validity of each
+ * function and have been measured against the standard library.
+ */
+
+namespace detail {
+
+/*!
+ * \brief Evaluate the core of the Cephes double-precision sin/cos
+ *
+ * \param x The absolute values of the input
+ * \param y The even octant of x
+ * \param cos_mask The mask of the elements for which the cosinus polynomial must be used
+ *
+ * \return The polynomial approximation of the reduced sinus or cosinus
+ */
+ETL_INLINE_VEC_256D sincos_poly256_pd(__m256d x, __m256d y, __m256d cos_mask) {
+    static constexpr double sincof[] = {1.58962301576546568060E-10, -2.50507477628578072866E-8, 2.75573136213857245213E-6,
+                                        -1.98412698295895385996E-4, 8.33333333332211858878E-3, -1.66666666666666307295E-1};
+    static constexpr double coscof[] = {-1.13585365213876817300E-11, 2.08757008419747316778E-9, -2.75573141792967388112E-7,
+                                        2.48015872888517045348E-5, -1.38888888888730564116E-3, 4.16666666666665929218E-2};
+
+    // Extended precision modular arithmetic
+    x = _mm256_sub_pd(x, _mm256_mul_pd(y, _mm256_set1_pd(7.85398125648498535156E-1)));
+    x = _mm256_sub_pd(x, _mm256_mul_pd(y, _mm256_set1_pd(3.77489470793079817668E-8)));
+    x = _mm256_sub_pd(x, _mm256_mul_pd(y, _mm256_set1_pd(2.69515142907905952645E-15)));
+
+    auto z = _mm256_mul_pd(x, x);
+
+    // cos(x) = 1 - z / 2 + z^2 * P(z)
+    auto c = _mm256_mul_pd(_mm256_mul_pd(z, z), polevl256_pd(z, coscof));
+    c      = _mm256_add_pd(_mm256_sub_pd(_mm256_set1_pd(1.0), _mm256_mul_pd(z, _mm256_set1_pd(0.5))), c);
+
+    // sin(x) = x + x * z * P(z)
+    auto s = _mm256_add_pd(x, _mm256_mul_pd(_mm256_mul_pd(x, z), polevl256_pd(z, sincof)));
+
+    return _mm256_blendv_pd(s, c, cos_mask);
+}
+
+/*!
+ * \brief Compute the even octant of each element of the vector
+ * \param x The absolute values of the input
+ * \param j The octant modulo 8
+ * \return the even octant
+ */
+ETL_INLINE_VEC_256D octant256_pd(__m256d x, __m256d& j) {
+    auto y = _mm256_floor_pd(_mm256_mul_pd(x, _mm256_set1_pd(1.27323954473516268615)));
+    y      = _mm256_add_pd(y, _mm256_sub_pd(y, _mm256_mul_pd(_mm256_set1_pd(2.0), _mm256_floor_pd(_mm256_mul_pd(y, _mm256_set1_pd(0.5))))));
+
+    j = _mm256_sub_pd(y, _mm256_mul_pd(_mm256_set1_pd(8.0), _mm256_floor_pd(_mm256_mul_pd(y, _mm256_set1_pd(0.125)))));
+
+    return y;
+}
+
+} //end of namespace detail
+
+/*!
+ * \brief AVX-Vectorized logarithm in double-precision
+ *
+ * The maximum error is 1 ULP. log(0) is -inf and the logarithm of a
+ * negative number is NaN.
+ *
+ * \param x The vector of numbers to compute the logarithm from
+ * \return a vector containing the logarithms of the input vector values
+ */
+ETL_INLINE_VEC_256D log256_pd(__m256d x) {
+    static constexpr double P[] = {1.01875663804580931796E-4, 4.97494994976747001425E-1, 4.70579119878881725854E0,
+                                   1.44989225341610930846E1, 1.79368678507819816313E1, 7.70838733755885391666E0};
+    static constexpr double Q[] = {1.0, 1.12873587189167450590E1, 4.52279145837532221105E1, 8.29875266912776603211E1,
+                                   7.11544750618563894466E1, 2.31251620126765340583E1};
+
+    const auto one = _mm256_set1_pd(1.0);
+
+    // Scale the denormals into the normal range
+    auto denormal = _mm256_cmp_pd(x, _mm256_set1_pd(2.2250738585072014e-308), _CMP_LT_OQ);
+    auto v        = _mm256_blendv_pd(x, _mm256_mul_pd(x, _mm256_set1_pd(18014398509481984.0)), denormal);
+
+    // Decompose v into m * 2^e with m in [0.5, 1[
+
+#ifdef __AVX2__
+    auto eb = _mm256_castsi256_pd(_mm256_srli_epi64(_mm256_castpd_si256(v), 52));
+#else
+    auto eb_lo = _mm_srli_epi64(_mm_castpd_si128(_mm256_castpd256_pd128(v)), 52);
+    auto eb_hi = _mm_srli_epi64(_mm_castpd_si128(_mm256_extractf128_pd(v, 1)), 52);
+    auto eb    = _mm256_insertf128_pd(_mm256_castpd128_pd256(_mm_castsi128_pd(eb_lo)), _mm_castsi128_pd(eb_hi), 1);
+#endif
+
+    auto e = _mm256_sub_pd(_mm256_or_pd(eb, _mm256_set1_pd(4503599627370496.0)), _mm256_set1_pd(4503599627370496.0 + 1022.0));
+    e      = _mm256_sub_pd(e, _mm256_and_pd(denormal, _mm256_set1_pd(54.0)));
+
+    auto m = _mm256_and_pd(v, _mm256_castsi256_pd(_mm256_set1_epi64x(0x000FFFFFFFFFFFFFLL)));
+    m      = _mm256_or_pd(m, _mm256_set1_pd(0.5));
+
+    // Bring m into [sqrt(0.5), sqrt(2)[
+    auto small = _mm256_cmp_pd(m, _mm256_set1_pd(0.70710678118654752440), _CMP_LT_OQ);
+    e          = _mm256_sub_pd(e, _mm256_and_pd(small, one));
+    m          = _mm256_sub_pd(_mm256_add_pd(m, _mm256_and_pd(small, m)), one);
+
+    // log(1 + m) = m - m^2 / 2 + m^3 * P(m) / Q(m)
+    auto z = _mm256_mul_pd(m, m);
+    auto y = _mm256_mul_pd(_mm256_mul_pd(m, z), _mm256_div_pd(detail::polevl256_pd(m, P), detail::polevl256_pd(m, Q)));
+
+    y = _mm256_sub_pd(y, _mm256_mul_pd(e, _mm256_set1_pd(2.121944400546905827679e-4)));
+    y = _mm256_sub_pd(y, _mm256_mul_pd(z, _mm256_set1_pd(0.5)));
+
+    auto r = _mm256_add_pd(_mm256_add_pd(m, y), _mm256_mul_pd(e, _mm256_set1_pd(0.693359375)));
+
+    // Handle the special values
+    r = _mm256_blendv_pd(r, x, _mm256_cmp_pd(x, _mm256_set1_pd(std::numeric_limits<double>::infinity()), _CMP_EQ_OQ));
+    r = _mm256_blendv_pd(r, _mm256_set1_pd(-std::numeric_limits<double>::infinity()), _mm256_cmp_pd(x, _mm256_setzero_pd(), _CMP_EQ_OQ));
+    r = _mm256_blendv_pd(r, _mm256_set1_pd(std::numeric_limits<double>::quiet_NaN()), _mm256_cmp_pd(x, _mm256_setzero_pd(), _CMP_NGE_UQ));
+
+    return r;
+}
+
+/*!
+ * \brief AVX-Vectorized sinus in double-precision
+ *
+ * The maximum error is 2 ULP for |x| < 2^30. The precision degrades
+ * for larger values.
+ *
+ * \param x The vector of numbers to compute the sinus from
+ * \return a vector containing the sinus of the input vector values
+ */
+ETL_INLINE_VEC_256D sin256_pd(__m256d x) {
+    auto sign = _mm256_and_pd(x, _mm256_set1_pd(-0.0));
+    x         = _mm256_andnot_pd(_mm256_set1_pd(-0.0), x);
+
+    __m256d j;
+    auto y = detail::octant256_pd(x, j);
+
+    // Reflect in x axis
+    auto upper = _mm256_cmp_pd(j, _mm256_set1_pd(4.0), _CMP_GE_OQ);
+    sign       = _mm256_xor_pd(sign, _mm256_and_pd(upper, _mm256_set1_pd(-0.0)));
+    j          = _mm256_sub_pd(j, _mm256_and_pd(upper, _mm256_set1_pd(4.0)));
+
+    auto r = detail::sincos_poly256_pd(x, y, _mm256_cmp_pd(j, _mm256_set1_pd(2.0), _CMP_EQ_OQ));
+
+    return _mm256_xor_pd(r, sign);
+}
+
+/*!
+ * \brief AVX-Vectorized cosinus in double-precision
+ *
+ * The maximum error is 2 ULP for |x| < 2^30. The precision degrades
+ * for larger values.
+ *
+ * \param x The vector of numbers to compute the cosinus from
+ * \return a vector containing the cosinus of the input vector values
+ */
+ETL_INLINE_VEC_256D cos256_pd(__m256d x) {
+    x = _mm256_andnot_pd(_mm256_set1_pd(-0.0), x);
+
+    __m256d j;
+    auto y = detail::octant256_pd(x, j);
+
+    auto upper = _mm256_cmp_pd(j, _mm256_set1_pd(4.0), _CMP_GE_OQ);
+    auto sign  = _mm256_and_pd(upper, _mm256_set1_pd(-0.0));
+    j          = _mm256_sub_pd(j, _mm256_and_pd(upper, _mm256_set1_pd(4.0)));
+
+    auto sin_octant = _mm256_cmp_pd(j, _mm256_set1_pd(2.0), _CMP_EQ_OQ);
+    sign            = _mm256_xor_pd(sign, _mm256_and_pd(sin_octant, _mm256_set1_pd(-0.0)));
+
+    auto r = detail::sincos_poly256_pd(x, y, _mm256_cmp_pd(j, _mm256_set1_pd(2.0), _CMP_NEQ_OQ));
+
+    return _mm256_xor_pd(r, sign);
+}
+
+/*!
+ * \brief AVX-Vectorized log(1 + x) in single-precision, for x > -1
+ *
+ * The maximum error is 2 ULP.
+ *
+ * \param x The vector of numbers to compute log(1 + x) from
+ * \return a vector containing log(1 + x) of the input vector values
+ */
+ETL_INLINE_VEC_256 log1p256_ps(__m256 x) {
+    const auto one = _mm256_set1_ps(1.0f);
+
+    // log(1 + x) = log(u) * x / (u - 1) cancels the rounding error of 1 + x
+    auto u = _mm256_add_ps(one, x);
+    auto d = _mm256_sub_ps(u, one);
+    auto r = _mm256_mul_ps(log256_ps(u), _mm256_div_ps(x, d));
+
+    return _mm256_blendv_ps(r, x, _mm256_cmp_ps(d, _mm256_setzero_ps(), _CMP_EQ_OQ));
+}
+
+/*!
+ * \brief AVX-Vectorized log(1 + x) in double-precision, for x > -1
+ *
+ * The maximum error is 2 ULP.
+ *
+ * \param x The vector of numbers to compute log(1 + x) from
+ * \return a vector containing log(1 + x) of the input vector values
+ */
+ETL_INLINE_VEC_256D log1p256_pd(__m256d x) {
+    const auto one = _mm256_set1_pd(1.0);
+
+    // log(1 + x) = log(u) * x / (u - 1) cancels the rounding error of 1 + x
+    auto u = _mm256_add_pd(one, x);
+    auto d = _mm256_sub_pd(u, one);
+    auto r = _mm256_mul_pd(log256_pd(u), _mm256_div_pd(x, d));
+
+    return _mm256_blendv_pd(r, x, _mm256_cmp_pd(d, _mm256_setzero_pd(), _CMP_EQ_OQ));
+}
+
+/*!
+ * \brief AVX-Vectorized hyperbolic tangent in single-precision
+ *
+ * The maximum error is 1 ULP.
+ *
+ * \param x The vector of numbers to compute the hyperbolic tangent from
+ * \return a vector containing the hyperbolic tangent of the input vector values
+ */
+ETL_INLINE_VEC_256 tanh256_ps(__m256 x) {
+    static constexpr float P[] = {-5.70498872745E-3f, 2.06390887954E-2f, -5.37397155531E-2f, 1.33314422036E-1f, -3.33332819422E-1f};
+
+    auto sign = _mm256_and_ps(x, _mm256_set1_ps(-0.0f));
+    auto ax   = _mm256_andnot_ps(_mm256_set1_ps(-0.0f), x);
+
+    // Small values: x + x^3 * P(x^2)
+    auto z     = _mm256_mul_ps(x, x);
+    auto small = _mm256_add_ps(x, _mm256_mul_ps(_mm256_mul_ps(x, z), detail::polevl256_ps(z, P)));
+
+    // Large values: 1 - 2 / (exp(2x) + 1)
+    auto e     = exp256_ps(_mm256_min_ps(_mm256_add_ps(ax, ax), _mm256_set1_ps(40.0f)));
+    auto large = _mm256_sub_ps(_mm256_set1_ps(1.0f), _mm256_div_ps(_mm256_set1_ps(2.0f), _mm256_add_ps(e, _mm256_set1_ps(1.0f))));
+    large      = _mm256_or_ps(large, sign);
+
+    return _mm256_blendv_ps(large, small, _mm256_cmp_ps(ax, _mm256_set1_ps(0.625f), _CMP_LT_OQ));
+}
+
+/*!
+ * \brief AVX-Vectorized hyperbolic tangent in double-precision
+ *
+ * The maximum error is 2 ULP.
+ *
+ * \param x The vector of numbers to compute the hyperbolic tangent from
+ * \return a vector containing the hyperbolic tangent of the input vector values
+ */
+ETL_INLINE_VEC_256D tanh256_pd(__m256d x) {
+    static constexpr double P[] = {-9.64399179425052238628E-1, -9.92877231001918586564E1, -1.61468768441708447952E3};
+    static constexpr double Q[] = {1.0, 1.12811678491632931402E2, 2.23548839060100448583E3, 4.84406305325125486048E3};
+
+    auto sign = _mm256_and_pd(x, _mm256_set1_pd(-0.0));
+    auto ax   = _mm256_andnot_pd(_mm256_set1_pd(-0.0), x);
+
+    // Small values: x + x^3 * P(x^2) / Q(x^2)
+    auto z     = _mm256_mul_pd(x, x);
+    auto small = _mm256_add_pd(x, _mm256_mul_pd(_mm256_mul_pd(x, z), _mm256_div_pd(detail::polevl256_pd(z, P), detail::polevl256_pd(z, Q))));
+
+    // Large values: 1 - 2 / (exp(2x) + 1)
+    auto e     = exp256_pd(_mm256_min_pd(_mm256_add_pd(ax, ax), _mm256_set1_pd(80.0)));
+    auto large = _mm256_sub_pd(_mm256_set1_pd(1.0), _mm256_div_pd(_mm256_set1_pd(2.0), _mm256_add_pd(e, _mm256_set1_pd(1.0))));
+    large      = _mm256_or_pd(large, sign);
+
+    return _mm256_blendv_pd(large, small, _mm256_cmp_pd(ax, _mm256_set1_pd(0.625), _CMP_LT_OQ));
+}
+
+/*!
+ * \brief AVX-Vectorized hyperbolic sinus in single-precision
+ *
+ * The maximum error is 4 ULP.
+ *
+ * \param x The vector of numbers to compute the hyperbolic sinus from
+ * \return a vector containing the hyperbolic sinus of the input vector values
+ */
+ETL_INLINE_VEC_256 sinh256_ps(__m256 x) {
+    static constexpr float P[] = {2.03721912945E-4f, 8.33028376239E-3f, 1.66667160211E-1f};
+
+    auto sign = _mm256_and_ps(x, _mm256_set1_ps(-0.0f));
+    auto ax   = _mm256_andnot_ps(_mm256_set1_ps(-0.0f), x);
+
+    // Small values: x + x^3 * P(x^2)
+    auto z     = _mm256_mul_ps(x, x);
+    auto small = _mm256_add_ps(x, _mm256_mul_ps(_mm256_mul_ps(x, z), detail::polevl256_ps(z, P)));
+
+    // Large values: (e^x - e^-x) / 2, computed in two halves to avoid the premature overflow
+    auto h     = exp256_ps(_mm256_mul_ps(ax, _mm256_set1_ps(0.5f)));
+    auto large = _mm256_sub_ps(_mm256_mul_ps(_mm256_mul_ps(h, _mm256_set1_ps(0.5f)), h), _mm256_div_ps(_mm256_div_ps(_mm256_set1_ps(0.5f), h), h));
+    large      = _mm256_or_ps(large, sign);
+
+    return _mm256_blendv_ps(large, small, _mm256_cmp_ps(ax, _mm256_set1_ps(1.0f), _CMP_LE_OQ));
+}
+
+/*!
+ * \brief AVX-Vectorized hyperbolic sinus in double-precision
+ *
+ * The maximum error is 4 ULP.
+ *
+ * \param x The vector of numbers to compute the hyperbolic sinus from
+ * \return a vector containing the hyperbolic sinus of the input vector values
+ */
+ETL_INLINE_VEC_256D sinh256_pd(__m256d x) {
+    static constexpr double P[] = {-7.89474443963537015605E-1, -1.63725857525983828727E2, -1.15614435765005216044E4, -3.51754964808151394800E5};
+    static constexpr double Q[] = {1.0, -2.77711081420602794433E2, 3.61578279834431989373E4, -2.11052978884890840399E6};
+
+    auto sign = _mm256_and_pd(x, _mm256_set1_pd(-0.0));
+    auto ax   = _mm256_andnot_pd(_mm256_set1_pd(-0.0), x);
+
+    // Small values: x + x^3 * P(x^2) / Q(x^2)
+    auto z     = _mm256_mul_pd(x, x);
+    auto small = _mm256_add_pd(x, _mm256_mul_pd(_mm256_mul_pd(x, z), _mm256_div_pd(detail::polevl256_pd(z, P), detail::polevl256_pd(z, Q))));
+
+    // Large values: (e^x - e^-x) / 2, computed in two halves to avoid the premature overflow
+    auto h     = exp256_pd(_mm256_mul_pd(ax, _mm256_set1_pd(0.5)));
+    auto large = _mm256_sub_pd(_mm256_mul_pd(_mm256_mul_pd(h, _mm256_set1_pd(0.5)), h), _mm256_div_pd(_mm256_div_pd(_mm256_set1_pd(0.5), h), h));
+    large      = _mm256_or_pd(large, sign);
+
+    return _mm256_blendv_pd(large, small, _mm256_cmp_pd(ax, _mm256_set1_pd(1.0), _CMP_LE_OQ));
+}
+
+/*!
+ * \brief AVX-Vectorized hyperbolic cosinus in single-precision
+ *
+ * The maximum error is 3 ULP.
+ *
+ * \param x The vector of numbers to compute the hyperbolic cosinus from
+ * \return a vector containing the hyperbolic cosinus of the input vector values
+ */
+ETL_INLINE_VEC_256 cosh256_ps(__m256 x) {
+    // (e^x + e^-x) / 2, computed in two halves to avoid the premature overflow
+    auto h = exp256_ps(_mm256_mul_ps(_mm256_andnot_ps(_mm256_set1_ps(-0.0f), x), _mm256_set1_ps(0.5f)));
+    return _mm256_add_ps(_mm256_mul_ps(_mm256_mul_ps(h, _mm256_set1_ps(0.5f)), h), _mm256_div_ps(_mm256_div_ps(_mm256_set1_ps(0.5f), h), h));
+}
+
+/*!
+ * \brief AVX-Vectorized hyperbolic cosinus in double-precision
+ *
+ * The maximum error is 4 ULP.
+ *
+ * \param x The vector of numbers to compute the hyperbolic cosinus from
+ * \return a vector containing the hyperbolic cosinus of the input vector values
+ */
+ETL_INLINE_VEC_256D cosh256_pd(__m256d x) {
+    // (e^x + e^-x) / 2, computed in two halves to avoid the premature overflow
+    auto h = exp256_pd(_mm256_mul_pd(_mm256_andnot_pd(_mm256_set1_pd(-0.0), x), _mm256_set1_pd(0.5)));
+    return _mm256_add_pd(_mm256_mul_pd(_mm256_mul_pd(h, _mm256_set1_pd(0.5)), h), _mm256_div_pd(_mm256_div_pd(_mm256_set1_pd(0.5), h), h));
+}
+
 } //end of namespace etl
 
 #endif //__AVX__
@@ -14,6 +14,8 @@
 
 #ifdef __AVX__
 
+#include <cstring>
+
 #include <immintrin.h>
 #include <emmintrin.h>
 #include <xmmintrin.h>
@@ -764,6 +766,189 @@ struct avx_vec {
         return _mm256_round_pd(x.value, (_MM_FROUND_TO_POS_INF |_MM_FROUND_NO_EXC));
     }
 
+    /*!
+     * \brief Round down each values of the vector and return them
+     */
+    ETL_STATIC_INLINE(avx_simd_float) round_down(avx_simd_float x) {
+        return _mm256_round_ps(x.value, (_MM_FROUND_TO_NEG_INF |_MM_FROUND_NO_EXC));
+    }
+
+    /*!
+     * \brief Round down each values of the vector and return them
+     */
+    ETL_STATIC_INLINE(avx_simd_double) round_down(avx_simd_double x) {
+        return _mm256_round_pd(x.value, (_MM_FROUND_TO_NEG_INF |_MM_FROUND_NO_EXC));
+    }
+
+    // Comparisons
+    //
+    // The comparisons return masks in the same vector type as their
+    // operands, with all the bits of a lane set when the comparison
+    // holds.
+
+    /*!
+     * \brief Compare each element of the two vectors for equality
+     */
+    ETL_STATIC_INLINE(avx_simd_float) equal(avx_simd_float lhs, avx_simd_float rhs) {
+        return _mm256_cmp_ps(lhs.value, rhs.value, _CMP_EQ_OQ);
+    }
+
+    /*!
+     * \brief Compare each element of the two vectors for equality
+     */
+    ETL_STATIC_INLINE(avx_simd_double) equal(avx_simd_double lhs, avx_simd_double rhs) {
+        return _mm256_cmp_pd(lhs.value, rhs.value, _CMP_EQ_OQ);
+    }
+
+    /*!
+     * \brief Compare each element of the two vectors for inequality
+     */
+    ETL_STATIC_INLINE(avx_simd_float) not_equal(avx_simd_float lhs, avx_simd_float rhs) {
+        return _mm256_cmp_ps(lhs.value, rhs.value, _CMP_NEQ_UQ);
+    }
+
+    /*!
+     * \brief Compare each element of the two vectors for inequality
+     */
+    ETL_STATIC_INLINE(avx_simd_double) not_equal(avx_simd_double lhs, avx_simd_double rhs) {
+        return _mm256_cmp_pd(lhs.value, rhs.value, _CMP_NEQ_UQ);
+    }
+
+    /*!
+     * \brief Test if each element of lhs is less than the element of rhs
+     */
+    ETL_STATIC_INLINE(avx_simd_float) less(avx_simd_float lhs, avx_simd_float rhs) {
+        return _mm256_cmp_ps(lhs.value, rhs.value, _CMP_LT_OQ);
+    }
+
+    /*!
+     * \brief Test if each element of lhs is less than the element of rhs
+     */
+    ETL_STATIC_INLINE(avx_simd_double) less(avx_simd_double lhs, avx_simd_double rhs) {
+        return _mm256_cmp_pd(lhs.value, rhs.value, _CMP_LT_OQ);
+    }
+
+    /*!
+     * \brief Test if each element of lhs is less than or equal to the element of rhs
+     */
+    ETL_STATIC_INLINE(avx_simd_float) less_equal(avx_simd_float lhs, avx_simd_float rhs) {
+        return _mm256_cmp_ps(lhs.value, rhs.value, _CMP_LE_OQ);
+    }
+
+    /*!
+     * \brief Test if each element of lhs is less than or equal to the element of rhs
+     */
+    ETL_STATIC_INLINE(avx_simd_double) less_equal(avx_simd_double lhs, avx_simd_double rhs) {
+        return _mm256_cmp_pd(lhs.value, rhs.value, _CMP_LE_OQ);
+    }
+
+    /*!
+     * \brief Test if each element of lhs is greater than the element of rhs
+     */
+    ETL_STATIC_INLINE(avx_simd_float) greater(avx_simd_float lhs, avx_simd_float rhs) {
+        return _mm256_cmp_ps(lhs.value, rhs.value, _CMP_GT_OQ);
+    }
+
+    /*!
+     * \brief Test if each element of lhs is greater than the element of rhs
+     */
+    ETL_STATIC_INLINE(avx_simd_double) greater(avx_simd_double lhs, avx_simd_double rhs) {
+        return _mm256_cmp_pd(lhs.value, rhs.value, _CMP_GT_OQ);
+    }
+
+    /*!
+     * \brief Test if each element of lhs is greater than or equal to the element of rhs
+     */
+    ETL_STATIC_INLINE(avx_simd_float) greater_equal(avx_simd_float lhs, avx_simd_float rhs) {
+        return _mm256_cmp_ps(lhs.value, rhs.value, _CMP_GE_OQ);
+    }
+
+    /*!
+     * \brief Test if each element of lhs is greater than or equal to the element of rhs
+     */
+    ETL_STATIC_INLINE(avx_simd_double) greater_equal(avx_simd_double lhs, avx_simd_double rhs) {
+        return _mm256_cmp_pd(lhs.value, rhs.value, _CMP_GE_OQ);
+    }
+
+    /*!
+     * \brief Compute the logical and of two masks
+     */
+    ETL_STATIC_INLINE(avx_simd_float) mask_and(avx_simd_float lhs, avx_simd_float rhs) {
+        return _mm256_and_ps(lhs.value, rhs.value);
+    }
+
+    /*!
+     * \brief Compute the logical and of two masks
+     */
+    ETL_STATIC_INLINE(avx_simd_double) mask_and(avx_simd_double lhs, avx_simd_double rhs) {
+        return _mm256_and_pd(lhs.value, rhs.value);
+    }
+
+    /*!
+     * \brief Compute the logical or of two masks
+     */
+    ETL_STATIC_INLINE(avx_simd_float) mask_or(avx_simd_float lhs, avx_simd_float rhs) {
+        return _mm256_or_ps(lhs.value, rhs.value);
+    }
+
+    /*!
+     * \brief Compute the logical or of two masks
+     */
+    ETL_STATIC_INLINE(avx_simd_double) mask_or(avx_simd_double lhs, avx_simd_double rhs) {
+        return _mm256_or_pd(lhs.value, rhs.value);
+    }
+
+    /*!
+     * \brief Compute the logical xor of two masks
+     */
+    ETL_STATIC_INLINE(avx_simd_float) mask_xor(avx_simd_float lhs, avx_simd_float rhs) {
+        return _mm256_xor_ps(lhs.value, rhs.value);
+    }
+
+    /*!
+     * \brief Compute the logical xor of two masks
+     */
+    ETL_STATIC_INLINE(avx_simd_double) mask_xor(avx_simd_double lhs, avx_simd_double rhs) {
+        return _mm256_xor_pd(lhs.value, rhs.value);
+    }
+
+    /*!
+     * \brief Select the elements of a where the mask is set and the elements of b elsewhere
+     */
+    ETL_STATIC_INLINE(avx_simd_float) select(avx_simd_float mask, avx_simd_float a, avx_simd_float b) {
+        return _mm256_blendv_ps(b.value, a.value, mask.value);
+    }
+
+    /*!
+     * \brief Select the elements of a where the mask is set and the elements of b elsewhere
+     */
+    ETL_STATIC_INLINE(avx_simd_double) select(avx_simd_double mask, avx_simd_double a, avx_simd_double b) {
+        return _mm256_blendv_pd(b.value, a.value, mask.value);
+    }
+
+    /*!
+     * \brief Store a mask as booleans at the given (unaligned) memory position
+     */
+    ETL_STATIC_INLINE(void) store_mask(bool* memory, avx_simd_float mask) {
+        // Narrow the 32-bit lanes to bytes and keep only the lowest bit
+        auto lo = _mm_castps_si128(_mm256_castps256_ps128(mask.value));
+        auto hi = _mm_castps_si128(_mm256_extractf128_ps(mask.value, 1));
+        auto m  = _mm_packs_epi16(_mm_packs_epi32(lo, hi), _mm_setzero_si128());
+
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(memory), _mm_and_si128(m, _mm_set1_epi8(1)));
+    }
+
+    /*!
+     * \brief Store a mask as booleans at the given (unaligned) memory position
+     */
+    ETL_STATIC_INLINE(void) store_mask(bool* memory, avx_simd_double mask) {
+        // Spread the four sign bits to the lowest bit of four bytes
+        uint32_t bits  = _mm256_movemask_pd(mask.value);
+        uint32_t bytes = (bits & 1U) | ((bits & 2U) << 7) | ((bits & 4U) << 14) | ((bits & 8U) << 21);
+
+        std::memcpy(memory, &bytes, 4);
+    }
+
     // Addition
 
 #ifdef __AVX2__
@@ -1234,6 +1419,13 @@ struct avx_vec {
         return etl::cos256_ps(x.value);
     }
 
+    /*!
+     * \brief Compute the cosinus of each element of the given vector
+     */
+    ETL_STATIC_INLINE(avx_simd_double) cos(avx_simd_double x) {
+        return etl::cos256_pd(x.value);
+    }
+
     /*!
      * \brief Compute the sinus of each element of the given vector
      */
@@ -1241,6 +1433,73 @@ struct avx_vec {
         return etl::sin256_ps(x.value);
     }
 
+    /*!
+     * \brief Compute the sinus of each element of the given vector
+     */
+    ETL_STATIC_INLINE(avx_simd_double) sin(avx_simd_double x) {
+        return etl::sin256_pd(x.value);
+    }
+
+    // Hyperbolic functions
+
+    /*!
+     * \brief Compute the hyperbolic tangent of each element of the given vector
+     */
+    ETL_STATIC_INLINE(avx_simd_float) tanh(avx_simd_float x) {
+        return etl::tanh256_ps(x.value);
+    }
+
+    /*!
+     * \brief Compute the hyperbolic tangent of each element of the given vector
+     */
+    ETL_STATIC_INLINE(avx_simd_double) tanh(avx_simd_double x) {
+        return etl::tanh256_pd(x.value);
+    }
+
+    /*!
+     * \brief Compute the hyperbolic sinus of each element of the given vector
+     */
+    ETL_STATIC_INLINE(avx_simd_float) sinh(avx_simd_float x) {
+        return etl::sinh256_ps(x.value);
+    }
+
+    /*!
+     * \brief Compute the hyperbolic sinus of each element of the given vector
+     */
+    ETL_STATIC_INLINE(avx_simd_double) sinh(avx_simd_double x) {
+        return etl::sinh256_pd(x.value);
+    }
+
+    /*!
+     * \brief Compute the hyperbolic cosinus of each element of the given vector
+     */
+    ETL_STATIC_INLINE(avx_simd_float) cosh(avx_simd_float x) {
+        return etl::cosh256_ps(x.value);
+    }
+
+    /*!
+     * \brief Compute the hyperbolic cosinus of each element of the given vector
+     */
+    ETL_STATIC_INLINE(avx_simd_double) cosh(avx_simd_double x) {
+        return etl::cosh256_pd(x.value);
+    }
+
+    // log(1 + x)
+
+    /*!
+     * \brief Compute log(1 + x) of each element of the given vector
+     */
+    ETL_STATIC_INLINE(avx_simd_float) log1p(avx_simd_float x) {
+        return etl::log1p256_ps(x.value);
+    }
+
+    /*!
+     * \brief Compute log(1 + x) of each element of the given vector
+     */
+    ETL_STATIC_INLINE(avx_simd_double) log1p(avx_simd_double x) {
+        return etl::log1p256_pd(x.value);
+    }
+
 #ifndef __INTEL_COMPILER
 
     //Exponential
@@ -1268,6 +1527,13 @@ struct avx_vec {
         return etl::log256_ps(x.value);
     }
 
+    /*!
+     * \brief Compute the logarithm of each element of the given vector
+     */
+    ETL_STATIC_INLINE(avx_simd_double) log(avx_simd_double x) {
+        return etl::log256_pd(x.value);
+    }
+
 #else //__INTEL_COMPILER
 
     //Exponential
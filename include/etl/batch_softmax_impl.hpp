@@ -18,8 +18,9 @@ namespace etl {
  * \brief Enumeration describing the different implementations of CCE
  */
 enum class batch_softmax_impl {
-    STD,  ///< Standard implementation
-    CUDNN ///< GPU implementation
+    STD,   ///< Standard implementation
+    VEC,   ///< Vectorized implementation
+    CUDNN  ///< GPU implementation
 };
 
 } //end of namespace etl
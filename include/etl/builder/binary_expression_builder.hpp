@@ -466,7 +466,7 @@ auto greater_equal(LE&& lhs, RE rhs) -> detail::bool_left_binary_helper_scalar<L
  * \return An expression representing the element wise logical and of lhs and rhs
  */
 template <typename LE, typename RE, cpp_enable_iff(all_etl_expr<LE, RE>)>
-auto logical_and(LE&& lhs, RE rhs) -> detail::bool_left_binary_helper<LE, LE, logical_and_binary_op> {
+auto logical_and(LE&& lhs, RE rhs) -> detail::bool_left_binary_helper<LE, RE, logical_and_binary_op> {
     return {lhs, rhs};
 }
 
@@ -499,7 +499,7 @@ auto logical_and(LE lhs, RE&& rhs) -> detail::bool_right_binary_helper<scalar<va
  * \return An expression representing the element wise logical xor of lhs and rhs
  */
 template <typename LE, typename RE, cpp_enable_iff(all_etl_expr<LE, RE>)>
-auto logical_xor(LE&& lhs, RE rhs) -> detail::bool_left_binary_helper<LE, LE, logical_xor_binary_op> {
+auto logical_xor(LE&& lhs, RE rhs) -> detail::bool_left_binary_helper<LE, RE, logical_xor_binary_op> {
     return {lhs, rhs};
 }
 
@@ -532,7 +532,7 @@ auto logical_xor(LE lhs, RE&& rhs) -> detail::bool_right_binary_helper<scalar<va
  * \return An expression representing the element wise logical or of lhs and rhs
  */
 template <typename LE, typename RE, cpp_enable_iff(all_etl_expr<LE, RE>)>
-auto logical_or(LE&& lhs, RE rhs) -> detail::bool_left_binary_helper<LE, LE, logical_or_binary_op> {
+auto logical_or(LE&& lhs, RE rhs) -> detail::bool_left_binary_helper<LE, RE, logical_or_binary_op> {
     return {lhs, rhs};
 }
 
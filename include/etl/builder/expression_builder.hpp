@@ -15,6 +15,7 @@
 //Include implementations
 #include "etl/impl/dot.hpp"
 #include "etl/impl/sum.hpp"
+#include "etl/impl/stats.hpp"
 #include "etl/impl/norm.hpp"
 
 #include "etl/builder/binary_expression_builder.hpp"
@@ -228,13 +229,17 @@ auto conj(E&& value) -> unary_expr<value_t<E>, detail::build_type<E>, conj_unary
 
 /*!
  * \brief Add some uniform noise (0, 1.0) to the given expression
+ *
+ * The noise is generated with a counter-based generator, the
+ * expression can be evaluated in parallel and vectorized.
+ *
  * \param value The input ETL expression
  * \return an expression representing the input expression plus noise
  */
 template <typename E>
-auto uniform_noise(E&& value) -> detail::unary_helper<E, uniform_noise_unary_op> {
+auto uniform_noise(E&& value) -> detail::left_binary_helper_op<E, generator_expr<uniform_generator_op<value_t<E>>>, plus_binary_op<value_t<E>>> {
     static_assert(is_etl_expr<E>, "etl::uniform_noise can only be used on ETL expressions");
-    return detail::unary_helper<E, uniform_noise_unary_op>{value};
+    return {value, generator_expr<uniform_generator_op<value_t<E>>>(value_t<E>(0.0), value_t<E>(1.0))};
 }
 
 /*!
@@ -249,13 +254,17 @@ auto uniform_noise(G& g, E&& value) {
 
 /*!
  * \brief Add some normal noise (0, 1.0) to the given expression
+ *
+ * The noise is generated with a counter-based generator, the
+ * expression can be evaluated in parallel and vectorized.
+ *
  * \param value The input ETL expression
  * \return an expression representing the input expression plus noise
  */
 template <typename E>
-auto normal_noise(E&& value) -> detail::unary_helper<E, normal_noise_unary_op> {
+auto normal_noise(E&& value) -> detail::left_binary_helper_op<E, generator_expr<normal_generator_op<value_t<E>>>, plus_binary_op<value_t<E>>> {
     static_assert(is_etl_expr<E>, "etl::normal_noise can only be used on ETL expressions");
-    return detail::unary_helper<E, normal_noise_unary_op>{value};
+    return {value, generator_expr<normal_generator_op<value_t<E>>>(value_t<E>(0.0), value_t<E>(1.0))};
 }
 
 /*!
@@ -270,13 +279,17 @@ auto normal_noise(G& g, E&& value) {
 
 /*!
  * \brief Add some normal noise (0, sigmoid(x)) to the given expression
+ *
+ * The noise is generated with a counter-based generator, the
+ * expression can be evaluated in parallel and vectorized.
+ *
  * \param value The input ETL expression
  * \return an expression representing the input expression plus noise
  */
 template <typename E>
-auto logistic_noise(E&& value) -> detail::unary_helper<E, logistic_noise_unary_op> {
+auto logistic_noise(E&& value) -> detail::left_binary_helper_op<E, generator_expr<normal_generator_op<value_t<E>>>, logistic_noise_binary_op<value_t<E>>> {
     static_assert(is_etl_expr<E>, "etl::logistic_noise can only be used on ETL expressions");
-    return detail::unary_helper<E, logistic_noise_unary_op>{value};
+    return {value, generator_expr<normal_generator_op<value_t<E>>>(value_t<E>(0.0), value_t<E>(1.0))};
 }
 
 /*!
@@ -395,9 +408,9 @@ auto rep_l(E&& value, size_t d1, D... d) -> unary_expr<value_t<E>, dyn_rep_l_tra
  * \return an expression representing the aggregated expression
  */
 template <typename E, cpp_enable_iff(decay_traits<E>::dimensions() > 1)>
-auto argmax(E&& value) -> detail::stable_transform_helper<E, argmax_transformer> {
+argmax_expr<detail::build_type<E>, true> argmax(E&& value) {
     static_assert(is_etl_expr<E>, "etl::argmax can only be used on ETL expressions");
-    return detail::make_transform_expr<E, argmax_transformer>(value);
+    return argmax_expr<detail::build_type<E>, true>{value};
 }
 
 /*!
@@ -423,9 +436,9 @@ size_t argmax(E&& value) {
  * \return an expression representing the aggregated expression
  */
 template <typename E, cpp_enable_iff(decay_traits<E>::dimensions() > 1)>
-auto argmin(E&& value) -> detail::stable_transform_helper<E, argmin_transformer> {
+argmax_expr<detail::build_type<E>, false> argmin(E&& value) {
     static_assert(is_etl_expr<E>, "etl::argmax can only be used on ETL expressions");
-    return detail::make_transform_expr<E, argmin_transformer>(value);
+    return argmax_expr<detail::build_type<E>, false>{value};
 }
 
 /*!
@@ -450,10 +463,10 @@ size_t argmin(E&& value) {
  * \return an expression representing the aggregated expression
  */
 template <typename E>
-auto sum_r(E&& value) -> detail::stable_transform_helper<E, sum_r_transformer> {
+sum_r_expr<detail::build_type<E>, false> sum_r(E&& value) {
     static_assert(is_etl_expr<E>, "etl::sum_r can only be used on ETL expressions");
     static_assert(decay_traits<E>::dimensions() > 1, "Can only use sum_r on matrix");
-    return detail::make_transform_expr<E, sum_r_transformer>(value);
+    return sum_r_expr<detail::build_type<E>, false>{value};
 }
 
 /*!
@@ -463,10 +476,10 @@ auto sum_r(E&& value) -> detail::stable_transform_helper<E, sum_r_transformer> {
  * \return an expression representing the aggregated expression
  */
 template <typename E>
-auto sum_l(E&& value) -> detail::stable_transform_helper<E, sum_l_transformer> {
+sum_l_expr<detail::build_type<E>, false> sum_l(E&& value) {
     static_assert(is_etl_expr<E>, "etl::sum_l can only be used on ETL expressions");
     static_assert(decay_traits<E>::dimensions() > 1, "Can only use sum_l on matrix");
-    return detail::make_transform_expr<E, sum_l_transformer>(value);
+    return sum_l_expr<detail::build_type<E>, false>{value};
 }
 
 /*!
@@ -476,10 +489,10 @@ auto sum_l(E&& value) -> detail::stable_transform_helper<E, sum_l_transformer> {
  * \return an expression representing the aggregated expression
  */
 template <typename E>
-auto mean_r(E&& value) -> detail::stable_transform_helper<E, mean_r_transformer> {
+sum_r_expr<detail::build_type<E>, true> mean_r(E&& value) {
     static_assert(is_etl_expr<E>, "etl::mean_r can only be used on ETL expressions");
     static_assert(decay_traits<E>::dimensions() > 1, "Can only use mean_r on matrix");
-    return detail::make_transform_expr<E, mean_r_transformer>(value);
+    return sum_r_expr<detail::build_type<E>, true>{value};
 }
 
 /*!
@@ -489,10 +502,10 @@ auto mean_r(E&& value) -> detail::stable_transform_helper<E, mean_r_transformer>
  * \return an expression representing the aggregated expression
  */
 template <typename E>
-auto mean_l(E&& value) -> detail::stable_transform_helper<E, mean_l_transformer> {
+sum_l_expr<detail::build_type<E>, true> mean_l(E&& value) {
     static_assert(is_etl_expr<E>, "etl::mean_l can only be used on ETL expressions");
     static_assert(decay_traits<E>::dimensions() > 1, "Can only use mean_l on matrix");
-    return detail::make_transform_expr<E, mean_l_transformer>(value);
+    return sum_l_expr<detail::build_type<E>, true>{value};
 }
 
 /*!
@@ -679,6 +692,28 @@ value_t<E> asum(E&& values) {
     return detail::asum_impl::apply(values);
 }
 
+/*!
+ * \brief Returns the sum of all the values contained in the given
+ * expression, computed with compensated summation.
+ *
+ * The result is more accurate than the one of etl::sum and does not depend
+ * on the number of threads. The sums of an ACCURATE_SECTION are computed
+ * in the same way.
+ *
+ * \param values The expression to reduce
+ * \return The sum of the values of the expression
+ */
+template <typename E>
+value_t<E> accurate_sum(E&& values) {
+    static_assert(is_etl_expr<E>, "etl::accurate_sum can only be used on ETL expressions");
+    static_assert(is_floating<E>, "etl::accurate_sum is only defined for floating point expressions");
+
+    //Reduction force evaluation
+    force(values);
+
+    return detail::accurate_sum_impl::apply(values);
+}
+
 /*!
  * \brief Returns the mean of all the values contained in the given expression
  * \param values The expression to reduce
@@ -703,12 +738,92 @@ value_t<E> amean(E&& values) {
     return asum(values) / etl::size(values);
 }
 
+/*!
+ * \brief Returns the statistics of all the values contained in the given
+ * expression: mean, variance, minimum and maximum.
+ *
+ * The statistics are all computed in a single pass over the expression.
+ *
+ * \param values The expression to reduce
+ * \return The statistics of the values of the expression
+ */
+template <typename E>
+statistics<value_t<E>> stats(E&& values) {
+    static_assert(is_etl_expr<E>, "etl::stats can only be used on ETL expressions");
+    static_assert(is_floating<E>, "etl::stats is only defined for floating point expressions");
+
+    //Reduction force evaluation
+    force(values);
+
+    return detail::stats_impl::apply(values);
+}
+
+/*!
+ * \brief Computes the mean and the variance of each sub matrix of the
+ * first dimension of the given expression, in a single pass.
+ *
+ * \param values The expression to reduce
+ * \param mean The output vector of means
+ * \param variance The output vector of (population) variances
+ */
+template <typename E, typename M, typename Var>
+void stats_r(E&& values, M&& mean, Var&& variance) {
+    static_assert(all_etl_expr<E, M, Var>, "etl::stats_r can only be used on ETL expressions");
+    static_assert(decay_traits<E>::dimensions() > 1, "Can only use stats_r on matrix");
+    static_assert(is_floating<E>, "etl::stats_r is only defined for floating point expressions");
+
+    cpp_assert(etl::size(mean) == etl::dim<0>(values), "Invalid dimensions for stats_r");
+    cpp_assert(etl::size(variance) == etl::dim<0>(values), "Invalid dimensions for stats_r");
+
+    //Reduction force evaluation
+    force(values);
+
+    detail::stats_r_impl::apply(values, mean, variance);
+}
+
+/*!
+ * \brief Computes the mean and the variance of the given expression over
+ * its first dimension, in a single pass.
+ *
+ * This computes the batch statistics of a batch of samples.
+ *
+ * \param values The expression to reduce
+ * \param mean The output of means
+ * \param variance The output of (population) variances
+ */
+template <typename E, typename M, typename Var>
+void stats_l(E&& values, M&& mean, Var&& variance) {
+    static_assert(all_etl_expr<E, M, Var>, "etl::stats_l can only be used on ETL expressions");
+    static_assert(decay_traits<E>::dimensions() > 1, "Can only use stats_l on matrix");
+    static_assert(is_floating<E>, "etl::stats_l is only defined for floating point expressions");
+
+    cpp_assert(etl::size(mean) * etl::dim<0>(values) == etl::size(values), "Invalid dimensions for stats_l");
+    cpp_assert(etl::size(variance) * etl::dim<0>(values) == etl::size(values), "Invalid dimensions for stats_l");
+
+    //Reduction force evaluation
+    force(values);
+
+    detail::stats_l_impl::apply(values, mean, variance);
+}
+
 /*!
  * \brief Returns the standard deviation of all the values contained in the given expression
  * \param values The expression to reduce
  * \return The standard deviation of the values of the expression
  */
-template <typename E>
+template <typename E, cpp_enable_iff(is_floating<E>)>
+value_t<E> stddev(E&& values) {
+    static_assert(is_etl_expr<E>, "etl::stddev can only be used on ETL expressions");
+
+    return stats(values).stddev();
+}
+
+/*!
+ * \brief Returns the standard deviation of all the values contained in the given expression
+ * \param values The expression to reduce
+ * \return The standard deviation of the values of the expression
+ */
+template <typename E, cpp_disable_iff(is_floating<E>)>
 value_t<E> stddev(E&& values) {
     static_assert(is_etl_expr<E>, "etl::stddev can only be used on ETL expressions");
 
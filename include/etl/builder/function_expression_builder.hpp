@@ -340,9 +340,9 @@ auto softplus(E&& value) -> detail::unary_helper<E, softplus_unary_op> {
  * \return an expression representing the Bernoulli sampling of the given expression
  */
 template <typename E>
-auto bernoulli(const E& value) -> detail::unary_helper<E, bernoulli_unary_op> {
+auto bernoulli(E&& value) -> detail::left_binary_helper_op<E, generator_expr<uniform_generator_op<value_t<E>>>, bernoulli_binary_op<value_t<E>>> {
     static_assert(is_etl_expr<E>, "etl::bernoulli can only be used on ETL expressions");
-    return detail::unary_helper<E, bernoulli_unary_op>{value};
+    return {value, generator_expr<uniform_generator_op<value_t<E>>>(value_t<E>(0.0), value_t<E>(1.0))};
 }
 
 /*!
@@ -361,9 +361,9 @@ auto bernoulli(G& g, E&& value) {
  * \return an expression representing the Reverse Bernoulli sampling of the given expression
  */
 template <typename E>
-auto r_bernoulli(const E& value) -> detail::unary_helper<E, reverse_bernoulli_unary_op> {
+auto r_bernoulli(E&& value) -> detail::left_binary_helper_op<E, generator_expr<uniform_generator_op<value_t<E>>>, reverse_bernoulli_binary_op<value_t<E>>> {
     static_assert(is_etl_expr<E>, "etl::r_bernoulli can only be used on ETL expressions");
-    return detail::unary_helper<E, reverse_bernoulli_unary_op>{value};
+    return {value, generator_expr<uniform_generator_op<value_t<E>>>(value_t<E>(0.0), value_t<E>(1.0))};
 }
 
 /*!
@@ -16,6 +16,7 @@
 #pragma once
 
 #include "etl/impl/cce.hpp"
+#include "etl/impl/batch_norm.hpp"
 
 namespace etl {
 
@@ -79,6 +80,62 @@ convolution_forward(A&& a, B&& b, size_t s1, size_t s2, size_t p1 = 0, size_t p2
     return dyn_conv_4d_valid_expr<detail::build_type<A>, detail::build_type<B>, true>{a, b, s1, s2, p1, p2};
 }
 
+/*!
+ * \brief Dilated Forward convolution for a batch of images with a set of kernels.
+ *
+ * This is the same as the forward convolution, except that the kernels
+ * are dilated, i.e. (D - 1) zeroes are inserted between each of their
+ * elements.
+ *
+ * The 4D matrix a is assumed to be of [N, C, Hi, Wi] dimensions.
+ * The 4D matrix b is assumed to be of [K, C, Hj, Wj] dimensions.
+ * The 4D matrix c is assumed to be of [N, K, (Hi - D1 * (Hj - 1) - 1 + 2 * P1) / S1 + 1, (Wi - D2 * (Wj - 1) - 1 + 2 * P2) / S2 + 1] dimensions.
+ *
+ * \param a An expression containing the batch of images
+ * \param b An expression containing the set of kernels
+ *
+ * \param s1 The stride in the first dimension
+ * \param s2 The stride in the second dimension
+ * \param p1 The padding of the first dimension
+ * \param p2 The padding of the second dimension
+ * \param d1 The dilation of the first dimension
+ * \param d2 The dilation of the second dimension
+ *
+ * \return an expression representing the result of the forward convolution
+ */
+template <typename A, typename B>
+dyn_conv_4d_valid_expr<detail::build_type<A>, detail::build_type<B>, true>
+convolution_forward(A&& a, B&& b, size_t s1, size_t s2, size_t p1, size_t p2, size_t d1, size_t d2) {
+    static_assert(all_etl_expr<A, B>, "Convolution only supported for ETL expressions");
+
+    return dyn_conv_4d_valid_expr<detail::build_type<A>, detail::build_type<B>, true>{a, b, s1, s2, p1, p2, d1, d2};
+}
+
+/*!
+ * \brief Forward convolution for a batch of channels-last images with a set of kernels.
+ *
+ * The 4D matrix a is assumed to be of [N, Hi, Wi, C] dimensions.
+ * The 4D matrix b is assumed to be of [K, Hj, Wj, C] dimensions.
+ * The 4D matrix c is assumed to be of [N, (Hi - Hj + 2 * P1) / S1 + 1, (Wi - Hj + 2 * P2) / S2 + 1, K] dimensions.
+ *
+ * \param a An expression containing the batch of images
+ * \param b An expression containing the set of kernels
+ *
+ * \param s1 The stride in the first dimension
+ * \param s2 The stride in the second dimension
+ * \param p1 The padding of the first dimension
+ * \param p2 The padding of the second dimension
+ *
+ * \return an expression representing the result of the forward convolution
+ */
+template <typename A, typename B>
+dyn_conv_4d_valid_nhwc_expr<detail::build_type<A>, detail::build_type<B>, true>
+convolution_forward_nhwc(A&& a, B&& b, size_t s1 = 1, size_t s2 = 1, size_t p1 = 0, size_t p2 = 0) {
+    static_assert(all_etl_expr<A, B>, "Convolution only supported for ETL expressions");
+
+    return dyn_conv_4d_valid_nhwc_expr<detail::build_type<A>, detail::build_type<B>, true>{a, b, s1, s2, p1, p2};
+}
+
 /*!
  * \brief Backward convolution for a batch of images with a set of kernels.
  *
@@ -550,5 +607,418 @@ value_t<O> cce_error(O&& output, L&& labels, value_t<O> scale) {
     return detail::cce_error_impl::apply(output, labels, scale);
 }
 
+/*!
+ * \brief Returns the Categorical Cross Entropy Loss of the softmax of the
+ * logits, without computing the softmax.
+ *
+ * The labels are either of the same dimensions as the logits or the index
+ * of the label of each row of the logits.
+ *
+ * \param logits The logits, one row per sample
+ * \param labels The labels
+ * \param scale The scale of the loss
+ * \return scale * sum(log(softmax(logits)) >> labels)
+ */
+template <typename O, typename L>
+value_t<O> softmax_cross_entropy(O&& logits, L&& labels, value_t<O> scale) {
+    static_assert(all_etl_expr<O, L>, "etl::softmax_cross_entropy can only be used on ETL expressions");
+    static_assert(decay_traits<O>::dimensions() == 2, "etl::softmax_cross_entropy is only defined for 2D logits");
+    static_assert(decay_traits<L>::dimensions() == 1 || decay_traits<L>::dimensions() == 2, "etl::softmax_cross_entropy needs 1D or 2D labels");
+    static_assert(all_row_major<O, L>, "etl::softmax_cross_entropy needs row-major logits and labels");
+
+    cpp_assert(decay_traits<L>::dimensions() == 2 ? etl::size(labels) == etl::size(logits) : etl::size(labels) == etl::dim<0>(logits),
+               "Invalid labels for softmax_cross_entropy");
+
+    return detail::softmax_cce_impl::apply(logits, labels, scale, nullptr);
+}
+
+/*!
+ * \brief Returns the Categorical Cross Entropy Loss of the softmax of the
+ * logits and write its gradient, softmax(logits) - labels, in the same
+ * pass over the logits.
+ *
+ * The gradient is not multiplied by the scale.
+ *
+ * \param logits The logits, one row per sample
+ * \param labels The labels
+ * \param scale The scale of the loss
+ * \param gradient The output of the gradient, of the same dimensions as the logits
+ * \return scale * sum(log(softmax(logits)) >> labels)
+ */
+template <typename O, typename L, typename G>
+value_t<O> softmax_cross_entropy(O&& logits, L&& labels, value_t<O> scale, G&& gradient) {
+    static_assert(all_etl_expr<O, L, G>, "etl::softmax_cross_entropy can only be used on ETL expressions");
+    static_assert(decay_traits<O>::dimensions() == 2, "etl::softmax_cross_entropy is only defined for 2D logits");
+    static_assert(decay_traits<L>::dimensions() == 1 || decay_traits<L>::dimensions() == 2, "etl::softmax_cross_entropy needs 1D or 2D labels");
+    static_assert(all_row_major<O, L>, "etl::softmax_cross_entropy needs row-major logits and labels");
+    static_assert(is_dma<G> && all_row_major<G>, "etl::softmax_cross_entropy needs a row-major gradient with direct memory access");
+    static_assert(std::is_same<value_t<O>, value_t<G>>::value, "etl::softmax_cross_entropy needs a gradient of the same type as the logits");
+
+    cpp_assert(decay_traits<L>::dimensions() == 2 ? etl::size(labels) == etl::size(logits) : etl::size(labels) == etl::dim<0>(logits),
+               "Invalid labels for softmax_cross_entropy");
+    cpp_assert(etl::size(gradient) == etl::size(logits), "Invalid gradient for softmax_cross_entropy");
+
+    auto loss = detail::softmax_cce_impl::apply(logits, labels, scale, gradient.memory_start());
+
+    gradient.validate_cpu();
+    gradient.invalidate_gpu();
+
+    return loss;
+}
+
+/*!
+ * \brief Batch normalization (training) of a batch of samples.
+ *
+ * The mean and the (population) variance of each feature are computed in a
+ * single pass over x and x is then normalized, scaled and shifted in a
+ * second pass.
+ *
+ * \param x The input, of [B, F] dimensions
+ * \param gamma The scale of each feature
+ * \param beta The shift of each feature
+ * \param y The output, of the same dimensions as x
+ * \param mean The output mean of each feature
+ * \param variance The output variance of each feature
+ * \param eps The epsilon added to the variance
+ */
+template <typename X, typename G, typename Beta, typename Y, typename M, typename Var>
+void batch_norm_2d_train(X&& x, G&& gamma, Beta&& beta, Y&& y, M&& mean, Var&& variance, value_t<X> eps = value_t<X>(1e-5)) {
+    static_assert(all_etl_expr<X, G, Beta, Y, M, Var>, "etl::batch_norm_2d_train can only be used on ETL expressions");
+    static_assert(decay_traits<X>::dimensions() == 2, "etl::batch_norm_2d_train is only defined for 2d input");
+    static_assert(is_floating<X>, "etl::batch_norm_2d_train is only defined for floating point input");
+    static_assert(all_dma<Y, M, Var> && all_row_major<Y>, "etl::batch_norm_2d_train needs outputs with direct memory access");
+    static_assert(all_homogeneous<X, Y, M, Var>, "etl::batch_norm_2d_train needs outputs of the same type as the input");
+
+    const size_t B = etl::dim<0>(x);
+    const size_t C = etl::dim<1>(x);
+    const size_t S = 1;
+
+    cpp_assert(etl::size(gamma) == C && etl::size(beta) == C, "Invalid scale and shift for batch_norm_2d_train");
+    cpp_assert(etl::size(mean) == C && etl::size(variance) == C, "Invalid statistics for batch_norm_2d_train");
+    cpp_assert(etl::size(y) == etl::size(x), "Invalid output for batch_norm_2d_train");
+
+    detail::batch_norm_train_impl::apply(x, gamma, beta, eps, y, mean, variance, B, C, S);
+}
+
+/*!
+ * \brief Batch normalization (inference) of a batch of samples, with the given
+ * statistics (generally the running statistics of the training).
+ *
+ * \param x The input, of [B, F] dimensions
+ * \param gamma The scale of each feature
+ * \param beta The shift of each feature
+ * \param mean The mean of each feature
+ * \param variance The variance of each feature
+ * \param y The output, of the same dimensions as x
+ * \param eps The epsilon added to the variance
+ */
+template <typename X, typename G, typename Beta, typename M, typename Var, typename Y>
+void batch_norm_2d_forward(X&& x, G&& gamma, Beta&& beta, M&& mean, Var&& variance, Y&& y, value_t<X> eps = value_t<X>(1e-5)) {
+    static_assert(all_etl_expr<X, G, Beta, M, Var, Y>, "etl::batch_norm_2d_forward can only be used on ETL expressions");
+    static_assert(decay_traits<X>::dimensions() == 2, "etl::batch_norm_2d_forward is only defined for 2d input");
+    static_assert(is_floating<X>, "etl::batch_norm_2d_forward is only defined for floating point input");
+    static_assert(is_dma<Y> && all_row_major<Y>, "etl::batch_norm_2d_forward needs an output with direct memory access");
+    static_assert(all_homogeneous<X, Y>, "etl::batch_norm_2d_forward needs an output of the same type as the input");
+
+    const size_t B = etl::dim<0>(x);
+    const size_t C = etl::dim<1>(x);
+    const size_t S = 1;
+
+    cpp_assert(etl::size(gamma) == C && etl::size(beta) == C, "Invalid scale and shift for batch_norm_2d_forward");
+    cpp_assert(etl::size(mean) == C && etl::size(variance) == C, "Invalid statistics for batch_norm_2d_forward");
+    cpp_assert(etl::size(y) == etl::size(x), "Invalid output for batch_norm_2d_forward");
+
+    detail::batch_norm_forward_impl::apply(x, gamma, beta, mean, variance, eps, y, B, C, S);
+}
+
+/*!
+ * \brief Backward pass of the batch normalization (training) of a batch of samples.
+ *
+ * The sums of dy and of dy * (x - mean) of each feature are computed in a
+ * single pass and the errors of the input in a second pass.
+ *
+ * \param x The input of the forward pass, of [B, F] dimensions
+ * \param dy The errors of the output of the forward pass
+ * \param gamma The scale of each feature
+ * \param mean The mean of each feature, computed by the forward pass
+ * \param variance The variance of each feature, computed by the forward pass
+ * \param dx The output errors of the input
+ * \param dgamma The output gradients of gamma
+ * \param dbeta The output gradients of beta
+ * \param eps The epsilon added to the variance
+ */
+template <typename X, typename DY, typename G, typename M, typename Var, typename DX, typename DG, typename DB>
+void batch_norm_2d_backward(X&& x, DY&& dy, G&& gamma, M&& mean, Var&& variance, DX&& dx, DG&& dgamma, DB&& dbeta, value_t<X> eps = value_t<X>(1e-5)) {
+    static_assert(all_etl_expr<X, DY, G, M, Var, DX, DG, DB>, "etl::batch_norm_2d_backward can only be used on ETL expressions");
+    static_assert(decay_traits<X>::dimensions() == 2 && decay_traits<DY>::dimensions() == 2, "etl::batch_norm_2d_backward is only defined for 2d input");
+    static_assert(is_floating<X>, "etl::batch_norm_2d_backward is only defined for floating point input");
+    static_assert(all_dma<DX, DG, DB> && all_row_major<DX>, "etl::batch_norm_2d_backward needs outputs with direct memory access");
+    static_assert(all_homogeneous<X, DY, DX, DG, DB>, "etl::batch_norm_2d_backward needs errors and outputs of the same type as the input");
+
+    const size_t B = etl::dim<0>(x);
+    const size_t C = etl::dim<1>(x);
+    const size_t S = 1;
+
+    cpp_assert(etl::size(dy) == etl::size(x) && etl::size(dx) == etl::size(x), "Invalid errors for batch_norm_2d_backward");
+    cpp_assert(etl::size(gamma) == C && etl::size(mean) == C && etl::size(variance) == C, "Invalid parameters for batch_norm_2d_backward");
+    cpp_assert(etl::size(dgamma) == C && etl::size(dbeta) == C, "Invalid gradients for batch_norm_2d_backward");
+
+    detail::batch_norm_backward_impl::apply(x, dy, gamma, mean, variance, eps, dx, dgamma, dbeta, B, C, S);
+}
+
+/*!
+ * \brief Batch normalization (training) of a batch of images.
+ *
+ * The mean and the (population) variance of each channel are computed in a
+ * single pass over x and x is then normalized, scaled and shifted in a
+ * second pass.
+ *
+ * \param x The input, of [B, C, H, W] dimensions
+ * \param gamma The scale of each channel
+ * \param beta The shift of each channel
+ * \param y The output, of the same dimensions as x
+ * \param mean The output mean of each channel
+ * \param variance The output variance of each channel
+ * \param eps The epsilon added to the variance
+ */
+template <typename X, typename G, typename Beta, typename Y, typename M, typename Var>
+void batch_norm_4d_train(X&& x, G&& gamma, Beta&& beta, Y&& y, M&& mean, Var&& variance, value_t<X> eps = value_t<X>(1e-5)) {
+    static_assert(all_etl_expr<X, G, Beta, Y, M, Var>, "etl::batch_norm_4d_train can only be used on ETL expressions");
+    static_assert(decay_traits<X>::dimensions() == 4, "etl::batch_norm_4d_train is only defined for 4d input");
+    static_assert(is_floating<X>, "etl::batch_norm_4d_train is only defined for floating point input");
+    static_assert(all_dma<Y, M, Var> && all_row_major<Y>, "etl::batch_norm_4d_train needs outputs with direct memory access");
+    static_assert(all_homogeneous<X, Y, M, Var>, "etl::batch_norm_4d_train needs outputs of the same type as the input");
+
+    const size_t B = etl::dim<0>(x);
+    const size_t C = etl::dim<1>(x);
+    const size_t S = etl::dim<2>(x) * etl::dim<3>(x);
+
+    cpp_assert(etl::size(gamma) == C && etl::size(beta) == C, "Invalid scale and shift for batch_norm_4d_train");
+    cpp_assert(etl::size(mean) == C && etl::size(variance) == C, "Invalid statistics for batch_norm_4d_train");
+    cpp_assert(etl::size(y) == etl::size(x), "Invalid output for batch_norm_4d_train");
+
+    detail::batch_norm_train_impl::apply(x, gamma, beta, eps, y, mean, variance, B, C, S);
+}
+
+/*!
+ * \brief Batch normalization (inference) of a batch of images, with the given
+ * statistics (generally the running statistics of the training).
+ *
+ * \param x The input, of [B, C, H, W] dimensions
+ * \param gamma The scale of each channel
+ * \param beta The shift of each channel
+ * \param mean The mean of each channel
+ * \param variance The variance of each channel
+ * \param y The output, of the same dimensions as x
+ * \param eps The epsilon added to the variance
+ */
+template <typename X, typename G, typename Beta, typename M, typename Var, typename Y>
+void batch_norm_4d_forward(X&& x, G&& gamma, Beta&& beta, M&& mean, Var&& variance, Y&& y, value_t<X> eps = value_t<X>(1e-5)) {
+    static_assert(all_etl_expr<X, G, Beta, M, Var, Y>, "etl::batch_norm_4d_forward can only be used on ETL expressions");
+    static_assert(decay_traits<X>::dimensions() == 4, "etl::batch_norm_4d_forward is only defined for 4d input");
+    static_assert(is_floating<X>, "etl::batch_norm_4d_forward is only defined for floating point input");
+    static_assert(is_dma<Y> && all_row_major<Y>, "etl::batch_norm_4d_forward needs an output with direct memory access");
+    static_assert(all_homogeneous<X, Y>, "etl::batch_norm_4d_forward needs an output of the same type as the input");
+
+    const size_t B = etl::dim<0>(x);
+    const size_t C = etl::dim<1>(x);
+    const size_t S = etl::dim<2>(x) * etl::dim<3>(x);
+
+    cpp_assert(etl::size(gamma) == C && etl::size(beta) == C, "Invalid scale and shift for batch_norm_4d_forward");
+    cpp_assert(etl::size(mean) == C && etl::size(variance) == C, "Invalid statistics for batch_norm_4d_forward");
+    cpp_assert(etl::size(y) == etl::size(x), "Invalid output for batch_norm_4d_forward");
+
+    detail::batch_norm_forward_impl::apply(x, gamma, beta, mean, variance, eps, y, B, C, S);
+}
+
+/*!
+ * \brief Backward pass of the batch normalization (training) of a batch of images.
+ *
+ * The sums of dy and of dy * (x - mean) of each channel are computed in a
+ * single pass and the errors of the input in a second pass.
+ *
+ * \param x The input of the forward pass, of [B, C, H, W] dimensions
+ * \param dy The errors of the output of the forward pass
+ * \param gamma The scale of each channel
+ * \param mean The mean of each channel, computed by the forward pass
+ * \param variance The variance of each channel, computed by the forward pass
+ * \param dx The output errors of the input
+ * \param dgamma The output gradients of gamma
+ * \param dbeta The output gradients of beta
+ * \param eps The epsilon added to the variance
+ */
+template <typename X, typename DY, typename G, typename M, typename Var, typename DX, typename DG, typename DB>
+void batch_norm_4d_backward(X&& x, DY&& dy, G&& gamma, M&& mean, Var&& variance, DX&& dx, DG&& dgamma, DB&& dbeta, value_t<X> eps = value_t<X>(1e-5)) {
+    static_assert(all_etl_expr<X, DY, G, M, Var, DX, DG, DB>, "etl::batch_norm_4d_backward can only be used on ETL expressions");
+    static_assert(decay_traits<X>::dimensions() == 4 && decay_traits<DY>::dimensions() == 4, "etl::batch_norm_4d_backward is only defined for 4d input");
+    static_assert(is_floating<X>, "etl::batch_norm_4d_backward is only defined for floating point input");
+    static_assert(all_dma<DX, DG, DB> && all_row_major<DX>, "etl::batch_norm_4d_backward needs outputs with direct memory access");
+    static_assert(all_homogeneous<X, DY, DX, DG, DB>, "etl::batch_norm_4d_backward needs errors and outputs of the same type as the input");
+
+    const size_t B = etl::dim<0>(x);
+    const size_t C = etl::dim<1>(x);
+    const size_t S = etl::dim<2>(x) * etl::dim<3>(x);
+
+    cpp_assert(etl::size(dy) == etl::size(x) && etl::size(dx) == etl::size(x), "Invalid errors for batch_norm_4d_backward");
+    cpp_assert(etl::size(gamma) == C && etl::size(mean) == C && etl::size(variance) == C, "Invalid parameters for batch_norm_4d_backward");
+    cpp_assert(etl::size(dgamma) == C && etl::size(dbeta) == C, "Invalid gradients for batch_norm_4d_backward");
+
+    detail::batch_norm_backward_impl::apply(x, dy, gamma, mean, variance, eps, dx, dgamma, dbeta, B, C, S);
+}
+
+/*!
+ * \brief Layer normalization: each row (the last dimension) of x is
+ * normalized to zero mean and unit variance, then scaled and shifted.
+ *
+ * The statistics of a row are computed in a first pass and the row is
+ * normalized, scaled and shifted in a second pass.
+ *
+ * \param x The input
+ * \param gamma The scale of each column
+ * \param beta The shift of each column
+ * \param eps The epsilon added to the variance
+ * \return an expression representing the normalized input
+ */
+template <typename X, typename G, typename Beta>
+layer_norm_expr<detail::build_type<X>, detail::build_type<G>, detail::build_type<Beta>> layer_norm(X&& x, G&& gamma, Beta&& beta, value_t<X> eps = value_t<X>(1e-5)) {
+    static_assert(all_etl_expr<X, G, Beta>, "etl::layer_norm can only be used on ETL expressions");
+    static_assert(decay_traits<X>::dimensions() > 1, "etl::layer_norm is only defined for matrices");
+    static_assert(is_1d<G> && is_1d<Beta>, "etl::layer_norm needs vectors of scales and shifts");
+    static_assert(is_floating<X>, "etl::layer_norm is only defined for floating point input");
+
+    return {x, gamma, beta, eps};
+}
+
+/*!
+ * \brief RMS normalization: each row (the last dimension) of x is
+ * divided by its root mean square, then scaled.
+ *
+ * \param x The input
+ * \param gamma The scale of each column
+ * \param eps The epsilon added to the mean square
+ * \return an expression representing the normalized input
+ */
+template <typename X, typename G>
+rms_norm_expr<detail::build_type<X>, detail::build_type<G>> rms_norm(X&& x, G&& gamma, value_t<X> eps = value_t<X>(1e-5)) {
+    static_assert(all_etl_expr<X, G>, "etl::rms_norm can only be used on ETL expressions");
+    static_assert(decay_traits<X>::dimensions() > 1, "etl::rms_norm is only defined for matrices");
+    static_assert(is_1d<G>, "etl::rms_norm needs a vector of scales");
+    static_assert(is_floating<X>, "etl::rms_norm is only defined for floating point input");
+
+    return {x, gamma, eps};
+}
+
+/*!
+ * \brief Backward pass of the layer normalization.
+ *
+ * The statistics of each row of x are computed again, the row being
+ * then read twice more, from the cache, for the sums of its errors and
+ * for the errors of the input.
+ *
+ * \param x The input of the forward pass
+ * \param dy The errors of the output of the forward pass
+ * \param gamma The scale of each column
+ * \param dx The output errors of the input
+ * \param dgamma The output gradients of gamma
+ * \param dbeta The output gradients of beta
+ * \param eps The epsilon added to the variance
+ */
+template <typename X, typename DY, typename G, typename DX, typename DG, typename DB>
+void layer_norm_backward(X&& x, DY&& dy, G&& gamma, DX&& dx, DG&& dgamma, DB&& dbeta, value_t<X> eps = value_t<X>(1e-5)) {
+    static_assert(all_etl_expr<X, DY, G, DX, DG, DB>, "etl::layer_norm_backward can only be used on ETL expressions");
+    static_assert(decay_traits<X>::dimensions() > 1, "etl::layer_norm_backward is only defined for matrices");
+    static_assert(is_floating<X>, "etl::layer_norm_backward is only defined for floating point input");
+    static_assert(all_dma<DX, DG, DB> && all_row_major<DX>, "etl::layer_norm_backward needs outputs with direct memory access");
+    static_assert(all_homogeneous<X, DY, DX, DG, DB>, "etl::layer_norm_backward needs errors and outputs of the same type as the input");
+
+    const size_t K = etl::dim(x, decay_traits<X>::dimensions() - 1);
+
+    cpp_assert(etl::size(dy) == etl::size(x) && etl::size(dx) == etl::size(x), "Invalid errors for layer_norm_backward");
+    cpp_assert(etl::size(gamma) == K && etl::size(dgamma) == K && etl::size(dbeta) == K, "Invalid parameters for layer_norm_backward");
+
+    detail::layer_norm_backward_impl::apply<false>(x, dy, gamma, eps, dx, dgamma, dbeta);
+}
+
+/*!
+ * \brief Backward pass of the RMS normalization.
+ *
+ * \param x The input of the forward pass
+ * \param dy The errors of the output of the forward pass
+ * \param gamma The scale of each column
+ * \param dx The output errors of the input
+ * \param dgamma The output gradients of gamma
+ * \param eps The epsilon added to the mean square
+ */
+template <typename X, typename DY, typename G, typename DX, typename DG>
+void rms_norm_backward(X&& x, DY&& dy, G&& gamma, DX&& dx, DG&& dgamma, value_t<X> eps = value_t<X>(1e-5)) {
+    static_assert(all_etl_expr<X, DY, G, DX, DG>, "etl::rms_norm_backward can only be used on ETL expressions");
+    static_assert(decay_traits<X>::dimensions() > 1, "etl::rms_norm_backward is only defined for matrices");
+    static_assert(is_floating<X>, "etl::rms_norm_backward is only defined for floating point input");
+    static_assert(all_dma<DX, DG> && all_row_major<DX>, "etl::rms_norm_backward needs outputs with direct memory access");
+    static_assert(all_homogeneous<X, DY, DX, DG>, "etl::rms_norm_backward needs errors and outputs of the same type as the input");
+
+    const size_t K = etl::dim(x, decay_traits<X>::dimensions() - 1);
+
+    cpp_assert(etl::size(dy) == etl::size(x) && etl::size(dx) == etl::size(x), "Invalid errors for rms_norm_backward");
+    cpp_assert(etl::size(gamma) == K && etl::size(dgamma) == K, "Invalid parameters for rms_norm_backward");
+
+    // RMS normalization has no shift, dgamma is passed in place of its gradients
+    detail::layer_norm_backward_impl::apply<true>(x, dy, gamma, eps, dx, dgamma, dgamma);
+}
+
+/*!
+ * \brief Scaled dot-product attention, softmax(q * trans(k) / sqrt(D)) * v.
+ *
+ * The keys are processed in tiles, with an online softmax, so that the
+ * [N, M] matrix of the scores is never stored. The last two dimensions are
+ * the sequence and the features, the other dimensions being independent
+ * heads.
+ *
+ * \param q The queries, of [..., N, D] dimensions
+ * \param k The keys, of [..., M, D] dimensions
+ * \param v The values, of [..., M, Dv] dimensions
+ * \return an expression representing the attention, of [..., N, Dv] dimensions
+ */
+template <typename Q, typename K, typename V>
+attention_expr<detail::build_type<Q>, detail::build_type<K>, detail::build_type<V>> attention(Q&& q, K&& k, V&& v) {
+    static_assert(all_etl_expr<Q, K, V>, "etl::attention can only be used on ETL expressions");
+    static_assert(decay_traits<Q>::dimensions() > 1, "etl::attention is only defined for matrices");
+    static_assert(all_row_major<Q, K, V>, "etl::attention is only defined for row-major inputs");
+    static_assert(is_floating<Q> && all_homogeneous<Q, K, V>, "etl::attention is only defined for floating point inputs of the same type");
+
+    return {q, k, v};
+}
+
+/*!
+ * \brief Backward pass of the scaled dot-product attention.
+ *
+ * The log-sum-exp of the scores of each query is computed again in a
+ * first pass. The tiles of keys are then split between the threads, the
+ * probabilities of a tile being computed again from the log-sum-exp.
+ *
+ * \param q The queries of the forward pass
+ * \param k The keys of the forward pass
+ * \param v The values of the forward pass
+ * \param o The output of the forward pass
+ * \param dy The errors of the output of the forward pass
+ * \param dq The output errors of the queries
+ * \param dk The output errors of the keys
+ * \param dv The output errors of the values
+ */
+template <typename Q, typename K, typename V, typename O, typename DY, typename DQ, typename DK, typename DV>
+void attention_backward(Q&& q, K&& k, V&& v, O&& o, DY&& dy, DQ&& dq, DK&& dk, DV&& dv) {
+    static_assert(all_etl_expr<Q, K, V, O, DY, DQ, DK, DV>, "etl::attention_backward can only be used on ETL expressions");
+    static_assert(decay_traits<Q>::dimensions() > 1, "etl::attention_backward is only defined for matrices");
+    static_assert(all_row_major<Q, K, V, O, DY>, "etl::attention_backward is only defined for row-major inputs");
+    static_assert(is_floating<Q>, "etl::attention_backward is only defined for floating point input");
+    static_assert(all_dma<DQ, DK, DV> && all_row_major<DQ, DK, DV>, "etl::attention_backward needs outputs with direct memory access");
+    static_assert(all_homogeneous<Q, K, V, O, DY, DQ, DK, DV>, "etl::attention_backward needs inputs and outputs of the same type");
+
+    cpp_assert(etl::size(dq) == etl::size(q) && etl::size(dk) == etl::size(k) && etl::size(dv) == etl::size(v), "Invalid errors for attention_backward");
+    cpp_assert(etl::size(o) == etl::size(dy), "Invalid output errors for attention_backward");
+
+    detail::attention_backward_impl::apply(q, k, v, o, dy, dq, dk, dv);
+}
+
 } //end of namespace ml
 } //end of namespace etl
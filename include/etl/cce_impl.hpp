@@ -18,8 +18,9 @@ namespace etl {
  * \brief Enumeration describing the different implementations of CCE
  */
 enum class cce_impl {
-    STD,   ///< Standard implementation
-    EGBLAS ///< GPU implementation
+    STD,    ///< Standard implementation
+    VEC,    ///< Vectorized implementation
+    EGBLAS  ///< GPU implementation
 };
 
 } //end of namespace etl
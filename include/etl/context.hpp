@@ -27,6 +27,7 @@ struct context {
     bool serial   = false; ///< Force serial execution
     bool parallel = false; ///< Force parallel execution
     bool cpu      = false; ///< Force CPU evaluation
+    bool accurate = false; ///< Force accurate (compensated) sums
 
 #ifdef ETL_MANUAL_SELECT
     forced_impl<sum_impl> sum_selector;               ///< Forced selector for sum
@@ -277,6 +278,39 @@ struct cpu_context {
     }
 };
 
+/*!
+ * \brief RAII helper for setting the context to accurate
+ */
+struct accurate_context {
+    bool old_accurate; ///< The previous value of accurate
+
+    /*!
+     * \brief Default construct an accurate context
+     *
+     * This saves the previous accurate value and sets accurate to true
+     */
+    accurate_context() {
+        old_accurate = etl::local_context().accurate;
+        etl::local_context().accurate = true;
+    }
+
+    /*!
+     * \brief Destruct an accurate context
+     *
+     * This restores the accurate state
+     */
+    ~accurate_context() {
+        etl::local_context().accurate = old_accurate;
+    }
+
+    /*!
+     * \brief Does nothing, simple trick for section to be nice
+     */
+    operator bool() {
+        return true;
+    }
+};
+
 #ifdef ETL_MANUAL_SELECT
 
 /*!
@@ -338,6 +372,12 @@ struct selected_context {
  */
 #define CPU_SECTION if (auto etl_cpu_context__ = etl::detail::cpu_context())
 
+/*!
+ * \brief Define the start of an ETL accurate section, in which the sums
+ * of floating point expressions are compensated and reproducible
+ */
+#define ACCURATE_SECTION if (auto etl_accurate_context__ = etl::detail::accurate_context())
+
 #ifdef ETL_MANUAL_SELECT
 
 /*!
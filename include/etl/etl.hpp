@@ -84,8 +84,13 @@
 #include "etl/expr/transpose_expr.hpp"
 #include "etl/expr/bias_batch_mean_2d_expr.hpp"
 #include "etl/expr/bias_batch_mean_4d_expr.hpp"
+#include "etl/expr/sum_r_expr.hpp"
+#include "etl/expr/sum_l_expr.hpp"
+#include "etl/expr/argmax_expr.hpp"
 #include "etl/expr/bias_add_2d_expr.hpp"
 #include "etl/expr/bias_add_4d_expr.hpp"
+#include "etl/expr/bias_add_4d_nhwc_expr.hpp"
+#include "etl/expr/layout_4d_expr.hpp"
 #include "etl/expr/pool_upsample_2d_expr.hpp"
 #include "etl/expr/pool_upsample_3d_expr.hpp"
 #include "etl/expr/dyn_pool_upsample_2d_expr.hpp"
@@ -94,6 +99,7 @@
 #include "etl/expr/dyn_pool_derivative_expr.hpp"
 #include "etl/expr/pool_2d_expr.hpp"
 #include "etl/expr/dyn_pool_2d_expr.hpp"
+#include "etl/expr/dyn_pool_2d_nhwc_expr.hpp"
 #include "etl/expr/pool_3d_expr.hpp"
 #include "etl/expr/dyn_pool_3d_expr.hpp"
 #include "etl/expr/upsample_2d_expr.hpp"
@@ -110,6 +116,7 @@
 #include "etl/expr/outer_product_expr.hpp"
 #include "etl/expr/batch_outer_product_expr.hpp"
 #include "etl/expr/inv_expr.hpp"
+#include "etl/expr/solve_expr.hpp"
 #include "etl/expr/conv_1d_valid_expr.hpp"
 #include "etl/expr/conv_1d_same_expr.hpp"
 #include "etl/expr/conv_1d_full_expr.hpp"
@@ -130,6 +137,7 @@
 #include "etl/expr/dyn_conv_4d_valid_expr.hpp"
 #include "etl/expr/dyn_conv_4d_valid_filter_expr.hpp"
 #include "etl/expr/dyn_conv_4d_valid_back_expr.hpp"
+#include "etl/expr/dyn_conv_4d_valid_nhwc_expr.hpp"
 #include "etl/expr/conv_2d_full_deep_expr.hpp"
 #include "etl/expr/conv_2d_same_deep_expr.hpp"
 #include "etl/expr/conv_2d_valid_deep_expr.hpp"
@@ -144,6 +152,9 @@
 #include "etl/expr/batch_embedding_lookup_expr.hpp"
 #include "etl/expr/embedding_gradients_expr.hpp"
 #include "etl/expr/batch_embedding_gradients_expr.hpp"
+#include "etl/expr/layer_norm_expr.hpp"
+#include "etl/expr/rms_norm_expr.hpp"
+#include "etl/expr/attention_expr.hpp"
 
 // The expressions building
 #include "etl/builder/expression_builder.hpp"
@@ -161,6 +172,7 @@
 #include "etl/expr/unary_expr.hpp"
 #include "etl/expr/generator_expr.hpp"
 #include "etl/expr/optimized_expr.hpp"
+#include "etl/expr/cse_expr.hpp"
 #include "etl/expr/serial_expr.hpp"
 #include "etl/expr/selected_expr.hpp"
 #include "etl/expr/parallel_expr.hpp"
@@ -175,6 +187,12 @@
 // The optimizer
 #include "etl/optimizer.hpp"
 
+// The fused assignments
+#include "etl/assign_many.hpp"
+
+// The row-sparse gradients
+#include "etl/sparse_rows.hpp"
+
 // The value classes implementation
 #include "etl/crtp/expression_able.hpp"
 #include "etl/fast.hpp"
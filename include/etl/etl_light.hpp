@@ -83,6 +83,9 @@
 // The complex expressions
 #include "etl/expr/transpose_expr.hpp"
 #include "etl/expr/batch_softmax_expr.hpp"
+#include "etl/expr/sum_r_expr.hpp"
+#include "etl/expr/sum_l_expr.hpp"
+#include "etl/expr/argmax_expr.hpp"
 
 // The expressions building
 #include "etl/builder/expression_builder.hpp"
@@ -100,6 +103,7 @@
 #include "etl/expr/unary_expr.hpp"
 #include "etl/expr/generator_expr.hpp"
 #include "etl/expr/optimized_expr.hpp"
+#include "etl/expr/cse_expr.hpp"
 #include "etl/expr/serial_expr.hpp"
 #include "etl/expr/selected_expr.hpp"
 #include "etl/expr/parallel_expr.hpp"
@@ -108,6 +112,9 @@
 // The optimizer
 #include "etl/optimizer.hpp"
 
+// The fused assignments
+#include "etl/assign_many.hpp"
+
 // The value classes implementation
 #include "etl/crtp/expression_able.hpp"
 #include "etl/fast.hpp"
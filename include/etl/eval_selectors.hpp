@@ -61,6 +61,19 @@ constexpr vector_mode_t select_vector_mode(){
                                                                                 : vector_mode_t::NONE;
 }
 
+/*!
+ * \brief Select a vector mode for the given mask assignment
+ * \tparam E The boolean expression to assign to the result
+ */
+template <typename E>
+constexpr vector_mode_t select_mask_vector_mode(){
+    return
+          (avx512_enabled && is_mask_vectorizable<vector_mode_t::AVX512, E>) ? vector_mode_t::AVX512
+        : (avx_enabled && is_mask_vectorizable<vector_mode_t::AVX, E>) ? vector_mode_t::AVX
+        : (sse3_enabled && is_mask_vectorizable<vector_mode_t::SSE3, E>) ? vector_mode_t::SSE3
+                                                                        : vector_mode_t::NONE;
+}
+
 //Selectors for assign
 
 /*!
@@ -83,11 +96,29 @@ constexpr bool gpu_assign = all_homogeneous<E, R> && !fast_assign<E, R> && all_g
 template <typename E, typename R>
 constexpr bool vectorized_assign = !fast_assign<E, R> && !gpu_assign<E, R> && are_vectorizable<E, R>;
 
+/*!
+ * \brief Integral constant indicating if a boolean expression can be
+ * assigned through vector masks.
+ */
+template <typename E, typename R>
+constexpr bool mask_assign_no_gpu =
+           vectorize_expr
+        && std::is_same<value_t<R>, bool>::value
+        && has_direct_access<R>
+        && select_mask_vector_mode<E>() != vector_mode_t::NONE;
+
+/*!
+ * \brief Integral constant indicating if a boolean expression can be
+ * assigned through vector masks.
+ */
+template <typename E, typename R>
+constexpr bool mask_assign = !gpu_assign<E, R> && mask_assign_no_gpu<E, R>;
+
 /*!
  * \brief Integral constant indicating if a direct assign is possible
  */
 template <typename E, typename R>
-constexpr bool direct_assign = !gpu_assign<E, R> && !are_vectorizable<E, R> && !has_direct_access<E> && has_direct_access<R>;
+constexpr bool direct_assign = !gpu_assign<E, R> && !are_vectorizable<E, R> && !mask_assign<E, R> && !has_direct_access<E> && has_direct_access<R>;
 
 /*!
  * \brief Integral constant indicating if a standard assign is necessary
@@ -167,7 +198,7 @@ constexpr bool vectorized_assign_no_gpu = !fast_assign_no_gpu<E, R> && are_vecto
  * \brief Integral constant indicating if a direct assign is possible
  */
 template <typename E, typename R>
-constexpr bool direct_assign_no_gpu = !are_vectorizable<E, R> && !has_direct_access<E> && has_direct_access<R>;
+constexpr bool direct_assign_no_gpu = !are_vectorizable<E, R> && !mask_assign_no_gpu<E, R> && !has_direct_access<E> && has_direct_access<R>;
 
 /*!
  * \brief Integral constant indicating if a standard assign is necessary
@@ -293,6 +293,36 @@ namespace standard_evaluator {
         result.invalidate_gpu();
     }
 
+    /*!
+     * \brief Assign the result of the boolean expression to the result.
+     *
+     * The comparisons are computed as vector masks and stored as
+     * booleans, possibly in parallel.
+     *
+     * \param expr The right hand side expression
+     * \param result The left hand side
+     */
+    template <typename E, typename R>
+    void mask_assign_impl(E& expr, R& result) {
+        safe_ensure_cpu_up_to_date(expr);
+        safe_ensure_cpu_up_to_date(result);
+
+        constexpr auto V = detail::select_mask_vector_mode<E>();
+
+        auto batch_fun = [&expr, &result](const size_t first, const size_t last) {
+            detail::VectorizedMaskAssign<V>::apply(result, expr, first, last);
+        };
+
+        if /*constexpr*/ (is_thread_safe<E>) {
+            engine_dispatch_1d(batch_fun, 0, etl::size(result), parallel_threshold);
+        } else {
+            batch_fun(0, etl::size(result));
+        }
+
+        result.validate_cpu();
+        result.invalidate_gpu();
+    }
+
     // Selector versions
 
     /*!
@@ -340,6 +370,14 @@ namespace standard_evaluator {
         vectorized_assign_impl(expr, result);
     }
 
+    /*!
+     * \copydoc assign_evaluate_impl_no_gpu
+     */
+    template <typename E, typename R, cpp_enable_iff(detail::mask_assign_no_gpu<E, R>)>
+    void assign_evaluate_impl_no_gpu(E&& expr, R&& result) {
+        mask_assign_impl(expr, result);
+    }
+
     /*!
      * \brief Assign the result of the expression to the result
      * \param expr The right hand side expression
@@ -394,6 +432,14 @@ namespace standard_evaluator {
         vectorized_assign_impl(expr, result);
     }
 
+    /*!
+     * \copydoc assign_evaluate_impl
+     */
+    template <typename E, typename R, cpp_enable_iff(detail::mask_assign<E, R>)>
+    void assign_evaluate_impl(E&& expr, R&& result) {
+        mask_assign_impl(expr, result);
+    }
+
     // Compound Assign Add functions implementations
 
     /*!
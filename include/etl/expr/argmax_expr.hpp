@@ -0,0 +1,246 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#pragma once
+
+#include "etl/expr/base_temporary_expr.hpp"
+
+#include "etl/impl/std/reduc.hpp"
+#include "etl/impl/vec/reduc.hpp"
+
+namespace etl {
+
+/*!
+ * \brief An expression representing the indices of the maximum (or
+ * minimum) values of each sub matrix of the first dimension of an
+ * expression.
+ *
+ * \tparam A The sub type
+ * \tparam Max Indicates if the maximum is searched instead of the minimum
+ */
+template <typename A, bool Max>
+struct argmax_expr : base_temporary_expr_un<argmax_expr<A, Max>, A> {
+    using value_type = value_t<A>;                           ///< The type of value of the expression
+    using this_type  = argmax_expr<A, Max>;                  ///< The type of this expression
+    using base_type  = base_temporary_expr_un<this_type, A>; ///< The base type
+    using sub_traits = decay_traits<A>;                      ///< The traits of the sub type
+
+    static constexpr auto storage_order = sub_traits::storage_order; ///< The sub storage order
+
+    /*!
+     * \brief Indicates if the temporary expression can be directly evaluated
+     * using only GPU.
+     */
+    static constexpr bool gpu_computable = false;
+
+    /*!
+     * \brief Construct a new expression
+     * \param a The sub expression
+     */
+    explicit argmax_expr(A a) : base_type(a) {
+        //Nothing else to init
+    }
+
+    /*!
+     * \brief Validate the reduction dimensions
+     * \param a The input matrix
+     * \þaram c The output vector
+     */
+    template <typename C, cpp_enable_iff(all_fast<A, C>)>
+    static void check(const A& a, const C& c) {
+        cpp_unused(a);
+        cpp_unused(c);
+
+        static_assert(etl::dimensions<C>() == 1, "The output of argmax is a vector");
+        static_assert(etl::dim<0, A>() == etl::dim<0, C>(), "Invalid dimensions for argmax");
+    }
+
+    /*!
+     * \brief Validate the reduction dimensions
+     * \param a The input matrix
+     * \þaram c The output vector
+     */
+    template <typename C, cpp_disable_iff(all_fast<A, C>)>
+    static void check(const A& a, const C& c) {
+        static_assert(etl::dimensions<C>() == 1, "The output of argmax is a vector");
+
+        cpp_assert(etl::dim<0>(a) == etl::dim<0>(c), "Invalid dimensions for argmax");
+
+        cpp_unused(a);
+        cpp_unused(c);
+    }
+
+    // Assignment functions
+
+    /*!
+     * \brief Assign to a matrix of the same storage order
+     * \param c The expression to which assign
+     */
+    template <typename C>
+    void assign_to(C&& c) const {
+        static_assert(all_etl_expr<A, C>, "argmax only supported for ETL expressions");
+
+        auto& a = this->a();
+
+        standard_evaluator::pre_assign_rhs(a);
+
+        check(a, c);
+
+        a.ensure_cpu_up_to_date();
+
+        if /*constexpr*/ (impl::vec::reduc_possible<A, C>) {
+            impl::vec::argmax<Max>(a, c);
+        } else {
+            impl::standard::argmax<Max>(a, c);
+        }
+    }
+
+    /*!
+     * \brief Add to the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_add_to(L&& lhs) const {
+        std_add_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Sub from the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_sub_to(L&& lhs) const {
+        std_sub_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Multiply the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_mul_to(L&& lhs) const {
+        std_mul_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Divide the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_div_to(L&& lhs) const {
+        std_div_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Modulo the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_mod_to(L&& lhs) const {
+        std_mod_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Print a representation of the expression on the given stream
+     * \param os The output stream
+     * \param expr The expression to print
+     * \return the output stream
+     */
+    friend std::ostream& operator<<(std::ostream& os, const argmax_expr& expr) {
+        if /*constexpr*/ (Max) {
+            return os << "argmax(" << expr._a << ")";
+        } else {
+            return os << "argmin(" << expr._a << ")";
+        }
+    }
+};
+
+/*!
+ * \brief Traits for an argmax expression
+ * \tparam A The sub type
+ * \tparam Max Indicates if the maximum is searched instead of the minimum
+ */
+template <typename A, bool Max>
+struct etl_traits<etl::argmax_expr<A, Max>> {
+    using expr_t     = etl::argmax_expr<A, Max>; ///< The expression type
+    using sub_expr_t = std::decay_t<A>;          ///< The sub expression type
+    using sub_traits = etl_traits<sub_expr_t>;   ///< The sub traits
+    using value_type = value_t<A>;               ///< The value type of the expression
+
+    static constexpr bool is_etl         = true;                      ///< Indicates if the type is an ETL expression
+    static constexpr bool is_transformer = false;                     ///< Indicates if the type is a transformer
+    static constexpr bool is_view        = false;                     ///< Indicates if the type is a view
+    static constexpr bool is_magic_view  = false;                     ///< Indicates if the type is a magic view
+    static constexpr bool is_fast        = sub_traits::is_fast;       ///< Indicates if the expression is fast
+    static constexpr bool is_linear      = false;                     ///< Indicates if the expression is linear
+    static constexpr bool is_thread_safe = true;                      ///< Indicates if the expression is thread safe
+    static constexpr bool is_value       = false;                     ///< Indicates if the expression is of value type
+    static constexpr bool is_direct      = true;                      ///< Indicates if the expression has direct memory access
+    static constexpr bool is_generator   = false;                     ///< Indicates if the expression is a generator
+    static constexpr bool is_padded      = false;                     ///< Indicates if the expression is padded
+    static constexpr bool is_aligned     = true;                      ///< Indicates if the expression is padded
+    static constexpr bool is_temporary   = true;                      ///< Indicates if the expression needs a evaluator visitor
+    static constexpr bool gpu_computable = false;                     ///< Indicates if the expression can be computed on GPU
+    static constexpr order storage_order = sub_traits::storage_order; ///< The expression's storage order
+
+    /*!
+     * \brief Indicates if the expression is vectorizable using the
+     * given vector mode
+     * \tparam V The vector mode
+     */
+    template <vector_mode_t V>
+    static constexpr bool vectorizable = true;
+
+    /*!
+     * \brief Returns the DDth dimension of the expression
+     * \return the DDth dimension of the expression
+     */
+    template <size_t DD>
+    static constexpr size_t dim() {
+        static_assert(DD == 0, "Invalid dimensions access");
+        return decay_traits<A>::template dim<0>();
+    }
+
+    /*!
+     * \brief Returns the dth dimension of the expression
+     * \param e The sub expression
+     * \param d The dimension to get
+     * \return the dth dimension of the expression
+     */
+    static size_t dim(const expr_t& e, size_t d) {
+        cpp_assert(d == 0, "Invalid dimensions access");
+        cpp_unused(d);
+        return etl::dim<0>(e._a);
+    }
+
+    /*!
+     * \brief Returns the size of the expression
+     * \param e The sub expression
+     * \return the size of the expression
+     */
+    static size_t size(const expr_t& e) {
+        return etl::dim<0>(e._a);
+    }
+
+    /*!
+     * \brief Returns the size of the expression
+     * \return the size of the expression
+     */
+    static constexpr size_t size() {
+        return decay_traits<A>::template dim<0>();
+    }
+
+    /*!
+     * \brief Returns the number of dimensions of the expression
+     * \return the number of dimensions of the expression
+     */
+    static constexpr size_t dimensions() {
+        return 1;
+    }
+};
+
+} //end of namespace etl
@@ -0,0 +1,248 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#pragma once
+
+#include "etl/expr/base_temporary_expr.hpp"
+
+#include "etl/impl/attention.hpp"
+
+namespace etl {
+
+/*!
+ * \brief A scaled dot-product attention expression,
+ * softmax(Q * trans(K) / sqrt(D)) * V, computed in blocks without the
+ * matrix of the scores.
+ *
+ * The last two dimensions are the sequence and the features, the other
+ * dimensions being independent heads.
+ *
+ * \tparam A The queries type
+ * \tparam B The keys type
+ * \tparam C The values type
+ */
+template <typename A, typename B, typename C>
+struct attention_expr : base_temporary_expr_tern<attention_expr<A, B, C>, A, B, C> {
+    using value_type = value_t<A>;                                   ///< The type of value of the expression
+    using this_type  = attention_expr<A, B, C>;                      ///< The type of this expression
+    using base_type  = base_temporary_expr_tern<this_type, A, B, C>; ///< The base type
+    using sub_traits = decay_traits<A>;                              ///< The traits of the sub type
+
+    static constexpr auto storage_order = sub_traits::storage_order; ///< The sub storage order
+
+    /*!
+     * \brief Indicates if the temporary expression can be directly evaluated
+     * using only GPU.
+     */
+    static constexpr bool gpu_computable = false;
+
+    /*!
+     * \brief Construct a new expression
+     * \param q The queries
+     * \param k The keys
+     * \param v The values
+     */
+    attention_expr(A q, B k, C v) : base_type(q, k, v) {
+        //Nothing else to init
+    }
+
+    /*!
+     * \brief Validate the dimensions of the expression
+     * \param q The queries
+     * \param k The keys
+     * \param v The values
+     * \param y The output
+     */
+    template <typename L>
+    static void check(const A& q, const B& k, const C& v, const L& y) {
+        static constexpr size_t D = etl::dimensions<A>();
+
+        static_assert(D > 1, "attention is only defined for matrices");
+        static_assert(etl::dimensions<B>() == D && etl::dimensions<C>() == D && etl::dimensions<L>() == D, "Invalid dimensions for attention");
+
+        for (size_t d = 0; d < D - 2; ++d) {
+            cpp_assert(etl::dim(k, d) == etl::dim(q, d) && etl::dim(v, d) == etl::dim(q, d) && etl::dim(y, d) == etl::dim(q, d), "Invalid heads for attention");
+        }
+
+        cpp_assert(etl::dim(k, D - 1) == etl::dim(q, D - 1), "The queries and the keys of attention must have the same features");
+        cpp_assert(etl::dim(v, D - 2) == etl::dim(k, D - 2), "The keys and the values of attention must have the same length");
+        cpp_assert(etl::dim(y, D - 2) == etl::dim(q, D - 2) && etl::dim(y, D - 1) == etl::dim(v, D - 1), "Invalid output dimensions for attention");
+
+        cpp_unused(q);
+        cpp_unused(k);
+        cpp_unused(v);
+        cpp_unused(y);
+    }
+
+    // Assignment functions
+
+    /*!
+     * \brief Assign to a matrix of the same storage order
+     * \param lhs The expression to which assign
+     */
+    template <typename L, cpp_enable_iff(is_dma<L> && decay_traits<L>::storage_order == order::RowMajor)>
+    void assign_to(L&& lhs) const {
+        static_assert(all_etl_expr<A, B, C, L>, "attention only supported for ETL expressions");
+
+        auto& a = this->a();
+        auto& b = this->b();
+        auto& c = this->c();
+
+        check(a, b, c, lhs);
+
+        detail::attention_impl::apply(smart_forward(a), smart_forward(b), smart_forward(c), lhs);
+    }
+
+    /*!
+     * \brief Assign to a matrix without direct memory access
+     * \param lhs The expression to which assign
+     */
+    template <typename L, cpp_disable_iff(is_dma<L> && decay_traits<L>::storage_order == order::RowMajor)>
+    void assign_to(L&& lhs) const {
+        std_assign_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Add to the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template<typename L>
+    void assign_add_to(L&& lhs)  const {
+        std_add_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Sub from the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template<typename L>
+    void assign_sub_to(L&& lhs)  const {
+        std_sub_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Multiply the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template<typename L>
+    void assign_mul_to(L&& lhs)  const {
+        std_mul_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Divide the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template<typename L>
+    void assign_div_to(L&& lhs)  const {
+        std_div_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Modulo the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template<typename L>
+    void assign_mod_to(L&& lhs)  const {
+        std_mod_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Print a representation of the expression on the given stream
+     * \param os The output stream
+     * \param expr The expression to print
+     * \return the output stream
+     */
+    friend std::ostream& operator<<(std::ostream& os, const attention_expr& expr) {
+        return os << "attention(" << expr._a << "," << expr._b << "," << expr._c << ")";
+    }
+};
+
+/*!
+ * \brief Traits for an attention expression
+ * \tparam A The queries type
+ * \tparam B The keys type
+ * \tparam C The values type
+ */
+template <typename A, typename B, typename C>
+struct etl_traits<etl::attention_expr<A, B, C>> {
+    using expr_t       = etl::attention_expr<A, B, C>; ///< The expression type
+    using sub_expr_t   = std::decay_t<A>;              ///< The sub expression type
+    using sub_traits   = etl_traits<sub_expr_t>;       ///< The sub traits
+    using value_traits = decay_traits<C>;              ///< The traits of the values
+    using value_type   = value_t<A>;                   ///< The value type of the expression
+
+    static constexpr bool is_etl         = true;                                         ///< Indicates if the type is an ETL expression
+    static constexpr bool is_transformer = false;                                        ///< Indicates if the type is a transformer
+    static constexpr bool is_view        = false;                                        ///< Indicates if the type is a view
+    static constexpr bool is_magic_view  = false;                                        ///< Indicates if the type is a magic view
+    static constexpr bool is_fast        = sub_traits::is_fast && value_traits::is_fast; ///< Indicates if the expression is fast
+    static constexpr bool is_linear      = true;                                         ///< Indicates if the expression is linear
+    static constexpr bool is_thread_safe = true;                                         ///< Indicates if the expression is thread safe
+    static constexpr bool is_value       = false;                                        ///< Indicates if the expression is of value type
+    static constexpr bool is_direct      = true;                                         ///< Indicates if the expression has direct memory access
+    static constexpr bool is_generator   = false;                                        ///< Indicates if the expression is a generator
+    static constexpr bool is_padded      = false;                                        ///< Indicates if the expression is padded
+    static constexpr bool is_aligned     = true;                                         ///< Indicates if the expression is padded
+    static constexpr bool is_temporary   = true;                                         ///< Indicates if the expression needs a evaluator visitor
+    static constexpr bool gpu_computable = false;                                        ///< Indicates if the expression can be computed on GPU
+    static constexpr order storage_order = sub_traits::storage_order;                    ///< The expression's storage order
+
+    /*!
+     * \brief Indicates if the expression is vectorizable using the
+     * given vector mode
+     * \tparam V The vector mode
+     */
+    template <vector_mode_t V>
+    static constexpr bool vectorizable = true;
+
+    /*!
+     * \brief Returns the DDth dimension of the expression
+     * \return the DDth dimension of the expression
+     */
+    template <size_t DD>
+    static constexpr size_t dim() {
+        return DD == dimensions() - 1 ? value_traits::template dim<DD>() : sub_traits::template dim<DD>();
+    }
+
+    /*!
+     * \brief Returns the dth dimension of the expression
+     * \param e The sub expression
+     * \param d The dimension to get
+     * \return the dth dimension of the expression
+     */
+    static size_t dim(const expr_t& e, size_t d) {
+        return d == dimensions() - 1 ? value_traits::dim(e._c, d) : sub_traits::dim(e._a, d);
+    }
+
+    /*!
+     * \brief Returns the size of the expression
+     * \param e The sub expression
+     * \return the size of the expression
+     */
+    static size_t size(const expr_t& e) {
+        return (sub_traits::size(e._a) / sub_traits::dim(e._a, dimensions() - 1)) * value_traits::dim(e._c, dimensions() - 1);
+    }
+
+    /*!
+     * \brief Returns the size of the expression
+     * \return the size of the expression
+     */
+    static constexpr size_t size() {
+        return (sub_traits::size() / sub_traits::template dim<dimensions() - 1>()) * value_traits::template dim<dimensions() - 1>();
+    }
+
+    /*!
+     * \brief Returns the number of dimensions of the expression
+     * \return the number of dimensions of the expression
+     */
+    static constexpr size_t dimensions() {
+        return sub_traits::dimensions();
+    }
+};
+
+} //end of namespace etl
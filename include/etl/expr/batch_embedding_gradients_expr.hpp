@@ -9,6 +9,8 @@
 
 #include "etl/expr/base_temporary_expr.hpp"
 
+#include "etl/impl/std/embedding.hpp"
+
 namespace etl {
 
 /*!
@@ -96,19 +98,12 @@ struct batch_embedding_gradients_expr : base_temporary_expr_tern<batch_embedding
 
         check(a, b, c, lhs);
 
-        const auto BB = etl::dim<0>(a);
-        const auto I = etl::dim<1>(a);
-
         standard_evaluator::pre_assign_rhs(a);
         standard_evaluator::pre_assign_rhs(b);
 
         lhs = 0;
 
-        for (size_t bb = 0; bb < BB; ++bb) {
-            for (size_t i = 0; i < I; ++i) {
-                lhs(a(bb, i)) += b(bb)(i);
-            }
-        }
+        impl::standard::embedding_gradients(a, b, lhs);
     }
 
     /*!
@@ -9,6 +9,8 @@
 
 #include "etl/expr/base_temporary_expr.hpp"
 
+#include "etl/impl/vec/embedding.hpp"
+
 namespace etl {
 
 /*!
@@ -99,9 +101,13 @@ struct batch_embedding_lookup_expr : base_temporary_expr_bin<batch_embedding_loo
         const auto BB = etl::dim<0>(a);
         const auto I = etl::dim<1>(a);
 
-        for (size_t bb = 0; bb < BB; ++bb) {
-            for (size_t i = 0; i < I; ++i) {
-                lhs(bb)(i) = b(a(bb, i));
+        if /*constexpr*/ (impl::vec::embedding_lookup_possible<B, L>) {
+            impl::vec::embedding_lookup(a, b, lhs);
+        } else {
+            for (size_t bb = 0; bb < BB; ++bb) {
+                for (size_t i = 0; i < I; ++i) {
+                    lhs(bb)(i) = b(a(bb, i));
+                }
             }
         }
     }
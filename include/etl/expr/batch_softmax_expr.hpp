@@ -9,6 +9,8 @@
 
 #include "etl/expr/base_temporary_expr.hpp"
 
+#include "etl/impl/vec/softmax.hpp"
+
 namespace etl {
 
 /*!
@@ -82,6 +84,10 @@ struct batch_softmax_expr : base_temporary_expr_un<batch_softmax_expr<A, Stable>
             return batch_softmax_impl::CUDNN;
         }
 
+        if (impl::vec::batch_softmax_possible<A, C> && storage_order == order::RowMajor) {
+            return batch_softmax_impl::VEC;
+        }
+
         return batch_softmax_impl::STD;
     }
 
@@ -131,15 +137,17 @@ struct batch_softmax_expr : base_temporary_expr_un<batch_softmax_expr<A, Stable>
             } else {
                 impl::cudnn::softmax(a_gpu, c);
             }
+        } else if /*constexpr_select*/ (impl == batch_softmax_impl::VEC) {
+            impl::vec::batch_softmax<Stable>(a, c);
         } else if /*constexpr_select*/ (impl == batch_softmax_impl::STD) {
             if /*constexpr*/ (Stable) {
                 for (size_t i = 0; i < etl::dim<0>(c); ++i) {
-                    c(i) = exp(a(i)) / sum(exp(a(i)));
+                    auto m = max(a(i));
+                    c(i)   = exp(a(i) - m) / sum(exp(a(i) - m));
                 }
             } else {
                 for (size_t i = 0; i < etl::dim<0>(c); ++i) {
-                    auto m = max(a(i));
-                    c(i)   = exp(a(i) - m) / sum(exp(a(i) - m));
+                    c(i) = exp(a(i)) / sum(exp(a(i)));
                 }
             }
         } else {
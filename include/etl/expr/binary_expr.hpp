@@ -37,6 +37,7 @@ private:
     friend struct optimizer<binary_expr>;
     friend struct optimizable<binary_expr>;
     friend struct transformer<binary_expr>;
+    friend struct cse_traits<binary_expr>;
 
 public:
     using value_type        = T;                              ///< The Value type
@@ -133,6 +134,21 @@ public:
         return BinaryOp::template load<V>(lhs.template loadu<V>(i), rhs.template loadu<V>(i));
     }
 
+    /*!
+     * \brief Compute several elements of the boolean expression at once,
+     * as a vector mask.
+     *
+     * This is only available for comparison and logical operators.
+     *
+     * \param i The index at which to perform the operation
+     * \tparam V The vectorization mode to use
+     * \return a vector mask containing several results of the expression
+     */
+    template <typename V = default_vec>
+    ETL_STRONG_INLINE(auto) load_mask(size_t i) const {
+        return BinaryOp::template load_mask<V>(lhs, rhs, i);
+    }
+
     /*!
      * \brief Returns the value at the given position (args...)
      * \param args The position indices
@@ -413,4 +429,21 @@ struct etl_traits<etl::binary_expr<T, LE, BinaryOp, RE>> {
     }
 };
 
+/*!
+ * \brief Specialization of mask_traits for binary_expr of comparison
+ * and logical operators.
+ */
+template <typename T, typename LE, typename BinaryOp, typename RE>
+struct mask_traits<etl::binary_expr<T, LE, BinaryOp, RE>, std::enable_if_t<BinaryOp::mask_op>> {
+    using value_type = typename BinaryOp::template mask_value_type<LE, RE>; ///< The type of the compared values
+
+    /*!
+     * \brief Indicates if the expression can be computed as vector
+     * masks with the given vector mode
+     * \tparam V The vector mode
+     */
+    template <vector_mode_t V>
+    static constexpr bool vectorizable = BinaryOp::template mask_vectorizable<V, LE, RE>;
+};
+
 } //end of namespace etl
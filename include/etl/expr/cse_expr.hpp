@@ -0,0 +1,625 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file cse_expr.hpp
+ * \brief Contains the common sub expression elimination expression.
+ *
+ * The optimizer detects the sub expression types that are repeated in
+ * both sides of a binary expression, for instance sigmoid(x) in
+ * sigmoid(x) >> (1.0 - sigmoid(x)). When all the occurrences use the same
+ * operands, the expression is replaced by a cse_expr that evaluates the
+ * shared sub expression once per element (or per vector) and uses the
+ * value for each of its occurrences.
+*/
+
+#pragma once
+
+namespace etl {
+
+/*!
+ * \brief Traits to find and evaluate the common sub expressions of the
+ * leaves of the expression trees, which are never shared and are read
+ * directly.
+ */
+template <typename E>
+struct cse_leaf_traits {
+    /*!
+     * \brief Indicates if the expression contains a sub expression of
+     * type S
+     */
+    template <typename S>
+    static constexpr bool contains = std::is_same<E, S>::value;
+
+    /*!
+     * \brief The first sub expression of E (in pre order) that is also
+     * contained in O, or void if there are none
+     */
+    template <typename O>
+    using common = void;
+
+    /*!
+     * \brief Test if two leaves are the same. Only the scalars and the
+     * leaves with direct memory access can be compared.
+     * \param a The first leaf
+     * \param b The second leaf
+     * \return true if the two leaves are the same, false otherwise
+     */
+    template <typename EE = E, cpp_enable_iff(is_scalar<EE>)>
+    static bool equal(const E& a, const E& b) {
+        return a.value == b.value;
+    }
+
+    /*!
+     * \copydoc equal
+     */
+    template <typename EE = E, cpp_enable_iff(!is_scalar<EE> && is_dma<EE>)>
+    static bool equal(const E& a, const E& b) {
+        return a.memory_start() == b.memory_start() && etl::size(a) == etl::size(b);
+    }
+
+    /*!
+     * \copydoc equal
+     */
+    template <typename EE = E, cpp_enable_iff(!is_scalar<EE> && !is_dma<EE>)>
+    static bool equal(const E& a, const E& b) {
+        cpp_unused(a);
+        cpp_unused(b);
+        return false;
+    }
+
+    /*!
+     * \brief Test if all the sub expressions of type S of e are the
+     * same as s
+     */
+    template <typename S>
+    static bool same(const E& e, const S& s) {
+        cpp_unused(e);
+        cpp_unused(s);
+        return true;
+    }
+
+    /*!
+     * \brief Returns the first sub expression of type S of e, or nullptr
+     */
+    template <typename S>
+    static const S* find(const E& e) {
+        cpp_unused(e);
+        return nullptr;
+    }
+
+    /*!
+     * \brief Compute the value of e at position i, using s as the value
+     * of the sub expressions of type S
+     */
+    template <typename S>
+    static value_t<E> read(const E& e, size_t i, value_t<S> s) {
+        cpp_unused(s);
+        return e.read_flat(i);
+    }
+
+    /*!
+     * \brief Compute a vector of e at position i, using s as the vector
+     * of the sub expressions of type S
+     */
+    template <typename V, bool Aligned, typename S, typename VT, cpp_enable_iff(Aligned)>
+    static auto load(const E& e, size_t i, VT s) {
+        cpp_unused(s);
+        return e.template load<V>(i);
+    }
+
+    /*!
+     * \copydoc load
+     */
+    template <typename V, bool Aligned, typename S, typename VT, cpp_disable_iff(Aligned)>
+    static auto load(const E& e, size_t i, VT s) {
+        cpp_unused(s);
+        return e.template loadu<V>(i);
+    }
+};
+
+/*!
+ * \brief Traits to find and evaluate the common sub expressions of an
+ * expression.
+ *
+ * The default implementation is used for the leaves of the expression
+ * tree.
+ */
+template <typename E>
+struct cse_traits : cse_leaf_traits<E> {};
+
+namespace detail {
+
+/*!
+ * \brief Indicates if E can be shared by the common sub expression
+ * elimination. Only pure element-wise operations can be shared.
+ */
+template <typename E>
+constexpr bool cse_candidate = decay_traits<E>::is_linear && decay_traits<E>::is_thread_safe && !decay_traits<E>::is_generator;
+
+/*!
+ * \brief Traits to select the shared sub expression of a binary
+ * expression, void if there are none
+ */
+template <typename L, typename R>
+using cse_common = typename cse_traits<std::decay_t<L>>::template common<std::decay_t<R>>;
+
+/*!
+ * \brief Indicates if S is a sub expression of E
+ */
+template <typename S, typename E>
+constexpr bool cse_contains = cse_traits<std::decay_t<E>>::template contains<S>;
+
+/*!
+ * \brief Returns the first candidate among N and the sub expressions
+ * of N that is also contained in O
+ */
+template <typename N, typename O, typename Sub>
+using cse_select = std::conditional_t<cse_candidate<N> && cse_contains<N, O>, N, Sub>;
+
+/*!
+ * \brief Test if all the sub expressions of type S of e are the same as s
+ */
+template <typename S, typename E, cpp_enable_iff(std::is_same<std::decay_t<E>, S>::value)>
+bool cse_same(const E& e, const S& s) {
+    return cse_traits<S>::equal(e, s);
+}
+
+/*!
+ * \copydoc cse_same
+ */
+template <typename S, typename E, cpp_disable_iff(std::is_same<std::decay_t<E>, S>::value)>
+bool cse_same(const E& e, const S& s) {
+    return cse_traits<std::decay_t<E>>::same(e, s);
+}
+
+/*!
+ * \brief Returns the first sub expression of type S of e, or nullptr
+ */
+template <typename S, typename E, cpp_enable_iff(std::is_same<std::decay_t<E>, S>::value)>
+const S* cse_find(const E& e) {
+    return &e;
+}
+
+/*!
+ * \copydoc cse_find
+ */
+template <typename S, typename E, cpp_disable_iff(std::is_same<std::decay_t<E>, S>::value)>
+const S* cse_find(const E& e) {
+    return cse_traits<std::decay_t<E>>::template find<S>(e);
+}
+
+/*!
+ * \brief Compute the value of e at position i, using s as the value of
+ * the sub expressions of type S
+ */
+template <typename S, typename E, cpp_enable_iff(std::is_same<std::decay_t<E>, S>::value)>
+value_t<S> cse_read(const E& e, size_t i, value_t<S> s) {
+    cpp_unused(e);
+    cpp_unused(i);
+    return s;
+}
+
+/*!
+ * \copydoc cse_read
+ */
+template <typename S, typename E, cpp_disable_iff(std::is_same<std::decay_t<E>, S>::value)>
+value_t<E> cse_read(const E& e, size_t i, value_t<S> s) {
+    return cse_traits<std::decay_t<E>>::template read<S>(e, i, s);
+}
+
+/*!
+ * \brief Compute a vector of e at position i, using s as the vector of
+ * the sub expressions of type S
+ */
+template <typename V, bool Aligned, typename S, typename E, typename VT, cpp_enable_iff(std::is_same<std::decay_t<E>, S>::value)>
+ETL_STRONG_INLINE(VT) cse_load(const E& e, size_t i, VT s) {
+    cpp_unused(e);
+    cpp_unused(i);
+    return s;
+}
+
+/*!
+ * \copydoc cse_load
+ */
+template <typename V, bool Aligned, typename S, typename E, typename VT, cpp_disable_iff(std::is_same<std::decay_t<E>, S>::value)>
+ETL_STRONG_INLINE(VT) cse_load(const E& e, size_t i, VT s) {
+    return cse_traits<std::decay_t<E>>::template load<V, Aligned, S>(e, i, s);
+}
+
+} //end of namespace detail
+
+/*!
+ * \copydoc cse_traits
+ *
+ * Specialization for unary_expr
+ */
+template <typename T, typename Expr, typename UnaryOp>
+struct cse_traits<unary_expr<T, Expr, UnaryOp>> {
+    using expr_t = unary_expr<T, Expr, UnaryOp>; ///< The type of the expression
+
+    /*! \copydoc cse_leaf_traits::contains */
+    template <typename S>
+    static constexpr bool contains = std::is_same<expr_t, S>::value || detail::cse_contains<S, Expr>;
+
+    /*! \copydoc cse_leaf_traits::common */
+    template <typename O>
+    using common = detail::cse_select<expr_t, O, detail::cse_common<Expr, O>>;
+
+    /*! \copydoc cse_leaf_traits::equal */
+    static bool equal(const expr_t& a, const expr_t& b) {
+        return cse_traits<std::decay_t<Expr>>::equal(a.value, b.value);
+    }
+
+    /*! \copydoc cse_leaf_traits::same */
+    template <typename S>
+    static bool same(const expr_t& e, const S& s) {
+        return detail::cse_same(e.value, s);
+    }
+
+    /*! \copydoc cse_leaf_traits::find */
+    template <typename S>
+    static const S* find(const expr_t& e) {
+        return detail::cse_find<S>(e.value);
+    }
+
+    /*! \copydoc cse_leaf_traits::read */
+    template <typename S>
+    static T read(const expr_t& e, size_t i, value_t<S> s) {
+        return UnaryOp::apply(detail::cse_read<S>(e.value, i, s));
+    }
+
+    /*! \copydoc cse_leaf_traits::load */
+    template <typename V, bool Aligned, typename S, typename VT>
+    static ETL_STRONG_INLINE(VT) load(const expr_t& e, size_t i, VT s) {
+        return UnaryOp::template load<V>(detail::cse_load<V, Aligned, S>(e.value, i, s));
+    }
+};
+
+/*!
+ * \copydoc cse_traits
+ *
+ * Specialization for the views, which are leaves
+ */
+template <typename T, typename Expr>
+struct cse_traits<unary_expr<T, Expr, identity_op>> : cse_leaf_traits<unary_expr<T, Expr, identity_op>> {};
+
+/*!
+ * \copydoc cse_traits
+ *
+ * Specialization for the transformers, which are leaves
+ */
+template <typename T, typename Expr>
+struct cse_traits<unary_expr<T, Expr, transform_op>> : cse_leaf_traits<unary_expr<T, Expr, transform_op>> {};
+
+/*!
+ * \copydoc cse_traits
+ *
+ * Specialization for the stateful operators, which are leaves and never
+ * shared
+ */
+template <typename T, typename Expr, typename Op>
+struct cse_traits<unary_expr<T, Expr, stateful_op<Op>>> : cse_leaf_traits<unary_expr<T, Expr, stateful_op<Op>>> {};
+
+/*!
+ * \copydoc cse_traits
+ *
+ * Specialization for binary_expr
+ */
+template <typename T, typename LeftExpr, typename BinaryOp, typename RightExpr>
+struct cse_traits<binary_expr<T, LeftExpr, BinaryOp, RightExpr>> {
+    using expr_t = binary_expr<T, LeftExpr, BinaryOp, RightExpr>; ///< The type of the expression
+
+    /*! \copydoc cse_leaf_traits::contains */
+    template <typename S>
+    static constexpr bool contains = std::is_same<expr_t, S>::value || detail::cse_contains<S, LeftExpr> || detail::cse_contains<S, RightExpr>;
+
+    /*! \copydoc cse_leaf_traits::common */
+    template <typename O>
+    using common = detail::cse_select<
+        expr_t, O,
+        std::conditional_t<
+            std::is_same<detail::cse_common<LeftExpr, O>, void>::value,
+            detail::cse_common<RightExpr, O>,
+            detail::cse_common<LeftExpr, O>>>;
+
+    /*! \copydoc cse_leaf_traits::equal */
+    static bool equal(const expr_t& a, const expr_t& b) {
+        return cse_traits<std::decay_t<LeftExpr>>::equal(a.lhs, b.lhs) && cse_traits<std::decay_t<RightExpr>>::equal(a.rhs, b.rhs);
+    }
+
+    /*! \copydoc cse_leaf_traits::same */
+    template <typename S>
+    static bool same(const expr_t& e, const S& s) {
+        return detail::cse_same(e.lhs, s) && detail::cse_same(e.rhs, s);
+    }
+
+    /*! \copydoc cse_leaf_traits::find */
+    template <typename S>
+    static const S* find(const expr_t& e) {
+        auto* l = detail::cse_find<S>(e.lhs);
+        return l ? l : detail::cse_find<S>(e.rhs);
+    }
+
+    /*! \copydoc cse_leaf_traits::read */
+    template <typename S>
+    static T read(const expr_t& e, size_t i, value_t<S> s) {
+        return BinaryOp::apply(detail::cse_read<S>(e.lhs, i, s), detail::cse_read<S>(e.rhs, i, s));
+    }
+
+    /*! \copydoc cse_leaf_traits::load */
+    template <typename V, bool Aligned, typename S, typename VT>
+    static ETL_STRONG_INLINE(VT) load(const expr_t& e, size_t i, VT s) {
+        return BinaryOp::template load<V>(detail::cse_load<V, Aligned, S>(e.lhs, i, s), detail::cse_load<V, Aligned, S>(e.rhs, i, s));
+    }
+
+    /*!
+     * \brief The sub expression shared by both sides of the expression,
+     * void if there are none
+     */
+    using shared_t = detail::cse_common<LeftExpr, RightExpr>;
+
+    /*!
+     * \brief Indicates if the expression may have a common sub
+     * expression
+     */
+    static constexpr bool possible = !std::is_same<shared_t, void>::value && decay_traits<expr_t>::is_linear;
+
+    /*!
+     * \brief Test if the shared sub expression of the given expression
+     * can be eliminated, i.e. if all its occurrences use the same operands
+     * \param e The expression to test
+     * \return true if the common sub expression can be eliminated
+     */
+    template <bool B = possible, cpp_enable_iff(B)>
+    static bool is(const expr_t& e) {
+        auto* s = detail::cse_find<shared_t>(e.lhs);
+        return s && detail::cse_same(e.lhs, *s) && detail::cse_same(e.rhs, *s);
+    }
+
+    /*!
+     * \copydoc is
+     */
+    template <bool B = possible, cpp_disable_iff(B)>
+    static bool is(const expr_t& e) {
+        cpp_unused(e);
+        return false;
+    }
+
+    /*!
+     * \brief Build the expression eliminating the shared sub expression
+     * of the given expression and pass it to the builder
+     * \param builder The builder to use
+     * \param e The expression to transform
+     */
+    template <typename Builder, bool B = possible, cpp_enable_iff(B)>
+    static void transform(Builder builder, const expr_t& e) {
+        builder(cse_expr<expr_t, shared_t>(e, *detail::cse_find<shared_t>(e.lhs)));
+    }
+
+    /*!
+     * \copydoc transform
+     */
+    template <typename Builder, bool B = possible, cpp_disable_iff(B)>
+    static void transform(Builder builder, const expr_t& e) {
+        cpp_unused(builder);
+        cpp_unused(e);
+    }
+};
+
+/*!
+ * \brief An expression evaluating its common sub expression of type S
+ * once per element and per vector.
+ *
+ * \tparam Expr The type of the expression
+ * \tparam S The type of the shared sub expression
+ */
+template <typename Expr, typename S>
+struct cse_expr final :
+        dim_testable<cse_expr<Expr, S>>,
+        value_testable<cse_expr<Expr, S>>,
+        iterable<cse_expr<Expr, S>>
+{
+    using expr_t            = Expr;                             ///< The wrapped expression type
+    using value_type        = value_t<Expr>;                    ///< The value type
+    using memory_type       = void;                             ///< The memory type
+    using const_memory_type = void;                             ///< The const memory type
+    using this_type         = cse_expr<Expr, S>;                ///< The type of this expression
+    using iterator          = etl::iterator<const this_type>;   ///< The iterator type
+    using const_iterator    = etl::iterator<const this_type>;   ///< The const iterator type
+
+    /*!
+     * \brief The vectorization type for V
+     */
+    template <typename V = default_vec>
+    using vec_type = typename V::template vec_type<value_type>;
+
+private:
+    Expr value; ///< The expression
+    S shared;   ///< The shared sub expression
+
+    friend struct wrapper_traits<cse_expr>;
+
+public:
+    //Cannot be constructed with no args
+    cse_expr() = delete;
+
+    /*!
+     * \brief Construct a new cse_expr
+     * \param l The expression
+     * \param s The shared sub expression
+     */
+    cse_expr(Expr l, const S& s)
+            : value(std::forward<Expr>(l)), shared(s) {
+        //Nothing else to init
+    }
+
+    //Expresison can be copied and moved
+    cse_expr(const cse_expr& e) = default;
+    cse_expr(cse_expr&& e) noexcept = default;
+
+    //Expressions are invariant
+    cse_expr& operator=(const cse_expr& e) = delete;
+    cse_expr& operator=(cse_expr&& e) = delete;
+
+    /*!
+     * \brief Test if this expression aliases with the given expression
+     * \param other The other expression to test
+     * \return true if the two expressions aliases, false otherwise
+     */
+    template <typename E>
+    bool alias(const E& other) const noexcept {
+        return value.alias(other);
+    }
+
+    /*!
+     * \brief Returns the element at the given index
+     * \param i The index
+     * \return the value at the given index.
+     */
+    value_type operator[](size_t i) const {
+        return read_flat(i);
+    }
+
+    /*!
+     * \brief Returns the value at the given index
+     * This function never alters the state of the container.
+     * \param i The index
+     * \return the value at the given index.
+     */
+    value_type read_flat(size_t i) const {
+        return cse_traits<std::decay_t<Expr>>::template read<S>(value, i, shared.read_flat(i));
+    }
+
+    /*!
+     * \brief Perform several operations at once.
+     * \param i The index at which to perform the operation
+     * \tparam V The vectorization mode to use
+     * \return a vector containing several results of the expression
+     */
+    template <typename V = default_vec>
+    ETL_STRONG_INLINE(vec_type<V>) load(size_t i) const {
+        return cse_traits<std::decay_t<Expr>>::template load<V, true, S>(value, i, shared.template load<V>(i));
+    }
+
+    /*!
+     * \brief Perform several operations at once.
+     * \param i The index at which to perform the operation
+     * \tparam V The vectorization mode to use
+     * \return a vector containing several results of the expression
+     */
+    template <typename V = default_vec>
+    ETL_STRONG_INLINE(vec_type<V>) loadu(size_t i) const {
+        return cse_traits<std::decay_t<Expr>>::template load<V, false, S>(value, i, shared.template loadu<V>(i));
+    }
+
+    // Assignment functions
+
+    /*!
+     * \brief Assign to the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_to(L&& lhs) const {
+        std_assign_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Add to the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_add_to(L&& lhs) const {
+        std_add_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Sub from the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_sub_to(L&& lhs) const {
+        std_sub_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Multiply the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_mul_to(L&& lhs) const {
+        std_mul_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Divide the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_div_to(L&& lhs) const {
+        std_div_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Modulo the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_mod_to(L&& lhs) const {
+        std_mod_evaluate(*this, lhs);
+    }
+
+    // Internals
+
+    /*!
+     * \brief Apply the given visitor to this expression and its descendants.
+     * \param visitor The visitor to apply
+     */
+    void visit(detail::evaluator_visitor& visitor) const {
+        value.visit(visitor);
+        shared.visit(visitor);
+    }
+
+    /*!
+     * \brief Ensures that the GPU memory is allocated and that the GPU memory
+     * is up to date (to undefined value).
+     */
+    void ensure_cpu_up_to_date() const {
+        value.ensure_cpu_up_to_date();
+    }
+
+    /*!
+     * \brief Copy back from the GPU to the expression memory if
+     * necessary.
+     */
+    void ensure_gpu_up_to_date() const {
+        value.ensure_gpu_up_to_date();
+    }
+
+    /*!
+     * \brief Prints the type of the expression to the stream
+     * \param os The output stream
+     * \param expr The expression to print
+     * \return the output stream
+     */
+    friend std::ostream& operator<<(std::ostream& os, const cse_expr& expr) {
+        return os << "CSE(" << expr.value << ")";
+    }
+};
+
+/*!
+ * \brief Specilization of the traits for cse_expr
+ *
+ * The expression uses the same traits as its expression, but is never
+ * computed on GPU.
+ */
+template <typename Expr, typename S>
+struct etl_traits<etl::cse_expr<Expr, S>> : wrapper_traits<etl::cse_expr<Expr, S>> {
+    static constexpr bool gpu_computable = false; ///< Indicates if the expression can be computed on GPU
+};
+
+} //end of namespace etl
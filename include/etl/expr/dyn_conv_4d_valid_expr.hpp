@@ -37,12 +37,15 @@ struct dyn_conv_4d_valid_expr : base_temporary_expr_bin<dyn_conv_4d_valid_expr<A
     const size_t s2; ///< The stride of the second dimension
     const size_t p1; ///< The padding of the first dimension
     const size_t p2; ///< The padding of the second dimension
+    const size_t d1; ///< The dilation of the first dimension
+    const size_t d2; ///< The dilation of the second dimension
 
     /*!
      * \brief Construct a new expression
      * \param a The sub expression
      */
-    explicit dyn_conv_4d_valid_expr(A a, B b, size_t s1, size_t s2, size_t p1, size_t p2) : base_type(a, b), s1(s1), s2(s2), p1(p1), p2(p2) {
+    explicit dyn_conv_4d_valid_expr(A a, B b, size_t s1, size_t s2, size_t p1, size_t p2, size_t d1 = 1, size_t d2 = 1)
+            : base_type(a, b), s1(s1), s2(s2), p1(p1), p2(p2), d1(d1), d2(d2) {
         //Nothing else to init
     }
 
@@ -61,8 +64,8 @@ struct dyn_conv_4d_valid_expr : base_temporary_expr_bin<dyn_conv_4d_valid_expr<A
         cpp_assert(etl::dim(conv, 1) == etl::dim(kernel, 0), "Invalid dimensions for conv4_valid");
         cpp_assert(etl::dim(input, 1) == etl::dim(kernel, 1), "Invalid dimensions for conv4_valid");
 
-        cpp_assert(etl::dim(conv, 2) == (etl::dim(input, 2) - etl::dim(kernel, 2) + 2 * p1) / s1 + 1, "Invalid dimensions for conv4_valid");
-        cpp_assert(etl::dim(conv, 3) == (etl::dim(input, 3) - etl::dim(kernel, 3) + 2 * p2) / s2 + 1, "Invalid dimensions for conv4_valid");
+        cpp_assert(etl::dim(conv, 2) == (etl::dim(input, 2) - (etl::dim(kernel, 2) - 1) * d1 - 1 + 2 * p1) / s1 + 1, "Invalid dimensions for conv4_valid");
+        cpp_assert(etl::dim(conv, 3) == (etl::dim(input, 3) - (etl::dim(kernel, 3) - 1) * d2 - 1 + 2 * p2) / s2 + 1, "Invalid dimensions for conv4_valid");
 
         cpp_unused(input);
         cpp_unused(kernel);
@@ -83,9 +86,9 @@ struct dyn_conv_4d_valid_expr : base_temporary_expr_bin<dyn_conv_4d_valid_expr<A
         check(a, b, c);
 
         if /*constexpr*/ (Flipped){
-            detail::dyn_conv4_valid_flipped_impl::apply(a, b, c, s1, s2, p1, p2);
+            detail::dyn_conv4_valid_flipped_impl::apply(a, b, c, s1, s2, p1, p2, d1, d2);
         } else {
-            detail::dyn_conv4_valid_impl::apply(a, b, c, s1, s2, p1, p2);
+            detail::dyn_conv4_valid_impl::apply(a, b, c, s1, s2, p1, p2, d1, d2);
         }
     }
 
@@ -194,9 +197,9 @@ struct etl_traits<etl::dyn_conv_4d_valid_expr<A, B, Flipped>> {
         } else if (d == 1){
             return etl::dim(e._b, 0);
         } else if (d == 2){
-            return (etl::dim(e._a, 2) - etl::dim(e._b, 2) + 2 * e.p1) / e.s1 + 1;
+            return (etl::dim(e._a, 2) - (etl::dim(e._b, 2) - 1) * e.d1 - 1 + 2 * e.p1) / e.s1 + 1;
         } else {
-            return (etl::dim(e._a, 3) - etl::dim(e._b, 3) + 2 * e.p2) / e.s2 + 1;
+            return (etl::dim(e._a, 3) - (etl::dim(e._b, 3) - 1) * e.d2 - 1 + 2 * e.p2) / e.s2 + 1;
         }
     }
 
@@ -206,7 +209,7 @@ struct etl_traits<etl::dyn_conv_4d_valid_expr<A, B, Flipped>> {
      * \return the size of the expression
      */
     static size_t size(const expr_t& e) {
-        return etl::dim(e._a, 0) * etl::dim(e._b, 0) * ((etl::dim(e._a, 2) - etl::dim(e._b, 2) + 2 * e.p1) / e.s1 + 1) * ((etl::dim(e._a, 3) - etl::dim(e._b, 3) + 2 * e.p2) / e.s2 + 1);
+        return etl::dim(e._a, 0) * etl::dim(e._b, 0) * dim(e, 2) * dim(e, 3);
     }
 
     /*!
@@ -235,6 +238,29 @@ dyn_conv_4d_valid_expr<detail::build_type<A>, detail::build_type<B>, false> conv
     return dyn_conv_4d_valid_expr<detail::build_type<A>, detail::build_type<B>, false>{a, b, s1, s2, p1, p2};
 }
 
+/*!
+ * \brief Creates an expression representing the dilated valid 4d convolution of a and b
+ *
+ * The kernel is dilated by inserting (d - 1) zeroes between each of its
+ * elements.
+ *
+ * \param a The input expression
+ * \param b The kernel expression
+ * \param s1 The first dimension stride
+ * \param s2 The second dimension stride
+ * \param p1 The first dimension padding (left and right)
+ * \param p2 The second dimension padding (top and bottom)
+ * \param d1 The first dimension dilation
+ * \param d2 The second dimension dilation
+ * \return an expression representing the dilated valid 4d convolution of a and b
+ */
+template <typename A, typename B>
+dyn_conv_4d_valid_expr<detail::build_type<A>, detail::build_type<B>, false> conv_4d_valid(A&& a, B&& b, size_t s1, size_t s2, size_t p1, size_t p2, size_t d1, size_t d2){
+    static_assert(all_etl_expr<A, B>, "Convolution only supported for ETL expressions");
+
+    return dyn_conv_4d_valid_expr<detail::build_type<A>, detail::build_type<B>, false>{a, b, s1, s2, p1, p2, d1, d2};
+}
+
 /*!
  * \brief Creates an expression representing the valid 4d convolution of a and b, the result will be stored in c
  * \param a The input expression
@@ -272,6 +298,29 @@ dyn_conv_4d_valid_expr<detail::build_type<A>, detail::build_type<B>, true> conv_
     return dyn_conv_4d_valid_expr<detail::build_type<A>, detail::build_type<B>, true>{a, b, s1, s2, p1, p2};
 }
 
+/*!
+ * \brief Creates an expression representing the dilated valid 4d convolution of a and b, with flipped kernels
+ *
+ * The kernel is dilated by inserting (d - 1) zeroes between each of its
+ * elements.
+ *
+ * \param a The input expression
+ * \param b The kernel expression
+ * \param s1 The first dimension stride
+ * \param s2 The second dimension stride
+ * \param p1 The first dimension padding (left and right)
+ * \param p2 The second dimension padding (top and bottom)
+ * \param d1 The first dimension dilation
+ * \param d2 The second dimension dilation
+ * \return an expression representing the dilated valid 4d convolution of a and b
+ */
+template <typename A, typename B>
+dyn_conv_4d_valid_expr<detail::build_type<A>, detail::build_type<B>, true> conv_4d_valid_flipped(A&& a, B&& b, size_t s1, size_t s2, size_t p1, size_t p2, size_t d1, size_t d2){
+    static_assert(all_etl_expr<A, B>, "Convolution only supported for ETL expressions");
+
+    return dyn_conv_4d_valid_expr<detail::build_type<A>, detail::build_type<B>, true>{a, b, s1, s2, p1, p2, d1, d2};
+}
+
 /*!
  * \brief Creates an expression representing the valid 4d convolution of a and b, the result will be stored in c
  * \param a The input expression
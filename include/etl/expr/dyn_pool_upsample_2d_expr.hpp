@@ -116,6 +116,11 @@ public:
 
                     return forced;
 
+                // VEC is only available for channels-last (NHWC) pooling
+                case pool_impl::VEC:
+                    std::cerr << "Forced selection to VEC pool implementation, but not possible for this expression" << std::endl; //COVERAGE_EXCLUDE_LINE
+                    return select_default_impl<R>(local_context().cpu); //COVERAGE_EXCLUDE_LINE
+
                 //In other cases, simply use the forced impl
                 default:
                     return forced;
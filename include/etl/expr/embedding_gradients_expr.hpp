@@ -9,6 +9,8 @@
 
 #include "etl/expr/base_temporary_expr.hpp"
 
+#include "etl/impl/std/embedding.hpp"
+
 namespace etl {
 
 /*!
@@ -72,7 +74,7 @@ struct embedding_gradients_expr : base_temporary_expr_tern<embedding_gradients_e
 
         static_assert(etl::dimensions<A>() == 1, "The input of embedding_gradients is a 1d matrix");
         static_assert(etl::dimensions<B>() == 2, "The vocabulary input of embedding_gradients is a 2d matrix");
-        static_assert(etl::dimensions<lhs>() == 2, "The output of embedding_gradients is 2d matrix");
+        static_assert(etl::dimensions<L>() == 2, "The output of embedding_gradients is 2d matrix");
 
         cpp_assert(etl::dim<0>(a) == etl::dim<0>(b), "Invalid dimensions for embedding_gradients");
         cpp_assert(etl::dim<1>(b) == etl::dim<1>(lhs), "Invalid dimensions for embedding_gradients");
@@ -94,16 +96,12 @@ struct embedding_gradients_expr : base_temporary_expr_tern<embedding_gradients_e
 
         check(a, b, c, lhs);
 
-        const auto I = etl::dim<0>(a);
-
         standard_evaluator::pre_assign_rhs(a);
         standard_evaluator::pre_assign_rhs(b);
 
         lhs = 0;
 
-        for (size_t i = 0; i < I; ++i) {
-            lhs(a(i)) += b(i);
-        }
+        impl::standard::embedding_gradients(a, b, lhs);
     }
 
     /*!
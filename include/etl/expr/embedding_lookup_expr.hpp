@@ -9,6 +9,8 @@
 
 #include "etl/expr/base_temporary_expr.hpp"
 
+#include "etl/impl/vec/embedding.hpp"
+
 namespace etl {
 
 /*!
@@ -96,8 +98,12 @@ struct embedding_lookup_expr : base_temporary_expr_bin<embedding_lookup_expr<A,
         standard_evaluator::pre_assign_rhs(a);
         standard_evaluator::pre_assign_rhs(b);
 
-        for (size_t i = 0; i < I; ++i) {
-            lhs(i) = b(a(i));
+        if /*constexpr*/ (impl::vec::embedding_lookup_possible<B, L>) {
+            impl::vec::embedding_lookup(a, b, lhs);
+        } else {
+            for (size_t i = 0; i < I; ++i) {
+                lhs(i) = b(a(i));
+            }
         }
     }
 
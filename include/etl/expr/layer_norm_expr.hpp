@@ -0,0 +1,240 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#pragma once
+
+#include "etl/expr/base_temporary_expr.hpp"
+
+#include "etl/impl/layer_norm.hpp"
+
+namespace etl {
+
+/*!
+ * \brief A layer normalization expression: each row (last dimension) of
+ * the input is normalized, scaled and shifted.
+ *
+ * \tparam A The input type
+ * \tparam G The scale type
+ * \tparam B The shift type
+ */
+template <typename A, typename G, typename B>
+struct layer_norm_expr : base_temporary_expr_tern<layer_norm_expr<A, G, B>, A, G, B> {
+    using value_type = value_t<A>;                                   ///< The type of value of the expression
+    using this_type  = layer_norm_expr<A, G, B>;                     ///< The type of this expression
+    using base_type  = base_temporary_expr_tern<this_type, A, G, B>; ///< The base type
+    using sub_traits = decay_traits<A>;                              ///< The traits of the sub type
+
+    static constexpr auto storage_order = sub_traits::storage_order; ///< The sub storage order
+
+    /*!
+     * \brief Indicates if the temporary expression can be directly evaluated
+     * using only GPU.
+     */
+    static constexpr bool gpu_computable = false;
+
+    const value_type eps; ///< The epsilon added to the variance
+
+    /*!
+     * \brief Construct a new expression
+     * \param a The input
+     * \param gamma The scale
+     * \param beta The shift
+     * \param eps The epsilon added to the variance
+     */
+    layer_norm_expr(A a, G gamma, B beta, value_type eps) : base_type(a, gamma, beta), eps(eps) {
+        //Nothing else to init
+    }
+
+    /*!
+     * \brief Validate the dimensions of the expression
+     * \param a The input matrix
+     * \param gamma The scale
+     * \param beta The shift
+     * \param c The output matrix
+     */
+    template <typename L>
+    static void check(const A& a, const G& gamma, const B& beta, const L& c) {
+        static_assert(etl::dimensions<A>() == etl::dimensions<L>(), "The output of layer_norm has the dimensions of the input");
+        static_assert(etl::dimensions<G>() == 1, "The scale of layer_norm is a vector");
+
+        cpp_assert(etl::size(a) == etl::size(c), "Invalid dimensions for layer_norm");
+        cpp_assert(etl::size(gamma) == etl::dim(a, etl::dimensions<A>() - 1), "Invalid dimensions for layer_norm");
+        cpp_assert(etl::size(beta) == etl::dim(a, etl::dimensions<A>() - 1), "Invalid dimensions for layer_norm");
+
+        cpp_unused(a);
+        cpp_unused(gamma);
+        cpp_unused(beta);
+        cpp_unused(c);
+    }
+
+    // Assignment functions
+
+    /*!
+     * \brief Assign to a matrix of the same storage order
+     * \param lhs The expression to which assign
+     */
+    template <typename L, cpp_enable_iff(is_dma<L> && decay_traits<L>::storage_order == order::RowMajor)>
+    void assign_to(L&& lhs) const {
+        static_assert(all_etl_expr<A, G, B, L>, "layer_norm only supported for ETL expressions");
+
+        auto& a = this->a();
+        auto& b = this->b();
+        auto& c = this->c();
+
+        check(a, b, c, lhs);
+
+        detail::layer_norm_impl::apply<false>(smart_forward(a), smart_forward(b), smart_forward(c), eps, lhs);
+    }
+
+    /*!
+     * \brief Assign to a matrix without direct memory access
+     * \param lhs The expression to which assign
+     */
+    template <typename L, cpp_disable_iff(is_dma<L> && decay_traits<L>::storage_order == order::RowMajor)>
+    void assign_to(L&& lhs) const {
+        std_assign_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Add to the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template<typename L>
+    void assign_add_to(L&& lhs)  const {
+        std_add_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Sub from the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template<typename L>
+    void assign_sub_to(L&& lhs)  const {
+        std_sub_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Multiply the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template<typename L>
+    void assign_mul_to(L&& lhs)  const {
+        std_mul_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Divide the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template<typename L>
+    void assign_div_to(L&& lhs)  const {
+        std_div_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Modulo the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template<typename L>
+    void assign_mod_to(L&& lhs)  const {
+        std_mod_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Print a representation of the expression on the given stream
+     * \param os The output stream
+     * \param expr The expression to print
+     * \return the output stream
+     */
+    friend std::ostream& operator<<(std::ostream& os, const layer_norm_expr& expr) {
+        return os << "layer_norm(" << expr._a << "," << expr._b << "," << expr._c << ")";
+    }
+};
+
+/*!
+ * \brief Traits for a layer_norm expression
+ * \tparam A The input type
+ * \tparam G The scale type
+ * \tparam B The shift type
+ */
+template <typename A, typename G, typename B>
+struct etl_traits<etl::layer_norm_expr<A, G, B>> {
+    using expr_t     = etl::layer_norm_expr<A, G, B>; ///< The expression type
+    using sub_expr_t = std::decay_t<A>;               ///< The sub expression type
+    using sub_traits = etl_traits<sub_expr_t>;        ///< The sub traits
+    using value_type = value_t<A>;                    ///< The value type of the expression
+
+    static constexpr bool is_etl         = true;                                 ///< Indicates if the type is an ETL expression
+    static constexpr bool is_transformer = false;                                ///< Indicates if the type is a transformer
+    static constexpr bool is_view        = false;                                ///< Indicates if the type is a view
+    static constexpr bool is_magic_view  = false;                                ///< Indicates if the type is a magic view
+    static constexpr bool is_fast        = sub_traits::is_fast;                  ///< Indicates if the expression is fast
+    static constexpr bool is_linear      = true;                                 ///< Indicates if the expression is linear
+    static constexpr bool is_thread_safe = true;                                 ///< Indicates if the expression is thread safe
+    static constexpr bool is_value       = false;                                ///< Indicates if the expression is of value type
+    static constexpr bool is_direct      = true;                                 ///< Indicates if the expression has direct memory access
+    static constexpr bool is_generator   = false;                                ///< Indicates if the expression is a generator
+    static constexpr bool is_padded      = false;                                ///< Indicates if the expression is padded
+    static constexpr bool is_aligned     = true;                                 ///< Indicates if the expression is padded
+    static constexpr bool is_temporary   = true;                                 ///< Indicates if the expression needs a evaluator visitor
+    static constexpr bool gpu_computable = false;                                ///< Indicates if the expression can be computed on GPU
+    static constexpr order storage_order = sub_traits::storage_order;            ///< The expression's storage order
+
+    /*!
+     * \brief Indicates if the expression is vectorizable using the
+     * given vector mode
+     * \tparam V The vector mode
+     */
+    template <vector_mode_t V>
+    static constexpr bool vectorizable = true;
+
+    /*!
+     * \brief Returns the DDth dimension of the expression
+     * \return the DDth dimension of the expression
+     */
+    template <size_t DD>
+    static constexpr size_t dim() {
+        return sub_traits::template dim<DD>();
+    }
+
+    /*!
+     * \brief Returns the dth dimension of the expression
+     * \param e The sub expression
+     * \param d The dimension to get
+     * \return the dth dimension of the expression
+     */
+    static size_t dim(const expr_t& e, size_t d) {
+        return sub_traits::dim(e._a, d);
+    }
+
+    /*!
+     * \brief Returns the size of the expression
+     * \param e The sub expression
+     * \return the size of the expression
+     */
+    static size_t size(const expr_t& e) {
+        return sub_traits::size(e._a);
+    }
+
+    /*!
+     * \brief Returns the size of the expression
+     * \return the size of the expression
+     */
+    static constexpr size_t size() {
+        return sub_traits::size();
+    }
+
+    /*!
+     * \brief Returns the number of dimensions of the expression
+     * \return the number of dimensions of the expression
+     */
+    static constexpr size_t dimensions() {
+        return sub_traits::dimensions();
+    }
+};
+
+} //end of namespace etl
@@ -0,0 +1,247 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#pragma once
+
+#include "etl/expr/base_temporary_expr.hpp"
+
+//Get the implementations
+#include "etl/impl/nhwc.hpp"
+
+namespace etl {
+
+/*!
+ * \brief A layout conversion expression between NCHW and NHWC.
+ * \tparam A The converted type
+ * \tparam NHWC true if the conversion is from NCHW to NHWC, false if it is from NHWC to NCHW
+ */
+template <typename A, bool NHWC>
+struct layout_4d_expr : base_temporary_expr_un<layout_4d_expr<A, NHWC>, A, false> {
+    using value_type = value_t<A>;                                  ///< The type of value of the expression
+    using this_type  = layout_4d_expr<A, NHWC>;                     ///< The type of this expression
+    using base_type  = base_temporary_expr_un<this_type, A, false>; ///< The base type
+    using sub_traits = decay_traits<A>;                             ///< The traits of the sub type
+
+    static constexpr auto storage_order = sub_traits::storage_order; ///< The sub storage order
+
+    /*!
+     * \brief Indicates if the temporary expression can be directly evaluated
+     * using only GPU.
+     */
+    static constexpr bool gpu_computable = false;
+
+    /*!
+     * \brief Construct a new expression
+     * \param a The sub expression
+     */
+    explicit layout_4d_expr(A a) : base_type(a) {
+        //Nothing else to init
+    }
+
+    /*!
+     * \brief Validate the conversion dimensions
+     * \param a The input matrix
+     * \param c The output matrix
+     */
+    template <typename C>
+    static void check(const A& a, const C& c) {
+        static_assert(etl::dimensions<A>() == 4, "The input of the layout conversion is a 4D matrix");
+        static_assert(etl::dimensions<C>() == 4, "The output of the layout conversion is a 4D matrix");
+
+        cpp_assert(etl::dim(a, 0) == etl::dim(c, 0), "Invalid dimensions for layout conversion");
+
+        if (NHWC) {
+            cpp_assert(etl::dim(a, 1) == etl::dim(c, 3), "Invalid dimensions for layout conversion");
+            cpp_assert(etl::dim(a, 2) == etl::dim(c, 1), "Invalid dimensions for layout conversion");
+            cpp_assert(etl::dim(a, 3) == etl::dim(c, 2), "Invalid dimensions for layout conversion");
+        } else {
+            cpp_assert(etl::dim(a, 3) == etl::dim(c, 1), "Invalid dimensions for layout conversion");
+            cpp_assert(etl::dim(a, 1) == etl::dim(c, 2), "Invalid dimensions for layout conversion");
+            cpp_assert(etl::dim(a, 2) == etl::dim(c, 3), "Invalid dimensions for layout conversion");
+        }
+
+        cpp_unused(a);
+        cpp_unused(c);
+    }
+
+    // Assignment functions
+
+    /*!
+     * \brief Assign to a matrix of the same storage order
+     * \param c The expression to which assign
+     */
+    template<typename C>
+    void assign_to(C&& c)  const {
+        static_assert(all_etl_expr<A, C>, "Layout conversion only supported for ETL expressions");
+
+        auto& a = this->a();
+
+        check(a, c);
+
+        if (NHWC) {
+            impl::standard::convert_layout_4d<true>(smart_forward(a), c, etl::dim(a, 1), etl::dim(a, 2) * etl::dim(a, 3));
+        } else {
+            impl::standard::convert_layout_4d<false>(smart_forward(a), c, etl::dim(a, 3), etl::dim(a, 1) * etl::dim(a, 2));
+        }
+    }
+
+    /*!
+     * \brief Add to the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template<typename L>
+    void assign_add_to(L&& lhs)  const {
+        std_add_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Sub from the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template<typename L>
+    void assign_sub_to(L&& lhs)  const {
+        std_sub_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Multiply the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template<typename L>
+    void assign_mul_to(L&& lhs)  const {
+        std_mul_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Divide the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template<typename L>
+    void assign_div_to(L&& lhs)  const {
+        std_div_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Modulo the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template<typename L>
+    void assign_mod_to(L&& lhs)  const {
+        std_mod_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Print a representation of the expression on the given stream
+     * \param os The output stream
+     * \param expr The expression to print
+     * \return the output stream
+     */
+    friend std::ostream& operator<<(std::ostream& os, const layout_4d_expr& expr) {
+        return os << (NHWC ? "nchw_to_nhwc(" : "nhwc_to_nchw(") << expr._a << ")";
+    }
+};
+
+/*!
+ * \brief Traits for a layout conversion expression
+ * \tparam A The converted sub type
+ */
+template <typename A, bool NHWC>
+struct etl_traits<etl::layout_4d_expr<A, NHWC>> {
+    using expr_t     = etl::layout_4d_expr<A, NHWC>; ///< The expression type
+    using sub_expr_t = std::decay_t<A>;              ///< The sub expression type
+    using sub_traits = etl_traits<sub_expr_t>;       ///< The sub traits
+    using value_type = value_t<A>;                   ///< The value type of the expression
+
+    static constexpr bool is_etl         = true;                      ///< Indicates if the type is an ETL expression
+    static constexpr bool is_transformer = false;                     ///< Indicates if the type is a transformer
+    static constexpr bool is_view        = false;                     ///< Indicates if the type is a view
+    static constexpr bool is_magic_view  = false;                     ///< Indicates if the type is a magic view
+    static constexpr bool is_fast        = false;                     ///< Indicates if the expression is fast
+    static constexpr bool is_linear      = false;                     ///< Indicates if the expression is linear
+    static constexpr bool is_thread_safe = true;                      ///< Indicates if the expression is thread safe
+    static constexpr bool is_value       = false;                     ///< Indicates if the expression is of value type
+    static constexpr bool is_direct      = true;                      ///< Indicates if the expression has direct memory access
+    static constexpr bool is_generator   = false;                     ///< Indicates if the expression is a generator
+    static constexpr bool is_padded      = false;                     ///< Indicates if the expression is padded
+    static constexpr bool is_aligned     = true;                      ///< Indicates if the expression is padded
+    static constexpr bool is_temporary   = true;                      ///< Indicates if the expression needs a evaluator visitor
+    static constexpr bool gpu_computable = false;                     ///< Indicates if the expression can be computed on GPU
+    static constexpr order storage_order = sub_traits::storage_order; ///< The expression's storage order
+
+    /*!
+     * \brief Indicates if the expression is vectorizable using the
+     * given vector mode
+     * \tparam V The vector mode
+     */
+    template <vector_mode_t V>
+    static constexpr bool vectorizable = true;
+
+    /*!
+     * \brief Returns the dth dimension of the expression
+     * \param e The sub expression
+     * \param d The dimension to get
+     * \return the dth dimension of the expression
+     */
+    static size_t dim(const expr_t& e, size_t d) {
+        if (d == 0) {
+            return etl::dim(e._a, 0);
+        }
+
+        // NCHW -> NHWC: (1, 2, 3) <- (2, 3, 1)
+        // NHWC -> NCHW: (1, 2, 3) <- (3, 1, 2)
+        if (NHWC) {
+            return etl::dim(e._a, d == 3 ? 1 : d + 1);
+        } else {
+            return etl::dim(e._a, d == 1 ? 3 : d - 1);
+        }
+    }
+
+    /*!
+     * \brief Returns the size of the expression
+     * \param e The sub expression
+     * \return the size of the expression
+     */
+    static size_t size(const expr_t& e) {
+        return etl::size(e._a);
+    }
+
+    /*!
+     * \brief Returns the number of dimensions of the expression
+     * \return the number of dimensions of the expression
+     */
+    static constexpr size_t dimensions() {
+        return 4;
+    }
+};
+
+/*!
+ * \brief Convert the given [N, C, H, W] expression into the channels-last [N, H, W, C] layout
+ * \param value The 4D expression
+ * \return an expression representing the converted matrix
+ */
+template <typename E>
+layout_4d_expr<detail::build_type<E>, true> nchw_to_nhwc(E&& value) {
+    static_assert(is_etl_expr<E>, "etl::nchw_to_nhwc can only be used on ETL expressions");
+    static_assert(is_4d<E>, "etl::nchw_to_nhwc is only defined for 4D input");
+
+    return layout_4d_expr<detail::build_type<E>, true>{value};
+}
+
+/*!
+ * \brief Convert the given channels-last [N, H, W, C] expression into the [N, C, H, W] layout
+ * \param value The 4D expression
+ * \return an expression representing the converted matrix
+ */
+template <typename E>
+layout_4d_expr<detail::build_type<E>, false> nhwc_to_nchw(E&& value) {
+    static_assert(is_etl_expr<E>, "etl::nhwc_to_nchw can only be used on ETL expressions");
+    static_assert(is_4d<E>, "etl::nhwc_to_nchw is only defined for 4D input");
+
+    return layout_4d_expr<detail::build_type<E>, false>{value};
+}
+
+} //end of namespace etl
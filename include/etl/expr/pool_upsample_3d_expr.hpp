@@ -141,6 +141,11 @@ struct pool_upsample_3d_expr : base_temporary_expr_tern<pool_upsample_3d_expr<A,
 
                     return forced;
 
+                // VEC is only available for channels-last (NHWC) pooling
+                case pool_impl::VEC:
+                    std::cerr << "Forced selection to VEC pool implementation, but not possible for this expression" << std::endl; //COVERAGE_EXCLUDE_LINE
+                    return select_default_impl<R>(local_context().cpu); //COVERAGE_EXCLUDE_LINE
+
                 //In other cases, simply use the forced impl
                 default:
                     return forced;
@@ -0,0 +1,258 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#pragma once
+
+#include "etl/expr/base_temporary_expr.hpp"
+
+#include "etl/impl/decomposition.hpp"
+
+namespace etl {
+
+/*!
+ * \brief An expression representing the solution of a linear system
+ * A * X = B
+ * \tparam A The type of the matrix of the system
+ * \tparam B The type of the right hand sides
+ * \tparam Impl The implementation of the solver
+ */
+template <typename A, typename B, typename Impl>
+struct solve_expr : base_temporary_expr_bin<solve_expr<A, B, Impl>, A, B> {
+    using value_type   = value_t<A>;                              ///< The type of value of the expression
+    using this_type    = solve_expr<A, B, Impl>;                  ///< The type of this expression
+    using base_type    = base_temporary_expr_bin<this_type, A, B>; ///< The base type
+    using right_traits = decay_traits<B>;                         ///< The traits of the right hand sides
+
+    static constexpr auto storage_order = right_traits::storage_order; ///< The sub storage order
+
+    /*!
+     * \brief Indicates if the temporary expression can be directly evaluated
+     * using only GPU.
+     */
+    static constexpr bool gpu_computable = false;
+
+    /*!
+     * \brief Construct a new expression
+     * \param a The matrix of the system
+     * \param b The right hand sides
+     */
+    explicit solve_expr(A a, B b) : base_type(a, b) {
+        //Nothing else to init
+    }
+
+    // Assignment functions
+
+    /*!
+     * \brief Assign to a matrix of the same storage order
+     * \param c The expression to which assign
+     */
+    template<typename C>
+    void assign_to(C&& c)  const {
+        static_assert(all_etl_expr<A, B, C>, "solve only supported for ETL expressions");
+        static_assert(etl::dimensions<B>() == etl::dimensions<C>(), "solve must be assigned to an expression of the dimensionality of B");
+
+        auto& a = this->a();
+        auto& b = this->b();
+
+        Impl::apply(smart_forward(a), smart_forward(b), c);
+    }
+
+    /*!
+     * \brief Add to the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template<typename L>
+    void assign_add_to(L&& lhs)  const {
+        std_add_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Sub from the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template<typename L>
+    void assign_sub_to(L&& lhs)  const {
+        std_sub_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Multiply the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template<typename L>
+    void assign_mul_to(L&& lhs)  const {
+        std_mul_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Divide the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template<typename L>
+    void assign_div_to(L&& lhs)  const {
+        std_div_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Modulo the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template<typename L>
+    void assign_mod_to(L&& lhs)  const {
+        std_mod_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Print a representation of the expression on the given stream
+     * \param os The output stream
+     * \param expr The expression to print
+     * \return the output stream
+     */
+    friend std::ostream& operator<<(std::ostream& os, const solve_expr& expr) {
+        return os << Impl::name() << "(" << expr._a << ", " << expr._b << ")";
+    }
+};
+
+/*!
+ * \brief Traits for a solve expression
+ * \tparam A The type of the matrix of the system
+ * \tparam B The type of the right hand sides
+ * \tparam Impl The implementation of the solver
+ */
+template <typename A, typename B, typename Impl>
+struct etl_traits<etl::solve_expr<A, B, Impl>> {
+    using expr_t       = etl::solve_expr<A, B, Impl>; ///< The expression type
+    using left_expr_t  = std::decay_t<A>;            ///< The left sub expression type
+    using right_expr_t = std::decay_t<B>;            ///< The right sub expression type
+    using left_traits  = etl_traits<left_expr_t>;    ///< The left sub traits
+    using right_traits = etl_traits<right_expr_t>;   ///< The right sub traits
+    using value_type   = value_t<A>;                 ///< The value type of the expression
+
+    static constexpr bool is_etl          = true;                                          ///< Indicates if the type is an ETL expression
+    static constexpr bool is_transformer  = false;                                         ///< Indicates if the type is a transformer
+    static constexpr bool is_view         = false;                                         ///< Indicates if the type is a view
+    static constexpr bool is_magic_view   = false;                                         ///< Indicates if the type is a magic view
+    static constexpr bool is_fast         = left_traits::is_fast && right_traits::is_fast; ///< Indicates if the expression is fast
+    static constexpr bool is_linear       = false;                                         ///< Indicates if the expression is linear
+    static constexpr bool is_thread_safe  = true;                                          ///< Indicates if the expression is thread safe
+    static constexpr bool is_value        = false;                                         ///< Indicates if the expression is of value type
+    static constexpr bool is_direct       = true;                                          ///< Indicates if the expression has direct memory access
+    static constexpr bool is_generator    = false;                                         ///< Indicates if the expression is a generator
+    static constexpr bool is_padded       = false;                                         ///< Indicates if the expression is padded
+    static constexpr bool is_aligned      = true;                                          ///< Indicates if the expression is padded
+    static constexpr bool is_temporary    = true;                                          ///< Indicates if the expression needs a evaluator visitor
+    static constexpr bool gpu_computable  = false;                                         ///< Indicates if the expression can be computed on GPU
+    static constexpr order storage_order  = right_traits::storage_order;                   ///< The expression's storage order
+
+    /*!
+     * \brief Indicates if the expression is vectorizable using the
+     * given vector mode
+     * \tparam V The vector mode
+     */
+    template <vector_mode_t V>
+    static constexpr bool vectorizable = true;
+
+    /*!
+     * \brief Returns the DDth dimension of the expression
+     * \return the DDth dimension of the expression
+     */
+    template <size_t DD>
+    static constexpr size_t dim() {
+        return DD == 0 ? decay_traits<A>::template dim<1>()
+                       : decay_traits<B>::template dim<DD>();
+    }
+
+    /*!
+     * \brief Returns the dth dimension of the expression
+     * \param e The sub expression
+     * \param d The dimension to get
+     * \return the dth dimension of the expression
+     */
+    static size_t dim(const expr_t& e, size_t d) {
+        if (d == 0){
+            return etl::dim(e._a, 1);
+        } else {
+            return etl::dim(e._b, d);
+        }
+    }
+
+    /*!
+     * \brief Returns the size of the expression
+     * \param e The sub expression
+     * \return the size of the expression
+     */
+    static size_t size(const expr_t& e) {
+        return etl::dim(e._a, 1) * (etl::size(e._b) / etl::dim(e._b, 0));
+    }
+
+    /*!
+     * \brief Returns the size of the expression
+     * \return the size of the expression
+     */
+    static constexpr size_t size() {
+        return decay_traits<A>::template dim<1>() * (decay_traits<B>::size() / decay_traits<B>::template dim<0>());
+    }
+
+    /*!
+     * \brief Returns the number of dimensions of the expression
+     * \return the number of dimensions of the expression
+     */
+    static constexpr size_t dimensions() {
+        return decay_traits<B>::dimensions();
+    }
+};
+
+/*!
+ * \brief Creates an expression representing the solution X of the
+ * linear system A * X = B.
+ *
+ * B can be a vector or a matrix of several right hand sides. Square
+ * systems are solved with the LU decomposition and overdetermined
+ * systems are solved in the least-squares sense with the QR
+ * decomposition.
+ *
+ * \param a The matrix of the system
+ * \param b The right hand sides
+ * \return an expression representing the solution of the system
+ */
+template <typename A, typename B>
+solve_expr<detail::build_type<A>, detail::build_type<B>, detail::solve_impl> solve(A&& a, B&& b) {
+    static_assert(all_etl_expr<A, B>, "solve only supported for ETL expressions");
+    static_assert(is_2d<A>, "solve is only defined for 2D matrices");
+    static_assert(is_1d<B> || is_2d<B>, "solve is only defined for 1D or 2D right hand sides");
+
+    cpp_assert(etl::dim<0>(a) >= etl::dim<1>(a), "solve is not defined for underdetermined systems");
+    cpp_assert(etl::dim<0>(a) == etl::dim<0>(b), "Invalid dimensions for solve");
+
+    return solve_expr<detail::build_type<A>, detail::build_type<B>, detail::solve_impl>{a, b};
+}
+
+/*!
+ * \brief Creates an expression representing the solution X of the
+ * linear system A * X = B, with A symmetric positive definite.
+ *
+ * The system is solved with the Cholesky decomposition, which is about
+ * twice faster than the LU decomposition. If A is not positive definite,
+ * the system is solved with the LU decomposition.
+ *
+ * \param a The symmetric positive definite matrix of the system
+ * \param b The right hand sides
+ * \return an expression representing the solution of the system
+ */
+template <typename A, typename B>
+solve_expr<detail::build_type<A>, detail::build_type<B>, detail::cholesky_solve_impl> cholesky_solve(A&& a, B&& b) {
+    static_assert(all_etl_expr<A, B>, "cholesky_solve only supported for ETL expressions");
+    static_assert(is_2d<A>, "cholesky_solve is only defined for 2D matrices");
+    static_assert(is_1d<B> || is_2d<B>, "cholesky_solve is only defined for 1D or 2D right hand sides");
+
+    cpp_assert(etl::dim<0>(a) == etl::dim<1>(a), "cholesky_solve is only defined for square systems");
+    cpp_assert(etl::dim<0>(a) == etl::dim<0>(b), "Invalid dimensions for cholesky_solve");
+
+    return solve_expr<detail::build_type<A>, detail::build_type<B>, detail::cholesky_solve_impl>{a, b};
+}
+
+} //end of namespace etl
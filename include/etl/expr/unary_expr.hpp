@@ -115,6 +115,7 @@ private:
     friend struct optimizer<unary_expr>;
     friend struct optimizable<unary_expr>;
     friend struct transformer<unary_expr>;
+    friend struct cse_traits<unary_expr>;
 
 public:
     using value_type        = T;                              ///< The value type
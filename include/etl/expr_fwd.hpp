@@ -18,6 +18,9 @@ struct optimizer;
 template <typename Expr>
 struct transformer;
 
+template <typename Expr>
+struct cse_traits;
+
 struct identity_op;
 
 struct transform_op;
@@ -37,6 +40,9 @@ class generator_expr;
 template <typename Expr>
 struct optimized_expr;
 
+template <typename Expr, typename S>
+struct cse_expr;
+
 template <typename Expr>
 struct serial_expr;
 
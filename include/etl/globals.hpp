@@ -641,6 +641,23 @@ bool qr(AT& A, QT& Q, RT& R) {
     return true;
 }
 
+/*!
+ * \brief Decomposition the symmetric positive definite matrix so that
+ * A = L * L^T
+ * \param A The A matrix (nxn)
+ * \param L The L matrix (Lower Triangular nxn)
+ * \return true if the decomposition suceeded, false otherwise
+ */
+template <typename AT, typename LT>
+bool cholesky(const AT& A, LT& L) {
+    // All matrices must be square and of the same dimension
+    if (!is_square(A) || !is_square(L) || etl::dim(A, 0) != etl::dim(L, 0)) {
+        return false;
+    }
+
+    return detail::cholesky_impl::apply(A, L);
+}
+
 /*!
  * \brief Shuffle all the elements of an ETL vector or matrix (considered as
  * array)
@@ -0,0 +1,111 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Selector for the scaled dot-product attention implementations.
+ *
+ * The last two dimensions of the inputs are the sequence and the features,
+ * all the other dimensions being flattened into independent heads.
+ */
+
+#pragma once
+
+//Include the implementations
+#include "etl/impl/std/attention.hpp"
+#include "etl/impl/vec/attention.hpp"
+
+namespace etl {
+
+namespace detail {
+
+/*!
+ * \brief Attention implementation
+ */
+struct attention_impl {
+    /*!
+     * \brief Compute softmax(Q * trans(K) / sqrt(D)) * V into y, for each head
+     */
+    template <typename Q, typename K, typename V, typename Y>
+    static void apply(const Q& q_raw, const K& k_raw, const V& v_raw, Y&& y) {
+        decltype(auto) q = make_temporary(q_raw);
+        decltype(auto) k = make_temporary(k_raw);
+        decltype(auto) v = make_temporary(v_raw);
+
+        static constexpr size_t Dims = decay_traits<Q>::dimensions();
+
+        const size_t N  = etl::dim(q, Dims - 2);
+        const size_t D  = etl::dim(q, Dims - 1);
+        const size_t M  = etl::dim(k, Dims - 2);
+        const size_t Dv = etl::dim(v, Dims - 1);
+        const size_t H  = etl::size(q) / (N * D);
+
+        q.ensure_cpu_up_to_date();
+        k.ensure_cpu_up_to_date();
+        v.ensure_cpu_up_to_date();
+
+        if /*constexpr*/ (impl::vec::attention_possible<value_t<Q>>) {
+            impl::vec::attention(q.memory_start(), k.memory_start(), v.memory_start(), y.memory_start(), H, N, M, D, Dv);
+        } else {
+            impl::standard::attention(q.memory_start(), k.memory_start(), v.memory_start(), y.memory_start(), H, N, M, D, Dv);
+        }
+
+        y.validate_cpu();
+        y.invalidate_gpu();
+    }
+};
+
+/*!
+ * \brief Attention backward implementation
+ */
+struct attention_backward_impl {
+    /*!
+     * \brief Compute the errors of q, k and v from the output o of the
+     * forward pass and its errors dy
+     */
+    template <typename Q, typename K, typename V, typename O, typename DY, typename DQ, typename DK, typename DV>
+    static void apply(const Q& q_raw, const K& k_raw, const V& v_raw, const O& o_raw, const DY& dy_raw, DQ&& dq, DK&& dk, DV&& dv) {
+        decltype(auto) q  = make_temporary(q_raw);
+        decltype(auto) k  = make_temporary(k_raw);
+        decltype(auto) v  = make_temporary(v_raw);
+        decltype(auto) o  = make_temporary(o_raw);
+        decltype(auto) dy = make_temporary(dy_raw);
+
+        static constexpr size_t Dims = decay_traits<Q>::dimensions();
+
+        const size_t N  = etl::dim(q, Dims - 2);
+        const size_t D  = etl::dim(q, Dims - 1);
+        const size_t M  = etl::dim(k, Dims - 2);
+        const size_t Dv = etl::dim(v, Dims - 1);
+        const size_t H  = etl::size(q) / (N * D);
+
+        q.ensure_cpu_up_to_date();
+        k.ensure_cpu_up_to_date();
+        v.ensure_cpu_up_to_date();
+        o.ensure_cpu_up_to_date();
+        dy.ensure_cpu_up_to_date();
+
+        if /*constexpr*/ (impl::vec::attention_possible<value_t<Q>>) {
+            impl::vec::attention_backward(q.memory_start(), k.memory_start(), v.memory_start(), o.memory_start(), dy.memory_start(),
+                                          dq.memory_start(), dk.memory_start(), dv.memory_start(), H, N, M, D, Dv);
+        } else {
+            impl::standard::attention_backward(q.memory_start(), k.memory_start(), v.memory_start(), o.memory_start(), dy.memory_start(),
+                                               dq.memory_start(), dk.memory_start(), dv.memory_start(), H, N, M, D, Dv);
+        }
+
+        dq.validate_cpu();
+        dq.invalidate_gpu();
+        dk.validate_cpu();
+        dk.invalidate_gpu();
+        dv.validate_cpu();
+        dv.invalidate_gpu();
+    }
+};
+
+} //end of namespace detail
+
+} //end of namespace etl
@@ -0,0 +1,167 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Selector for the batch normalization implementations.
+ *
+ * In training, the statistics of each channel are computed in one pass
+ * and the channel is normalized, scaled and shifted in a second pass. The
+ * backward pass computes the sums of each channel in one pass and the
+ * errors of the input in a second pass.
+ */
+
+#pragma once
+
+#include "etl/statistics.hpp"
+
+//Include the implementations
+#include "etl/impl/std/batch_norm.hpp"
+#include "etl/impl/vec/batch_norm.hpp"
+
+namespace etl {
+
+namespace detail {
+
+/*!
+ * \brief Batch normalization (training) implementation
+ */
+struct batch_norm_train_impl {
+    /*!
+     * \brief Compute the statistics of each channel of x, seen as
+     * [B, C, S], into mean and variance and normalize x into y
+     */
+    template <typename X, typename G, typename Beta, typename Y, typename M, typename Var>
+    static void apply(const X& x, const G& gamma, const Beta& beta, value_t<X> eps, Y&& y, M&& mean, Var&& variance, size_t B, size_t C, size_t S) {
+        using T = value_t<X>;
+
+        etl::force(x);
+        etl::force(gamma);
+        etl::force(beta);
+
+        safe_ensure_cpu_up_to_date(x);
+        safe_ensure_cpu_up_to_date(gamma);
+        safe_ensure_cpu_up_to_date(beta);
+
+        std::vector<T> g(C);
+        std::vector<T> s(C);
+
+        for (size_t c = 0; c < C; ++c) {
+            g[c] = gamma.read_flat(c);
+            s[c] = beta.read_flat(c);
+        }
+
+        if /*constexpr*/ (impl::vec::batch_norm_possible<X, X>) {
+            impl::vec::batch_norm_train(x, B, C, S, g.data(), s.data(), eps, mean.memory_start(), variance.memory_start(), y.memory_start());
+        } else {
+            impl::standard::batch_norm_train(x, B, C, S, g.data(), s.data(), eps, mean.memory_start(), variance.memory_start(), y.memory_start());
+        }
+
+        mean.validate_cpu();
+        mean.invalidate_gpu();
+        variance.validate_cpu();
+        variance.invalidate_gpu();
+        y.validate_cpu();
+        y.invalidate_gpu();
+    }
+};
+
+/*!
+ * \brief Batch normalization forward implementation
+ */
+struct batch_norm_forward_impl {
+    /*!
+     * \brief Normalize x, seen as [B, C, S], into y with the given
+     * statistics
+     */
+    template <typename X, typename G, typename Beta, typename M, typename Var, typename Y>
+    static void apply(const X& x, const G& gamma, const Beta& beta, const M& mean, const Var& variance, value_t<X> eps, Y&& y, size_t B, size_t C, size_t S) {
+        using T = value_t<X>;
+
+        etl::force(x);
+        etl::force(gamma);
+        etl::force(beta);
+        etl::force(mean);
+        etl::force(variance);
+
+        safe_ensure_cpu_up_to_date(x);
+        safe_ensure_cpu_up_to_date(gamma);
+        safe_ensure_cpu_up_to_date(beta);
+        safe_ensure_cpu_up_to_date(mean);
+        safe_ensure_cpu_up_to_date(variance);
+
+        std::vector<T> scale(C);
+        std::vector<T> shift(C);
+
+        for (size_t c = 0; c < C; ++c) {
+            scale[c] = gamma.read_flat(c) / std::sqrt(variance.read_flat(c) + eps);
+            shift[c] = beta.read_flat(c) - mean.read_flat(c) * scale[c];
+        }
+
+        if /*constexpr*/ (impl::vec::batch_norm_possible<X, X>) {
+            impl::vec::batch_norm_scale_shift(x, B, C, S, scale.data(), shift.data(), y.memory_start());
+        } else {
+            impl::standard::batch_norm_scale_shift(x, B, C, S, scale.data(), shift.data(), y.memory_start());
+        }
+
+        y.validate_cpu();
+        y.invalidate_gpu();
+    }
+};
+
+/*!
+ * \brief Batch normalization backward implementation
+ */
+struct batch_norm_backward_impl {
+    /*!
+     * \brief Compute the errors of x, gamma and beta, with x seen as
+     * [B, C, S], from the errors dy of the output
+     */
+    template <typename X, typename DY, typename G, typename M, typename Var, typename DX, typename DG, typename DB>
+    static void apply(const X& x, const DY& dy, const G& gamma, const M& mean, const Var& variance, value_t<X> eps, DX&& dx, DG&& dgamma, DB&& dbeta, size_t B, size_t C, size_t S) {
+        using T = value_t<X>;
+
+        etl::force(x);
+        etl::force(dy);
+        etl::force(gamma);
+        etl::force(mean);
+        etl::force(variance);
+
+        safe_ensure_cpu_up_to_date(x);
+        safe_ensure_cpu_up_to_date(dy);
+        safe_ensure_cpu_up_to_date(gamma);
+        safe_ensure_cpu_up_to_date(mean);
+        safe_ensure_cpu_up_to_date(variance);
+
+        std::vector<T> g(C);
+        std::vector<T> m(C);
+        std::vector<T> v(C);
+
+        for (size_t c = 0; c < C; ++c) {
+            g[c] = gamma.read_flat(c);
+            m[c] = mean.read_flat(c);
+            v[c] = variance.read_flat(c);
+        }
+
+        if /*constexpr*/ (impl::vec::batch_norm_possible<X, DY>) {
+            impl::vec::batch_norm_backward(x, dy, B, C, S, g.data(), m.data(), v.data(), eps, dx.memory_start(), dgamma.memory_start(), dbeta.memory_start());
+        } else {
+            impl::standard::batch_norm_backward(x, dy, B, C, S, g.data(), m.data(), v.data(), eps, dx.memory_start(), dgamma.memory_start(), dbeta.memory_start());
+        }
+
+        dx.validate_cpu();
+        dx.invalidate_gpu();
+        dgamma.validate_cpu();
+        dgamma.invalidate_gpu();
+        dbeta.validate_cpu();
+        dbeta.invalidate_gpu();
+    }
+};
+
+} //end of namespace detail
+
+} //end of namespace etl
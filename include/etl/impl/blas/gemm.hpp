@@ -1154,31 +1154,45 @@ void blas_conv2_valid_multi_multi_flipped(I&& input, K_T&& kernels, C&& conv, si
 
 /*!
  * \brief Compute a 4D valid convolution using a BLAS matrix multiplication kernel
+ *
+ * The im2col matrix of each image is never materialized. Instead, small
+ * panels of it are generated on the fly (with the stride, padding and
+ * dilation) and directly multiplied by the kernels. This keeps the working
+ * set in cache and only needs a constant amount of temporary memory.
+ *
  * \param input The input matrix
- * \param kernel The kernel matrix, with flipped kernels
+ * \param kernels The kernel matrix (already flipped) [K, C, m1, m2]
  * \param conv The output matrix
  * \param s1 The stride of the first dimension
  * \param s2 The stride of the second dimension
  * \param p1 The padding of the first dimension
  * \param p2 The padding of the second dimension
+ * \param d1 The dilation of the first dimension
+ * \param d2 The dilation of the second dimension
  */
-template <typename I_T, typename K_T, typename KS_T, typename C_T>
-void blas_conv4_valid_prepared(I_T&& input, K_T&& kernel, KS_T&& kernels, C_T&& conv, size_t s1, size_t s2, size_t p1, size_t p2) {
+template <typename I_T, typename KS_T, typename C_T>
+void blas_conv4_valid_prepared(I_T&& input, KS_T&& kernels, C_T&& conv, size_t s1, size_t s2, size_t p1, size_t p2, size_t d1, size_t d2) {
     using T = value_t<I_T>;
 
-    const auto N = etl::dim<0>(input);  // The number of images
-    const auto K = etl::dim<0>(kernel); // The number of kernels
-    const auto C = etl::dim<1>(input);  // The number of channels
+    static constexpr size_t n_block_size = 256;
+    static constexpr size_t k_block_size = 256;
+
+    const auto N = etl::dim<0>(input);   // The number of images
+    const auto K = etl::dim<0>(kernels); // The number of kernels
+    const auto C = etl::dim<1>(input);   // The number of channels
 
     const auto n1 = etl::dim<2>(input);
     const auto n2 = etl::dim<3>(input);
 
-    const auto m1 = etl::dim<2>(kernel);
-    const auto m2 = etl::dim<3>(kernel);
+    const auto m1 = etl::dim<2>(kernels);
+    const auto m2 = etl::dim<3>(kernels);
 
     const auto c1 = etl::dim<2>(conv);
     const auto c2 = etl::dim<3>(conv);
 
+    const size_t R = C * m1 * m2; // The rows of the im2col matrix
+    const size_t P = c1 * c2;     // The columns of the im2col matrix
+
     input.ensure_cpu_up_to_date();
     kernels.ensure_cpu_up_to_date();
 
@@ -1186,75 +1200,30 @@ void blas_conv4_valid_prepared(I_T&& input, K_T&& kernel, KS_T&& kernels, C_T&&
 
     auto batch_fun_n = [&](const size_t first, const size_t last) {
         if (last - first) {
-            // unit-strided result dimensions
-            const size_t sc1 = (n1 - m1 + 2 * p1) + 1;
-            const size_t sc2 = (n2 - m2 + 2 * p2) + 1;
+            etl::dyn_matrix<T, 2> panel(std::min(k_block_size, R), std::min(n_block_size, P));
 
-            etl::dyn_matrix<T, 2> input_col(m1 * m2, sc1 * sc2);
+            for (size_t i = first; i < last; ++i) {
+                const T* in = input.memory_start() + i * C * n1 * n2;
+                T* out      = conv.memory_start() + i * K * P;
 
-            // Optimize for the most common case
-            if (cpp_likely(!p1 && !p2 && s1 == 1 && s2 == 1)) {
-                for (size_t i = first; i < last; ++i) {
-                    for (size_t c = 0; c < C; ++c) {
-                        im2col_direct_tr(input_col, input(i)(c), m1, m2);
+                for (size_t block_j = 0; block_j < P; block_j += n_block_size) {
+                    const size_t j_end = std::min(block_j + n_block_size, P);
+
+                    for (size_t block_l = 0; block_l < R; block_l += k_block_size) {
+                        const size_t l_end = std::min(block_l + k_block_size, R);
+
+                        impl::common::im2col_panel(panel.memory_start(), in, n1, n2, m1, m2, c2,
+                                                   block_l, l_end, block_j, j_end, s1, s2, p1, p2, d1, d2);
 
                         cblas_gemm(
                             CblasRowMajor,
                             CblasNoTrans, CblasNoTrans,
-                            K, sc1 * sc2, m1 * m2,
+                            K, j_end - block_j, l_end - block_l,
                             T(1.0),
-                            kernels(c).memory_start(), m1 * m2,
-                            input_col.memory_start(), sc1 * sc2,
+                            kernels.memory_start() + block_l, R,
+                            panel.memory_start(), j_end - block_j,
                             T(1.0),
-                            conv(i).memory_start(), sc1 * sc2);
-                    }
-                }
-            } else {
-                etl::dyn_matrix<T, 2> input_padded(n1 + 2 * p1, n2 + 2 * p2);
-                etl::dyn_matrix<T, 3> tmp_result(K, sc1, sc2);
-
-                for (size_t i = first; i < last; ++i) {
-                    for (size_t c = 0; c < C; ++c) {
-                        if (p1 || p2) {
-                            input_padded = T(0.0);
-
-                            impl::common::pad_2d_input(input(i)(c), input_padded, p1, p2);
-
-                            im2col_direct_tr(input_col, input_padded, m1, m2);
-                        } else {
-                            im2col_direct_tr(input_col, input(i)(c), m1, m2);
-                        }
-
-                        if (s1 > 1 || s2 > 1) {
-                            cblas_gemm(
-                                CblasRowMajor,
-                                CblasNoTrans, CblasNoTrans,
-                                K, sc1 * sc2, m1 * m2,
-                                T(1.0),
-                                kernels(c).memory_start(), m1 * m2,
-                                input_col.memory_start(), sc1 * sc2,
-                                T(0.0),
-                                tmp_result.memory_start(), sc1 * sc2);
-
-                            // Strided copy of the large result into the small result
-                            for (size_t k = 0; k < K; ++k) {
-                                for (size_t ii = 0; ii < c1; ++ii) {
-                                    for (size_t j = 0; j < c2; ++j) {
-                                        conv(i, k, ii, j) += tmp_result(k, ii * s1, j * s2);
-                                    }
-                                }
-                            }
-                        } else {
-                            cblas_gemm(
-                                CblasRowMajor,
-                                CblasNoTrans, CblasNoTrans,
-                                K, c1 * c2, m1 * m2,
-                                T(1.0),
-                                kernels(c).memory_start(), m1 * m2,
-                                input_col.memory_start(), sc1 * sc2,
-                                T(1.0),
-                                conv(i).memory_start(), c1 * c2);
-                        }
+                            out + block_j, P);
                     }
                 }
             }
@@ -1289,24 +1258,26 @@ void blas_conv4_valid_prepared(I_T&& input, K_T&& kernel, KS_T&& kernels, C_T&&
  * \param s2 The stride of the second dimension
  * \param p1 The padding of the first dimension
  * \param p2 The padding of the second dimension
+ * \param d1 The dilation of the first dimension
+ * \param d2 The dilation of the second dimension
  */
 template <typename I_T, typename K_T, typename C_T>
-void blas_conv4_valid(I_T&& input, K_T&& kernel, C_T&& conv, size_t s1, size_t s2, size_t p1, size_t p2) {
+void blas_conv4_valid(I_T&& input, K_T&& kernel, C_T&& conv, size_t s1, size_t s2, size_t p1, size_t p2, size_t d1 = 1, size_t d2 = 1) {
     const auto K = etl::dim<0>(kernel); // The number of kernels
     const auto C = etl::dim<1>(input);  // The number of channels
 
     const auto m1 = etl::dim<2>(kernel);
     const auto m2 = etl::dim<3>(kernel);
 
-    etl::dyn_matrix<value_t<I_T>, 4> kernels(C, K, m1, m2);
+    etl::dyn_matrix<value_t<I_T>, 4> kernels(K, C, m1, m2);
 
-    for(size_t c = 0; c < C; ++c){
-        for(size_t k = 0; k < K; ++k){
-            kernels(c)(k) = fflip(kernel(k)(c));
+    for(size_t k = 0; k < K; ++k){
+        for(size_t c = 0; c < C; ++c){
+            kernels(k)(c) = fflip(kernel(k)(c));
         }
     }
 
-    blas_conv4_valid_prepared(input, kernel, kernels, conv, s1, s2, p1, p2);
+    blas_conv4_valid_prepared(input, kernels, conv, s1, s2, p1, p2, d1, d2);
 }
 
 /*!
@@ -1318,24 +1289,13 @@ void blas_conv4_valid(I_T&& input, K_T&& kernel, C_T&& conv, size_t s1, size_t s
  * \param s2 The stride of the second dimension
  * \param p1 The padding of the first dimension
  * \param p2 The padding of the second dimension
+ * \param d1 The dilation of the first dimension
+ * \param d2 The dilation of the second dimension
  */
 template <typename I_T, typename K_T, typename C_T>
-void blas_conv4_valid_flipped(I_T&& input, K_T&& kernel, C_T&& conv, size_t s1, size_t s2, size_t p1, size_t p2) {
-    const auto K = etl::dim<0>(kernel); // The number of kernels
-    const auto C = etl::dim<1>(input);  // The number of channels
-
-    const auto m1 = etl::dim<2>(kernel);
-    const auto m2 = etl::dim<3>(kernel);
-
-    etl::dyn_matrix<value_t<I_T>, 4> kernels(C, K, m1, m2);
-
-    for(size_t c = 0; c < C; ++c){
-        for(size_t k = 0; k < K; ++k){
-            kernels(c)(k) = kernel(k)(c);
-        }
-    }
-
-    blas_conv4_valid_prepared(input, kernel, kernels, conv, s1, s2, p1, p2);
+void blas_conv4_valid_flipped(I_T&& input, K_T&& kernel, C_T&& conv, size_t s1, size_t s2, size_t p1, size_t p2, size_t d1 = 1, size_t d2 = 1) {
+    // The flipped kernels are already in the [K, C, m1, m2] layout
+    blas_conv4_valid_prepared(input, kernel, conv, s1, s2, p1, p2, d1, d2);
 }
 
 /*!
@@ -1853,9 +1813,11 @@ void blas_conv2_valid_multi_multi_flipped(const I& input, const K_T& kernels, C&
  * \param s2 The stride of the second dimension
  * \param p1 The padding of the first dimension
  * \param p2 The padding of the second dimension
+ * \param d1 The dilation of the first dimension
+ * \param d2 The dilation of the second dimension
  */
 template <typename I_T, typename K_T, typename C_T>
-void blas_conv4_valid(I_T&& input, K_T&& kernel, C_T&& conv, size_t s1, size_t s2, size_t p1, size_t p2){
+void blas_conv4_valid(I_T&& input, K_T&& kernel, C_T&& conv, size_t s1, size_t s2, size_t p1, size_t p2, size_t d1 = 1, size_t d2 = 1){
     cpp_unused(input);
     cpp_unused(kernel);
     cpp_unused(conv);
@@ -1863,6 +1825,8 @@ void blas_conv4_valid(I_T&& input, K_T&& kernel, C_T&& conv, size_t s1, size_t s
     cpp_unused(s2);
     cpp_unused(p1);
     cpp_unused(p2);
+    cpp_unused(d1);
+    cpp_unused(d2);
     cpp_unreachable("Unsupported feature called: blas gemm");
 }
 
@@ -1875,9 +1839,11 @@ void blas_conv4_valid(I_T&& input, K_T&& kernel, C_T&& conv, size_t s1, size_t s
  * \param s2 The stride of the second dimension
  * \param p1 The padding of the first dimension
  * \param p2 The padding of the second dimension
+ * \param d1 The dilation of the first dimension
+ * \param d2 The dilation of the second dimension
  */
 template <typename I_T, typename K_T, typename C_T>
-void blas_conv4_valid_flipped(I_T&& input, K_T&& kernel, C_T&& conv, size_t s1, size_t s2, size_t p1, size_t p2){
+void blas_conv4_valid_flipped(I_T&& input, K_T&& kernel, C_T&& conv, size_t s1, size_t s2, size_t p1, size_t p2, size_t d1 = 1, size_t d2 = 1){
     cpp_unused(input);
     cpp_unused(kernel);
     cpp_unused(conv);
@@ -1885,6 +1851,8 @@ void blas_conv4_valid_flipped(I_T&& input, K_T&& kernel, C_T&& conv, size_t s1,
     cpp_unused(s2);
     cpp_unused(p1);
     cpp_unused(p2);
+    cpp_unused(d1);
+    cpp_unused(d2);
     cpp_unreachable("Unsupported feature called: blas gemm");
 }
 
@@ -17,6 +17,7 @@
 
 //Include the implementations
 #include "etl/impl/std/cce.hpp"
+#include "etl/impl/vec/cce.hpp"
 #include "etl/impl/egblas/cce.hpp"
 
 namespace etl {
@@ -59,6 +60,21 @@ constexpr etl::cce_impl select_cce_error_impl() {
     return etl::cce_impl::STD;
 }
 
+/*!
+ * \brief Select the fused softmax CCE implementation for logits of type O
+ * and labels of type L
+ *
+ * \return The implementation to use
+ */
+template <typename O, typename L>
+constexpr etl::cce_impl select_softmax_cce_impl() {
+    if (impl::vec::softmax_cce_possible<O, L>) {
+        return etl::cce_impl::VEC;
+    }
+
+    return etl::cce_impl::STD;
+}
+
 /*!
  * \brief Sum operation implementation
  */
@@ -119,6 +135,31 @@ struct cce_error_impl {
     }
 };
 
+/*!
+ * \brief Fused softmax CCE implementation
+ */
+struct softmax_cce_impl {
+    /*!
+     * \brief Compute the loss of the softmax of the logits and, if
+     * gradient is not null, its gradient
+     */
+    template <typename O, typename L>
+    static value_t<O> apply(const O& logits, const L& labels, value_t<O> scale, value_t<O>* gradient) {
+        constexpr auto impl = select_softmax_cce_impl<O, L>();
+
+        etl::force(logits);
+        etl::force(labels);
+
+        if /*constexpr*/ (impl == etl::cce_impl::VEC) {
+            return impl::vec::softmax_cce(logits, labels, scale, gradient);
+        } else if /*constexpr*/ (impl == etl::cce_impl::STD) {
+            return impl::standard::softmax_cce(logits, labels, scale, gradient);
+        } else {
+            cpp_unreachable("Invalid selection for softmax CCE");
+        }
+    }
+};
+
 } //end of namespace detail
 
 } //end of namespace etl
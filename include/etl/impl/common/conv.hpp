@@ -526,6 +526,118 @@ etl::dyn_matrix<value_t<I>, 4> inner_pad(const I& in, size_t s1, size_t s2) {
     return result;
 }
 
+/*!
+ * \brief Return a copy of the given NHWC kernels [K, H, W, C] with the
+ * spatial dimensions flipped.
+ *
+ * This is used to compute convolution with the cross-correlation kernels.
+ *
+ * \param kernel The kernels to flip
+ * \return a new matrix containing the flipped kernels
+ */
+template <typename K>
+etl::dyn_matrix<value_t<K>, 4> flip_nhwc_kernel(const K& kernel) {
+    const size_t k1 = etl::dim<1>(kernel);
+    const size_t k2 = etl::dim<2>(kernel);
+    const size_t C  = etl::dim<3>(kernel);
+
+    etl::dyn_matrix<value_t<K>, 4> flipped(etl::dim<0>(kernel), k1, k2, C);
+
+    kernel.ensure_cpu_up_to_date();
+
+    for (size_t k = 0; k < etl::dim<0>(kernel); ++k) {
+        for (size_t i = 0; i < k1; ++i) {
+            for (size_t j = 0; j < k2; ++j) {
+                direct_copy_n(kernel.memory_start() + ((k * k1 + i) * k2 + j) * C,
+                              flipped.memory_start() + ((k * k1 + (k1 - 1 - i)) * k2 + (k2 - 1 - j)) * C, C);
+            }
+        }
+    }
+
+    return flipped;
+}
+
+/*!
+ * \brief Generate a panel of the im2col matrix of a multi-channel image.
+ *
+ * The full im2col matrix of a [C, n1, n2] image has one row per (channel,
+ * kernel row, kernel column) triplet and one column per output pixel. Only
+ * the rows [l_first, l_last) and the columns [j_first, j_last) are
+ * generated in the row-major panel. Padded cells are written as zeroes.
+ *
+ * \param panel The output panel
+ * \param in The input image [C, n1, n2]
+ * \param n1 The first dimension of the input
+ * \param n2 The second dimension of the input
+ * \param m1 The first dimension of the kernel
+ * \param m2 The second dimension of the kernel
+ * \param c2 The second dimension of the output
+ * \param l_first The first row of the panel
+ * \param l_last The end of the rows of the panel
+ * \param j_first The first column of the panel
+ * \param j_last The end of the columns of the panel
+ * \param s1 The first dimension stride
+ * \param s2 The second dimension stride
+ * \param p1 The first dimension padding
+ * \param p2 The second dimension padding
+ * \param d1 The first dimension dilation
+ * \param d2 The second dimension dilation
+ */
+template <typename T>
+void im2col_panel(T* panel, const T* in, size_t n1, size_t n2, size_t m1, size_t m2, size_t c2,
+                  size_t l_first, size_t l_last, size_t j_first, size_t j_last,
+                  size_t s1, size_t s2, size_t p1, size_t p2, size_t d1, size_t d2) {
+    const size_t width = j_last - j_first;
+
+    for (size_t l = l_first; l < l_last; ++l) {
+        const size_t c = l / (m1 * m2);
+        const size_t h_offset = ((l / m2) % m1) * d1;
+        const size_t w_offset = (l % m2) * d2;
+
+        // The range of output columns that are not in the padding
+        const size_t w_first = w_offset >= p2 ? 0 : std::min(c2, (p2 - w_offset + s2 - 1) / s2);
+        const size_t w_last  = n2 + p2 > w_offset ? std::min(c2, (n2 + p2 - w_offset - 1) / s2 + 1) : 0;
+
+        T* target = panel + (l - l_first) * width;
+
+        size_t j = j_first;
+
+        while (j < j_last) {
+            const size_t oh    = j / c2;
+            const size_t first = j % c2;
+            const size_t last  = std::min(c2, first + (j_last - j));
+
+            // The output of the column first of the current row
+            T* out = target + (j - j_first);
+
+            const size_t hh = oh * s1 + h_offset;
+
+            if (hh < p1 || hh - p1 >= n1 || w_first >= w_last) {
+                std::fill_n(out, last - first, T(0));
+            } else {
+                const T* source = in + (c * n1 + hh - p1) * n2;
+
+                const size_t v_first = std::min(last, std::max(first, w_first));
+                const size_t v_last  = std::max(v_first, std::min(last, w_last));
+
+                std::fill_n(out, v_first - first, T(0));
+
+                if (s2 == 1) {
+                    std::copy_n(source + (v_first + w_offset - p2), v_last - v_first, out + (v_first - first));
+                } else {
+                    for (size_t w = v_first; w < v_last; ++w) {
+                        out[w - first] = source[w * s2 + w_offset - p2];
+                    }
+                }
+
+                std::fill_n(out + (v_last - first), last - v_last, T(0));
+            }
+
+            j += last - first;
+        }
+    }
+}
+
 } //end of namespace common
 } //end of namespace impl
 } //end of namespace etl
@@ -101,26 +101,38 @@ struct dyn_conv4_valid_impl {
      * \param input The input expression
      * \param kernel The kernel expression
      * \param conv The output expression
+     * \param s1 The first dimension stride
+     * \param s2 The second dimension stride
+     * \param p1 The first dimension padding
+     * \param p2 The second dimension padding
+     * \param d1 The first dimension dilation
+     * \param d2 The second dimension dilation
      */
     template <typename I, typename K, typename C>
-    static void apply(const I& input, const K& kernel, C&& conv, size_t s1, size_t s2, size_t p1, size_t p2) {
+    static void apply(const I& input, const K& kernel, C&& conv, size_t s1, size_t s2, size_t p1, size_t p2, size_t d1 = 1, size_t d2 = 1) {
 #ifndef ETL_MANUAL_SELECT
         if /*constexpr*/ (impl::cudnn::conv_possible<I, K, C>) {
-            impl::cudnn::conv4_forward(smart_forward_gpu(input), smart_forward_gpu(kernel), conv, s1, s2, p1, p2);
+            impl::cudnn::conv4_forward(smart_forward_gpu(input), smart_forward_gpu(kernel), conv, s1, s2, p1, p2, d1, d2);
         } else {
 #endif
             auto impl = select_conv4_valid_impl<I, K, C>(etl::dim<2>(input), etl::dim<3>(input), etl::dim<2>(kernel), etl::dim<3>(kernel));
 
+            // The direct vectorized kernels do not support dilation, the
+            // vectorized im2col reduction handles it without any overhead
+            if (impl == etl::conv4_impl::VEC && (d1 > 1 || d2 > 1)) {
+                impl = etl::conv4_impl::BLAS_VEC;
+            }
+
             if (impl == etl::conv4_impl::CUDNN) {
-                impl::cudnn::conv4_forward(smart_forward_gpu(input), smart_forward_gpu(kernel), conv, s1, s2, p1, p2);
+                impl::cudnn::conv4_forward(smart_forward_gpu(input), smart_forward_gpu(kernel), conv, s1, s2, p1, p2, d1, d2);
             } else if (impl == etl::conv4_impl::BLAS_VEC) {
-                impl::vec::blas_conv4_valid(smart_forward(input), smart_forward(kernel), conv, s1, s2, p1, p2);
+                impl::vec::blas_conv4_valid(smart_forward(input), smart_forward(kernel), conv, s1, s2, p1, p2, d1, d2);
             } else if (impl == etl::conv4_impl::BLAS_MKL) {
-                impl::blas::blas_conv4_valid(smart_forward(input), smart_forward(kernel), conv, s1, s2, p1, p2);
+                impl::blas::blas_conv4_valid(smart_forward(input), smart_forward(kernel), conv, s1, s2, p1, p2, d1, d2);
             } else if (impl == etl::conv4_impl::VEC) {
                 impl::vec::conv4_valid(smart_forward(input), smart_forward(kernel), conv, s1, s2, p1, p2);
             } else if (impl == etl::conv4_impl::STD) {
-                impl::standard::conv4_valid(smart_forward(input), smart_forward(kernel), conv, s1, s2, p1, p2);
+                impl::standard::conv4_valid(smart_forward(input), smart_forward(kernel), conv, s1, s2, p1, p2, d1, d2);
             } else {
                 cpp_unreachable("Invalid conv implementation selection");
             }
@@ -139,26 +151,38 @@ struct dyn_conv4_valid_flipped_impl {
      * \param input The input expression
      * \param kernel The kernel expression
      * \param conv The output expression
+     * \param s1 The first dimension stride
+     * \param s2 The second dimension stride
+     * \param p1 The first dimension padding
+     * \param p2 The second dimension padding
+     * \param d1 The first dimension dilation
+     * \param d2 The second dimension dilation
      */
     template <typename I, typename K, typename C>
-    static void apply(const I& input, const K& kernel, C&& conv, size_t s1, size_t s2, size_t p1, size_t p2) {
+    static void apply(const I& input, const K& kernel, C&& conv, size_t s1, size_t s2, size_t p1, size_t p2, size_t d1 = 1, size_t d2 = 1) {
 #ifndef ETL_MANUAL_SELECT
         if /*constexpr*/ (impl::cudnn::conv_possible<I, K, C>) {
-            impl::cudnn::conv4_forward(smart_forward_gpu(input), smart_forward_gpu(kernel), conv, s1, s2, p1, p2);
+            impl::cudnn::conv4_forward_flipped(smart_forward_gpu(input), smart_forward_gpu(kernel), conv, s1, s2, p1, p2, d1, d2);
         } else {
 #endif
             auto impl = select_conv4_valid_impl<I, K, C>(etl::dim<2>(input), etl::dim<3>(input), etl::dim<2>(kernel), etl::dim<3>(kernel));
 
+            // The direct vectorized kernels do not support dilation, the
+            // vectorized im2col reduction handles it without any overhead
+            if (impl == etl::conv4_impl::VEC && (d1 > 1 || d2 > 1)) {
+                impl = etl::conv4_impl::BLAS_VEC;
+            }
+
             if (impl == etl::conv4_impl::CUDNN) {
-                impl::cudnn::conv4_forward_flipped(smart_forward_gpu(input), smart_forward_gpu(kernel), conv, s1, s2, p1, p2);
+                impl::cudnn::conv4_forward_flipped(smart_forward_gpu(input), smart_forward_gpu(kernel), conv, s1, s2, p1, p2, d1, d2);
             } else if (impl == etl::conv4_impl::BLAS_VEC) {
-                impl::vec::blas_conv4_valid_flipped(smart_forward(input), smart_forward(kernel), conv, s1, s2, p1, p2);
+                impl::vec::blas_conv4_valid_flipped(smart_forward(input), smart_forward(kernel), conv, s1, s2, p1, p2, d1, d2);
             } else if (impl == etl::conv4_impl::BLAS_MKL) {
-                impl::blas::blas_conv4_valid_flipped(smart_forward(input), smart_forward(kernel), conv, s1, s2, p1, p2);
+                impl::blas::blas_conv4_valid_flipped(smart_forward(input), smart_forward(kernel), conv, s1, s2, p1, p2, d1, d2);
             } else if (impl == etl::conv4_impl::VEC) {
                 impl::vec::conv4_valid_flipped(smart_forward(input), smart_forward(kernel), conv, s1, s2, p1, p2);
             } else if (impl == etl::conv4_impl::STD) {
-                impl::standard::conv4_valid_flipped(smart_forward(input), smart_forward(kernel), conv, s1, s2, p1, p2);
+                impl::standard::conv4_valid_flipped(smart_forward(input), smart_forward(kernel), conv, s1, s2, p1, p2, d1, d2);
             } else {
                 cpp_unreachable("Invalid conv implementation selection");
             }
@@ -159,7 +159,7 @@ void conv2_valid_flipped(I&& input, K&& kernel, C&& conv, size_t s1, size_t s2,
  * \param conv The output matrix
  */
 template <typename I, typename K, typename C>
-void conv4_forward_set(I&& input, K&& kernel, C&& conv, size_t s1, size_t s2, size_t p1, size_t p2, cudnnConvolutionMode_t mode) {
+void conv4_forward_set(I&& input, K&& kernel, C&& conv, size_t s1, size_t s2, size_t p1, size_t p2, size_t d1, size_t d2, cudnnConvolutionMode_t mode) {
     using type = value_t<I>;
 
     type alpha[] = {1.0f};
@@ -175,7 +175,7 @@ void conv4_forward_set(I&& input, K&& kernel, C&& conv, size_t s1, size_t s2, si
     // Prepare the convolution
     cudnnConvolutionDescriptor_t convolution;
     cudnn_check(cudnnCreateConvolutionDescriptor(&convolution));
-    cudnn_check(cudnnSetConvolution2dDescriptor(convolution, p1, p2, s1, s2, 1, 1, mode));
+    cudnn_check(cudnnSetConvolution2dDescriptor(convolution, p1, p2, s1, s2, d1, d2, mode));
 
     // Find the algorithm to use
     cudnnConvolutionFwdAlgo_t conv_algo;
@@ -220,8 +220,8 @@ void conv4_forward_set(I&& input, K&& kernel, C&& conv, size_t s1, size_t s2, si
  * \param conv The output matrix
  */
 template <typename I, typename K, typename C, cpp_enable_iff(conv_possible<I, K, C>)>
-void conv4_forward(I&& input, K&& kernel, C&& conv, size_t s1, size_t s2, size_t p1, size_t p2) {
-    conv4_forward_set(input, kernel, conv, s1, s2, p1, p2, CUDNN_CONVOLUTION);
+void conv4_forward(I&& input, K&& kernel, C&& conv, size_t s1, size_t s2, size_t p1, size_t p2, size_t d1 = 1, size_t d2 = 1) {
+    conv4_forward_set(input, kernel, conv, s1, s2, p1, p2, d1, d2, CUDNN_CONVOLUTION);
 }
 
 /*!
@@ -231,8 +231,8 @@ void conv4_forward(I&& input, K&& kernel, C&& conv, size_t s1, size_t s2, size_t
  * \param conv The output matrix
  */
 template <typename I, typename K, typename C, cpp_enable_iff(conv_possible<I, K, C>)>
-void conv4_forward_flipped(I&& input, K&& kernel, C&& conv, size_t s1, size_t s2, size_t p1, size_t p2) {
-    conv4_forward_set(input, kernel, conv, s1, s2, p1, p2, CUDNN_CROSS_CORRELATION);
+void conv4_forward_flipped(I&& input, K&& kernel, C&& conv, size_t s1, size_t s2, size_t p1, size_t p2, size_t d1 = 1, size_t d2 = 1) {
+    conv4_forward_set(input, kernel, conv, s1, s2, p1, p2, d1, d2, CUDNN_CROSS_CORRELATION);
 }
 
 /*!
@@ -665,7 +665,7 @@ void conv2_valid_flipped(I&& input, K&& kernel, C&& conv, size_t s1, size_t s2,
  * \param conv The output matrix
  */
 template <typename I, typename K, typename C, cpp_disable_iff(conv_possible<I, K, C>)>
-void conv4_forward(I&& input, K&& kernel, C&& conv, size_t s1, size_t s2, size_t p1, size_t p2) {
+void conv4_forward(I&& input, K&& kernel, C&& conv, size_t s1, size_t s2, size_t p1, size_t p2, size_t d1 = 1, size_t d2 = 1) {
     cpp_unused(input);
     cpp_unused(kernel);
     cpp_unused(conv);
@@ -673,6 +673,8 @@ void conv4_forward(I&& input, K&& kernel, C&& conv, size_t s1, size_t s2, size_t
     cpp_unused(s2);
     cpp_unused(p1);
     cpp_unused(p2);
+    cpp_unused(d1);
+    cpp_unused(d2);
     cpp_unreachable("Unsupported feature called: cudnn conv4_valid");
 }
 
@@ -683,7 +685,7 @@ void conv4_forward(I&& input, K&& kernel, C&& conv, size_t s1, size_t s2, size_t
  * \param conv The output matrix
  */
 template <typename I, typename K, typename C, cpp_disable_iff(conv_possible<I, K, C>)>
-void conv4_forward_flipped(I&& input, K&& kernel, C&& conv, size_t s1, size_t s2, size_t p1, size_t p2) {
+void conv4_forward_flipped(I&& input, K&& kernel, C&& conv, size_t s1, size_t s2, size_t p1, size_t p2, size_t d1 = 1, size_t d2 = 1) {
     cpp_unused(input);
     cpp_unused(kernel);
     cpp_unused(conv);
@@ -691,6 +693,8 @@ void conv4_forward_flipped(I&& input, K&& kernel, C&& conv, size_t s1, size_t s2
     cpp_unused(s2);
     cpp_unused(p1);
     cpp_unused(p2);
+    cpp_unused(d1);
+    cpp_unused(d2);
     cpp_unreachable("Unsupported feature called: cudnn conv4_valid_flipped");
 }
 
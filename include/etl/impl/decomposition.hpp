@@ -20,7 +20,7 @@ namespace etl {
 namespace detail {
 
 /*!
- * \brief Functor for euclidean norm
+ * \brief Functor for LU decomposition
  */
 struct lu_impl {
     /*!
@@ -52,6 +52,69 @@ struct qr_impl {
     }
 };
 
+/*!
+ * \brief Functor for Cholesky decomposition
+ */
+struct cholesky_impl {
+    /*!
+     * \brief Apply the functor to A, L
+     * \param A The input matrix
+     * \param L The L decomposition (output)
+     * \return true if the decomposition succeeded, false otherwise
+     */
+    template <typename AT, typename LT>
+    static bool apply(const AT& A, LT& L) {
+        return etl::impl::standard::cholesky(A, L);
+    }
+};
+
+/*!
+ * \brief Functor for the solution of linear systems
+ */
+struct solve_impl {
+    /*!
+     * \brief Apply the functor to A, B and X
+     * \param A The matrix of the system
+     * \param B The right hand sides
+     * \param X The solutions (output)
+     */
+    template <typename AT, typename BT, typename XT>
+    static void apply(const AT& A, const BT& B, XT& X) {
+        etl::impl::standard::solve(A, B, X);
+    }
+
+    /*!
+     * \brief Returns the name of the operation
+     */
+    static const char* name() {
+        return "solve";
+    }
+};
+
+/*!
+ * \brief Functor for the solution of symmetric positive definite linear
+ * systems
+ */
+struct cholesky_solve_impl {
+    /*!
+     * \brief Apply the functor to A, B and X
+     * \param A The matrix of the system
+     * \param B The right hand sides
+     * \param X The solutions (output)
+     */
+    template <typename AT, typename BT, typename XT>
+    static void apply(const AT& A, const BT& B, XT& X) {
+        etl::impl::standard::cholesky_solve(A, B, X);
+    }
+
+    /*!
+     * \brief Returns the name of the operation
+     */
+    static const char* name() {
+        return "cholesky_solve";
+    }
+};
+
 } //end of namespace detail
 
 } //end of namespace etl
@@ -0,0 +1,116 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Selector for the layer normalization and RMS normalization
+ * implementations.
+ *
+ * The rows are the last dimension of the input, all the other dimensions
+ * being flattened.
+ */
+
+#pragma once
+
+#include "etl/statistics.hpp"
+
+//Include the implementations
+#include "etl/impl/std/layer_norm.hpp"
+#include "etl/impl/vec/layer_norm.hpp"
+
+namespace etl {
+
+namespace detail {
+
+/*!
+ * \brief Layer normalization implementation
+ */
+struct layer_norm_impl {
+    /*!
+     * \brief Normalize each row of x into y, scaled by gamma and shifted
+     * by beta (not used if Rms is true)
+     */
+    template <bool Rms, typename X, typename G, typename Beta, typename Y>
+    static void apply(const X& x, const G& gamma, const Beta& beta, value_t<X> eps, Y&& y) {
+        using T = value_t<X>;
+
+        const size_t K = etl::dim(x, decay_traits<X>::dimensions() - 1);
+        const size_t N = etl::size(x) / K;
+
+        safe_ensure_cpu_up_to_date(x);
+        safe_ensure_cpu_up_to_date(gamma);
+        safe_ensure_cpu_up_to_date(beta);
+
+        std::vector<T> g(K);
+        std::vector<T> b(Rms ? 0 : K);
+
+        for (size_t k = 0; k < K; ++k) {
+            g[k] = gamma.read_flat(k);
+
+            if (!Rms) {
+                b[k] = beta.read_flat(k);
+            }
+        }
+
+        if /*constexpr*/ (impl::vec::layer_norm_possible<X, X>) {
+            impl::vec::layer_norm<Rms>(x, N, K, g.data(), b.data(), eps, y.memory_start());
+        } else {
+            impl::standard::layer_norm<Rms>(x, N, K, g.data(), b.data(), eps, y.memory_start());
+        }
+
+        y.validate_cpu();
+        y.invalidate_gpu();
+    }
+};
+
+/*!
+ * \brief Layer normalization backward implementation
+ */
+struct layer_norm_backward_impl {
+    /*!
+     * \brief Compute the errors of x, gamma and beta (not used if Rms is
+     * true) from the errors dy of the output
+     */
+    template <bool Rms, typename X, typename DY, typename G, typename DX, typename DG, typename DB>
+    static void apply(const X& x, const DY& dy, const G& gamma, value_t<X> eps, DX&& dx, DG&& dgamma, DB&& dbeta) {
+        using T = value_t<X>;
+
+        const size_t K = etl::dim(x, decay_traits<X>::dimensions() - 1);
+        const size_t N = etl::size(x) / K;
+
+        etl::force(x);
+        etl::force(dy);
+        etl::force(gamma);
+
+        safe_ensure_cpu_up_to_date(x);
+        safe_ensure_cpu_up_to_date(dy);
+        safe_ensure_cpu_up_to_date(gamma);
+
+        std::vector<T> g(K);
+
+        for (size_t k = 0; k < K; ++k) {
+            g[k] = gamma.read_flat(k);
+        }
+
+        if /*constexpr*/ (impl::vec::layer_norm_possible<X, DY>) {
+            impl::vec::layer_norm_backward<Rms>(x, dy, N, K, g.data(), eps, dx.memory_start(), dgamma.memory_start(), dbeta.memory_start());
+        } else {
+            impl::standard::layer_norm_backward<Rms>(x, dy, N, K, g.data(), eps, dx.memory_start(), dgamma.memory_start(), dbeta.memory_start());
+        }
+
+        dx.validate_cpu();
+        dx.invalidate_gpu();
+        dgamma.validate_cpu();
+        dgamma.invalidate_gpu();
+        dbeta.validate_cpu();
+        dbeta.invalidate_gpu();
+    }
+};
+
+} //end of namespace detail
+
+} //end of namespace etl
@@ -0,0 +1,200 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Selection of the implementations of the channels-last (NHWC) operations
+ */
+
+#pragma once
+
+// Include the implementations
+
+#include "etl/impl/common/conv.hpp"
+#include "etl/impl/std/nhwc.hpp"
+#include "etl/impl/vec/nhwc.hpp"
+
+namespace etl {
+
+namespace impl {
+
+/*!
+ * \brief Select the default implementation for a NHWC operation on the given expressions
+ *
+ * This does not consider the local context
+ *
+ * \tparam Impl The enumeration of the implementations
+ * \tparam E The types of the expressions
+ *
+ * \return The implementation to use
+ */
+template <typename Impl, typename... E>
+constexpr Impl select_default_nhwc_impl() {
+    if (vec::nhwc_possible<vector_mode, E...>) {
+        return Impl::VEC;
+    }
+
+    return Impl::STD;
+}
+
+#ifdef ETL_MANUAL_SELECT
+
+/*!
+ * \brief Select the implementation for a NHWC operation on the given expressions
+ *
+ * Only the STD and VEC implementations are available for NHWC.
+ *
+ * \param selector The forced selector of the local context
+ * \param name The name of the operation, for diagnostics
+ *
+ * \tparam Impl The enumeration of the implementations
+ * \tparam E The types of the expressions
+ *
+ * \return The implementation to use
+ */
+template <typename Impl, typename... E>
+Impl select_nhwc_impl(const forced_impl<Impl>& selector, const char* name) {
+    auto def = select_default_nhwc_impl<Impl, E...>();
+
+    if (selector.forced) {
+        auto forced = selector.impl;
+
+        if (forced == Impl::STD) {
+            return forced;
+        }
+
+        if (forced != Impl::VEC || !vec::nhwc_possible<vector_mode, E...>) {
+            std::cerr << "Forced selection of " << name << " implementation, but not possible for NHWC" << std::endl; //COVERAGE_EXCLUDE_LINE
+            return def;                                                                                             //COVERAGE_EXCLUDE_LINE
+        }
+
+        return forced;
+    }
+
+    return def;
+}
+
+/*!
+ * \brief Select the conv4 implementation for a NHWC convolution
+ * \return The implementation to use
+ */
+template <typename I, typename K, typename C>
+etl::conv4_impl select_nhwc_conv4_impl() {
+    return select_nhwc_impl<etl::conv4_impl, I, K, C>(local_context().conv4_selector, "conv4");
+}
+
+/*!
+ * \brief Select the pool implementation for a NHWC pooling
+ * \return The implementation to use
+ */
+template <typename X, typename Y>
+etl::pool_impl select_nhwc_pool_impl() {
+    return select_nhwc_impl<etl::pool_impl, X, Y>(local_context().pool_selector, "pool");
+}
+
+/*!
+ * \brief Select the bias_add implementation for a NHWC bias_add
+ * \return The implementation to use
+ */
+template <typename A, typename B, typename C>
+etl::bias_add_impl select_nhwc_bias_add_impl() {
+    return select_nhwc_impl<etl::bias_add_impl, A, B, C>(local_context().bias_add_selector, "bias_add");
+}
+
+#else
+
+/*!
+ * \brief Select the conv4 implementation for a NHWC convolution
+ * \return The implementation to use
+ */
+template <typename I, typename K, typename C>
+constexpr etl::conv4_impl select_nhwc_conv4_impl() {
+    return select_default_nhwc_impl<etl::conv4_impl, I, K, C>();
+}
+
+/*!
+ * \brief Select the pool implementation for a NHWC pooling
+ * \return The implementation to use
+ */
+template <typename X, typename Y>
+constexpr etl::pool_impl select_nhwc_pool_impl() {
+    return select_default_nhwc_impl<etl::pool_impl, X, Y>();
+}
+
+/*!
+ * \brief Select the bias_add implementation for a NHWC bias_add
+ * \return The implementation to use
+ */
+template <typename A, typename B, typename C>
+constexpr etl::bias_add_impl select_nhwc_bias_add_impl() {
+    return select_default_nhwc_impl<etl::bias_add_impl, A, B, C>();
+}
+
+#endif
+
+/*!
+ * \brief Functor for 2D Max Pooling in NHWC layout
+ */
+struct max_pool_2d_nhwc {
+    /*!
+     * \brief Pool x into y
+     *
+     * \param x The expression to pool [N, H, W, C]
+     * \param y The expression in which to store the result [N, Ho, Wo, C]
+     * \param c1 The first dimension pooling ratio
+     * \param c2 The second dimension pooling ratio
+     * \param s1 The first dimension stride
+     * \param s2 The second dimension stride
+     * \param p1 The first dimension padding
+     * \param p2 The second dimension padding
+     */
+    template <typename X, typename Y>
+    static void apply(const X& x, Y&& y, size_t c1, size_t c2, size_t s1, size_t s2, size_t p1, size_t p2) {
+        constexpr_select const auto impl = select_nhwc_pool_impl<X, Y>();
+
+        if /*constexpr_select*/ (impl == pool_impl::VEC) {
+            etl::impl::vec::max_pool_2d_nhwc(smart_forward(x), y, c1, c2, s1, s2, p1, p2);
+        } else if /*constexpr_select*/ (impl == pool_impl::STD) {
+            etl::impl::standard::max_pool_2d_nhwc(smart_forward(x), y, c1, c2, s1, s2, p1, p2);
+        } else {
+            cpp_unreachable("Invalid selection for pooling");
+        }
+    }
+};
+
+/*!
+ * \brief Functor for 2D Average Pooling in NHWC layout
+ */
+struct avg_pool_2d_nhwc {
+    /*!
+     * \brief Pool x into y
+     *
+     * \param x The expression to pool [N, H, W, C]
+     * \param y The expression in which to store the result [N, Ho, Wo, C]
+     * \param c1 The first dimension pooling ratio
+     * \param c2 The second dimension pooling ratio
+     * \param s1 The first dimension stride
+     * \param s2 The second dimension stride
+     * \param p1 The first dimension padding
+     * \param p2 The second dimension padding
+     */
+    template <typename X, typename Y>
+    static void apply(const X& x, Y&& y, size_t c1, size_t c2, size_t s1, size_t s2, size_t p1, size_t p2) {
+        constexpr_select const auto impl = select_nhwc_pool_impl<X, Y>();
+
+        if /*constexpr_select*/ (impl == pool_impl::VEC) {
+            etl::impl::vec::avg_pool_2d_nhwc(smart_forward(x), y, c1, c2, s1, s2, p1, p2);
+        } else if /*constexpr_select*/ (impl == pool_impl::STD) {
+            etl::impl::standard::avg_pool_2d_nhwc(smart_forward(x), y, c1, c2, s1, s2, p1, p2);
+        } else {
+            cpp_unreachable("Invalid selection for pooling");
+        }
+    }
+};
+
+} //end of namespace impl
+} //end of namespace etl
@@ -65,6 +65,11 @@ etl::pool_impl select_pool_impl() {
 
                 return forced;
 
+            // VEC is only available for channels-last (NHWC) pooling
+            case pool_impl::VEC:
+                std::cerr << "Forced selection to VEC pool implementation, but not possible for this expression" << std::endl; //COVERAGE_EXCLUDE_LINE
+                return select_default_pool_impl<X, Y>(local_context().cpu); //COVERAGE_EXCLUDE_LINE
+
             //In other cases, simply use the forced impl
             default:
                 return forced;
@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include "etl/impl/vec/prob_pooling.hpp"
+
 namespace etl {
 
 namespace impl {
@@ -116,12 +118,27 @@ struct pmp_h_impl {
     template<typename A>
     static constexpr bool gpu_computable = false;
 
+    /*!
+     * \brief Apply the functor, with the vectorized implementation
+     * \param a The input sub expression
+     * \param c The output sub expression
+     */
+    template <size_t C1, size_t C2, size_t S1, size_t S2, size_t P1, size_t P2, typename A, typename C, cpp_enable_iff(vec::pmp_possible<A, C>)>
+    static void apply(A&& a, C&& c) {
+        static_assert(S1 == C1, "pmp_h does not support strides");
+        static_assert(S2 == C2, "pmp_h does not support strides");
+        static_assert(P1 == 0, "pmp_h does not support padding");
+        static_assert(P2 == 0, "pmp_h does not support padding");
+
+        vec::pmp_h(a, c, C1, C2);
+    }
+
     /*!
      * \brief Apply the functor
      * \param a The input sub expression
      * \param c The output sub expression
      */
-    template <size_t C1, size_t C2, size_t S1, size_t S2, size_t P1, size_t P2, typename A, typename C, cpp_enable_iff(etl::is_2d<A>)>
+    template <size_t C1, size_t C2, size_t S1, size_t S2, size_t P1, size_t P2, typename A, typename C, cpp_enable_iff(etl::is_2d<A> && !vec::pmp_possible<A, C>)>
     static void apply(A&& a, C&& c) {
         static_assert(S1 == C1, "pmp_h does not support strides");
         static_assert(S2 == C2, "pmp_h does not support strides");
@@ -154,7 +171,7 @@ struct pmp_h_impl {
      * \param a The input sub expression
      * \param c The output sub expression
      */
-    template <size_t C1, size_t C2, size_t S1, size_t S2, size_t P1, size_t P2, typename A, typename C, cpp_enable_iff(etl::is_3d<A>)>
+    template <size_t C1, size_t C2, size_t S1, size_t S2, size_t P1, size_t P2, typename A, typename C, cpp_enable_iff(etl::is_3d<A> && !vec::pmp_possible<A, C>)>
     static void apply(A&& a, C&& c) {
         static_assert(S1 == C1, "pmp_h does not support strides");
         static_assert(S2 == C2, "pmp_h does not support strides");
@@ -196,7 +213,7 @@ struct pmp_h_impl {
      * \param a The input sub expression
      * \param c The output sub expression
      */
-    template <size_t C1, size_t C2, size_t S1, size_t S2, size_t P1, size_t P2, typename A, typename C, cpp_enable_iff(etl::is_4d<A>)>
+    template <size_t C1, size_t C2, size_t S1, size_t S2, size_t P1, size_t P2, typename A, typename C, cpp_enable_iff(etl::is_4d<A> && !vec::pmp_possible<A, C>)>
     static void apply(A&& a, C&& c) {
         static_assert(S1 == C1, "pmp_h does not support strides");
         static_assert(S2 == C2, "pmp_h does not support strides");
@@ -250,12 +267,32 @@ struct dyn_pmp_h_impl {
     template<typename A>
     static constexpr bool gpu_computable = false;
 
+    /*!
+     * \brief Apply the functor, with the vectorized implementation
+     * \param a The input sub expression
+     * \param c The output sub expression
+     */
+    template <typename A, typename C, cpp_enable_iff(vec::pmp_possible<A, C>)>
+    static void apply(A&& a, C&& c, size_t c1, size_t c2, size_t s1, size_t s2, size_t p1, size_t p2) {
+        cpp_assert(s1 == c1, "pmp_h does not support strides");
+        cpp_assert(s2 == c2, "pmp_h does not support strides");
+        cpp_assert(p1 == 0, "pmp_h does not support pooling");
+        cpp_assert(p2 == 0, "pmp_h does not support pooling");
+
+        cpp_unused(s1);
+        cpp_unused(s2);
+        cpp_unused(p1);
+        cpp_unused(p2);
+
+        vec::pmp_h(a, c, c1, c2);
+    }
+
     /*!
      * \brief Apply the functor
      * \param a The input sub expression
      * \param c The output sub expression
      */
-    template <typename A, typename C, cpp_enable_iff(etl::is_2d<A>)>
+    template <typename A, typename C, cpp_enable_iff(etl::is_2d<A> && !vec::pmp_possible<A, C>)>
     static void apply(A&& a, C&& c, size_t c1, size_t c2, size_t s1, size_t s2, size_t p1, size_t p2) {
         cpp_assert(s1 == c1, "pmp_p does not support strides");
         cpp_assert(s2 == c2, "pmp_p does not support strides");
@@ -293,7 +330,7 @@ struct dyn_pmp_h_impl {
      * \param a The input sub expression
      * \param c The output sub expression
      */
-    template <typename A, typename C, cpp_enable_iff(etl::is_3d<A>)>
+    template <typename A, typename C, cpp_enable_iff(etl::is_3d<A> && !vec::pmp_possible<A, C>)>
     static void apply(A&& a, C&& c, size_t c1, size_t c2, size_t s1, size_t s2, size_t p1, size_t p2) {
         cpp_assert(s1 == c1, "pmp_p does not support strides");
         cpp_assert(s2 == c2, "pmp_p does not support strides");
@@ -340,7 +377,7 @@ struct dyn_pmp_h_impl {
      * \param a The input sub expression
      * \param c The output sub expression
      */
-    template <typename A, typename C, cpp_enable_iff(etl::is_4d<A>)>
+    template <typename A, typename C, cpp_enable_iff(etl::is_4d<A> && !vec::pmp_possible<A, C>)>
     static void apply(A&& a, C&& c, size_t c1, size_t c2, size_t s1, size_t s2, size_t p1, size_t p2) {
         cpp_assert(s1 == c1, "pmp_p does not support strides");
         cpp_assert(s2 == c2, "pmp_p does not support strides");
@@ -491,12 +528,27 @@ struct pmp_p_impl {
     template<typename A>
     static constexpr bool gpu_computable = false;
 
+    /*!
+     * \brief Apply the functor, with the vectorized implementation
+     * \param a The input sub expression
+     * \param c The output sub expression
+     */
+    template <size_t C1, size_t C2, size_t S1, size_t S2, size_t P1, size_t P2, typename A, typename C, cpp_enable_iff(vec::pmp_possible<A, C>)>
+    static void apply(A&& a, C&& c) {
+        static_assert(S1 == C1, "pmp_p does not support strides");
+        static_assert(S2 == C2, "pmp_p does not support strides");
+        static_assert(P1 == 0, "pmp_p does not support padding");
+        static_assert(P2 == 0, "pmp_p does not support padding");
+
+        vec::pmp_p(a, c, C1, C2);
+    }
+
     /*!
      * \brief Apply the functor
      * \param a The input sub expression
      * \param c The output sub expression
      */
-    template <size_t C1, size_t C2, size_t S1, size_t S2, size_t P1, size_t P2, typename A, typename C, cpp_enable_iff(etl::is_2d<A>)>
+    template <size_t C1, size_t C2, size_t S1, size_t S2, size_t P1, size_t P2, typename A, typename C, cpp_enable_iff(etl::is_2d<A> && !vec::pmp_possible<A, C>)>
     static void apply(A&& a, C&& c) {
         static_assert(S1 == C1, "pmp_p does not support strides");
         static_assert(S2 == C2, "pmp_p does not support strides");
@@ -527,7 +579,7 @@ struct pmp_p_impl {
      * \param a The input sub expression
      * \param c The output sub expression
      */
-    template <size_t C1, size_t C2, size_t S1, size_t S2, size_t P1, size_t P2, typename A, typename C, cpp_enable_iff(etl::is_3d<A>)>
+    template <size_t C1, size_t C2, size_t S1, size_t S2, size_t P1, size_t P2, typename A, typename C, cpp_enable_iff(etl::is_3d<A> && !vec::pmp_possible<A, C>)>
     static void apply(A&& a, C&& c) {
         static_assert(S1 == C1, "pmp_p does not support strides");
         static_assert(S2 == C2, "pmp_p does not support strides");
@@ -567,7 +619,7 @@ struct pmp_p_impl {
      * \param a The input sub expression
      * \param c The output sub expression
      */
-    template <size_t C1, size_t C2, size_t S1, size_t S2, size_t P1, size_t P2, typename A, typename C, cpp_enable_iff(etl::is_4d<A>)>
+    template <size_t C1, size_t C2, size_t S1, size_t S2, size_t P1, size_t P2, typename A, typename C, cpp_enable_iff(etl::is_4d<A> && !vec::pmp_possible<A, C>)>
     static void apply(A&& a, C&& c) {
         static_assert(S1 == C1, "pmp_p does not support strides");
         static_assert(S2 == C2, "pmp_p does not support strides");
@@ -619,12 +671,32 @@ struct dyn_pmp_p_impl {
     template<typename A>
     static constexpr bool gpu_computable = false;
 
+    /*!
+     * \brief Apply the functor, with the vectorized implementation
+     * \param a The input sub expression
+     * \param c The output sub expression
+     */
+    template <typename A, typename C, cpp_enable_iff(vec::pmp_possible<A, C>)>
+    static void apply(A&& a, C&& c, size_t c1, size_t c2, size_t s1, size_t s2, size_t p1, size_t p2) {
+        cpp_assert(s1 == c1, "pmp_p does not support strides");
+        cpp_assert(s2 == c2, "pmp_p does not support strides");
+        cpp_assert(p1 == 0, "pmp_p does not support pooling");
+        cpp_assert(p2 == 0, "pmp_p does not support pooling");
+
+        cpp_unused(s1);
+        cpp_unused(s2);
+        cpp_unused(p1);
+        cpp_unused(p2);
+
+        vec::pmp_p(a, c, c1, c2);
+    }
+
     /*!
      * \brief Apply the functor
      * \param a The input sub expression
      * \param c The output sub expression
      */
-    template <typename A, typename C, cpp_enable_iff(etl::is_2d<A>)>
+    template <typename A, typename C, cpp_enable_iff(etl::is_2d<A> && !vec::pmp_possible<A, C>)>
     static void apply(A&& a, C&& c, size_t c1, size_t c2, size_t s1, size_t s2, size_t p1, size_t p2) {
         cpp_assert(s1 == c1, "pmp_p does not support strides");
         cpp_assert(s2 == c2, "pmp_p does not support strides");
@@ -660,7 +732,7 @@ struct dyn_pmp_p_impl {
      * \param a The input sub expression
      * \param c The output sub expression
      */
-    template <typename A, typename C, cpp_enable_iff(etl::is_3d<A>)>
+    template <typename A, typename C, cpp_enable_iff(etl::is_3d<A> && !vec::pmp_possible<A, C>)>
     static void apply(A&& a, C&& c, size_t c1, size_t c2, size_t s1, size_t s2, size_t p1, size_t p2) {
         cpp_assert(s1 == c1, "pmp_p does not support strides");
         cpp_assert(s2 == c2, "pmp_p does not support strides");
@@ -705,7 +777,7 @@ struct dyn_pmp_p_impl {
      * \param a The input sub expression
      * \param c The output sub expression
      */
-    template <typename A, typename C, cpp_enable_iff(etl::is_4d<A>)>
+    template <typename A, typename C, cpp_enable_iff(etl::is_4d<A> && !vec::pmp_possible<A, C>)>
     static void apply(A&& a, C&& c, size_t c1, size_t c2, size_t s1, size_t s2, size_t p1, size_t p2) {
         cpp_assert(s1 == c1, "pmp_p does not support strides");
         cpp_assert(s2 == c2, "pmp_p does not support strides");
@@ -0,0 +1,82 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Selector for the single-pass statistics implementations.
+ */
+
+#pragma once
+
+#include "etl/statistics.hpp"
+
+//Include the implementations
+#include "etl/impl/std/stats.hpp"
+#include "etl/impl/vec/stats.hpp"
+
+namespace etl {
+
+namespace detail {
+
+/*!
+ * \brief Statistics implementation
+ */
+struct stats_impl {
+    /*!
+     * \brief Compute the statistics of the values of e
+     */
+    template <typename E>
+    static statistics<value_t<E>> apply(const E& e) {
+        if /*constexpr*/ (impl::vec::stats_possible<E>) {
+            return impl::vec::stats(e);
+        } else {
+            return impl::standard::stats(e);
+        }
+    }
+};
+
+/*!
+ * \brief Row statistics implementation
+ */
+struct stats_r_impl {
+    /*!
+     * \brief Compute the mean and the variance of each row of a
+     */
+    template <typename A, typename M, typename Var>
+    static void apply(const A& a, M&& mean, Var&& variance) {
+        safe_ensure_cpu_up_to_date(a);
+
+        if /*constexpr*/ (impl::vec::stats_rl_possible<A, M, Var>) {
+            impl::vec::stats_r(a, mean, variance);
+        } else {
+            impl::standard::stats_r(a, mean, variance);
+        }
+    }
+};
+
+/*!
+ * \brief Column statistics implementation
+ */
+struct stats_l_impl {
+    /*!
+     * \brief Compute the mean and the variance of each column of a
+     */
+    template <typename A, typename M, typename Var>
+    static void apply(const A& a, M&& mean, Var&& variance) {
+        safe_ensure_cpu_up_to_date(a);
+
+        if /*constexpr*/ (impl::vec::stats_rl_possible<A, M, Var>) {
+            impl::vec::stats_l(a, mean, variance);
+        } else {
+            impl::standard::stats_l(a, mean, variance);
+        }
+    }
+};
+
+} //end of namespace detail
+
+} //end of namespace etl
@@ -0,0 +1,179 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Standard implementation of the scaled dot-product attention,
+ * softmax(Q * trans(K) / sqrt(D)) * V.
+ *
+ * The inputs are H independent heads of Q [N, D], K [M, D] and V [M, Dv]
+ * stored contiguously. The scores of a query are computed one row at a
+ * time, the [N, M] score matrix is never stored.
+ */
+
+#pragma once
+
+namespace etl {
+
+namespace impl {
+
+namespace standard {
+
+namespace attention_detail {
+
+/*!
+ * \brief Compute the scaled scores of the query q against the M keys of k
+ * \param q The query
+ * \param k The keys
+ * \param M The number of keys
+ * \param D The dimension of the queries and keys
+ * \param scale The scale of the scores
+ * \param s The output scores
+ * \return the maximum score
+ */
+template <typename T>
+T scores(const T* q, const T* k, size_t M, size_t D, T scale, T* s) {
+    T m = std::numeric_limits<T>::lowest();
+
+    for (size_t j = 0; j < M; ++j) {
+        T v = 0;
+
+        for (size_t d = 0; d < D; ++d) {
+            v += q[d] * k[j * D + d];
+        }
+
+        s[j] = scale * v;
+        m    = std::max(m, s[j]);
+    }
+
+    return m;
+}
+
+} //end of namespace attention_detail
+
+/*!
+ * \brief Compute the attention of each head
+ * \param q The queries [H, N, D]
+ * \param k The keys [H, M, D]
+ * \param v The values [H, M, Dv]
+ * \param y The output [H, N, Dv]
+ * \param H The number of heads
+ * \param N The number of queries
+ * \param M The number of keys
+ * \param D The dimension of the queries and keys
+ * \param Dv The dimension of the values
+ */
+template <typename T>
+void attention(const T* q, const T* k, const T* v, T* y, size_t H, size_t N, size_t M, size_t D, size_t Dv) {
+    const T scale = T(1) / std::sqrt(T(D));
+
+    std::vector<T> s(M);
+
+    for (size_t h = 0; h < H; ++h) {
+        for (size_t i = 0; i < N; ++i) {
+            const T m = attention_detail::scores(q + (h * N + i) * D, k + h * M * D, M, D, scale, s.data());
+
+            T* yi = y + (h * N + i) * Dv;
+
+            std::fill(yi, yi + Dv, T(0));
+
+            T l = 0;
+
+            for (size_t j = 0; j < M; ++j) {
+                const T p = std::exp(s[j] - m);
+
+                l += p;
+
+                for (size_t d = 0; d < Dv; ++d) {
+                    yi[d] += p * v[(h * M + j) * Dv + d];
+                }
+            }
+
+            for (size_t d = 0; d < Dv; ++d) {
+                yi[d] /= l;
+            }
+        }
+    }
+}
+
+/*!
+ * \brief Compute the errors of the queries, keys and values of the
+ * attention of each head
+ * \param q The queries [H, N, D]
+ * \param k The keys [H, M, D]
+ * \param v The values [H, M, Dv]
+ * \param o The output of the forward pass [H, N, Dv]
+ * \param dy The errors of the output [H, N, Dv]
+ * \param dq The output errors of the queries
+ * \param dk The output errors of the keys
+ * \param dv The output errors of the values
+ * \param H The number of heads
+ * \param N The number of queries
+ * \param M The number of keys
+ * \param D The dimension of the queries and keys
+ * \param Dv The dimension of the values
+ */
+template <typename T>
+void attention_backward(const T* q, const T* k, const T* v, const T* o, const T* dy, T* dq, T* dk, T* dv, size_t H, size_t N, size_t M, size_t D, size_t Dv) {
+    const T scale = T(1) / std::sqrt(T(D));
+
+    std::fill(dq, dq + H * N * D, T(0));
+    std::fill(dk, dk + H * M * D, T(0));
+    std::fill(dv, dv + H * M * Dv, T(0));
+
+    std::vector<T> s(M);
+
+    for (size_t h = 0; h < H; ++h) {
+        for (size_t i = 0; i < N; ++i) {
+            const T* qi  = q + (h * N + i) * D;
+            const T* oi  = o + (h * N + i) * Dv;
+            const T* dyi = dy + (h * N + i) * Dv;
+
+            const T m = attention_detail::scores(qi, k + h * M * D, M, D, scale, s.data());
+
+            T l = 0;
+
+            for (size_t j = 0; j < M; ++j) {
+                s[j] = std::exp(s[j] - m);
+                l += s[j];
+            }
+
+            // The derivative of the softmax needs sum(dy * o) of the row
+
+            T delta = 0;
+
+            for (size_t d = 0; d < Dv; ++d) {
+                delta += dyi[d] * oi[d];
+            }
+
+            for (size_t j = 0; j < M; ++j) {
+                const T p = s[j] / l;
+
+                const T* vj = v + (h * M + j) * Dv;
+                const T* kj = k + (h * M + j) * D;
+
+                T dp = 0;
+
+                for (size_t d = 0; d < Dv; ++d) {
+                    dv[(h * M + j) * Dv + d] += p * dyi[d];
+                    dp += dyi[d] * vj[d];
+                }
+
+                const T ds = scale * p * (dp - delta);
+
+                for (size_t d = 0; d < D; ++d) {
+                    dq[(h * N + i) * D + d] += ds * kj[d];
+                    dk[(h * M + j) * D + d] += ds * qi[d];
+                }
+            }
+        }
+    }
+}
+
+} //end of namespace standard
+} //end of namespace impl
+} //end of namespace etl
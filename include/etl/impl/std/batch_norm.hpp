@@ -0,0 +1,170 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Standard implementation of the batch normalization.
+ *
+ * The input is seen as a [B, C, S] tensor, normalized per channel C. The
+ * 2D batch normalization has S = 1 and the 4D batch normalization has one
+ * plane of S = H * W elements per sample and channel.
+ */
+
+#pragma once
+
+namespace etl {
+
+namespace impl {
+
+namespace standard {
+
+namespace batch_norm_detail {
+
+/*!
+ * \brief Compute the coefficients of the errors of the input of a channel,
+ * dx = k * dy + p * x + q, and the gradient of gamma.
+ *
+ * This is dx = k * (dy - dbeta / N - x_hat * dgamma / N), with
+ * k = gamma / std, expanded to avoid computing x_hat.
+ *
+ * \param gamma The scale of the channel
+ * \param mean The mean of the channel
+ * \param variance The variance of the channel
+ * \param eps The epsilon added to the variance
+ * \param n The number of elements of the channel
+ * \param sum_dy The sum of dy, the gradient of beta
+ * \param sum_dyx The sum of dy * (x - mean), replaced by the gradient of gamma
+ */
+template <typename T>
+void backward_coefficients(T gamma, T mean, T variance, T eps, T n, T sum_dy, T& sum_dyx, T& k, T& p, T& q) {
+    const T inv_std = T(1) / std::sqrt(variance + eps);
+
+    sum_dyx *= inv_std;
+
+    k = gamma * inv_std;
+    p = -k * inv_std * sum_dyx / n;
+    q = -k * sum_dy / n - p * mean;
+}
+
+} //end of namespace batch_norm_detail
+
+/*!
+ * \brief Compute the mean and the (population) variance of each channel
+ * of x and normalize, scale and shift x into y
+ * \param x The input
+ * \param B The number of samples
+ * \param C The number of channels
+ * \param S The number of elements of a channel of a sample
+ * \param gamma The scale of each channel
+ * \param beta The shift of each channel
+ * \param eps The epsilon added to the variance
+ * \param mean The output means
+ * \param variance The output variances
+ * \param y The output memory
+ */
+template <typename X, typename T>
+void batch_norm_train(const X& x, size_t B, size_t C, size_t S, const T* gamma, const T* beta, T eps, T* mean, T* variance, T* y) {
+    for (size_t c = 0; c < C; ++c) {
+        statistics<T> local;
+
+        for (size_t b = 0; b < B; ++b) {
+            for (size_t s = 0; s < S; ++s) {
+                local.push(x.read_flat((b * C + c) * S + s));
+            }
+        }
+
+        mean[c]     = local.mean;
+        variance[c] = local.variance();
+
+        const T scale = gamma[c] / std::sqrt(variance[c] + eps);
+        const T shift = beta[c] - mean[c] * scale;
+
+        for (size_t b = 0; b < B; ++b) {
+            const size_t base = (b * C + c) * S;
+
+            for (size_t s = 0; s < S; ++s) {
+                y[base + s] = scale * x.read_flat(base + s) + shift;
+            }
+        }
+    }
+}
+
+/*!
+ * \brief Compute y = scale[c] * x + shift[c] for each channel c
+ * \param x The input
+ * \param B The number of samples
+ * \param C The number of channels
+ * \param S The number of elements of a channel of a sample
+ * \param scale The scale of each channel
+ * \param shift The shift of each channel
+ * \param y The output memory
+ */
+template <typename X, typename T>
+void batch_norm_scale_shift(const X& x, size_t B, size_t C, size_t S, const T* scale, const T* shift, T* y) {
+    for (size_t b = 0; b < B; ++b) {
+        for (size_t c = 0; c < C; ++c) {
+            const size_t base = (b * C + c) * S;
+
+            for (size_t s = 0; s < S; ++s) {
+                y[base + s] = scale[c] * x.read_flat(base + s) + shift[c];
+            }
+        }
+    }
+}
+
+/*!
+ * \brief Compute the errors of the input, of gamma and of beta of the
+ * batch normalization of x
+ * \param x The input of the forward pass
+ * \param dy The errors of the output
+ * \param B The number of samples
+ * \param C The number of channels
+ * \param S The number of elements of a channel of a sample
+ * \param gamma The scale of each channel
+ * \param mean The mean of each channel
+ * \param variance The variance of each channel
+ * \param eps The epsilon added to the variance
+ * \param dx The output errors of the input
+ * \param dgamma The output gradients of gamma
+ * \param dbeta The output gradients of beta
+ */
+template <typename X, typename DY, typename T>
+void batch_norm_backward(const X& x, const DY& dy, size_t B, size_t C, size_t S, const T* gamma, const T* mean, const T* variance, T eps, T* dx, T* dgamma, T* dbeta) {
+    for (size_t c = 0; c < C; ++c) {
+        T s1 = 0;
+        T s2 = 0;
+
+        for (size_t b = 0; b < B; ++b) {
+            const size_t base = (b * C + c) * S;
+
+            for (size_t s = 0; s < S; ++s) {
+                const T e = dy.read_flat(base + s);
+
+                s1 += e;
+                s2 += e * (x.read_flat(base + s) - mean[c]);
+            }
+        }
+
+        T k, p, q;
+        batch_norm_detail::backward_coefficients(gamma[c], mean[c], variance[c], eps, T(B * S), s1, s2, k, p, q);
+
+        dbeta[c]  = s1;
+        dgamma[c] = s2;
+
+        for (size_t b = 0; b < B; ++b) {
+            const size_t base = (b * C + c) * S;
+
+            for (size_t s = 0; s < S; ++s) {
+                dx[base + s] = k * dy.read_flat(base + s) + p * x.read_flat(base + s) + q;
+            }
+        }
+    }
+}
+
+} //end of namespace standard
+} //end of namespace impl
+} //end of namespace etl
@@ -39,6 +39,164 @@ value_t<O> cce_error(const O& output, const L& labels, value_t<O> scale) {
 
 }
 
+namespace cce_detail {
+
+/*!
+ * \brief The minimum number of rows of logits of the given length to
+ * compute the fused softmax cross entropy in parallel
+ *
+ * The computation is never parallel if the logits or the labels are not
+ * thread safe.
+ *
+ * \param K The length of each row
+ */
+template <typename O, typename L>
+size_t softmax_cce_threshold(size_t K) {
+    return all_thread_safe<O, L> ? std::max(size_t(1), parallel_threshold / K) : std::numeric_limits<size_t>::max();
+}
+
+/*!
+ * \brief Compute the cross entropy of the softmax of the row i of the
+ * logits with its labels and, if g is not null, write its gradient.
+ * \param x The logits
+ * \param labels The labels, of the same dimensions as the logits
+ * \param i The row
+ * \param K The length of each row
+ * \param g The gradient (softmax - labels) or nullptr
+ * \return the sum of the labels multiplied by the log-softmax of the row
+ */
+template <typename O, typename L, typename T = value_t<O>, cpp_enable_iff(decay_traits<L>::dimensions() == 2)>
+T softmax_cce_row(const O& x, const L& labels, size_t i, size_t K, T* g) {
+    const size_t base = i * K;
+
+    T m = std::numeric_limits<T>::lowest();
+
+    for (size_t k = 0; k < K; ++k) {
+        m = std::max(m, x.read_flat(base + k));
+    }
+
+    T s    = 0;
+    T dot  = 0;
+    T lsum = 0;
+
+    for (size_t k = 0; k < K; ++k) {
+        const T xk = x.read_flat(base + k) - m;
+        const T lk = labels.read_flat(base + k);
+        const T e  = std::exp(xk);
+
+        s += e;
+        dot += lk * xk;
+        lsum += lk;
+
+        if (g) {
+            g[base + k] = e;
+        }
+    }
+
+    if (g) {
+        const T inv = T(1) / s;
+
+        for (size_t k = 0; k < K; ++k) {
+            g[base + k] = g[base + k] * inv - labels.read_flat(base + k);
+        }
+    }
+
+    // The maximum is not added back to avoid cancellation with large logits
+    return dot - std::log(s) * lsum;
+}
+
+/*!
+ * \brief Compute the cross entropy of the softmax of the row i of the
+ * logits with its label index and, if g is not null, write its gradient.
+ * \param x The logits
+ * \param labels The indices of the labels of each row
+ * \param i The row
+ * \param K The length of each row
+ * \param g The gradient (softmax - one_hot(label)) or nullptr
+ * \return the log-softmax of the label of the row
+ */
+template <typename O, typename L, typename T = value_t<O>, cpp_enable_iff(decay_traits<L>::dimensions() == 1)>
+T softmax_cce_row(const O& x, const L& labels, size_t i, size_t K, T* g) {
+    const size_t base = i * K;
+    const size_t y    = labels.read_flat(i);
+
+    cpp_assert(y < K, "Invalid label for softmax_cross_entropy");
+
+    T m = std::numeric_limits<T>::lowest();
+
+    for (size_t k = 0; k < K; ++k) {
+        m = std::max(m, x.read_flat(base + k));
+    }
+
+    T s = 0;
+
+    for (size_t k = 0; k < K; ++k) {
+        const T e = std::exp(x.read_flat(base + k) - m);
+
+        s += e;
+
+        if (g) {
+            g[base + k] = e;
+        }
+    }
+
+    if (g) {
+        const T inv = T(1) / s;
+
+        for (size_t k = 0; k < K; ++k) {
+            g[base + k] *= inv;
+        }
+
+        g[base + y] -= T(1);
+    }
+
+    return (x.read_flat(base + y) - m) - std::log(s);
+}
+
+} //end of namespace cce_detail
+
+/*!
+ * \brief Compute the Categorical Cross Entropy loss of the softmax of the
+ * logits and, optionally, its gradient, in a single pass over each row.
+ *
+ * The loss is scale * sum(log(softmax(logits)) >> labels), the same as
+ * cce_loss(softmax(logits), labels, scale).
+ *
+ * \param logits The logits, one row per sample
+ * \param labels The labels, either of the same dimensions as the logits
+ * or the index of the label of each row
+ * \param scale The scale of the loss
+ * \param gradient The memory of the gradient (softmax - labels) or nullptr
+ * \return the loss
+ */
+template <typename O, typename L>
+value_t<O> softmax_cce(const O& logits, const L& labels, value_t<O> scale, value_t<O>* gradient) {
+    using T = value_t<O>;
+
+    const size_t N = etl::dim<0>(logits);
+    const size_t K = etl::size(logits) / N;
+
+    T loss = 0;
+
+    auto acc_functor = [&loss](T value) {
+        loss += value;
+    };
+
+    auto batch_fun = [&](const size_t first, const size_t last) {
+        T local = 0;
+
+        for (size_t i = first; i < last; ++i) {
+            local += cce_detail::softmax_cce_row(logits, labels, i, K, gradient);
+        }
+
+        return local;
+    };
+
+    engine_dispatch_1d_acc<T>(batch_fun, acc_functor, 0, N, cce_detail::softmax_cce_threshold<O, L>(K));
+
+    return scale * loss;
+}
+
 } //end of namespace standard
 } //end of namespace impl
 } //end of namespace etl
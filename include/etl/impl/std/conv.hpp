@@ -400,17 +400,92 @@ void conv2_valid_flipped(const I& input, const K& kernel, C&& conv, size_t s1, s
     }
 }
 
+/*!
+ * \brief Standard implementation of a dilated 4D 'valid' convolution C = I * K
+ *
+ * A dilated convolution is equivalent to a convolution by the kernel with
+ * (d - 1) zeroes inserted between each of its elements.
+ *
+ * \param input The input matrix
+ * \param kernel The kernel matrix
+ * \param conv The output matrix
+ * \param s1 The first dimension stride
+ * \param s2 The second dimension stride
+ * \param p1 The first dimension padding
+ * \param p2 The second dimension padding
+ * \param d1 The first dimension dilation
+ * \param d2 The second dimension dilation
+ * \tparam Flipped true if the kernels are already flipped, false otherwise
+ */
+template <bool Flipped, typename I, typename K, typename C>
+void conv4_valid_dilated(const I& input, const K& kernel, C&& conv, size_t s1, size_t s2, size_t p1, size_t p2, size_t d1, size_t d2) {
+    using T = value_t<I>;
+
+    const size_t n1 = etl::dim<2>(input);
+    const size_t n2 = etl::dim<3>(input);
+
+    const size_t m1 = etl::dim<2>(kernel);
+    const size_t m2 = etl::dim<3>(kernel);
+
+    for (size_t i = 0; i < etl::dim<0>(conv); ++i) {
+        for (size_t k = 0; k < etl::dim<1>(conv); ++k) {
+            for (size_t oh = 0; oh < etl::dim<2>(conv); ++oh) {
+                for (size_t ow = 0; ow < etl::dim<3>(conv); ++ow) {
+                    T acc(0);
+
+                    for (size_t c = 0; c < etl::dim<1>(kernel); ++c) {
+                        for (size_t a = 0; a < m1; ++a) {
+                            const size_t h = oh * s1 + a * d1;
+
+                            if (h < p1 || h - p1 >= n1) {
+                                continue;
+                            }
+
+                            for (size_t b = 0; b < m2; ++b) {
+                                const size_t w = ow * s2 + b * d2;
+
+                                if (w < p2 || w - p2 >= n2) {
+                                    continue;
+                                }
+
+                                if (Flipped) {
+                                    acc += input(i, c, h - p1, w - p2) * kernel(k, c, a, b);
+                                } else {
+                                    acc += input(i, c, h - p1, w - p2) * kernel(k, c, m1 - 1 - a, m2 - 1 - b);
+                                }
+                            }
+                        }
+                    }
+
+                    conv(i, k, oh, ow) = acc;
+                }
+            }
+        }
+    }
+}
+
 /*!
  * \brief Standard implementation of a 4D 'valid' convolution C = I * K
  * \param input The input matrix
  * \param kernel The kernel matrix
  * \param conv The output matrix
+ * \param s1 The first dimension stride
+ * \param s2 The second dimension stride
+ * \param p1 The first dimension padding
+ * \param p2 The second dimension padding
+ * \param d1 The first dimension dilation
+ * \param d2 The second dimension dilation
  */
 template <typename I, typename K, typename C>
-void conv4_valid(const I& input, const K& kernel, C&& conv, size_t s1, size_t s2, size_t p1, size_t p2) {
+void conv4_valid(const I& input, const K& kernel, C&& conv, size_t s1, size_t s2, size_t p1, size_t p2, size_t d1 = 1, size_t d2 = 1) {
     cpp_assert(etl::dim<1>(input) == etl::dim<1>(kernel), "Invalid number of channels");
     cpp_assert(etl::dim<0>(input) == etl::dim<0>(conv), "Invalid number of images");
 
+    if (d1 > 1 || d2 > 1) {
+        conv4_valid_dilated<false>(input, kernel, conv, s1, s2, p1, p2, d1, d2);
+        return;
+    }
+
     if(etl::dim<1>(kernel) > 0){
         for(size_t i = 0; i < etl::dim<0>(input); ++i){
             for(size_t k = 0; k < etl::dim<0>(kernel); ++k){
@@ -425,16 +500,27 @@ void conv4_valid(const I& input, const K& kernel, C&& conv, size_t s1, size_t s2
 }
 
 /*!
- * \brief Standard implementation of a 4D 'valid' convolution C = I * K
+ * \brief Standard implementation of a 4D 'valid' convolution C = I * K, with flipped kernels
  * \param input The input matrix
  * \param kernel The kernel matrix
  * \param conv The output matrix
+ * \param s1 The first dimension stride
+ * \param s2 The second dimension stride
+ * \param p1 The first dimension padding
+ * \param p2 The second dimension padding
+ * \param d1 The first dimension dilation
+ * \param d2 The second dimension dilation
  */
 template <typename I, typename K, typename C>
-void conv4_valid_flipped(const I& input, const K& kernel, C&& conv, size_t s1, size_t s2, size_t p1, size_t p2) {
+void conv4_valid_flipped(const I& input, const K& kernel, C&& conv, size_t s1, size_t s2, size_t p1, size_t p2, size_t d1 = 1, size_t d2 = 1) {
     cpp_assert(etl::dim<1>(input) == etl::dim<1>(kernel), "Invalid number of channels");
     cpp_assert(etl::dim<0>(input) == etl::dim<0>(conv), "Invalid number of images");
 
+    if (d1 > 1 || d2 > 1) {
+        conv4_valid_dilated<true>(input, kernel, conv, s1, s2, p1, p2, d1, d2);
+        return;
+    }
+
     if(etl::dim<1>(kernel) > 0){
         for(size_t i = 0; i < etl::dim<0>(input); ++i){
             for(size_t k = 0; k < etl::dim<0>(kernel); ++k){
@@ -8,157 +8,756 @@
 /*!
  * \file
  * \brief Standard implementation of the decompositions
+ *
+ * The LU and QR decompositions are computed with right-looking blocked
+ * algorithms. Only the panels are factorized one column at a time, the
+ * updates of the trailing matrices are done with GEMM (BLAS or the
+ * vectorized GEMM kernels), where most of the time is spent for large
+ * matrices.
  */
 
 #pragma once
 
+#include "etl/impl/blas/gemm.hpp"
+#include "etl/impl/vec/gemm_rr_to_r.hpp"
+
 namespace etl {
 
 namespace impl {
 
 namespace standard {
 
+namespace decomposition_detail {
+
+constexpr size_t lu_block_size  = 64; ///< The number of columns of the LU panels
+constexpr size_t qr_block_size  = 32; ///< The number of columns of the QR panels
+constexpr size_t cholesky_block_size = 64; ///< The number of columns of the Cholesky panels
+constexpr size_t trsm_block_size = 64; ///< The number of rows of the diagonal blocks of the triangular solves
+constexpr size_t gemm_panel_width = 256; ///< The number of columns of the packed panels of the updates
+
 /*!
- * \brief Performs the PA=LU decomposition of the matrix A
- * \param A The matrix to decompose
- * \param L The resulting L matrix
- * \param U The resulting U matrix
- * \param P The resulting P matrix
+ * \brief Indicates if the vectorized kernels can be used for the given type
  */
-template <typename AT, typename LT, typename UT, typename PT>
-void lu(const AT& A, LT& L, UT& U, PT& P) {
-    const auto n = etl::dim(A, 0);
+template <typename T>
+constexpr bool vec_possible = vec_enabled && is_floating_t<T>;
 
-    L = 0;
-    U = 0;
-    P = 0;
+/*!
+ * \brief Compute y += alpha * x
+ * \param y The output vector
+ * \param x The input vector
+ * \param alpha The multiplicator
+ * \param n The number of elements
+ */
+template <typename V, typename T, cpp_enable_iff(vec_possible<T>)>
+void axpy(T* y, const T* x, T alpha, size_t n) {
+    static constexpr size_t vec_size = V::template traits<T>::size;
+
+    auto a = V::set(alpha);
 
-    // 1. Create the pivot matrix
+    size_t j = 0;
 
-    for(size_t i = 0; i < n; ++i){
-        P(i, i) = 1;
+    for (; j + vec_size - 1 < n; j += vec_size) {
+        V::storeu(y + j, V::fmadd(a, V::loadu(x + j), V::loadu(y + j)));
     }
 
-    for(size_t i = 0; i < n; ++i){
-        auto max_j = i;
+    for (; j < n; ++j) {
+        y[j] += alpha * x[j];
+    }
+}
 
-        for(size_t j = i; j < n; ++j){
-            if(std::abs(A(j, i)) > A(max_j, i)){
-                max_j = j;
+/*!
+ * \copydoc axpy
+ */
+template <typename V, typename T, cpp_disable_iff(vec_possible<T>)>
+void axpy(T* y, const T* x, T alpha, size_t n) {
+    for (size_t j = 0; j < n; ++j) {
+        y[j] += alpha * x[j];
+    }
+}
+
+/*!
+ * \brief Compute C += alpha * A * B for row-major blocks of larger
+ * matrices.
+ *
+ * \param alpha The multiplicator
+ * \param a The A block (MxK)
+ * \param lda The leading dimension of A
+ * \param b The B block (KxN)
+ * \param ldb The leading dimension of B
+ * \param c The C block (MxN)
+ * \param ldc The leading dimension of C
+ */
+template <typename T>
+void gemm(T alpha, const T* a, size_t lda, const T* b, size_t ldb, T* c, size_t ldc, size_t M, size_t N, size_t K) {
+    if (!M || !N || !K) {
+        return;
+    }
+
+#ifdef ETL_BLAS_MODE
+    if /*constexpr*/ (is_floating_t<T>) {
+        etl::impl::blas::cblas_gemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, M, N, K, alpha, a, lda, b, ldb, T(1), c, ldc);
+        return;
+    }
+#endif
+
+    if /*constexpr*/ (vec_possible<T>) {
+        // Pack alpha * B into contiguous panels for the vectorized kernel
+        etl::dyn_matrix<T, 2> panel(K, std::min(N, gemm_panel_width));
+
+        for (size_t j = 0; j < N; j += gemm_panel_width) {
+            const size_t nb = std::min(gemm_panel_width, N - j);
+
+            for (size_t k = 0; k < K; ++k) {
+                for (size_t jj = 0; jj < nb; ++jj) {
+                    panel.memory_start()[k * nb + jj] = alpha * b[k * ldb + j + jj];
+                }
+            }
+
+            etl::impl::vec::gemm_panel_kernel_rr_to_r<default_vec>(a, lda, panel.memory_start(), c + j, ldc, M, nb, K);
+        }
+    } else {
+        for (size_t i = 0; i < M; ++i) {
+            for (size_t k = 0; k < K; ++k) {
+                axpy<default_vec>(c + i * ldc, b + k * ldb, alpha * a[i * lda + k], N);
             }
         }
+    }
+}
 
-        if(max_j != i){
-            for(size_t k = 0; k < n; ++k){
-                using std::swap;
-                swap(P(i, k), P(max_j, k));
+/*!
+ * \brief Solve L * X = B in place, with L unit lower triangular
+ * \param l The L matrix
+ * \param ldl The leading dimension of L
+ * \param x The right hand sides (B), replaced with the solutions (X)
+ * \param ldx The leading dimension of X
+ * \param n The dimension of L
+ * \param nrhs The number of right hand sides
+ */
+template <typename T>
+void trsm_lower_unit(const T* l, size_t ldl, T* x, size_t ldx, size_t n, size_t nrhs) {
+    for (size_t k0 = 0; k0 < n; k0 += trsm_block_size) {
+        const size_t k1 = std::min(n, k0 + trsm_block_size);
+
+        for (size_t i = k0 + 1; i < k1; ++i) {
+            for (size_t j = k0; j < i; ++j) {
+                axpy<default_vec>(x + i * ldx, x + j * ldx, -l[i * ldl + j], nrhs);
             }
         }
+
+        gemm(T(-1), l + k1 * ldl + k0, ldl, x + k0 * ldx, ldx, x + k1 * ldx, ldx, n - k1, nrhs, k1 - k0);
     }
+}
 
-    auto Ap = etl::force_temporary(P * A);
+/*!
+ * \brief Solve L * X = B in place, with L lower triangular
+ * \param l The L matrix
+ * \param ldl The leading dimension of L
+ * \param x The right hand sides (B), replaced with the solutions (X)
+ * \param ldx The leading dimension of X
+ * \param n The dimension of L
+ * \param nrhs The number of right hand sides
+ */
+template <typename T>
+void trsm_lower(const T* l, size_t ldl, T* x, size_t ldx, size_t n, size_t nrhs) {
+    for (size_t k0 = 0; k0 < n; k0 += trsm_block_size) {
+        const size_t k1 = std::min(n, k0 + trsm_block_size);
+
+        for (size_t i = k0; i < k1; ++i) {
+            for (size_t j = k0; j < i; ++j) {
+                axpy<default_vec>(x + i * ldx, x + j * ldx, -l[i * ldl + j], nrhs);
+            }
 
-    for(size_t i = 0; i < n; ++i){
-        L(i, i) = 1;
+            const T inv_diag = T(1) / l[i * ldl + i];
+
+            for (size_t jj = 0; jj < nrhs; ++jj) {
+                x[i * ldx + jj] *= inv_diag;
+            }
+        }
+
+        gemm(T(-1), l + k1 * ldl + k0, ldl, x + k0 * ldx, ldx, x + k1 * ldx, ldx, n - k1, nrhs, k1 - k0);
     }
+}
 
-    for (size_t i = 0; i < n; ++i) {
-        for (size_t j = 0; j < n; ++j) {
-            if (j <= i) {
-                value_t<AT> s = 0;
-                for (size_t k = 0; k < j; ++k) {
-                    s += L(j, k) * U(k, i);
+/*!
+ * \brief Solve U * X = B in place, with U upper triangular
+ * \param u The U matrix
+ * \param ldu The leading dimension of U
+ * \param x The right hand sides (B), replaced with the solutions (X)
+ * \param ldx The leading dimension of X
+ * \param n The dimension of U
+ * \param nrhs The number of right hand sides
+ */
+template <typename T>
+void trsm_upper(const T* u, size_t ldu, T* x, size_t ldx, size_t n, size_t nrhs) {
+    for (size_t k1 = n; k1 > 0;) {
+        const size_t k0 = k1 > trsm_block_size ? k1 - trsm_block_size : 0;
+
+        for (size_t i = k1; i-- > k0;) {
+            for (size_t j = i + 1; j < k1; ++j) {
+                axpy<default_vec>(x + i * ldx, x + j * ldx, -u[i * ldu + j], nrhs);
+            }
+
+            const T inv_diag = T(1) / u[i * ldu + i];
+
+            for (size_t jj = 0; jj < nrhs; ++jj) {
+                x[i * ldx + jj] *= inv_diag;
+            }
+        }
+
+        gemm(T(-1), u + k0, ldu, x + k0 * ldx, ldx, x, ldx, k0, nrhs, k1 - k0);
+
+        k1 = k0;
+    }
+}
+
+/*!
+ * \brief Compute X = inv(L), with L lower triangular.
+ *
+ * The inverse is computed one block row at a time. The off-diagonal blocks
+ * of the block row i are computed with GEMM from the previous block rows,
+ * X(i, :i) = -inv(L(i, i)) * L(i, :i) * X(:i, :i), and the diagonal block
+ * is the inverse of the diagonal block of L.
+ *
+ * \param l The L matrix (n x n)
+ * \param x The inverse (n x n, output)
+ * \param n The dimension of L
+ */
+template <typename T>
+void trtri_lower(const T* l, T* x, size_t n) {
+    std::fill(x, x + n * n, T(0));
+
+    for (size_t i0 = 0; i0 < n; i0 += trsm_block_size) {
+        const size_t i1 = std::min(n, i0 + trsm_block_size);
+        const size_t ib = i1 - i0;
+
+        // X(i, :i) = -L(i, :i) * X(:i, :i)
+        gemm(T(-1), l + i0 * n, n, x, n, x + i0 * n, n, ib, i0, i0);
+
+        // X(i, i) = I
+        for (size_t i = i0; i < i1; ++i) {
+            x[i * n + i] = T(1);
+        }
+
+        // X(i, :i+1) = inv(L(i, i)) * X(i, :i+1)
+        trsm_lower(l + i0 * n + i0, n, x + i0 * n, n, ib, i1);
+    }
+}
+
+/*!
+ * \brief Compute the PA = LU factorization in place, with partial
+ * pivoting.
+ *
+ * The unit lower triangular L and the upper triangular U are stored in
+ * place of A. The row i has been swapped with the row piv[i] at the step
+ * i of the factorization.
+ *
+ * \param a The matrix to factorize (n x n)
+ * \param n The dimension of the matrix
+ * \param piv The pivots (output)
+ * \return the number of row swaps
+ */
+template <typename T>
+size_t lu_factor(T* a, size_t n, size_t* piv) {
+    size_t swaps = 0;
+
+    for (size_t k0 = 0; k0 < n; k0 += lu_block_size) {
+        const size_t k1 = std::min(n, k0 + lu_block_size);
+
+        // 1. Factorize the panel A[k0:n, k0:k1]
+
+        for (size_t k = k0; k < k1; ++k) {
+            size_t p = k;
+
+            for (size_t i = k + 1; i < n; ++i) {
+                if (std::abs(a[i * n + k]) > std::abs(a[p * n + k])) {
+                    p = i;
                 }
+            }
+
+            piv[k] = p;
 
-                U(j, i) = Ap(j, i) - s;
+            if (p != k) {
+                std::swap_ranges(a + k * n, a + (k + 1) * n, a + p * n);
+                ++swaps;
             }
 
-            if (j >= i) {
-                value_t<AT> s = 0;
-                for (size_t k = 0; k < i; ++k) {
-                    s += L(j, k) * U(k, i);
+            if (a[k * n + k] != T(0)) {
+                const T inv_pivot = T(1) / a[k * n + k];
+
+                for (size_t i = k + 1; i < n; ++i) {
+                    a[i * n + k] *= inv_pivot;
                 }
+            }
 
-                L(j, i) = (Ap(j, i) - s) / U(i, i);
+            for (size_t i = k + 1; i < n; ++i) {
+                axpy<default_vec>(a + i * n + k + 1, a + k * n + k + 1, -a[i * n + k], k1 - k - 1);
             }
         }
+
+        // 2. U12 = inv(L11) * A12
+
+        for (size_t i = k0 + 1; i < k1; ++i) {
+            for (size_t j = k0; j < i; ++j) {
+                axpy<default_vec>(a + i * n + k1, a + j * n + k1, -a[i * n + j], n - k1);
+            }
+        }
+
+        // 3. A22 = A22 - L21 * U12
+
+        gemm(T(-1), a + k1 * n + k0, n, a + k0 * n + k1, n, a + k1 * n + k1, n, n - k1, n - k1, k1 - k0);
     }
+
+    return swaps;
 }
 
 /*!
- * \brief Use the householder algorithm to perform the A=QR decomposition of the matrix A
- * \param A The matrix to decompose
- * \param Q The resulting Q matrix
- * \param R The resulting R matrix
+ * \brief Compute the A = LL' factorization in place.
+ *
+ * Only the lower triangle of A is read. L is stored in the lower triangle
+ * of A and the strict upper triangle is set to zero.
+ *
+ * \param a The symmetric positive definite matrix to factorize (n x n)
+ * \param n The dimension of the matrix
+ * \return true if the factorization succeeded, false if the matrix is
+ * not positive definite
  */
-template <typename AT, typename QT, typename RT>
-void householder(AT& A, QT& Q, RT& R) {
-    using T = value_t<AT>;
+template <typename T>
+bool cholesky_factor(T* a, size_t n) {
+    etl::dyn_matrix<T, 2> panel_t(cholesky_block_size, n);
 
-    const auto m = etl::dim<0>(A);
-    const auto n = etl::dim<1>(A);
+    for (size_t k0 = 0; k0 < n; k0 += cholesky_block_size) {
+        const size_t k1 = std::min(n, k0 + cholesky_block_size);
+        const size_t kb = k1 - k0;
 
-    std::vector<etl::dyn_matrix<T, 2>> q;
-    q.reserve(m);
+        // 1. Factorize the diagonal block A11 = L11 * L11'
 
-    for(size_t i = 0; i < m; ++i){
-        q.emplace_back(m, m);
-    }
+        for (size_t j = k0; j < k1; ++j) {
+            T d = a[j * n + j];
+
+            for (size_t p = k0; p < j; ++p) {
+                d -= a[j * n + p] * a[j * n + p];
+            }
+
+            if (!(d > T(0))) {
+                return false;
+            }
+
+            d = std::sqrt(d);
 
-    etl::dyn_matrix<T> z(m, n);
-    z = A;
+            a[j * n + j] = d;
 
-    for (size_t k = 0; k < n && k < m - 1; k++) {
-        etl::dyn_matrix<T> zz(m, n, T(0));
+            const T inv_d = T(1) / d;
 
-        for(size_t i = 0; i < k; ++i){
-            zz(i, i) = 1;
+            for (size_t i = j + 1; i < k1; ++i) {
+                T v = a[i * n + j];
+
+                for (size_t p = k0; p < j; ++p) {
+                    v -= a[i * n + p] * a[j * n + p];
+                }
+
+                a[i * n + j] = v * inv_d;
+            }
+        }
+
+        if (k1 == n) {
+            break;
         }
 
-        for(size_t i = k; i < m; ++i){
-            for(size_t j = k; j < n; ++j){
-                zz(i, j) = z(i, j);
+        // 2. L21 = A21 * inv(L11')
+
+        for (size_t i = k1; i < n; ++i) {
+            for (size_t j = k0; j < k1; ++j) {
+                T v = a[i * n + j];
+
+                for (size_t p = k0; p < j; ++p) {
+                    v -= a[i * n + p] * a[j * n + p];
+                }
+
+                a[i * n + j] = v / a[j * n + j];
             }
         }
 
-        z = std::move(zz);
+        // 3. A22 = A22 - L21 * L21', only the lower triangle is updated
 
-        // x -> Take k-th column of z
-        etl::dyn_vector<T> x(m);
+        const size_t m = n - k1;
 
-        for(size_t i = 0; i < m; ++i){
-            x[i] = z(i, k);
+        for (size_t i = 0; i < m; ++i) {
+            for (size_t p = 0; p < kb; ++p) {
+                panel_t(p, i) = a[(k1 + i) * n + k0 + p];
+            }
         }
 
-        auto a = norm(x);
-        if (A(k, k) > 0) {
-            a = -a;
+        for (size_t j = 0; j < m; j += gemm_panel_width) {
+            const size_t nb = std::min(gemm_panel_width, m - j);
+
+            gemm(T(-1), a + (k1 + j) * n + k0, n, panel_t.memory_start() + j, n, a + (k1 + j) * n + k1 + j, n, m - j, nb, kb);
         }
+    }
+
+    for (size_t i = 0; i < n; ++i) {
+        std::fill(a + i * n + i + 1, a + (i + 1) * n, T(0));
+    }
 
-        x[k] += a;
+    return true;
+}
 
-        x /= norm(x);
+/*!
+ * \brief Compute the A = QR factorization in place with Householder
+ * reflectors.
+ *
+ * R is stored in the upper triangle of A and the reflectors
+ * H(k) = I - tau[k] * v * v' below the diagonal, with the implicit unit
+ * first element of v (LAPACK convention).
+ *
+ * \param a The matrix to factorize (m x n)
+ * \param m The number of rows of the matrix
+ * \param n The number of columns of the matrix
+ * \param tau The scalar factors of the reflectors (output, min(m, n))
+ */
+template <typename T>
+void qr_factor(T* a, size_t m, size_t n, T* tau);
 
-        for(size_t i = 0; i < m; ++i){
-            for(size_t j = 0; j < m; ++j){
-                q[k](i, j) = T(-2) * x[i] * x[j];
+/*!
+ * \brief A block of Householder reflectors, in the compact WY form
+ * H = I - V * T * V'.
+ */
+template <typename T>
+struct householder_block {
+    size_t k0; ///< The first row of the reflectors
+    size_t kb; ///< The number of reflectors
+
+    etl::dyn_matrix<T, 2> v;  ///< The reflectors (m - k0 x kb)
+    etl::dyn_matrix<T, 2> vt; ///< The transposed reflectors (kb x m - k0)
+    etl::dyn_matrix<T, 2> t;  ///< The upper triangular factor (kb x kb)
+
+    /*!
+     * \brief Build the block of the reflectors k0 to k0 + kb of the
+     * factorized matrix a
+     */
+    householder_block(const T* a, size_t m, size_t n, const T* tau, size_t k0, size_t kb)
+            : k0(k0), kb(kb), v(m - k0, kb), vt(kb, m - k0), t(kb, kb) {
+        const size_t mm = m - k0;
+
+        for (size_t i = 0; i < mm; ++i) {
+            for (size_t j = 0; j < kb; ++j) {
+                v(i, j) = i > j ? a[(k0 + i) * n + k0 + j] : (i == j ? T(1) : T(0));
+                vt(j, i) = v(i, j);
             }
+        }
+
+        // T(0:j, j) = -tau(j) * T(0:j, 0:j) * V(:, 0:j)' * v(j)
+
+        t = T(0);
+
+        for (size_t j = 0; j < kb; ++j) {
+            t(j, j) = tau[k0 + j];
+
+            for (size_t i = 0; i < j; ++i) {
+                T s(0);
+
+                for (size_t r = j; r < mm; ++r) {
+                    s += vt(i, r) * vt(j, r);
+                }
+
+                t(i, j) = -tau[k0 + j] * s;
+            }
+
+            for (size_t i = 0; i < j; ++i) {
+                T s(0);
+
+                for (size_t r = i; r < j; ++r) {
+                    s += t(i, r) * t(r, j);
+                }
+
+                t(i, j) = s;
+            }
+        }
+    }
+
+    /*!
+     * \brief Apply H or H' to the rows k0 to m of the given matrix
+     * \param c The matrix (m x nc)
+     * \param ldc The leading dimension of c
+     * \param nc The number of columns to update
+     * \param transpose Indicates if H' must be applied instead of H
+     */
+    void apply(T* c, size_t ldc, size_t nc, bool transpose) {
+        const size_t mm = v.template dim<0>();
+
+        if (!nc) {
+            return;
+        }
+
+        // W = V' * C
+
+        etl::dyn_matrix<T, 2> w(kb, nc, T(0));
+        gemm(T(1), vt.memory_start(), mm, c + k0 * ldc, ldc, w.memory_start(), nc, kb, nc, mm);
+
+        // W = T * W or W = T' * W (T is upper triangular)
 
-            q[k](i, i) += 1;
+        if (transpose) {
+            for (size_t j = kb; j-- > 0;) {
+                for (size_t jj = 0; jj < nc; ++jj) {
+                    w(j, jj) *= t(j, j);
+                }
+
+                for (size_t i = 0; i < j; ++i) {
+                    axpy<default_vec>(w.memory_start() + j * nc, w.memory_start() + i * nc, t(i, j), nc);
+                }
+            }
+        } else {
+            for (size_t i = 0; i < kb; ++i) {
+                for (size_t jj = 0; jj < nc; ++jj) {
+                    w(i, jj) *= t(i, i);
+                }
+
+                for (size_t j = i + 1; j < kb; ++j) {
+                    axpy<default_vec>(w.memory_start() + i * nc, w.memory_start() + j * nc, t(i, j), nc);
+                }
+            }
         }
 
-        z = q[k] * z;
+        // C = C - V * W
+
+        gemm(T(-1), v.memory_start(), kb, w.memory_start(), nc, c + k0 * ldc, ldc, mm, nc, kb);
     }
+};
+
+template <typename T>
+void qr_factor(T* a, size_t m, size_t n, T* tau) {
+    const size_t k = std::min(m, n);
+
+    etl::dyn_vector<T> w(n);
+
+    for (size_t k0 = 0; k0 < k; k0 += qr_block_size) {
+        const size_t k1 = std::min(k, k0 + qr_block_size);
+
+        // 1. Factorize the panel A[k0:m, k0:k1]
+
+        for (size_t j = k0; j < k1; ++j) {
+            T alpha = a[j * n + j];
+            T sigma(0);
+
+            for (size_t i = j + 1; i < m; ++i) {
+                sigma += a[i * n + j] * a[i * n + j];
+            }
+
+            if (sigma == T(0)) {
+                tau[j] = T(0);
+                continue;
+            }
+
+            T beta = std::sqrt(alpha * alpha + sigma);
+
+            if (alpha > T(0)) {
+                beta = -beta;
+            }
 
-    Q = q[0];
+            tau[j] = (beta - alpha) / beta;
 
-    for (size_t i = 1; i < n && i < m - 1; i++) {
-        Q = q[i] * Q;
+            const T scale = T(1) / (alpha - beta);
+
+            for (size_t i = j + 1; i < m; ++i) {
+                a[i * n + j] *= scale;
+            }
+
+            a[j * n + j] = beta;
+
+            // Apply H(j) to the rest of the panel
+
+            const size_t nc = k1 - j - 1;
+
+            if (nc) {
+                auto* wp = w.memory_start();
+
+                std::copy(a + j * n + j + 1, a + j * n + k1, wp);
+
+                for (size_t i = j + 1; i < m; ++i) {
+                    axpy<default_vec>(wp, a + i * n + j + 1, a[i * n + j], nc);
+                }
+
+                axpy<default_vec>(a + j * n + j + 1, wp, -tau[j], nc);
+
+                for (size_t i = j + 1; i < m; ++i) {
+                    axpy<default_vec>(a + i * n + j + 1, wp, -tau[j] * a[i * n + j], nc);
+                }
+            }
+        }
+
+        // 2. Apply H' to the trailing matrix A[k0:m, k1:n]
+
+        if (k1 < n) {
+            householder_block<T> block(a, m, n, tau, k0, k1 - k0);
+            block.apply(a + k1, n, n - k1, true);
+        }
     }
+}
 
-    R = Q * A;
+/*!
+ * \brief Copy the given 2D expression into a row-major buffer
+ * \param a The expression to copy
+ * \param buffer The row-major buffer
+ */
+template <typename AT, typename T>
+void copy_row_major(const AT& a, etl::dyn_matrix<T, 2>& buffer) {
+    const auto m = etl::dim<0>(a);
+    const auto n = etl::dim<1>(a);
 
-    Q = transpose(Q);
+    for (size_t i = 0; i < m; ++i) {
+        for (size_t j = 0; j < n; ++j) {
+            buffer(i, j) = a(i, j);
+        }
+    }
+}
+
+/*!
+ * \brief Copy the right hand sides into a row-major buffer
+ * \param b The right hand sides (vector or matrix)
+ * \param buffer The row-major buffer
+ */
+template <typename BT, typename T, cpp_enable_iff(etl::dimensions<BT>() == 1)>
+void copy_rhs(const BT& b, etl::dyn_matrix<T, 2>& buffer) {
+    for (size_t i = 0; i < etl::dim<0>(b); ++i) {
+        buffer(i, 0) = b(i);
+    }
+}
+
+/*!
+ * \copydoc copy_rhs
+ */
+template <typename BT, typename T, cpp_enable_iff(etl::dimensions<BT>() == 2)>
+void copy_rhs(const BT& b, etl::dyn_matrix<T, 2>& buffer) {
+    copy_row_major(b, buffer);
+}
+
+/*!
+ * \brief Copy the solutions from a row-major buffer
+ * \param buffer The row-major buffer
+ * \param x The solutions (vector or matrix)
+ */
+template <typename T, typename XT, cpp_enable_iff(etl::dimensions<XT>() == 1)>
+void copy_solution(const etl::dyn_matrix<T, 2>& buffer, XT& x) {
+    for (size_t i = 0; i < etl::dim<0>(x); ++i) {
+        x(i) = buffer(i, 0);
+    }
+}
+
+/*!
+ * \copydoc copy_solution
+ */
+template <typename T, typename XT, cpp_enable_iff(etl::dimensions<XT>() == 2)>
+void copy_solution(const etl::dyn_matrix<T, 2>& buffer, XT& x) {
+    for (size_t i = 0; i < etl::dim<0>(x); ++i) {
+        for (size_t j = 0; j < etl::dim<1>(x); ++j) {
+            x(i, j) = buffer(i, j);
+        }
+    }
+}
+
+} //end of namespace decomposition_detail
+
+/*!
+ * \brief Performs the PA=LU decomposition of the matrix A
+ * \param A The matrix to decompose
+ * \param L The resulting L matrix
+ * \param U The resulting U matrix
+ * \param P The resulting P matrix
+ */
+template <typename AT, typename LT, typename UT, typename PT>
+void lu(const AT& A, LT& L, UT& U, PT& P) {
+    using T = value_t<AT>;
+
+    const auto n = etl::dim(A, 0);
+
+    etl::dyn_matrix<T, 2> a(n, n);
+    decomposition_detail::copy_row_major(A, a);
+
+    std::vector<size_t> piv(n);
+    decomposition_detail::lu_factor(a.memory_start(), n, piv.data());
+
+    L = 0;
+    U = 0;
+    P = 0;
+
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t j = 0; j < i; ++j) {
+            L(i, j) = a(i, j);
+        }
+
+        L(i, i) = 1;
+
+        for (size_t j = i; j < n; ++j) {
+            U(i, j) = a(i, j);
+        }
+    }
+
+    // Row i of PA is the row perm[i] of A
+
+    std::vector<size_t> perm(n);
+
+    for (size_t i = 0; i < n; ++i) {
+        perm[i] = i;
+    }
+
+    for (size_t i = 0; i < n; ++i) {
+        std::swap(perm[i], perm[piv[i]]);
+    }
+
+    for (size_t i = 0; i < n; ++i) {
+        P(i, perm[i]) = 1;
+    }
+}
+
+/*!
+ * \brief Use the householder algorithm to perform the A=QR decomposition of the matrix A
+ * \param A The matrix to decompose
+ * \param Q The resulting Q matrix
+ * \param R The resulting R matrix
+ */
+template <typename AT, typename QT, typename RT>
+void householder(AT& A, QT& Q, RT& R) {
+    using T = value_t<AT>;
+
+    const auto m = etl::dim<0>(A);
+    const auto n = etl::dim<1>(A);
+    const auto k = std::min(m, n);
+
+    etl::dyn_matrix<T, 2> a(m, n);
+    decomposition_detail::copy_row_major(A, a);
+
+    etl::dyn_vector<T> tau(std::max(k, size_t(1)));
+    decomposition_detail::qr_factor(a.memory_start(), m, n, tau.memory_start());
+
+    R = 0;
+
+    for (size_t i = 0; i < k; ++i) {
+        for (size_t j = i; j < n; ++j) {
+            R(i, j) = a(i, j);
+        }
+    }
+
+    // Q = H(0) * H(1) * ... * H(k-1), accumulated backward
+
+    etl::dyn_matrix<T, 2> q(m, m, T(0));
+
+    for (size_t i = 0; i < m; ++i) {
+        q(i, i) = 1;
+    }
+
+    const size_t nb = decomposition_detail::qr_block_size;
+
+    for (size_t k0 = ((k + nb - 1) / nb) * nb; k0 > 0;) {
+        k0 -= nb;
+
+        decomposition_detail::householder_block<T> block(a.memory_start(), m, n, tau.memory_start(), k0, std::min(k, k0 + nb) - k0);
+        block.apply(q.memory_start() + k0, m, m - k0, false);
+    }
+
+    for (size_t i = 0; i < m; ++i) {
+        for (size_t j = 0; j < m; ++j) {
+            Q(i, j) = q(i, j);
+        }
+    }
 }
 
 /*!
@@ -172,6 +771,135 @@ void qr(AT& A, QT& Q, RT& R) {
     householder(A, Q, R);
 }
 
+/*!
+ * \brief Performs the A = LL' (Cholesky) decomposition of the symmetric
+ * positive definite matrix A
+ * \param A The matrix to decompose
+ * \param L The resulting L matrix
+ * \return true if the decomposition succeeded, false if A is not
+ * positive definite
+ */
+template <typename AT, typename LT>
+bool cholesky(const AT& A, LT& L) {
+    using T = value_t<AT>;
+
+    const auto n = etl::dim<0>(A);
+
+    etl::dyn_matrix<T, 2> a(n, n);
+    decomposition_detail::copy_row_major(A, a);
+
+    if (!decomposition_detail::cholesky_factor(a.memory_start(), n)) {
+        return false;
+    }
+
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t j = 0; j < n; ++j) {
+            L(i, j) = a(i, j);
+        }
+    }
+
+    return true;
+}
+
+/*!
+ * \brief Solve the system A * X = B.
+ *
+ * Square systems are solved with the LU decomposition with partial
+ * pivoting. Overdetermined systems (more rows than columns) are solved in
+ * the least-squares sense with the QR decomposition.
+ *
+ * \param A The matrix of the system (m x n, m >= n)
+ * \param B The right hand sides (vector of m elements or m x nrhs matrix)
+ * \param X The solutions (vector of n elements or n x nrhs matrix)
+ */
+template <typename AT, typename BT, typename XT>
+void solve(const AT& A, const BT& B, XT& X) {
+    using T = value_t<AT>;
+
+    const auto m    = etl::dim<0>(A);
+    const auto n    = etl::dim<1>(A);
+    const auto nrhs = etl::size(B) / m;
+
+    etl::dyn_matrix<T, 2> a(m, n);
+    decomposition_detail::copy_row_major(A, a);
+
+    etl::dyn_matrix<T, 2> x(m, nrhs);
+    decomposition_detail::copy_rhs(B, x);
+
+    if (m == n) {
+        std::vector<size_t> piv(n);
+        decomposition_detail::lu_factor(a.memory_start(), n, piv.data());
+
+        for (size_t i = 0; i < n; ++i) {
+            if (piv[i] != i) {
+                std::swap_ranges(x.memory_start() + i * nrhs, x.memory_start() + (i + 1) * nrhs, x.memory_start() + piv[i] * nrhs);
+            }
+        }
+
+        decomposition_detail::trsm_lower_unit(a.memory_start(), n, x.memory_start(), nrhs, n, nrhs);
+    } else {
+        etl::dyn_vector<T> tau(n);
+        decomposition_detail::qr_factor(a.memory_start(), m, n, tau.memory_start());
+
+        const size_t nb = decomposition_detail::qr_block_size;
+
+        for (size_t k0 = 0; k0 < n; k0 += nb) {
+            decomposition_detail::householder_block<T> block(a.memory_start(), m, n, tau.memory_start(), k0, std::min(n, k0 + nb) - k0);
+            block.apply(x.memory_start(), nrhs, nrhs, true);
+        }
+    }
+
+    decomposition_detail::trsm_upper(a.memory_start(), n, x.memory_start(), nrhs, n, nrhs);
+
+    decomposition_detail::copy_solution(x, X);
+}
+
+/*!
+ * \brief Solve the system A * X = B, with A symmetric positive definite,
+ * with the Cholesky decomposition.
+ *
+ * If A is not positive definite, the system is solved with the LU
+ * decomposition instead.
+ *
+ * \param A The matrix of the system (n x n)
+ * \param B The right hand sides (vector of n elements or n x nrhs matrix)
+ * \param X The solutions (vector of n elements or n x nrhs matrix)
+ */
+template <typename AT, typename BT, typename XT>
+void cholesky_solve(const AT& A, const BT& B, XT& X) {
+    using T = value_t<AT>;
+
+    const auto n    = etl::dim<0>(A);
+    const auto nrhs = etl::size(B) / n;
+
+    etl::dyn_matrix<T, 2> a(n, n);
+    decomposition_detail::copy_row_major(A, a);
+
+    if (!decomposition_detail::cholesky_factor(a.memory_start(), n)) {
+        solve(A, B, X);
+        return;
+    }
+
+    etl::dyn_matrix<T, 2> x(n, nrhs);
+    decomposition_detail::copy_rhs(B, x);
+
+    // L * Y = B
+    decomposition_detail::trsm_lower(a.memory_start(), n, x.memory_start(), nrhs, n, nrhs);
+
+    // L' * X = Y
+    etl::dyn_matrix<T, 2> lt(n, n);
+
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t j = 0; j < n; ++j) {
+            lt(i, j) = a(j, i);
+        }
+    }
+
+    decomposition_detail::trsm_upper(lt.memory_start(), n, x.memory_start(), nrhs, n, nrhs);
+
+    decomposition_detail::copy_solution(x, X);
+}
+
 } //end of namespace standard
 } //end of namespace impl
 } //end of namespace etl
@@ -12,13 +12,9 @@
 
 #pragma once
 
-namespace etl {
+#include "etl/impl/std/decomposition.hpp"
 
-/*!
- * \copydoc etl::lu
- */
-template <typename AT, typename LT, typename UT, typename PT>
-bool lu(const AT& A, LT& L, UT& U, PT& P);
+namespace etl {
 
 namespace impl {
 
@@ -58,13 +54,19 @@ value_t<AT> det(const AT& A) {
         return det;
     }
 
-    auto L = force_temporary_dim_only(A);
-    auto U = force_temporary_dim_only(A);
-    auto P = force_temporary_dim_only(A);
+    etl::dyn_matrix<T, 2> a(n, n);
+    decomposition_detail::copy_row_major(A, a);
 
-    etl::lu(A, L, U, P);
+    std::vector<size_t> piv(n);
+    const size_t swaps = decomposition_detail::lu_factor(a.memory_start(), n, piv.data());
+
+    T det(swaps % 2 ? -1.0 : 1.0);
+
+    for (size_t i = 0; i < n; ++i) {
+        det *= a(i, i);
+    }
 
-    return det(L) * det(U) * det(P);
+    return det;
 }
 
 } //end of namespace standard
@@ -0,0 +1,186 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Standard implementation of the accumulation of the embedding
+ * gradients.
+ *
+ * The positions of the input sequence are bucketed by vocabulary row.
+ * Each row is then accumulated by a single thread, without any write
+ * conflict and in the order of the sequence.
+ */
+
+#pragma once
+
+namespace etl {
+
+namespace impl {
+
+namespace standard {
+
+/*!
+ * \brief The positions of an input sequence, grouped by vocabulary row
+ */
+struct embedding_buckets {
+    std::vector<size_t> rows;      ///< The distinct vocabulary rows, in increasing order
+    std::vector<size_t> offsets;   ///< The first position of each row in positions (rows.size() + 1 elements)
+    std::vector<size_t> positions; ///< The positions in the sequence, sorted by row
+};
+
+/*!
+ * \brief Group the positions of the given sequence by vocabulary row
+ * \param a The input sequence (the vocabulary row of each position)
+ * \return the buckets of the sequence
+ */
+template <typename A>
+embedding_buckets make_embedding_buckets(const A& a) {
+    const size_t n = etl::size(a);
+
+    std::vector<std::pair<size_t, size_t>> pairs(n);
+
+    for (size_t i = 0; i < n; ++i) {
+        pairs[i] = std::make_pair(size_t(a.read_flat(i)), i);
+    }
+
+    // Sorting by (row, position) keeps the positions of a row in the order of the sequence
+    std::sort(pairs.begin(), pairs.end());
+
+    embedding_buckets buckets;
+
+    buckets.positions.resize(n);
+
+    for (size_t i = 0; i < n; ++i) {
+        if (!i || pairs[i].first != pairs[i - 1].first) {
+            buckets.rows.push_back(pairs[i].first);
+            buckets.offsets.push_back(i);
+        }
+
+        buckets.positions[i] = pairs[i].second;
+    }
+
+    buckets.offsets.push_back(n);
+
+    return buckets;
+}
+
+/*!
+ * \brief Accumulate the errors of each bucket into its row of out.
+ *
+ * The row of the kth bucket is out + rows[k] * D if Compact is false and
+ * out + k * D otherwise. The rows of out that are not in the buckets are
+ * not touched.
+ *
+ * \param buckets The buckets of the input sequence
+ * \param b The errors, D values per position of the sequence
+ * \param D The dimension of the embeddings
+ * \param out The output memory
+ */
+template <bool Compact, typename B, typename T>
+void embedding_accumulate(const embedding_buckets& buckets, const B& b, size_t D, T* out) {
+    auto batch_fun = [&](const size_t first, const size_t last) {
+        for (size_t k = first; k < last; ++k) {
+            T* row = out + (Compact ? k : buckets.rows[k]) * D;
+
+            const size_t p0 = buckets.positions[buckets.offsets[k]] * D;
+
+            for (size_t d = 0; d < D; ++d) {
+                row[d] = b.read_flat(p0 + d);
+            }
+
+            for (size_t j = buckets.offsets[k] + 1; j < buckets.offsets[k + 1]; ++j) {
+                const size_t p = buckets.positions[j] * D;
+
+                for (size_t d = 0; d < D; ++d) {
+                    row[d] += b.read_flat(p + d);
+                }
+            }
+        }
+    };
+
+    const size_t n = buckets.positions.size();
+
+    engine_dispatch_1d(batch_fun, 0, buckets.rows.size(), engine_select_parallel(n * D, parallel_threshold) && is_thread_safe<B>);
+}
+
+/*!
+ * \brief Indicates if the bucketed embedding gradients can be used for
+ * the given types.
+ *
+ * The positions and the errors are read in flat order, which is only the
+ * order of the sequence in row-major storage.
+ */
+template <typename A, typename B, typename L>
+constexpr bool embedding_buckets_possible = is_dma<L> && all_row_major<A, B, L>;
+
+/*!
+ * \brief Compute the embedding gradients of the sequence a with the errors b
+ * into the vocabulary-sized gradients lhs.
+ *
+ * Only the rows of lhs present in the sequence are written, the other
+ * rows must have been cleared by the caller.
+ *
+ * \param a The input sequence
+ * \param b The errors, one row per position of the sequence
+ * \param lhs The gradients
+ */
+template <typename A, typename B, typename L, cpp_enable_iff(embedding_buckets_possible<A, B, L>)>
+void embedding_gradients(const A& a, const B& b, L&& lhs) {
+    const size_t D = etl::dim<1>(lhs);
+
+    a.ensure_cpu_up_to_date();
+    b.ensure_cpu_up_to_date();
+
+    embedding_accumulate<false>(make_embedding_buckets(a), b, D, lhs.memory_start());
+
+    lhs.validate_cpu();
+    lhs.invalidate_gpu();
+}
+
+/*!
+ * \copydoc embedding_gradients
+ */
+template <typename A, typename B, typename L, cpp_enable_iff(!embedding_buckets_possible<A, B, L> && is_1d<A>)>
+void embedding_gradients(const A& a, const B& b, L&& lhs) {
+    const size_t D = etl::dim<1>(lhs);
+
+    a.ensure_cpu_up_to_date();
+    b.ensure_cpu_up_to_date();
+
+    for (size_t i = 0; i < etl::dim<0>(a); ++i) {
+        const size_t row = a(i);
+
+        for (size_t d = 0; d < D; ++d) {
+            lhs(row, d) += b(i, d);
+        }
+    }
+}
+
+/*!
+ * \copydoc embedding_gradients
+ */
+template <typename A, typename B, typename L, cpp_enable_iff(!embedding_buckets_possible<A, B, L> && is_2d<A>)>
+void embedding_gradients(const A& a, const B& b, L&& lhs) {
+    const size_t D = etl::dim<1>(lhs);
+
+    a.ensure_cpu_up_to_date();
+    b.ensure_cpu_up_to_date();
+
+    for (size_t bb = 0; bb < etl::dim<0>(a); ++bb) {
+        for (size_t i = 0; i < etl::dim<1>(a); ++i) {
+            const size_t row = a(bb, i);
+
+            for (size_t d = 0; d < D; ++d) {
+                lhs(row, d) += b(bb, i, d);
+            }
+        }
+    }
+}
+
+} //end of namespace standard
+} //end of namespace impl
+} //end of namespace etl
@@ -7,17 +7,114 @@
 
 #pragma once
 
+#include "etl/impl/std/decomposition.hpp"
+
 namespace etl {
 
+namespace impl {
+
+namespace standard {
+
+namespace inv_detail {
+
 /*!
- * \copydoc etl::lu
+ * \brief The structure of a matrix to invert
  */
-template <typename AT, typename LT, typename UT, typename PT>
-bool lu(const AT& A, LT& L, UT& U, PT& P);
+enum class inv_structure {
+    GENERAL,     ///< No special structure
+    PERMUTATION, ///< Permutation matrix
+    DIAGONAL,    ///< Diagonal matrix
+    LOWER,       ///< Lower triangular matrix
+    UPPER        ///< Upper triangular matrix
+};
 
-namespace impl {
+/*!
+ * \brief Detect the structure of the given square matrix.
+ *
+ * The permutation, lower triangular and upper triangular properties are
+ * all tested in a single pass over the matrix which stops as soon as none
+ * of them can hold anymore. For a general matrix, this is generally after
+ * a few elements.
+ *
+ * \param a The matrix to test
+ * \return The structure of the matrix
+ */
+template <typename A>
+inv_structure probe_structure(const A& a) {
+    using T = value_t<A>;
 
-namespace standard {
+    const auto n = etl::dim<0>(a);
+
+    bool lower       = true;
+    bool upper       = true;
+    bool permutation = true;
+
+    std::vector<bool> used_column(n, false);
+
+    for (size_t i = 0; i < n; ++i) {
+        size_t ones = 0;
+
+        for (size_t j = 0; j < n; ++j) {
+            const T v = a(i, j);
+
+            if (v != T(0)) {
+                lower = lower && j <= i;
+                upper = upper && j >= i;
+
+                if (permutation) {
+                    if (v == T(1) && !used_column[j] && !ones) {
+                        used_column[j] = true;
+                        ++ones;
+                    } else {
+                        permutation = false;
+                    }
+                }
+
+                if (!lower && !upper && !permutation) {
+                    return inv_structure::GENERAL;
+                }
+            }
+        }
+
+        permutation = permutation && ones == 1;
+    }
+
+    if (permutation) {
+        return inv_structure::PERMUTATION;
+    } else if (lower && upper) {
+        return inv_structure::DIAGONAL;
+    } else if (lower) {
+        return inv_structure::LOWER;
+    } else if (upper) {
+        return inv_structure::UPPER;
+    }
+
+    return inv_structure::GENERAL;
+}
+
+/*!
+ * \brief Returns the structure of the given square matrix.
+ *
+ * The structure of the triangular and diagonal adapters is known at
+ * compile-time and they are never probed.
+ *
+ * \param a The matrix to test
+ * \return The structure of the matrix
+ */
+template <typename A>
+inv_structure structure(const A& a) {
+    if /*constexpr*/ (is_diagonal_matrix<A>) {
+        return inv_structure::DIAGONAL;
+    } else if /*constexpr*/ (is_lower_matrix<A> || is_uni_lower_matrix<A> || is_strictly_lower_matrix<A>) {
+        return inv_structure::LOWER;
+    } else if /*constexpr*/ (is_upper_matrix<A> || is_uni_upper_matrix<A> || is_strictly_upper_matrix<A>) {
+        return inv_structure::UPPER;
+    } else {
+        return probe_structure(a);
+    }
+}
+
+} //end of namespace inv_detail
 
 /*!
  * \brief Compute inv(a) and store the result in c
@@ -26,77 +123,80 @@ namespace standard {
  */
 template <typename A, typename C>
 void inv(A&& a, C&& c) {
-    // The inverse of a permutation matrix is its transpose
-    if(is_permutation_matrix(a)){
-        c = transpose(a);
-        return;
-    }
+    using T = value_t<A>;
+
+    using inv_detail::inv_structure;
 
     const auto n = etl::dim<0>(a);
 
-    // Use forward propagation for lower triangular matrix
-    if(is_lower_triangular(a)){
-        c = 0;
+    switch (inv_detail::structure(a)) {
+        // The inverse of a permutation matrix is its transpose
+        case inv_structure::PERMUTATION:
+            c = transpose(a);
+            return;
 
-        // The column in c
-        for (size_t s = 0; s < n; ++s) {
-            // The row in a
-            for (size_t row = 0; row < n; ++row) {
-                auto b = row == s ? 1.0 : 0.0;
+        case inv_structure::DIAGONAL:
+            c = 0;
 
-                if (row == 0) {
-                    c(0, s) = b / a(0, 0);
-                } else {
-                    value_t<A> acc(0);
+            for (size_t i = 0; i < n; ++i) {
+                c(i, i) = T(1) / a(i, i);
+            }
 
-                    // The column in a
-                    for (size_t col = 0; col < row; ++col) {
-                        acc += a(row, col) * c(col, s);
-                    }
+            return;
 
-                    c(row, s) = (b - acc) / a(row, row);
-                }
-            }
-        }
+        case inv_structure::LOWER: {
+            etl::dyn_matrix<T, 2> l(n, n);
+            etl::dyn_matrix<T, 2> x(n, n);
 
-        return;
-    }
+            decomposition_detail::copy_row_major(a, l);
+            decomposition_detail::trtri_lower(l.memory_start(), x.memory_start(), n);
+            decomposition_detail::copy_solution(x, c);
 
-    // Use backward propagation for upper triangular matrix
-    if(is_upper_triangular(a)){
-        c = 0;
+            return;
+        }
 
-        // The column in c
-        for (int64_t s = n - 1; s >= 0; --s) {
-            // The row in a
-            for (int64_t row = n - 1; row >= 0; --row) {
-                auto b = row == s ? 1.0 : 0.0;
+        // inv(U) = inv(U')'
+        case inv_structure::UPPER: {
+            etl::dyn_matrix<T, 2> l(n, n);
+            etl::dyn_matrix<T, 2> x(n, n);
 
-                if (row == int64_t(n) - 1) {
-                    c(row, s) = b / a(row, row);
-                } else {
-                    value_t<A> acc(0);
+            for (size_t i = 0; i < n; ++i) {
+                for (size_t j = 0; j < n; ++j) {
+                    l(j, i) = a(i, j);
+                }
+            }
 
-                    // The column in a
-                    for (int64_t col = n - 1; col > row; --col) {
-                        acc += a(row, col) * c(col, s);
-                    }
+            decomposition_detail::trtri_lower(l.memory_start(), x.memory_start(), n);
 
-                    c(row, s) = (b - acc) / a(row, row);
+            for (size_t i = 0; i < n; ++i) {
+                for (size_t j = 0; j < n; ++j) {
+                    c(i, j) = x(j, i);
                 }
             }
+
+            return;
         }
 
-        return;
+        case inv_structure::GENERAL:
+            break;
     }
 
-    auto L = force_temporary_dim_only(a);
-    auto U = force_temporary_dim_only(a);
-    auto P = force_temporary_dim_only(a);
+    // Solve A * C = I
+    auto I = force_temporary_dim_only(a);
 
-    etl::lu(a, L, U, P);
+    I = 0;
 
-    c = inv(U) * inv(L) * P;
+    for (size_t i = 0; i < n; ++i) {
+        I(i, i) = 1;
+    }
+
+    // The Cholesky decomposition is twice cheaper than LU for symmetric
+    // matrices and falls back to LU when they are not positive definite
+    if (is_symmetric_matrix<A>) {
+        etl::impl::standard::cholesky_solve(a, I, c);
+    } else {
+        etl::impl::standard::solve(a, I, c);
+    }
 }
 
 } //end of namespace standard
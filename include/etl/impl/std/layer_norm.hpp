@@ -0,0 +1,148 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Standard implementation of the layer normalization and of the
+ * RMS normalization.
+ *
+ * The input is seen as N rows of K elements, each row being normalized
+ * independently. The RMS normalization (Rms = true) does not center the
+ * rows and has no shift.
+ */
+
+#pragma once
+
+namespace etl {
+
+namespace impl {
+
+namespace standard {
+
+namespace layer_norm_detail {
+
+/*!
+ * \brief Compute the mean and the inverse of the standard deviation (or
+ * of the root mean square if Rms is true) of the row starting at base
+ * \param x The input
+ * \param base The first element of the row
+ * \param K The length of the row
+ * \param eps The epsilon added to the variance
+ * \param mean The output mean (zero if Rms is true)
+ * \param rstd The output inverse standard deviation
+ */
+template <bool Rms, typename X, typename T>
+void row_moments(const X& x, size_t base, size_t K, T eps, T& mean, T& rstd) {
+    if (Rms) {
+        T ss = 0;
+
+        for (size_t k = 0; k < K; ++k) {
+            const T v = x.read_flat(base + k);
+            ss += v * v;
+        }
+
+        mean = T(0);
+        rstd = T(1) / std::sqrt(ss / T(K) + eps);
+    } else {
+        statistics<T> local;
+
+        for (size_t k = 0; k < K; ++k) {
+            local.push(x.read_flat(base + k));
+        }
+
+        mean = local.mean;
+        rstd = T(1) / std::sqrt(local.variance() + eps);
+    }
+}
+
+} //end of namespace layer_norm_detail
+
+/*!
+ * \brief Normalize each row of x, scale it with gamma and shift it with
+ * beta (not used if Rms is true)
+ * \param x The input
+ * \param N The number of rows
+ * \param K The length of each row
+ * \param gamma The scale of each column
+ * \param beta The shift of each column
+ * \param eps The epsilon added to the variance
+ * \param y The output memory
+ */
+template <bool Rms, typename X, typename T>
+void layer_norm(const X& x, size_t N, size_t K, const T* gamma, const T* beta, T eps, T* y) {
+    for (size_t i = 0; i < N; ++i) {
+        const size_t base = i * K;
+
+        T mean, rstd;
+        layer_norm_detail::row_moments<Rms>(x, base, K, eps, mean, rstd);
+
+        for (size_t k = 0; k < K; ++k) {
+            y[base + k] = (x.read_flat(base + k) - mean) * rstd * gamma[k] + (Rms ? T(0) : beta[k]);
+        }
+    }
+}
+
+/*!
+ * \brief Compute the errors of the input, of gamma and of beta (not used
+ * if Rms is true) of the normalization of the rows of x
+ * \param x The input of the forward pass
+ * \param dy The errors of the output
+ * \param N The number of rows
+ * \param K The length of each row
+ * \param gamma The scale of each column
+ * \param eps The epsilon added to the variance
+ * \param dx The output errors of the input
+ * \param dgamma The output gradients of gamma
+ * \param dbeta The output gradients of beta
+ */
+template <bool Rms, typename X, typename DY, typename T>
+void layer_norm_backward(const X& x, const DY& dy, size_t N, size_t K, const T* gamma, T eps, T* dx, T* dgamma, T* dbeta) {
+    std::fill(dgamma, dgamma + K, T(0));
+
+    if (!Rms) {
+        std::fill(dbeta, dbeta + K, T(0));
+    }
+
+    for (size_t i = 0; i < N; ++i) {
+        const size_t base = i * K;
+
+        T mean, rstd;
+        layer_norm_detail::row_moments<Rms>(x, base, K, eps, mean, rstd);
+
+        T sg  = 0;
+        T sgx = 0;
+
+        for (size_t k = 0; k < K; ++k) {
+            const T g = dy.read_flat(base + k) * gamma[k];
+
+            sg += g;
+            sgx += g * (x.read_flat(base + k) - mean);
+        }
+
+        // dx = rstd * (g - mean(g) - x_hat * mean(g * x_hat)), without the mean(g) term for RMS
+
+        const T c0 = Rms ? T(0) : sg / T(K);
+        const T c1 = sgx * rstd / T(K);
+
+        for (size_t k = 0; k < K; ++k) {
+            const T e     = dy.read_flat(base + k);
+            const T x_hat = (x.read_flat(base + k) - mean) * rstd;
+
+            dx[base + k] = rstd * (e * gamma[k] - c0 - x_hat * c1);
+
+            dgamma[k] += e * x_hat;
+
+            if (!Rms) {
+                dbeta[k] += e;
+            }
+        }
+    }
+}
+
+} //end of namespace standard
+} //end of namespace impl
+} //end of namespace etl
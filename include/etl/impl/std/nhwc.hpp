@@ -0,0 +1,254 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Standard implementations of the channels-last (NHWC) operations
+ *
+ * In NHWC layout, a batch of images is stored as [N, H, W, C] and the
+ * kernels of a convolution as [K, H, W, C].
+ */
+
+#pragma once
+
+namespace etl {
+
+namespace impl {
+
+namespace standard {
+
+/*!
+ * \brief Standard implementation of a 4D 'valid' cross-correlation in NHWC layout
+ * \param input The input matrix [N, Hi, Wi, C]
+ * \param kernel The kernel matrix [K, Hk, Wk, C]
+ * \param conv The output matrix [N, Ho, Wo, K]
+ * \param s1 The first dimension stride
+ * \param s2 The second dimension stride
+ * \param p1 The first dimension padding
+ * \param p2 The second dimension padding
+ */
+template <typename I, typename K, typename C>
+void conv4_valid_flipped_nhwc(const I& input, const K& kernel, C&& conv, size_t s1, size_t s2, size_t p1, size_t p2) {
+    cpp_assert(etl::dim<3>(input) == etl::dim<3>(kernel), "Invalid number of channels");
+    cpp_assert(etl::dim<0>(input) == etl::dim<0>(conv), "Invalid number of images");
+
+    using T = value_t<I>;
+
+    const size_t Hi = etl::dim<1>(input);
+    const size_t Wi = etl::dim<2>(input);
+    const size_t CC = etl::dim<3>(input);
+
+    const size_t k1 = etl::dim<1>(kernel);
+    const size_t k2 = etl::dim<2>(kernel);
+
+    input.ensure_cpu_up_to_date();
+    kernel.ensure_cpu_up_to_date();
+
+    for (size_t i = 0; i < etl::dim<0>(conv); ++i) {
+        for (size_t oh = 0; oh < etl::dim<1>(conv); ++oh) {
+            for (size_t ow = 0; ow < etl::dim<2>(conv); ++ow) {
+                for (size_t k = 0; k < etl::dim<3>(conv); ++k) {
+                    T acc(0);
+
+                    for (size_t kh = 0; kh < k1; ++kh) {
+                        if (oh * s1 + kh < p1 || oh * s1 + kh - p1 >= Hi) {
+                            continue;
+                        }
+
+                        for (size_t kw = 0; kw < k2; ++kw) {
+                            if (ow * s2 + kw < p2 || ow * s2 + kw - p2 >= Wi) {
+                                continue;
+                            }
+
+                            for (size_t c = 0; c < CC; ++c) {
+                                acc += input(i, oh * s1 + kh - p1, ow * s2 + kw - p2, c) * kernel(k, kh, kw, c);
+                            }
+                        }
+                    }
+
+                    conv(i, oh, ow, k) = acc;
+                }
+            }
+        }
+    }
+
+    conv.invalidate_gpu();
+}
+
+/*!
+ * \brief Standard implementation of 2D max pooling in NHWC layout
+ *
+ * Padded cells are considered to be zero, as in the NCHW pooling.
+ *
+ * \param x The input matrix [N, H, W, C]
+ * \param y The output matrix [N, Ho, Wo, C]
+ * \param c1 The first dimension pooling ratio
+ * \param c2 The second dimension pooling ratio
+ * \param s1 The first dimension stride
+ * \param s2 The second dimension stride
+ * \param p1 The first dimension padding
+ * \param p2 The second dimension padding
+ */
+template <typename X, typename Y>
+void max_pool_2d_nhwc(const X& x, Y&& y, size_t c1, size_t c2, size_t s1, size_t s2, size_t p1, size_t p2) {
+    using T = value_t<X>;
+
+    const size_t H = etl::dim<1>(x);
+    const size_t W = etl::dim<2>(x);
+
+    x.ensure_cpu_up_to_date();
+
+    for (size_t i = 0; i < etl::dim<0>(y); ++i) {
+        for (size_t oh = 0; oh < etl::dim<1>(y); ++oh) {
+            for (size_t ow = 0; ow < etl::dim<2>(y); ++ow) {
+                for (size_t c = 0; c < etl::dim<3>(y); ++c) {
+                    auto max = std::numeric_limits<T>::lowest();
+
+                    for (size_t jj = 0; jj < c1; ++jj) {
+                        for (size_t kk = 0; kk < c2; ++kk) {
+                            if (oh * s1 + jj >= p1 && oh * s1 + jj - p1 < H && ow * s2 + kk >= p2 && ow * s2 + kk - p2 < W) {
+                                max = std::max(max, x(i, oh * s1 + jj - p1, ow * s2 + kk - p2, c));
+                            } else {
+                                max = std::max(max, T(0));
+                            }
+                        }
+                    }
+
+                    y(i, oh, ow, c) = max;
+                }
+            }
+        }
+    }
+
+    y.invalidate_gpu();
+}
+
+/*!
+ * \brief Standard implementation of 2D average pooling in NHWC layout
+ *
+ * Padded cells are considered to be zero, as in the NCHW pooling.
+ *
+ * \param x The input matrix [N, H, W, C]
+ * \param y The output matrix [N, Ho, Wo, C]
+ * \param c1 The first dimension pooling ratio
+ * \param c2 The second dimension pooling ratio
+ * \param s1 The first dimension stride
+ * \param s2 The second dimension stride
+ * \param p1 The first dimension padding
+ * \param p2 The second dimension padding
+ */
+template <typename X, typename Y>
+void avg_pool_2d_nhwc(const X& x, Y&& y, size_t c1, size_t c2, size_t s1, size_t s2, size_t p1, size_t p2) {
+    using T = value_t<X>;
+
+    const size_t H = etl::dim<1>(x);
+    const size_t W = etl::dim<2>(x);
+
+    x.ensure_cpu_up_to_date();
+
+    for (size_t i = 0; i < etl::dim<0>(y); ++i) {
+        for (size_t oh = 0; oh < etl::dim<1>(y); ++oh) {
+            for (size_t ow = 0; ow < etl::dim<2>(y); ++ow) {
+                for (size_t c = 0; c < etl::dim<3>(y); ++c) {
+                    T avg(0);
+
+                    for (size_t jj = 0; jj < c1; ++jj) {
+                        for (size_t kk = 0; kk < c2; ++kk) {
+                            if (oh * s1 + jj >= p1 && oh * s1 + jj - p1 < H && ow * s2 + kk >= p2 && ow * s2 + kk - p2 < W) {
+                                avg += x(i, oh * s1 + jj - p1, ow * s2 + kk - p2, c);
+                            }
+                        }
+                    }
+
+                    y(i, oh, ow, c) = avg / T(c1 * c2);
+                }
+            }
+        }
+    }
+
+    y.invalidate_gpu();
+}
+
+/*!
+ * \brief Compute the bias addition of b into the NHWC matrix x and store the result in y
+ * \param x The input matrix [N, H, W, C]
+ * \param b The biases [C]
+ * \param y The output matrix [N, H, W, C]
+ */
+template <typename A, typename B, typename C>
+void bias_add_4d_nhwc(const A& x, const B& b, C&& y) {
+    x.ensure_cpu_up_to_date();
+    b.ensure_cpu_up_to_date();
+
+    for (size_t i = 0; i < etl::dim<0>(x); ++i) {
+        for (size_t j = 0; j < etl::dim<1>(x); ++j) {
+            for (size_t k = 0; k < etl::dim<2>(x); ++k) {
+                for (size_t l = 0; l < etl::dim<3>(x); ++l) {
+                    y(i, j, k, l) = x(i, j, k, l) + b(l);
+                }
+            }
+        }
+    }
+
+    y.invalidate_gpu();
+}
+
+/*!
+ * \brief Convert a batch of images between the NCHW and the NHWC layouts.
+ *
+ * Each image is a [C, HW] matrix in NCHW and a [HW, C] matrix in NHWC,
+ * therefore the conversion is a batch of tiled 2D transpositions.
+ *
+ * \param x The input matrix
+ * \param y The output matrix
+ * \param C The number of channels
+ * \param HW The number of pixels per channel
+ * \tparam NHWC true if the conversion is from NCHW to NHWC, false otherwise
+ */
+template <bool NHWC, typename X, typename Y>
+void convert_layout_4d(const X& x, Y&& y, size_t C, size_t HW) {
+    constexpr size_t tile = 16;
+
+    const size_t N = etl::dim<0>(x);
+
+    // In NCHW, the image is R=C x S=HW, in NHWC, the image is R=HW x S=C
+    const size_t R = NHWC ? C : HW;
+    const size_t S = NHWC ? HW : C;
+
+    x.ensure_cpu_up_to_date();
+
+    const auto* in = x.memory_start();
+    auto* out      = y.memory_start();
+
+    auto batch_fun = [&](const size_t first, const size_t last) {
+        for (size_t n = first; n < last; ++n) {
+            const auto* in_n = in + n * R * S;
+            auto* out_n      = out + n * R * S;
+
+            for (size_t rr = 0; rr < R; rr += tile) {
+                for (size_t ss = 0; ss < S; ss += tile) {
+                    const size_t r_last = std::min(rr + tile, R);
+                    const size_t s_last = std::min(ss + tile, S);
+
+                    for (size_t r = rr; r < r_last; ++r) {
+                        for (size_t s = ss; s < s_last; ++s) {
+                            out_n[s * R + r] = in_n[r * S + s];
+                        }
+                    }
+                }
+            }
+        }
+    };
+
+    engine_dispatch_1d_serial(batch_fun, 0, N, 2UL);
+
+    y.invalidate_gpu();
+}
+
+} //end of namespace standard
+} //end of namespace impl
+} //end of namespace etl
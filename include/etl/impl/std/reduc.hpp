@@ -0,0 +1,150 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Standard implementation of the partial reductions (sum_r,
+ * mean_r, sum_l, mean_l, argmax and argmin)
+ *
+ * The input expression is seen as a (M, K) matrix, where M is its first
+ * dimension.
+ */
+
+#pragma once
+
+namespace etl {
+
+namespace impl {
+
+namespace standard {
+
+namespace reduc_detail {
+
+/*!
+ * \brief Returns the flat index of the element (i, k) of the input seen
+ * as a (M, K) matrix
+ * \param i The index in the first dimension
+ * \param k The index in the remaining dimensions
+ * \param M The first dimension
+ * \param K The product of the remaining dimensions
+ * \return The flat index of the element
+ */
+template <typename A>
+size_t flat_index(size_t i, size_t k, size_t M, size_t K) {
+    if /*constexpr*/ (decay_traits<A>::storage_order == order::RowMajor) {
+        cpp_unused(M);
+        return i * K + k;
+    } else {
+        cpp_unused(K);
+        return i + k * M;
+    }
+}
+
+} // end of namespace reduc_detail
+
+/*!
+ * \brief Compute the sum (or the mean) of each sub matrix of the first
+ * dimension of a into c
+ * \param a The input expression
+ * \param c The output expression
+ */
+template <bool Mean, typename A, typename C>
+void sum_r(const A& a, C&& c) {
+    using T = value_t<A>;
+
+    const size_t M = etl::dim<0>(a);
+
+    if (!M) {
+        return;
+    }
+
+    const size_t K = etl::size(a) / M;
+
+    for (size_t i = 0; i < M; ++i) {
+        T value(0);
+
+        for (size_t k = 0; k < K; ++k) {
+            value += a.read_flat(reduc_detail::flat_index<A>(i, k, M, K));
+        }
+
+        if /*constexpr*/ (Mean) {
+            c[i] = value / T(K);
+        } else {
+            c[i] = value;
+        }
+    }
+}
+
+/*!
+ * \brief Compute the sum (or the mean) of a over its first dimension
+ * into c
+ * \param a The input expression
+ * \param c The output expression
+ */
+template <bool Mean, typename A, typename C>
+void sum_l(const A& a, C&& c) {
+    using T = value_t<A>;
+
+    const size_t M = etl::dim<0>(a);
+    const size_t K = etl::size(a) / M;
+
+    for (size_t k = 0; k < K; ++k) {
+        T value(0);
+
+        for (size_t i = 0; i < M; ++i) {
+            value += a.read_flat(reduc_detail::flat_index<A>(i, k, M, K));
+        }
+
+        if /*constexpr*/ (Mean) {
+            c[k] = value / T(M);
+        } else {
+            c[k] = value;
+        }
+    }
+}
+
+/*!
+ * \brief Compute the index of the maximum (or minimum) of each sub
+ * matrix of the first dimension of a into c
+ *
+ * The index of the first occurrence is returned.
+ *
+ * \param a The input expression
+ * \param c The output expression
+ */
+template <bool Max, typename A, typename C>
+void argmax(const A& a, C&& c) {
+    using T = value_t<A>;
+
+    const size_t M = etl::dim<0>(a);
+
+    if (!etl::size(a)) {
+        return;
+    }
+
+    const size_t K = etl::size(a) / M;
+
+    for (size_t i = 0; i < M; ++i) {
+        T best_value      = a.read_flat(reduc_detail::flat_index<A>(i, 0, M, K));
+        size_t best_index = 0;
+
+        for (size_t k = 1; k < K; ++k) {
+            const T value = a.read_flat(reduc_detail::flat_index<A>(i, k, M, K));
+
+            if (Max ? value > best_value : value < best_value) {
+                best_value = value;
+                best_index = k;
+            }
+        }
+
+        c[i] = best_index;
+    }
+}
+
+} //end of namespace standard
+} //end of namespace impl
+} //end of namespace etl
@@ -0,0 +1,116 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Standard implementation of the single-pass statistics
+ */
+
+#pragma once
+
+#include "etl/impl/std/reduc.hpp"
+
+namespace etl {
+
+namespace impl {
+
+namespace standard {
+
+/*!
+ * \brief Compute the statistics of the values of the given expression
+ * \param a The input expression
+ * \return the statistics of the values of a
+ */
+template <typename A>
+statistics<value_t<A>> stats(const A& a) {
+    using T = value_t<A>;
+
+    statistics<T> acc;
+
+    auto acc_functor = [&acc](const statistics<T>& value) {
+        acc.merge(value);
+    };
+
+    auto batch_fun = [&a](const size_t first, const size_t last) {
+        statistics<T> local;
+
+        for (size_t i = first; i < last; ++i) {
+            local.push(a.read_flat(i));
+        }
+
+        return local;
+    };
+
+    engine_dispatch_1d_acc<statistics<T>>(batch_fun, acc_functor, 0, etl::size(a), sum_parallel_threshold);
+
+    return acc;
+}
+
+/*!
+ * \brief Compute the mean and the variance of each sub matrix of the
+ * first dimension of a
+ * \param a The input expression
+ * \param mean The output means
+ * \param variance The output variances
+ */
+template <typename A, typename M, typename Var>
+void stats_r(const A& a, M&& mean, Var&& variance) {
+    using T = value_t<A>;
+
+    const size_t N = etl::dim<0>(a);
+
+    if (!N) {
+        return;
+    }
+
+    const size_t K = etl::size(a) / N;
+
+    for (size_t i = 0; i < N; ++i) {
+        statistics<T> local;
+
+        for (size_t k = 0; k < K; ++k) {
+            local.push(a.read_flat(reduc_detail::flat_index<A>(i, k, N, K)));
+        }
+
+        mean[i]     = local.mean;
+        variance[i] = local.variance();
+    }
+}
+
+/*!
+ * \brief Compute the mean and the variance of a over its first dimension
+ * \param a The input expression
+ * \param mean The output means
+ * \param variance The output variances
+ */
+template <typename A, typename M, typename Var>
+void stats_l(const A& a, M&& mean, Var&& variance) {
+    using T = value_t<A>;
+
+    const size_t N = etl::dim<0>(a);
+
+    if (!N) {
+        return;
+    }
+
+    const size_t K = etl::size(a) / N;
+
+    for (size_t k = 0; k < K; ++k) {
+        statistics<T> local;
+
+        for (size_t i = 0; i < N; ++i) {
+            local.push(a.read_flat(reduc_detail::flat_index<A>(i, k, N, K)));
+        }
+
+        mean[k]     = local.mean;
+        variance[k] = local.variance();
+    }
+}
+
+} //end of namespace standard
+} //end of namespace impl
+} //end of namespace etl
@@ -16,6 +16,49 @@ namespace etl {
 
 namespace impl {
 
+/*!
+ * \brief A sum with a compensation term, holding the rounding errors of
+ * the additions (TwoSum).
+ *
+ * The compensation is removed by the compiler with -ffast-math (or
+ * -fassociative-math), which must not be used with compensated sums.
+ *
+ * \tparam T The type of the values
+ */
+template <typename T>
+struct compensated_sum {
+    T sum  = T(0); ///< The (rounded) sum
+    T comp = T(0); ///< The sum of the rounding errors
+
+    /*!
+     * \brief Add a value to the sum
+     * \param value The value to add
+     */
+    void add(T value) noexcept {
+        const T t = sum + value;
+        const T v = t - sum;
+
+        comp += (sum - (t - v)) + (value - v);
+        sum = t;
+    }
+
+    /*!
+     * \brief Merge another compensated sum into this one
+     * \param rhs The sum to merge
+     */
+    void merge(const compensated_sum& rhs) noexcept {
+        add(rhs.sum);
+        comp += rhs.comp;
+    }
+
+    /*!
+     * \brief Returns the value of the sum
+     */
+    T value() const noexcept {
+        return sum + comp;
+    }
+};
+
 namespace standard {
 
 /*!
@@ -79,6 +122,25 @@ value_t<E> asum(const E& input) {
     return acc;
 }
 
+/*!
+ * \brief Compute the sum of the range [first, last) of the given
+ * expression with compensated summation
+ * \param input The input expression
+ * \param first The first element of the range
+ * \param last The last element of the range (exclusive)
+ * \return the compensated sum of the range
+ */
+template <typename E>
+compensated_sum<value_t<E>> accurate_sum(const E& input, size_t first, size_t last) {
+    compensated_sum<value_t<E>> acc;
+
+    for (size_t i = first; i < last; ++i) {
+        acc.add(input.read_flat(i));
+    }
+
+    return acc;
+}
+
 } //end of namespace standard
 } //end of namespace impl
 } //end of namespace etl
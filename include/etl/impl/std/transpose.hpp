@@ -44,50 +44,137 @@ void inplace_square_transpose(C&& c) {
     }
 }
 
+namespace transpose_detail {
+
+/*!
+ * \brief Inplace transposition of the (rows, cols) row-major matrix data
+ * whose elements are runs of contiguous values.
+ *
+ * The runs are moved along the cycles of the transposition permutation.
+ * Only one bit per run is used to mark the runs that are already at their
+ * place.
+ *
+ * \param data The matrix
+ * \param rows The number of rows of the matrix
+ * \param cols The number of columns of the matrix
+ * \param run The number of values of each element of the matrix
+ */
+template <typename T>
+void inplace_run_transpose(T* data, size_t rows, size_t cols, size_t run) {
+    const size_t n = rows * cols;
+
+    if (rows == 1 || cols == 1) {
+        return;
+    }
+
+    std::vector<bool> done(n, false);
+    std::vector<T> value(run);
+
+    // The first and the last runs never move
+    for (size_t start = 1; start + 1 < n; ++start) {
+        if (done[start]) {
+            continue;
+        }
+
+        // The run at (i, j) moves to (j, i)
+        size_t index = start;
+
+        std::copy(data + start * run, data + (start + 1) * run, value.begin());
+
+        do {
+            index = (index % cols) * rows + index / cols;
+
+            std::swap_ranges(value.begin(), value.end(), data + index * run);
+
+            done[index] = true;
+        } while (index != start);
+    }
+}
+
+/*!
+ * \brief Inplace transposition of the (R, K) row-major matrix data
+ *
+ * With g the greatest common divisor of R and K, the matrix is a grid of
+ * (g, g) blocks. The rows of runs of g values are first permuted to make the
+ * blocks contiguous, each block is transposed by the given functor and the
+ * blocks and runs are then permuted to their final place. Except for
+ * small g, the permutations move long runs and the blocks are transposed
+ * in cache, which is much faster than following the cycles of single
+ * values.
+ *
+ * \param data The matrix
+ * \param R The number of rows of the matrix
+ * \param K The number of columns of the matrix
+ * \param square_transpose The functor to transpose a contiguous (g, g) block inplace
+ */
+template <typename T, typename Square>
+void inplace_rectangular_transpose(T* data, size_t R, size_t K, Square&& square_transpose) {
+    size_t g = R;
+
+    for (size_t r = K; r;) {
+        const size_t t = g % r;
+        g = r;
+        r = t;
+    }
+
+    if (g == 1) {
+        inplace_run_transpose(data, R, K, 1);
+        return;
+    }
+
+    const size_t a = R / g;
+    const size_t b = K / g;
+
+    // [i1][i0][j1][j0] -> [i1][j1][i0][j0]
+    for (size_t i1 = 0; i1 < a; ++i1) {
+        inplace_run_transpose(data + i1 * g * K, g, b, g);
+    }
+
+    // [i1][j1][i0][j0] -> [i1][j1][j0][i0]
+    for (size_t block = 0; block < a * b; ++block) {
+        square_transpose(data + block * g * g, g);
+    }
+
+    // [i1][j1][j0][i0] -> [j1][i1][j0][i0]
+    inplace_run_transpose(data, a, b, g * g);
+
+    // [j1][i1][j0][i0] -> [j1][j0][i1][i0]
+    for (size_t j1 = 0; j1 < b; ++j1) {
+        inplace_run_transpose(data + j1 * g * R, a, g, g);
+    }
+}
+
+} // end of namespace transpose_detail
+
 /*!
  * \brief Inplace transposition of the rectangular matrix c
  * \param mat The matrix to transpose
  */
 template <typename C>
 void inplace_rectangular_transpose(C&& mat) {
-    static constexpr bool row_major = decay_traits<C>::storage_order == order::RowMajor;
-
-    auto copy = force_temporary(mat);
+    using T = value_t<C>;
 
-    //Dimensions prior to transposition
-    const size_t N = etl::dim<0>(mat);
-    const size_t M = etl::dim<1>(mat);
+    static constexpr bool row_major = decay_traits<C>::storage_order == order::RowMajor;
 
-    // Note: cannot use operator(i,j) for lhs because it is indexed by its
-    // previous scheme (N instead of M)
+    // Both storage orders are the transposition of a (R, K) row-major matrix
+    const size_t R = row_major ? etl::dim<0>(mat) : etl::dim<1>(mat);
+    const size_t K = row_major ? etl::dim<1>(mat) : etl::dim<0>(mat);
 
-    if /*constexpr*/ (row_major) {
-        for (size_t i = 0; i < N; ++i) {
-            size_t j = 0;
+    mat.ensure_cpu_up_to_date();
 
-            for (; j + 1 < M; j += 2) {
-                mat[(j + 0) * N + i] = copy(i, (j + 0));
-                mat[(j + 1) * N + i] = copy(i, (j + 1));
-            }
+    auto square_transpose = [](T* block, size_t N) {
+        using std::swap;
 
-            if (j < M) {
-                mat[j * N + i] = copy(i, j);
+        for (size_t i = 0; i + 1 < N; ++i) {
+            for (size_t j = i + 1; j < N; ++j) {
+                swap(block[i * N + j], block[j * N + i]);
             }
         }
-    } else {
-        for (size_t i = 0; i < N; ++i) {
-            size_t j = 0;
+    };
 
-            for (; j + 1 < M; j += 2) {
-                mat[(j + 0) + M * i] = copy(i, (j + 0));
-                mat[(j + 1) + M * i] = copy(i, (j + 1));
-            }
+    transpose_detail::inplace_rectangular_transpose(mat.memory_start(), R, K, square_transpose);
 
-            if (j < M) {
-                mat[j + M * i] = copy(i, j);
-            }
-        }
-    }
+    mat.invalidate_gpu();
 }
 
 /*!
@@ -120,6 +120,72 @@ constexpr etl::sum_impl select_sum_impl() {
 
 #endif
 
+/*!
+ * \brief The number of elements of the blocks of the accurate sum.
+ *
+ * The blocks do not depend on the number of threads, which makes the
+ * accurate sum reproducible.
+ */
+constexpr size_t accurate_sum_block = 4096;
+
+/*!
+ * \brief Accurate sum operation implementation
+ *
+ * The expression is split into blocks of fixed size, which are summed
+ * with compensated summation, in parallel. The sums of the blocks are then
+ * merged in order. The result does not depend on the number of threads.
+ */
+struct accurate_sum_impl {
+    /*!
+     * \brief Apply the functor to e
+     */
+    template <typename E>
+    static value_t<E> apply(const E& e) {
+        using T = value_t<E>;
+
+        const size_t n = etl::size(e);
+
+        safe_ensure_cpu_up_to_date(e);
+
+        if (n <= accurate_sum_block) {
+            return compute(e, 0, n).value();
+        }
+
+        const size_t blocks = (n + accurate_sum_block - 1) / accurate_sum_block;
+
+        std::vector<impl::compensated_sum<T>> partials(blocks);
+
+        auto batch_fun = [&](size_t first, size_t last) {
+            for (size_t b = first; b < last; ++b) {
+                partials[b] = compute(e, b * accurate_sum_block, std::min(n, (b + 1) * accurate_sum_block));
+            }
+        };
+
+        engine_dispatch_1d_serial(batch_fun, 0, blocks, engine_select_parallel(n, sum_parallel_threshold) && is_thread_safe<E>);
+
+        impl::compensated_sum<T> acc;
+
+        for (auto& partial : partials) {
+            acc.merge(partial);
+        }
+
+        return acc.value();
+    }
+
+private:
+    /*!
+     * \brief Compute the compensated sum of the range [first, last) of e
+     */
+    template <typename E>
+    static impl::compensated_sum<value_t<E>> compute(const E& e, size_t first, size_t last) {
+        if /*constexpr_select*/ (vec_enabled && all_vectorizable<vector_mode, E> && all_floating<E>) {
+            return impl::vec::accurate_sum(e, first, last);
+        } else {
+            return impl::standard::accurate_sum(e, first, last);
+        }
+    }
+};
+
 /*!
  * \brief Sum operation implementation
  */
@@ -129,6 +195,10 @@ struct sum_impl {
      */
     template <typename E>
     static value_t<E> apply(const E& e) {
+        if (is_floating<E> && local_context().accurate) {
+            return accurate_sum_impl::apply(e);
+        }
+
         constexpr_select const auto impl = select_sum_impl<E>();
 
         if /*constexpr_select*/ (impl == etl::sum_impl::VEC) {
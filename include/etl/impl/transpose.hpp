@@ -14,6 +14,7 @@
 
 //Include the implementations
 #include "etl/impl/std/transpose.hpp"
+#include "etl/impl/vec/transpose.hpp"
 #include "etl/impl/blas/transpose.hpp"
 #include "etl/impl/cublas/transpose.hpp"
 
@@ -45,6 +46,10 @@ constexpr transpose_impl select_default_transpose_impl(bool no_gpu){
 
 #ifdef SLOW_MKL
     // STD is always faster than MKL for out-of-place transpose
+    if (impl::vec::transpose_possible<A, C>) {
+        return transpose_impl::VEC;
+    }
+
     return transpose_impl::STD;
 #else
     // Condition to use MKL
@@ -52,6 +57,8 @@ constexpr transpose_impl select_default_transpose_impl(bool no_gpu){
 
     if (mkl_possible) {
         return transpose_impl::MKL;
+    } else if (impl::vec::transpose_possible<A, C>) {
+        return transpose_impl::VEC;
     } else {
         return transpose_impl::STD;
     }
@@ -80,6 +87,8 @@ constexpr transpose_impl select_default_in_square_transpose_impl(bool no_gpu){
 
     if (mkl_possible) {
         return transpose_impl::MKL;
+    } else if (impl::vec::transpose_possible<A, C>) {
+        return transpose_impl::VEC;
     } else {
         return transpose_impl::STD;
     }
@@ -117,6 +126,15 @@ transpose_impl select_transpose_impl(transpose_impl def) {
 
                 return forced;
 
+            //VEC cannot always be used
+            case transpose_impl::VEC:
+                if (!impl::vec::transpose_possible<A, C>) {
+                    std::cerr << "Forced selection to VEC transpose implementation, but not possible for this expression" << std::endl;
+                    return def;
+                }
+
+                return forced;
+
             //In other cases, simply use the forced impl
             default:
                 return forced;
@@ -200,6 +218,8 @@ struct inplace_square_transpose {
             etl::impl::blas::inplace_square_transpose(c);
         } else if /*constexpr_select*/ (impl == transpose_impl::CUBLAS) {
             etl::impl::cublas::inplace_square_transpose(c);
+        } else if /*constexpr_select*/ (impl == transpose_impl::VEC) {
+            etl::impl::vec::inplace_square_transpose(c);
         } else if /*constexpr_select*/ (impl == transpose_impl::STD) {
             etl::impl::standard::inplace_square_transpose(c);
         } else {
@@ -224,6 +244,8 @@ struct inplace_rectangular_transpose {
             etl::impl::blas::inplace_rectangular_transpose(c);
         } else if /*constexpr_select*/ (impl == transpose_impl::CUBLAS) {
             etl::impl::cublas::inplace_rectangular_transpose(c);
+        } else if /*constexpr_select*/ (impl == transpose_impl::VEC) {
+            etl::impl::vec::inplace_rectangular_transpose(c);
         } else if /*constexpr_select*/ (impl == transpose_impl::STD) {
             etl::impl::standard::inplace_rectangular_transpose(c);
         } else {
@@ -278,6 +300,8 @@ struct transpose {
 
             if /*constexpr_select*/ (impl == transpose_impl::MKL) {
                 etl::impl::blas::transpose(aa, c);
+            } else if /*constexpr_select*/ (impl == transpose_impl::VEC) {
+                etl::impl::vec::transpose(aa, c);
             } else if /*constexpr_select*/ (impl == transpose_impl::STD) {
                 etl::impl::standard::transpose(aa, c);
             } else {
@@ -0,0 +1,447 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Blocked and vectorized implementation of the scaled dot-product
+ * attention.
+ *
+ * The queries are processed in blocks and the keys are tiled: the scores of
+ * a block of queries against a block of keys are computed with the GEMM
+ * kernels and folded into the output with an online softmax. Only a
+ * [query_block, key_block] tile of scores is ever stored.
+ */
+
+#pragma once
+
+#include "etl/impl/vec/gemm.hpp"
+#include "etl/impl/vec/transpose.hpp"
+
+namespace etl {
+
+namespace impl {
+
+namespace vec {
+
+/*!
+ * \brief Indicates if the attention of values of type T can be vectorized
+ */
+template <typename T>
+constexpr bool attention_possible = vec_enabled && vectorize_impl && is_floating_t<T>;
+
+namespace attention_detail {
+
+/*!
+ * \brief The number of queries of a block
+ */
+static constexpr size_t query_block = 32;
+
+/*!
+ * \brief The number of keys of a tile
+ */
+static constexpr size_t key_block = 128;
+
+/*!
+ * \brief Compute the maximum of the n elements of s
+ */
+template <typename V, typename T>
+T row_max(const T* s, size_t n) {
+    static constexpr size_t vec_size = V::template traits<T>::size;
+
+    T m = std::numeric_limits<T>::lowest();
+
+    size_t j = 0;
+
+    if (n >= vec_size) {
+        auto m1 = V::set(m);
+
+        for (; j + vec_size - 1 < n; j += vec_size) {
+            m1 = V::max(V::loadu(s + j), m1);
+        }
+
+        T maxs[vec_size];
+
+        V::storeu(maxs, m1);
+
+        for (size_t l = 0; l < vec_size; ++l) {
+            m = maxs[l] > m ? maxs[l] : m;
+        }
+    }
+
+    for (; j < n; ++j) {
+        m = s[j] > m ? s[j] : m;
+    }
+
+    return m;
+}
+
+/*!
+ * \brief Replace the n scores of s by exp(scale * s - m)
+ * \return the sum of the exponentials
+ */
+template <typename V, typename T>
+T exp_row(T* s, size_t n, T scale, T m) {
+    static constexpr size_t vec_size = V::template traits<T>::size;
+
+    auto vs = V::set(scale);
+    auto vm = V::set(-m);
+    auto r1 = V::template zero<T>();
+
+    size_t j = 0;
+
+    for (; j + vec_size - 1 < n; j += vec_size) {
+        auto e = V::exp(V::fmadd(V::loadu(s + j), vs, vm));
+
+        V::storeu(s + j, e);
+
+        r1 = V::add(e, r1);
+    }
+
+    T sum = V::hadd(r1);
+
+    for (; j < n; ++j) {
+        s[j] = std::exp(scale * s[j] - m);
+        sum += s[j];
+    }
+
+    return sum;
+}
+
+/*!
+ * \brief Multiply the n elements of y by alpha
+ */
+template <typename V, typename T>
+void scale_row(T* y, size_t n, T alpha) {
+    static constexpr size_t vec_size = V::template traits<T>::size;
+
+    auto va = V::set(alpha);
+
+    size_t j = 0;
+
+    for (; j + vec_size - 1 < n; j += vec_size) {
+        V::storeu(y + j, V::mul(V::loadu(y + j), va));
+    }
+
+    for (; j < n; ++j) {
+        y[j] *= alpha;
+    }
+}
+
+/*!
+ * \brief Compute the dot product of the n elements of a and b
+ */
+template <typename V, typename T>
+T dot_row(const T* a, const T* b, size_t n) {
+    static constexpr size_t vec_size = V::template traits<T>::size;
+
+    auto r1 = V::template zero<T>();
+
+    size_t j = 0;
+
+    for (; j + vec_size - 1 < n; j += vec_size) {
+        r1 = V::fmadd(V::loadu(a + j), V::loadu(b + j), r1);
+    }
+
+    T sum = V::hadd(r1);
+
+    for (; j < n; ++j) {
+        sum += a[j] * b[j];
+    }
+
+    return sum;
+}
+
+/*!
+ * \brief Compute the attention of R queries of q into y.
+ *
+ * The output block is used as accumulator. For each tile of keys, the
+ * scores are computed in s, the running maximum and sum of each row are
+ * updated and the previous output is rescaled before accumulating the
+ * tile of values.
+ *
+ * \param q The R queries [R, D]
+ * \param k The keys of the head [M, D]
+ * \param v The values of the head [M, Dv]
+ * \param y The output of the R queries [R, Dv]
+ * \param s The scores buffer [query_block, key_block]
+ * \param m The running maximums buffer
+ * \param l The running sums buffer
+ */
+template <typename V, typename T>
+void attention_block(const T* q, const T* k, const T* v, T* y, T* s, T* m, T* l, size_t R, size_t M, size_t D, size_t Dv, T scale) {
+    std::fill(y, y + R * Dv, T(0));
+    std::fill(m, m + R, std::numeric_limits<T>::lowest());
+    std::fill(l, l + R, T(0));
+
+    for (size_t j = 0; j < M; j += key_block) {
+        const size_t C = std::min(key_block, M - j);
+
+        gemm_rc_to_r(q, k + j * D, s, R, C, D);
+
+        for (size_t r = 0; r < R; ++r) {
+            T* sr = s + r * C;
+
+            const T m_new = std::max(m[r], scale * row_max<V>(sr, C));
+            const T alpha = std::exp(m[r] - m_new);
+
+            l[r] = l[r] * alpha + exp_row<V>(sr, C, scale, m_new);
+            m[r] = m_new;
+
+            if (alpha != T(1)) {
+                scale_row<V>(y + r * Dv, Dv, alpha);
+            }
+        }
+
+        gemm_panel_kernel_rr_to_r<V>(s, C, v + j * Dv, y, Dv, R, Dv, C);
+    }
+
+    for (size_t r = 0; r < R; ++r) {
+        scale_row<V>(y + r * Dv, Dv, T(1) / l[r]);
+    }
+}
+
+/*!
+ * \brief Compute the log-sum-exp of the scaled scores of R queries and
+ * the sum of dy * o of their rows
+ */
+template <typename V, typename T>
+void backward_stats_block(const T* q, const T* k, const T* o, const T* dy, T* s, T* lse, T* delta, size_t R, size_t M, size_t D, size_t Dv, T scale) {
+    std::fill(lse, lse + R, std::numeric_limits<T>::lowest());
+    std::fill(delta, delta + R, T(0));
+
+    for (size_t j = 0; j < M; j += key_block) {
+        const size_t C = std::min(key_block, M - j);
+
+        gemm_rc_to_r(q, k + j * D, s, R, C, D);
+
+        // delta holds the running sum, lse the running maximum
+
+        for (size_t r = 0; r < R; ++r) {
+            T* sr = s + r * C;
+
+            const T m_new = std::max(lse[r], scale * row_max<V>(sr, C));
+
+            delta[r] = delta[r] * std::exp(lse[r] - m_new) + exp_row<V>(sr, C, scale, m_new);
+            lse[r]   = m_new;
+        }
+    }
+
+    for (size_t r = 0; r < R; ++r) {
+        lse[r] += std::log(delta[r]);
+        delta[r] = dot_row<V>(dy + r * Dv, o + r * Dv, Dv);
+    }
+}
+
+/*!
+ * \brief Accumulate the errors of a tile of C keys and values for a block
+ * of R queries.
+ *
+ * The probabilities are recomputed from the log-sum-exp of the queries.
+ * dv += trans(P) * dy, dS = P * (dy * trans(V) - delta), dq += dS * K and
+ * dk += trans(dS) * Q. dq and dk are not scaled.
+ *
+ * \param s The probabilities buffer [query_block, key_block]
+ * \param ds The errors of the scores buffer [query_block, key_block]
+ * \param t The transposition buffer [key_block, query_block]
+ */
+template <typename V, typename T>
+void backward_block(const T* q, const T* k, const T* v, const T* dy, const T* lse, const T* delta, T* dq, T* dk, T* dv, T* s, T* ds, T* t, size_t R, size_t C, size_t D, size_t Dv, T scale) {
+    gemm_rc_to_r(q, k, s, R, C, D);
+
+    for (size_t r = 0; r < R; ++r) {
+        exp_row<V>(s + r * C, C, scale, lse[r]);
+    }
+
+    transpose_detail::transpose_kernel(s, t, R, C, 0, R);
+
+    gemm_panel_kernel_rr_to_r<V>(t, R, dy, dv, Dv, C, Dv, R);
+
+    gemm_rc_to_r(dy, v, ds, R, C, Dv);
+
+    static constexpr size_t vec_size = V::template traits<T>::size;
+
+    for (size_t r = 0; r < R; ++r) {
+        T* sr  = s + r * C;
+        T* dsr = ds + r * C;
+
+        auto vd = V::set(delta[r]);
+
+        size_t j = 0;
+
+        for (; j + vec_size - 1 < C; j += vec_size) {
+            V::storeu(dsr + j, V::mul(V::loadu(sr + j), V::sub(V::loadu(dsr + j), vd)));
+        }
+
+        for (; j < C; ++j) {
+            dsr[j] = sr[j] * (dsr[j] - delta[r]);
+        }
+    }
+
+    gemm_panel_kernel_rr_to_r<V>(ds, C, k, dq, D, R, D, C);
+
+    transpose_detail::transpose_kernel(ds, t, R, C, 0, R);
+
+    gemm_panel_kernel_rr_to_r<V>(t, R, q, dk, D, C, D, R);
+}
+
+} //end of namespace attention_detail
+
+/*!
+ * \copydoc etl::impl::standard::attention
+ */
+template <typename T, cpp_enable_iff(attention_possible<T>)>
+void attention(const T* q, const T* k, const T* v, T* y, size_t H, size_t N, size_t M, size_t D, size_t Dv) {
+    using namespace attention_detail;
+
+    const T scale = T(1) / std::sqrt(T(D));
+
+    const size_t blocks = (N + query_block - 1) / query_block;
+
+    auto batch_fun = [&](const size_t first, const size_t last) {
+        std::vector<T> s(query_block * key_block);
+        std::vector<T> m(query_block);
+        std::vector<T> l(query_block);
+
+        for (size_t b = first; b < last; ++b) {
+            const size_t h = b / blocks;
+            const size_t i = (b % blocks) * query_block;
+            const size_t R = std::min(query_block, N - i);
+
+            attention_block<default_vec>(q + (h * N + i) * D, k + h * M * D, v + h * M * Dv, y + (h * N + i) * Dv, s.data(), m.data(), l.data(), R, M, D, Dv, scale);
+        }
+    };
+
+    engine_dispatch_1d(batch_fun, 0, H * blocks, engine_select_parallel(H * N * M, parallel_threshold) && H * blocks > 1);
+}
+
+/*!
+ * \copydoc etl::impl::standard::attention_backward
+ */
+template <typename T, cpp_enable_iff(attention_possible<T>)>
+void attention_backward(const T* q, const T* k, const T* v, const T* o, const T* dy, T* dq, T* dk, T* dv, size_t H, size_t N, size_t M, size_t D, size_t Dv) {
+    using namespace attention_detail;
+
+    const T scale = T(1) / std::sqrt(T(D));
+
+    const size_t q_blocks = (N + query_block - 1) / query_block;
+    const size_t k_blocks = (M + key_block - 1) / key_block;
+
+    const bool parallel = engine_select_parallel(H * N * M, parallel_threshold);
+
+    // 1. The log-sum-exp and sum(dy * o) of each query
+
+    std::vector<T> lse(H * N);
+    std::vector<T> delta(H * N);
+
+    auto stats_fun = [&](const size_t first, const size_t last) {
+        std::vector<T> s(query_block * key_block);
+
+        for (size_t b = first; b < last; ++b) {
+            const size_t h = b / q_blocks;
+            const size_t i = (b % q_blocks) * query_block;
+            const size_t R = std::min(query_block, N - i);
+
+            backward_stats_block<default_vec>(q + (h * N + i) * D, k + h * M * D, o + (h * N + i) * Dv, dy + (h * N + i) * Dv,
+                                              s.data(), lse.data() + h * N + i, delta.data() + h * N + i, R, M, D, Dv, scale);
+        }
+    };
+
+    engine_dispatch_1d(stats_fun, 0, H * q_blocks, parallel && H * q_blocks > 1);
+
+    // 2. The tiles of keys are split between the threads, each thread
+    // accumulating the errors of the queries of the head into a local buffer
+
+    std::fill(dk, dk + H * M * D, T(0));
+    std::fill(dv, dv + H * M * Dv, T(0));
+
+    for (size_t h = 0; h < H; ++h) {
+        const T* qh  = q + h * N * D;
+        const T* kh  = k + h * M * D;
+        const T* vh  = v + h * M * Dv;
+        const T* dyh = dy + h * N * Dv;
+        T* dqh       = dq + h * N * D;
+        T* dkh       = dk + h * M * D;
+        T* dvh       = dv + h * M * Dv;
+
+        std::fill(dqh, dqh + N * D, T(0));
+
+        auto acc_functor = [&](const std::vector<T>& local) {
+            for (size_t i = 0; i < N * D; ++i) {
+                dqh[i] += local[i];
+            }
+        };
+
+        auto batch_fun = [&](const size_t first, const size_t last) {
+            std::vector<T> local(N * D);
+
+            std::vector<T> s(query_block * key_block);
+            std::vector<T> ds(query_block * key_block);
+            std::vector<T> t(query_block * key_block);
+
+            for (size_t b = first; b < last; ++b) {
+                const size_t j = b * key_block;
+                const size_t C = std::min(key_block, M - j);
+
+                for (size_t i = 0; i < N; i += query_block) {
+                    const size_t R = std::min(query_block, N - i);
+
+                    backward_block<default_vec>(qh + i * D, kh + j * D, vh + j * Dv, dyh + i * Dv, lse.data() + h * N + i, delta.data() + h * N + i,
+                                                local.data() + i * D, dkh + j * D, dvh + j * Dv, s.data(), ds.data(), t.data(), R, C, D, Dv, scale);
+                }
+            }
+
+            return local;
+        };
+
+        engine_dispatch_1d_acc<std::vector<T>>(batch_fun, acc_functor, 0, k_blocks, parallel ? 2 : std::numeric_limits<size_t>::max());
+
+        scale_row<default_vec>(dqh, N * D, scale);
+        scale_row<default_vec>(dkh, M * D, scale);
+    }
+}
+
+/*!
+ * \copydoc etl::impl::standard::attention
+ */
+template <typename T, cpp_disable_iff(attention_possible<T>)>
+void attention(const T* q, const T* k, const T* v, T* y, size_t H, size_t N, size_t M, size_t D, size_t Dv) {
+    cpp_unused(q);
+    cpp_unused(k);
+    cpp_unused(v);
+    cpp_unused(y);
+    cpp_unused(H);
+    cpp_unused(N);
+    cpp_unused(M);
+    cpp_unused(D);
+    cpp_unused(Dv);
+    cpp_unreachable("vec::attention called with invalid parameters");
+}
+
+/*!
+ * \copydoc etl::impl::standard::attention_backward
+ */
+template <typename T, cpp_disable_iff(attention_possible<T>)>
+void attention_backward(const T* q, const T* k, const T* v, const T* o, const T* dy, T* dq, T* dk, T* dv, size_t H, size_t N, size_t M, size_t D, size_t Dv) {
+    cpp_unused(q);
+    cpp_unused(k);
+    cpp_unused(v);
+    cpp_unused(o);
+    cpp_unused(dy);
+    cpp_unused(dq);
+    cpp_unused(dk);
+    cpp_unused(dv);
+    cpp_unused(H);
+    cpp_unused(N);
+    cpp_unused(M);
+    cpp_unused(D);
+    cpp_unused(Dv);
+    cpp_unreachable("vec::attention_backward called with invalid parameters");
+}
+
+} //end of namespace vec
+} //end of namespace impl
+} //end of namespace etl
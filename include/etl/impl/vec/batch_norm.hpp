@@ -0,0 +1,448 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Vectorized implementation of the batch normalization kernels.
+ *
+ * The work is split by channels (by blocks of columns for the 2D batch
+ * normalization). The second pass over a channel (the normalization or
+ * the errors of the input) directly follows the first pass (the
+ * statistics or the sums) and reads the channel from the cache instead
+ * of the memory.
+ */
+
+#pragma once
+
+#include "etl/impl/std/batch_norm.hpp"
+#include "etl/impl/vec/stats.hpp"
+
+namespace etl {
+
+namespace impl {
+
+namespace vec {
+
+/*!
+ * \brief Indicates if the batch normalization kernels of X (and the errors
+ * DY) can be vectorized
+ */
+template <typename X, typename DY>
+constexpr bool batch_norm_possible =
+    vec_enabled && vectorize_impl && all_row_major<X, DY> && all_vectorizable<vector_mode, X, DY> && all_floating<X> && all_homogeneous<X, DY>;
+
+namespace batch_norm_detail {
+
+/*!
+ * \brief The number of elements of a block of columns (2D batch
+ * normalization). The block is read a second time to normalize it and
+ * should stay in the cache.
+ */
+static constexpr size_t block_size = 8192;
+
+/*!
+ * \brief Returns the number of columns of a block of B rows
+ */
+template <typename V, typename T>
+size_t block_columns(size_t B) {
+    static constexpr size_t vec_size = V::template traits<T>::size;
+
+    return std::max(vec_size, (block_size / B) / vec_size * vec_size);
+}
+
+/*!
+ * \brief Compute out = k * dy + p * x + q on the columns [cfirst, clast)
+ * of the rows [rfirst, rlast) of C columns, with the coefficients of each
+ * column. The dy term is only computed if Dy is true.
+ */
+template <typename V, bool Dy, typename X, typename DY, typename T>
+void columns_affine(const X& x, const DY& dy, size_t C, const T* k, const T* p, const T* q, T* out, size_t rfirst, size_t rlast, size_t cfirst, size_t clast) {
+    static constexpr size_t vec_size = V::template traits<T>::size;
+
+    for (size_t i = rfirst; i < rlast; ++i) {
+        const size_t base = i * C;
+
+        size_t j = cfirst;
+
+        for (; j + vec_size - 1 < clast; j += vec_size) {
+            auto r = V::fmadd(x.template loadu<V>(base + j), V::loadu(p + j), V::loadu(q + j));
+
+            if (Dy) {
+                r = V::fmadd(dy.template loadu<V>(base + j), V::loadu(k + j), r);
+            }
+
+            V::storeu(out + base + j, r);
+        }
+
+        for (; j < clast; ++j) {
+            out[base + j] = p[j] * x.read_flat(base + j) + q[j];
+
+            if (Dy) {
+                out[base + j] += k[j] * dy.read_flat(base + j);
+            }
+        }
+    }
+}
+
+/*!
+ * \brief Compute out = k * dy + p * x + q on the plane of S elements
+ * starting at base. The dy term is only computed if Dy is true.
+ */
+template <typename V, bool Dy, typename X, typename DY, typename T>
+void plane_affine(const X& x, const DY& dy, size_t base, size_t S, T k, T p, T q, T* out) {
+    static constexpr size_t vec_size = V::template traits<T>::size;
+
+    auto vk = V::set(k);
+    auto vp = V::set(p);
+    auto vq = V::set(q);
+
+    size_t s = 0;
+
+    for (; s + 2 * vec_size - 1 < S; s += 2 * vec_size) {
+        auto r1 = V::fmadd(x.template loadu<V>(base + s + 0 * vec_size), vp, vq);
+        auto r2 = V::fmadd(x.template loadu<V>(base + s + 1 * vec_size), vp, vq);
+
+        if (Dy) {
+            r1 = V::fmadd(dy.template loadu<V>(base + s + 0 * vec_size), vk, r1);
+            r2 = V::fmadd(dy.template loadu<V>(base + s + 1 * vec_size), vk, r2);
+        }
+
+        V::storeu(out + base + s + 0 * vec_size, r1);
+        V::storeu(out + base + s + 1 * vec_size, r2);
+    }
+
+    for (; s + vec_size - 1 < S; s += vec_size) {
+        auto r1 = V::fmadd(x.template loadu<V>(base + s), vp, vq);
+
+        if (Dy) {
+            r1 = V::fmadd(dy.template loadu<V>(base + s), vk, r1);
+        }
+
+        V::storeu(out + base + s, r1);
+    }
+
+    for (; s < S; ++s) {
+        out[base + s] = p * x.read_flat(base + s) + q;
+
+        if (Dy) {
+            out[base + s] += k * dy.read_flat(base + s);
+        }
+    }
+}
+
+/*!
+ * \brief Compute the sums of dy and of dy * (x - mean) of the columns
+ * [first, last) of the B rows of C columns
+ */
+template <typename V, typename X, typename DY, typename T>
+void columns_sums(const X& x, const DY& dy, size_t B, size_t C, const T* mean, T* sum_dy, T* sum_dyx, size_t first, size_t last) {
+    static constexpr size_t vec_size = V::template traits<T>::size;
+
+    std::fill(sum_dy + first, sum_dy + last, T(0));
+    std::fill(sum_dyx + first, sum_dyx + last, T(0));
+
+    for (size_t i = 0; i < B; ++i) {
+        const size_t base = i * C;
+
+        size_t j = first;
+
+        for (; j + vec_size - 1 < last; j += vec_size) {
+            auto e = dy.template loadu<V>(base + j);
+            auto d = V::sub(x.template loadu<V>(base + j), V::loadu(mean + j));
+
+            V::storeu(sum_dy + j, V::add(e, V::loadu(sum_dy + j)));
+            V::storeu(sum_dyx + j, V::fmadd(e, d, V::loadu(sum_dyx + j)));
+        }
+
+        for (; j < last; ++j) {
+            const T e = dy.read_flat(base + j);
+
+            sum_dy[j] += e;
+            sum_dyx[j] += e * (x.read_flat(base + j) - mean[j]);
+        }
+    }
+}
+
+/*!
+ * \brief Accumulate the sums of dy and of dy * (x - mean) of the plane of
+ * S elements starting at base
+ */
+template <typename V, typename X, typename DY, typename T>
+void plane_sums(const X& x, const DY& dy, size_t base, size_t S, T mean, T& sum_dy, T& sum_dyx) {
+    static constexpr size_t vec_size = V::template traits<T>::size;
+
+    auto vm = V::set(mean);
+
+    auto s1 = V::template zero<T>();
+    auto s2 = V::template zero<T>();
+    auto d1 = V::template zero<T>();
+    auto d2 = V::template zero<T>();
+
+    size_t s = 0;
+
+    for (; s + 2 * vec_size - 1 < S; s += 2 * vec_size) {
+        auto e1 = dy.template loadu<V>(base + s + 0 * vec_size);
+        auto e2 = dy.template loadu<V>(base + s + 1 * vec_size);
+
+        s1 = V::add(e1, s1);
+        s2 = V::add(e2, s2);
+
+        d1 = V::fmadd(e1, V::sub(x.template loadu<V>(base + s + 0 * vec_size), vm), d1);
+        d2 = V::fmadd(e2, V::sub(x.template loadu<V>(base + s + 1 * vec_size), vm), d2);
+    }
+
+    for (; s + vec_size - 1 < S; s += vec_size) {
+        auto e1 = dy.template loadu<V>(base + s);
+
+        s1 = V::add(e1, s1);
+        d1 = V::fmadd(e1, V::sub(x.template loadu<V>(base + s), vm), d1);
+    }
+
+    sum_dy += V::hadd(V::add(s1, s2));
+    sum_dyx += V::hadd(V::add(d1, d2));
+
+    for (; s < S; ++s) {
+        const T e = dy.read_flat(base + s);
+
+        sum_dy += e;
+        sum_dyx += e * (x.read_flat(base + s) - mean);
+    }
+}
+
+/*!
+ * \brief Batch normalization (training) of the columns [first, last) of
+ * the B rows of C columns.
+ *
+ * The columns are processed by blocks, normalized right after their
+ * statistics are computed, while they are still in cache.
+ */
+template <typename V, typename X, typename T>
+void train_columns(const X& x, size_t B, size_t C, const T* gamma, const T* beta, T eps, T* mean, T* variance, T* scale, T* shift, T* y, size_t first, size_t last) {
+    const size_t width = block_columns<V, T>(B);
+
+    for (size_t j0 = first; j0 < last; j0 += width) {
+        const size_t j1 = std::min(j0 + width, last);
+
+        stats_detail::stats_l_kernel<V>(x, mean, variance, B, C, j0, j1);
+
+        for (size_t j = j0; j < j1; ++j) {
+            scale[j] = gamma[j] / std::sqrt(variance[j] + eps);
+            shift[j] = beta[j] - mean[j] * scale[j];
+        }
+
+        columns_affine<V, false>(x, x, C, scale, scale, shift, y, 0, B, j0, j1);
+    }
+}
+
+/*!
+ * \brief Batch normalization (training) of the channels [first, last) of
+ * the B samples of C planes of S elements.
+ *
+ * The planes of a channel are normalized right after the statistics of
+ * the channel are computed, while they are still in cache.
+ */
+template <typename V, typename X, typename T>
+void train_planes(const X& x, size_t B, size_t C, size_t S, const T* gamma, const T* beta, T eps, T* mean, T* variance, T* y, size_t first, size_t last) {
+    for (size_t c = first; c < last; ++c) {
+        statistics<T> local;
+
+        for (size_t b = 0; b < B; ++b) {
+            local.merge(stats_detail::stats_kernel<V>(x, (b * C + c) * S, (b * C + c + 1) * S));
+        }
+
+        mean[c]     = local.mean;
+        variance[c] = local.variance();
+
+        const T scale = gamma[c] / std::sqrt(variance[c] + eps);
+        const T shift = beta[c] - mean[c] * scale;
+
+        for (size_t b = 0; b < B; ++b) {
+            plane_affine<V, false>(x, x, (b * C + c) * S, S, T(0), scale, shift, y);
+        }
+    }
+}
+
+/*!
+ * \brief Batch normalization backward of the columns [first, last) of the
+ * B rows of C columns, by blocks of columns.
+ */
+template <typename V, typename X, typename DY, typename T>
+void backward_columns(const X& x, const DY& dy, size_t B, size_t C, const T* gamma, const T* mean, const T* variance, T eps, T* k, T* p, T* q, T* dx, T* dgamma, T* dbeta, size_t first, size_t last) {
+    const size_t width = block_columns<V, T>(B);
+
+    for (size_t j0 = first; j0 < last; j0 += width) {
+        const size_t j1 = std::min(j0 + width, last);
+
+        columns_sums<V>(x, dy, B, C, mean, dbeta, dgamma, j0, j1);
+
+        for (size_t j = j0; j < j1; ++j) {
+            standard::batch_norm_detail::backward_coefficients(gamma[j], mean[j], variance[j], eps, T(B), dbeta[j], dgamma[j], k[j], p[j], q[j]);
+        }
+
+        columns_affine<V, true>(x, dy, C, k, p, q, dx, 0, B, j0, j1);
+    }
+}
+
+/*!
+ * \brief Batch normalization backward of the channels [first, last) of
+ * the B samples of C planes of S elements.
+ */
+template <typename V, typename X, typename DY, typename T>
+void backward_planes(const X& x, const DY& dy, size_t B, size_t C, size_t S, const T* gamma, const T* mean, const T* variance, T eps, T* dx, T* dgamma, T* dbeta, size_t first, size_t last) {
+    for (size_t c = first; c < last; ++c) {
+        T s1 = 0;
+        T s2 = 0;
+
+        for (size_t b = 0; b < B; ++b) {
+            plane_sums<V>(x, dy, (b * C + c) * S, S, mean[c], s1, s2);
+        }
+
+        T k, p, q;
+        standard::batch_norm_detail::backward_coefficients(gamma[c], mean[c], variance[c], eps, T(B * S), s1, s2, k, p, q);
+
+        dbeta[c]  = s1;
+        dgamma[c] = s2;
+
+        for (size_t b = 0; b < B; ++b) {
+            plane_affine<V, true>(x, dy, (b * C + c) * S, S, k, p, q, dx);
+        }
+    }
+}
+
+} //end of namespace batch_norm_detail
+
+/*!
+ * \copydoc etl::impl::standard::batch_norm_train
+ */
+template <typename X, typename T, cpp_enable_iff(batch_norm_possible<X, X>)>
+void batch_norm_train(const X& x, size_t B, size_t C, size_t S, const T* gamma, const T* beta, T eps, T* mean, T* variance, T* y) {
+    const bool parallel = engine_select_parallel(B * C * S, parallel_threshold) && is_thread_safe<X>;
+
+    if (S == 1) {
+        std::vector<T> scale(C);
+        std::vector<T> shift(C);
+
+        auto batch_fun = [&](const size_t first, const size_t last) {
+            batch_norm_detail::train_columns<default_vec>(x, B, C, gamma, beta, eps, mean, variance, scale.data(), shift.data(), y, first, last);
+        };
+
+        reduc_detail::dispatch<default_vec, T>(batch_fun, C, parallel);
+    } else {
+        auto batch_fun = [&](const size_t first, const size_t last) {
+            batch_norm_detail::train_planes<default_vec>(x, B, C, S, gamma, beta, eps, mean, variance, y, first, last);
+        };
+
+        engine_dispatch_1d(batch_fun, 0, C, parallel);
+    }
+}
+
+/*!
+ * \copydoc etl::impl::standard::batch_norm_scale_shift
+ */
+template <typename X, typename T, cpp_enable_iff(batch_norm_possible<X, X>)>
+void batch_norm_scale_shift(const X& x, size_t B, size_t C, size_t S, const T* scale, const T* shift, T* y) {
+    const bool parallel = engine_select_parallel(B * C * S, parallel_threshold) && is_thread_safe<X>;
+
+    if (S == 1) {
+        auto batch_fun = [&](const size_t first, const size_t last) {
+            batch_norm_detail::columns_affine<default_vec, false>(x, x, C, scale, scale, shift, y, first, last, 0, C);
+        };
+
+        engine_dispatch_1d(batch_fun, 0, B, parallel);
+    } else {
+        auto batch_fun = [&](const size_t first, const size_t last) {
+            for (size_t i = first; i < last; ++i) {
+                batch_norm_detail::plane_affine<default_vec, false>(x, x, i * S, S, T(0), scale[i % C], shift[i % C], y);
+            }
+        };
+
+        engine_dispatch_1d(batch_fun, 0, B * C, parallel);
+    }
+}
+
+/*!
+ * \copydoc etl::impl::standard::batch_norm_backward
+ */
+template <typename X, typename DY, typename T, cpp_enable_iff(batch_norm_possible<X, DY>)>
+void batch_norm_backward(const X& x, const DY& dy, size_t B, size_t C, size_t S, const T* gamma, const T* mean, const T* variance, T eps, T* dx, T* dgamma, T* dbeta) {
+    const bool parallel = engine_select_parallel(B * C * S, parallel_threshold) && is_thread_safe<X> && is_thread_safe<DY>;
+
+    if (S == 1) {
+        std::vector<T> k(C);
+        std::vector<T> p(C);
+        std::vector<T> q(C);
+
+        auto batch_fun = [&](const size_t first, const size_t last) {
+            batch_norm_detail::backward_columns<default_vec>(x, dy, B, C, gamma, mean, variance, eps, k.data(), p.data(), q.data(), dx, dgamma, dbeta, first, last);
+        };
+
+        reduc_detail::dispatch<default_vec, T>(batch_fun, C, parallel);
+    } else {
+        auto batch_fun = [&](const size_t first, const size_t last) {
+            batch_norm_detail::backward_planes<default_vec>(x, dy, B, C, S, gamma, mean, variance, eps, dx, dgamma, dbeta, first, last);
+        };
+
+        engine_dispatch_1d(batch_fun, 0, C, parallel);
+    }
+}
+
+/*!
+ * \copydoc etl::impl::standard::batch_norm_train
+ */
+template <typename X, typename T, cpp_disable_iff(batch_norm_possible<X, X>)>
+void batch_norm_train(const X& x, size_t B, size_t C, size_t S, const T* gamma, const T* beta, T eps, T* mean, T* variance, T* y) {
+    cpp_unused(x);
+    cpp_unused(B);
+    cpp_unused(C);
+    cpp_unused(S);
+    cpp_unused(gamma);
+    cpp_unused(beta);
+    cpp_unused(eps);
+    cpp_unused(mean);
+    cpp_unused(variance);
+    cpp_unused(y);
+    cpp_unreachable("vec::batch_norm_train called with invalid parameters");
+}
+
+/*!
+ * \copydoc etl::impl::standard::batch_norm_scale_shift
+ */
+template <typename X, typename T, cpp_disable_iff(batch_norm_possible<X, X>)>
+void batch_norm_scale_shift(const X& x, size_t B, size_t C, size_t S, const T* scale, const T* shift, T* y) {
+    cpp_unused(x);
+    cpp_unused(B);
+    cpp_unused(C);
+    cpp_unused(S);
+    cpp_unused(scale);
+    cpp_unused(shift);
+    cpp_unused(y);
+    cpp_unreachable("vec::batch_norm_scale_shift called with invalid parameters");
+}
+
+/*!
+ * \copydoc etl::impl::standard::batch_norm_backward
+ */
+template <typename X, typename DY, typename T, cpp_disable_iff(batch_norm_possible<X, DY>)>
+void batch_norm_backward(const X& x, const DY& dy, size_t B, size_t C, size_t S, const T* gamma, const T* mean, const T* variance, T eps, T* dx, T* dgamma, T* dbeta) {
+    cpp_unused(x);
+    cpp_unused(dy);
+    cpp_unused(B);
+    cpp_unused(C);
+    cpp_unused(S);
+    cpp_unused(gamma);
+    cpp_unused(mean);
+    cpp_unused(variance);
+    cpp_unused(eps);
+    cpp_unused(dx);
+    cpp_unused(dgamma);
+    cpp_unused(dbeta);
+    cpp_unreachable("vec::batch_norm_backward called with invalid parameters");
+}
+
+} //end of namespace vec
+} //end of namespace impl
+} //end of namespace etl
@@ -0,0 +1,282 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Vectorized implementation of the fused softmax Categorical Cross
+ * Entropy
+ */
+
+#pragma once
+
+#include "etl/impl/std/cce.hpp"
+#include "etl/impl/vec/softmax.hpp"
+
+namespace etl {
+
+namespace impl {
+
+namespace vec {
+
+/*!
+ * \brief Indicates if the fused softmax cross entropy of the logits O
+ * with the labels L can be vectorized
+ */
+template <typename O, typename L>
+constexpr bool softmax_cce_possible =
+    vec_enabled && vectorize_impl && all_floating<O> && all_row_major<O, L>
+    && (decay_traits<L>::dimensions() == 1 ? all_vectorizable<vector_mode, O> : all_vectorizable<vector_mode, O, L> && all_homogeneous<O, L>);
+
+namespace cce_detail {
+
+/*!
+ * \brief Compute the sum of the exponentials exp(x - m) of the row
+ * [first, last) of the logits and store them in g, if Grad is true
+ *
+ * For dense labels, the dot product of the labels and the shifted logits
+ * (x - m) and the sum of the labels are accumulated in the same pass.
+ *
+ * \param x The logits
+ * \param labels The labels, only used if Dense is true
+ * \param first The first element of the row
+ * \param K The length of the row
+ * \param m The maximum of the row
+ * \param g The row of the gradient
+ * \param dot The dot product of the labels and the shifted logits
+ * \param lsum The sum of the labels
+ * \return the sum of the exponentials
+ */
+template <typename V, bool Grad, bool Dense, typename O, typename L, typename T>
+T exp_row(const O& x, const L& labels, size_t first, size_t K, T m, T* g, T& dot, T& lsum) {
+    static constexpr size_t vec_size = V::template traits<T>::size;
+
+    auto vm = V::set(m);
+
+    auto s1 = V::template zero<T>();
+    auto s2 = V::template zero<T>();
+    auto d1 = V::template zero<T>();
+    auto l1 = V::template zero<T>();
+
+    size_t k = 0;
+
+    for (; k + 2 * vec_size - 1 < K; k += 2 * vec_size) {
+        auto x1 = x.template loadu<V>(first + k + 0 * vec_size);
+        auto x2 = x.template loadu<V>(first + k + 1 * vec_size);
+
+        x1 = V::sub(x1, vm);
+        x2 = V::sub(x2, vm);
+
+        auto e1 = V::exp(x1);
+        auto e2 = V::exp(x2);
+
+        if (Grad) {
+            V::storeu(g + k + 0 * vec_size, e1);
+            V::storeu(g + k + 1 * vec_size, e2);
+        }
+
+        s1 = V::add(e1, s1);
+        s2 = V::add(e2, s2);
+
+        if (Dense) {
+            auto y1 = labels.template loadu<V>(first + k + 0 * vec_size);
+            auto y2 = labels.template loadu<V>(first + k + 1 * vec_size);
+
+            d1 = V::fmadd(y1, x1, d1);
+            d1 = V::fmadd(y2, x2, d1);
+            l1 = V::add(V::add(y1, y2), l1);
+        }
+    }
+
+    for (; k + vec_size - 1 < K; k += vec_size) {
+        auto x1 = V::sub(x.template loadu<V>(first + k), vm);
+        auto e1 = V::exp(x1);
+
+        if (Grad) {
+            V::storeu(g + k, e1);
+        }
+
+        s1 = V::add(e1, s1);
+
+        if (Dense) {
+            auto y1 = labels.template loadu<V>(first + k);
+
+            d1 = V::fmadd(y1, x1, d1);
+            l1 = V::add(y1, l1);
+        }
+    }
+
+    T s = V::hadd(V::add(s1, s2));
+
+    if (Dense) {
+        dot  = V::hadd(d1);
+        lsum = V::hadd(l1);
+    }
+
+    for (; k < K; ++k) {
+        const T xk = x.read_flat(first + k) - m;
+        const T e  = std::exp(xk);
+
+        if (Grad) {
+            g[k] = e;
+        }
+
+        s += e;
+
+        if (Dense) {
+            const T yk = labels.read_flat(first + k);
+
+            dot += yk * xk;
+            lsum += yk;
+        }
+    }
+
+    return s;
+}
+
+/*!
+ * \brief Compute the cross entropy of the softmax of the rows [first,
+ * last) of the logits with their dense labels and write their gradient
+ * if Grad is true
+ * \return the sum of the labels multiplied by the log-softmax of the rows
+ */
+template <typename V, bool Grad, typename O, typename L, typename T, cpp_enable_iff(decay_traits<L>::dimensions() == 2)>
+T softmax_cce_kernel(const O& x, const L& labels, size_t K, T* gradient, size_t first, size_t last) {
+    static constexpr size_t vec_size = V::template traits<T>::size;
+
+    T loss = 0;
+
+    for (size_t i = first; i < last; ++i) {
+        const size_t base = i * K;
+
+        T* g = gradient + base;
+
+        const T m = softmax_detail::row_max<V>(x, base, base + K);
+
+        T dot  = 0;
+        T lsum = 0;
+
+        const T s = exp_row<V, Grad, true>(x, labels, base, K, m, g, dot, lsum);
+
+        if (Grad) {
+            const T inv = T(1) / s;
+
+            auto vinv = V::set(inv);
+
+            size_t k = 0;
+
+            for (; k + vec_size - 1 < K; k += vec_size) {
+                V::storeu(g + k, V::sub(V::mul(V::loadu(g + k), vinv), labels.template loadu<V>(base + k)));
+            }
+
+            for (; k < K; ++k) {
+                g[k] = g[k] * inv - labels.read_flat(base + k);
+            }
+        }
+
+        loss += dot - std::log(s) * lsum;
+    }
+
+    return loss;
+}
+
+/*!
+ * \brief Compute the cross entropy of the softmax of the rows [first,
+ * last) of the logits with their label indices and write their gradient
+ * if Grad is true
+ * \return the sum of the log-softmax of the labels of the rows
+ */
+template <typename V, bool Grad, typename O, typename L, typename T, cpp_enable_iff(decay_traits<L>::dimensions() == 1)>
+T softmax_cce_kernel(const O& x, const L& labels, size_t K, T* gradient, size_t first, size_t last) {
+    static constexpr size_t vec_size = V::template traits<T>::size;
+
+    T loss = 0;
+
+    for (size_t i = first; i < last; ++i) {
+        const size_t base = i * K;
+        const size_t y    = labels.read_flat(i);
+
+        cpp_assert(y < K, "Invalid label for softmax_cross_entropy");
+
+        T* g = gradient + base;
+
+        const T m = softmax_detail::row_max<V>(x, base, base + K);
+
+        T dot  = 0;
+        T lsum = 0;
+
+        const T s = exp_row<V, Grad, false>(x, x, base, K, m, g, dot, lsum);
+
+        if (Grad) {
+            const T inv = T(1) / s;
+
+            auto vinv = V::set(inv);
+
+            size_t k = 0;
+
+            for (; k + vec_size - 1 < K; k += vec_size) {
+                V::storeu(g + k, V::mul(V::loadu(g + k), vinv));
+            }
+
+            for (; k < K; ++k) {
+                g[k] *= inv;
+            }
+
+            g[y] -= T(1);
+        }
+
+        loss += (x.read_flat(base + y) - m) - std::log(s);
+    }
+
+    return loss;
+}
+
+} //end of namespace cce_detail
+
+/*!
+ * \copydoc etl::impl::standard::softmax_cce
+ */
+template <typename O, typename L, cpp_enable_iff(softmax_cce_possible<O, L>)>
+value_t<O> softmax_cce(const O& logits, const L& labels, value_t<O> scale, value_t<O>* gradient) {
+    using T = value_t<O>;
+
+    const size_t N = etl::dim<0>(logits);
+    const size_t K = etl::size(logits) / N;
+
+    T loss = 0;
+
+    auto acc_functor = [&loss](T value) {
+        loss += value;
+    };
+
+    auto batch_fun = [&](const size_t first, const size_t last) {
+        if (gradient) {
+            return cce_detail::softmax_cce_kernel<default_vec, true>(logits, labels, K, gradient, first, last);
+        } else {
+            return cce_detail::softmax_cce_kernel<default_vec, false>(logits, labels, K, gradient, first, last);
+        }
+    };
+
+    engine_dispatch_1d_acc<T>(batch_fun, acc_functor, 0, N, standard::cce_detail::softmax_cce_threshold<O, L>(K));
+
+    return scale * loss;
+}
+
+/*!
+ * \copydoc etl::impl::standard::softmax_cce
+ */
+template <typename O, typename L, cpp_disable_iff(softmax_cce_possible<O, L>)>
+value_t<O> softmax_cce(const O& logits, const L& labels, value_t<O> scale, value_t<O>* gradient) {
+    cpp_unused(logits);
+    cpp_unused(labels);
+    cpp_unused(scale);
+    cpp_unused(gradient);
+    cpp_unreachable("vec::softmax_cce called with invalid parameters");
+}
+
+} //end of namespace vec
+} //end of namespace impl
+} //end of namespace etl
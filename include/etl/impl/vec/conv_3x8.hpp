@@ -81,10 +81,10 @@ void conv2_valid_flipped_micro_kernel_3x8(const T* in, size_t n1, size_t n2, con
                 auto i12 = vec_type::loadu(in + (i + 0) * n2 + j + 1 + 0);
                 auto i13 = vec_type::loadu(in + (i + 0) * n2 + j + 2 + 0);
                 auto i14 = vec_type::loadu(in + (i + 0) * n2 + j + 3 + 0);
-                auto i15 = vec_type::loadu(in + (i + 0) * n2 + j + 4 + 0);
-                auto i16 = vec_type::loadu(in + (i + 0) * n2 + j + 5 + 0);
-                auto i17 = vec_type::loadu(in + (i + 0) * n2 + j + 6 + 0);
-                auto i18 = vec_type::loadu(in + (i + 0) * n2 + j + 7 + 0);
+                auto i15 = vec_type::loadu(in + (i + 0) * n2 + j + 8 + 0);
+                auto i16 = vec_type::loadu(in + (i + 0) * n2 + j + 9 + 0);
+                auto i17 = vec_type::loadu(in + (i + 0) * n2 + j + 10 + 0);
+                auto i18 = vec_type::loadu(in + (i + 0) * n2 + j + 11 + 0);
 
                 auto r1 = vec_type::mul(i11, dk1);
                 auto r2 = vec_type::mul(i12, dk1);
@@ -99,37 +99,37 @@ void conv2_valid_flipped_micro_kernel_3x8(const T* in, size_t n1, size_t n2, con
                 auto i22 = vec_type::loadu(in + (i + 1) * n2 + j + 1 + 0);
                 auto i23 = vec_type::loadu(in + (i + 1) * n2 + j + 2 + 0);
                 auto i24 = vec_type::loadu(in + (i + 1) * n2 + j + 3 + 0);
-                auto i25 = vec_type::loadu(in + (i + 1) * n2 + j + 4 + 0);
-                auto i26 = vec_type::loadu(in + (i + 1) * n2 + j + 5 + 0);
-                auto i27 = vec_type::loadu(in + (i + 1) * n2 + j + 6 + 0);
-                auto i28 = vec_type::loadu(in + (i + 1) * n2 + j + 7 + 0);
+                auto i25 = vec_type::loadu(in + (i + 1) * n2 + j + 8 + 0);
+                auto i26 = vec_type::loadu(in + (i + 1) * n2 + j + 9 + 0);
+                auto i27 = vec_type::loadu(in + (i + 1) * n2 + j + 10 + 0);
+                auto i28 = vec_type::loadu(in + (i + 1) * n2 + j + 11 + 0);
 
                 r1 = vec_type::fmadd(i21, dk2, r1);
                 r2 = vec_type::fmadd(i22, dk2, r2);
                 r3 = vec_type::fmadd(i23, dk2, r3);
                 r4 = vec_type::fmadd(i24, dk2, r4);
                 r5 = vec_type::fmadd(i25, dk2, r5);
-                r6 = vec_type::fmadd(i26, dk2, r5);
-                r7 = vec_type::fmadd(i27, dk2, r6);
-                r8 = vec_type::fmadd(i28, dk2, r7);
+                r6 = vec_type::fmadd(i26, dk2, r6);
+                r7 = vec_type::fmadd(i27, dk2, r7);
+                r8 = vec_type::fmadd(i28, dk2, r8);
 
                 auto i31 = vec_type::loadu(in + (i + 2) * n2 + j + 0 + 0);
                 auto i32 = vec_type::loadu(in + (i + 2) * n2 + j + 1 + 0);
                 auto i33 = vec_type::loadu(in + (i + 2) * n2 + j + 2 + 0);
                 auto i34 = vec_type::loadu(in + (i + 2) * n2 + j + 3 + 0);
-                auto i35 = vec_type::loadu(in + (i + 2) * n2 + j + 4 + 0);
-                auto i36 = vec_type::loadu(in + (i + 2) * n2 + j + 5 + 0);
-                auto i37 = vec_type::loadu(in + (i + 2) * n2 + j + 6 + 0);
-                auto i38 = vec_type::loadu(in + (i + 2) * n2 + j + 7 + 0);
+                auto i35 = vec_type::loadu(in + (i + 2) * n2 + j + 8 + 0);
+                auto i36 = vec_type::loadu(in + (i + 2) * n2 + j + 9 + 0);
+                auto i37 = vec_type::loadu(in + (i + 2) * n2 + j + 10 + 0);
+                auto i38 = vec_type::loadu(in + (i + 2) * n2 + j + 11 + 0);
 
                 r1 = vec_type::fmadd(i31, dk3, r1);
                 r2 = vec_type::fmadd(i32, dk3, r2);
                 r3 = vec_type::fmadd(i33, dk3, r3);
                 r4 = vec_type::fmadd(i34, dk3, r4);
                 r5 = vec_type::fmadd(i35, dk3, r5);
-                r6 = vec_type::fmadd(i36, dk3, r5);
-                r7 = vec_type::fmadd(i37, dk3, r6);
-                r8 = vec_type::fmadd(i38, dk3, r7);
+                r6 = vec_type::fmadd(i36, dk3, r6);
+                r7 = vec_type::fmadd(i37, dk3, r7);
+                r8 = vec_type::fmadd(i38, dk3, r8);
 
                 r1 = _mm256_hadd_ps(r1.value, r1.value);
                 r2 = _mm256_hadd_ps(r2.value, r2.value);
@@ -278,10 +278,10 @@ void conv2_valid_flipped_micro_kernel_3x8(const T* in, size_t n1, size_t n2, con
                 auto i12 = vec_type::loadu(in + (i + 0) * n2 + j + 1 + 0);
                 auto i13 = vec_type::loadu(in + (i + 0) * n2 + j + 2 + 0);
                 auto i14 = vec_type::loadu(in + (i + 0) * n2 + j + 3 + 0);
-                auto i15 = vec_type::loadu(in + (i + 0) * n2 + j + 4 + 0);
-                auto i16 = vec_type::loadu(in + (i + 0) * n2 + j + 5 + 0);
-                auto i17 = vec_type::loadu(in + (i + 0) * n2 + j + 6 + 0);
-                auto i18 = vec_type::loadu(in + (i + 0) * n2 + j + 7 + 0);
+                auto i15 = vec_type::loadu(in + (i + 0) * n2 + j + 8 + 0);
+                auto i16 = vec_type::loadu(in + (i + 0) * n2 + j + 9 + 0);
+                auto i17 = vec_type::loadu(in + (i + 0) * n2 + j + 10 + 0);
+                auto i18 = vec_type::loadu(in + (i + 0) * n2 + j + 11 + 0);
 
                 auto r1 = vec_type::mul(i11, dk1);
                 auto r2 = vec_type::mul(i12, dk1);
@@ -296,37 +296,37 @@ void conv2_valid_flipped_micro_kernel_3x8(const T* in, size_t n1, size_t n2, con
                 auto i22 = vec_type::loadu(in + (i + 1) * n2 + j + 1 + 0);
                 auto i23 = vec_type::loadu(in + (i + 1) * n2 + j + 2 + 0);
                 auto i24 = vec_type::loadu(in + (i + 1) * n2 + j + 3 + 0);
-                auto i25 = vec_type::loadu(in + (i + 1) * n2 + j + 4 + 0);
-                auto i26 = vec_type::loadu(in + (i + 1) * n2 + j + 5 + 0);
-                auto i27 = vec_type::loadu(in + (i + 1) * n2 + j + 6 + 0);
-                auto i28 = vec_type::loadu(in + (i + 1) * n2 + j + 7 + 0);
+                auto i25 = vec_type::loadu(in + (i + 1) * n2 + j + 8 + 0);
+                auto i26 = vec_type::loadu(in + (i + 1) * n2 + j + 9 + 0);
+                auto i27 = vec_type::loadu(in + (i + 1) * n2 + j + 10 + 0);
+                auto i28 = vec_type::loadu(in + (i + 1) * n2 + j + 11 + 0);
 
                 r1 = vec_type::fmadd(i21, dk2, r1);
                 r2 = vec_type::fmadd(i22, dk2, r2);
                 r3 = vec_type::fmadd(i23, dk2, r3);
                 r4 = vec_type::fmadd(i24, dk2, r4);
                 r5 = vec_type::fmadd(i25, dk2, r5);
-                r6 = vec_type::fmadd(i26, dk2, r5);
-                r7 = vec_type::fmadd(i27, dk2, r6);
-                r8 = vec_type::fmadd(i28, dk2, r7);
+                r6 = vec_type::fmadd(i26, dk2, r6);
+                r7 = vec_type::fmadd(i27, dk2, r7);
+                r8 = vec_type::fmadd(i28, dk2, r8);
 
                 auto i31 = vec_type::loadu(in + (i + 2) * n2 + j + 0 + 0);
                 auto i32 = vec_type::loadu(in + (i + 2) * n2 + j + 1 + 0);
                 auto i33 = vec_type::loadu(in + (i + 2) * n2 + j + 2 + 0);
                 auto i34 = vec_type::loadu(in + (i + 2) * n2 + j + 3 + 0);
-                auto i35 = vec_type::loadu(in + (i + 2) * n2 + j + 4 + 0);
-                auto i36 = vec_type::loadu(in + (i + 2) * n2 + j + 5 + 0);
-                auto i37 = vec_type::loadu(in + (i + 2) * n2 + j + 6 + 0);
-                auto i38 = vec_type::loadu(in + (i + 2) * n2 + j + 7 + 0);
+                auto i35 = vec_type::loadu(in + (i + 2) * n2 + j + 8 + 0);
+                auto i36 = vec_type::loadu(in + (i + 2) * n2 + j + 9 + 0);
+                auto i37 = vec_type::loadu(in + (i + 2) * n2 + j + 10 + 0);
+                auto i38 = vec_type::loadu(in + (i + 2) * n2 + j + 11 + 0);
 
                 r1 = vec_type::fmadd(i31, dk3, r1);
                 r2 = vec_type::fmadd(i32, dk3, r2);
                 r3 = vec_type::fmadd(i33, dk3, r3);
                 r4 = vec_type::fmadd(i34, dk3, r4);
                 r5 = vec_type::fmadd(i35, dk3, r5);
-                r6 = vec_type::fmadd(i36, dk3, r5);
-                r7 = vec_type::fmadd(i37, dk3, r6);
-                r8 = vec_type::fmadd(i38, dk3, r7);
+                r6 = vec_type::fmadd(i36, dk3, r6);
+                r7 = vec_type::fmadd(i37, dk3, r7);
+                r8 = vec_type::fmadd(i38, dk3, r8);
 
                 r1 = _mm256_hadd_ps(r1.value, r1.value);
                 r2 = _mm256_hadd_ps(r2.value, r2.value);
@@ -0,0 +1,157 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Vectorized implementation of the embedding lookup (gather of
+ * vocabulary rows)
+ */
+
+#pragma once
+
+namespace etl {
+
+namespace impl {
+
+namespace vec {
+
+/*!
+ * \brief Indicates if the embedding lookup of the rows of B into L can be
+ * vectorized
+ */
+template <typename B, typename L>
+constexpr bool embedding_lookup_possible =
+    vec_enabled && vectorize_impl && all_dma<B, L> && all_row_major<B, L> && all_vectorizable<vector_mode, B, L> && all_homogeneous<B, L>;
+
+namespace embedding_detail {
+
+/*!
+ * \brief The number of indices ahead of the current one whose rows are
+ * prefetched
+ */
+static constexpr size_t prefetch_distance = 8;
+
+/*!
+ * \brief Prefetch the given row of the vocabulary
+ * \param row The row
+ * \param D The length of the row
+ */
+template <typename T>
+ETL_STRONG_INLINE(void) prefetch_row(const T* row, size_t D) {
+    static constexpr size_t line = 64 / sizeof(T);
+
+    for (size_t d = 0; d < D; d += line) {
+        __builtin_prefetch(row + d);
+    }
+}
+
+/*!
+ * \brief Copy the vocabulary rows of the indices [first, last) of a into
+ * the output rows [first, last).
+ *
+ * The rows of the indices prefetch_distance ahead are prefetched. The
+ * output is written with normal stores since it is generally consumed
+ * right away by the next layer.
+ *
+ * \param a The indices
+ * \param b The memory of the vocabulary
+ * \param c The output memory
+ * \param D The length of the rows
+ * \param first The first index
+ * \param last The last index (exclusive)
+ */
+template <typename V, typename A, typename T>
+void gather_kernel(const A& a, const T* b, T* c, size_t D, size_t first, size_t last) {
+    static constexpr size_t vec_size = V::template traits<T>::size;
+
+    for (size_t i = first; i < first + prefetch_distance && i < last; ++i) {
+        prefetch_row(b + size_t(a.read_flat(i)) * D, D);
+    }
+
+    for (size_t i = first; i < last; ++i) {
+        if (i + prefetch_distance < last) {
+            prefetch_row(b + size_t(a.read_flat(i + prefetch_distance)) * D, D);
+        }
+
+        const T* src = b + size_t(a.read_flat(i)) * D;
+        T* dst       = c + i * D;
+
+        size_t d = 0;
+
+        for (; d + 4 * vec_size - 1 < D; d += 4 * vec_size) {
+            auto x1 = V::loadu(src + d + 0 * vec_size);
+            auto x2 = V::loadu(src + d + 1 * vec_size);
+            auto x3 = V::loadu(src + d + 2 * vec_size);
+            auto x4 = V::loadu(src + d + 3 * vec_size);
+
+            V::storeu(dst + d + 0 * vec_size, x1);
+            V::storeu(dst + d + 1 * vec_size, x2);
+            V::storeu(dst + d + 2 * vec_size, x3);
+            V::storeu(dst + d + 3 * vec_size, x4);
+        }
+
+        for (; d + vec_size - 1 < D; d += vec_size) {
+            V::storeu(dst + d, V::loadu(src + d));
+        }
+
+        for (; d < D; ++d) {
+            dst[d] = src[d];
+        }
+    }
+}
+
+} //end of namespace embedding_detail
+
+/*!
+ * \brief Copy the vocabulary row of each index of a into the
+ * corresponding row of c.
+ *
+ * The indices are split between the threads. Each thread prefetches the
+ * rows of the next indices, which are generally not in cache for large
+ * vocabularies.
+ *
+ * \param a The indices (of any dimensions)
+ * \param b The vocabulary
+ * \param c The output, one row per index
+ */
+template <typename A, typename B, typename C, cpp_enable_iff(embedding_lookup_possible<B, C>)>
+void embedding_lookup(const A& a, const B& b, C&& c) {
+    using T = value_t<B>;
+
+    const size_t n = etl::size(a);
+    const size_t D = etl::dim<1>(b);
+
+    a.ensure_cpu_up_to_date();
+    b.ensure_cpu_up_to_date();
+
+    const T* bm = b.memory_start();
+    T* cm       = c.memory_start();
+
+    auto batch_fun = [&](const size_t first, const size_t last) {
+        embedding_detail::gather_kernel<default_vec>(a, bm, cm, D, first, last);
+    };
+
+    engine_dispatch_1d(batch_fun, 0, n, engine_select_parallel(n * D, parallel_threshold) && is_thread_safe<A>);
+
+    c.validate_cpu();
+    c.invalidate_gpu();
+}
+
+/*!
+ * \copydoc embedding_lookup
+ */
+template <typename A, typename B, typename C, cpp_disable_iff(embedding_lookup_possible<B, C>)>
+void embedding_lookup(const A& a, const B& b, C&& c) {
+    cpp_unused(a);
+    cpp_unused(b);
+    cpp_unused(c);
+    cpp_unreachable("vec::embedding_lookup called with invalid parameters");
+}
+
+} //end of namespace vec
+} //end of namespace impl
+} //end of namespace etl
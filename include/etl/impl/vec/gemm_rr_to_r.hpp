@@ -608,6 +608,143 @@ void gemm_large_kernel_rr_to_r(const T* a, const T* b, T* ETL_RESTRICT c, size_t
     }
 }
 
+/*!
+ * \brief Accumulate the product of a block of A with a packed panel of B
+ * into a block of C, C += A * B.
+ *
+ * A and C are blocks inside larger row-major matrices, with the given
+ * leading dimensions. B is a contiguous row-major panel, which should be
+ * small enough to stay in cache.
+ *
+ * \param a The lhs block
+ * \param lda The leading dimension of a
+ * \param b The rhs packed panel
+ * \param c The result block
+ * \param ldc The leading dimension of c
+ * \param M The number of rows of A and C
+ * \param N The number of columns of B and C
+ * \param K The number of columns of A and rows of B
+ */
+template <typename V, typename T>
+void gemm_panel_kernel_rr_to_r(const T* a, size_t lda, const T* b, T* ETL_RESTRICT c, size_t ldc, size_t M, size_t N, size_t K) {
+    using vec_type = V;
+
+    static constexpr size_t vec_size = vec_type::template traits<T>::size;
+
+    size_t j = 0;
+
+    for (; j + vec_size * 4 - 1 < N; j += vec_size * 4) {
+        const size_t j1 = j + vec_size * 1;
+        const size_t j2 = j + vec_size * 2;
+        const size_t j3 = j + vec_size * 3;
+
+        size_t i = 0;
+
+        for (; i + 1 < M; i += 2) {
+            auto r11 = vec_type::loadu(c + (i + 0) * ldc + j);
+            auto r12 = vec_type::loadu(c + (i + 0) * ldc + j1);
+            auto r13 = vec_type::loadu(c + (i + 0) * ldc + j2);
+            auto r14 = vec_type::loadu(c + (i + 0) * ldc + j3);
+
+            auto r21 = vec_type::loadu(c + (i + 1) * ldc + j);
+            auto r22 = vec_type::loadu(c + (i + 1) * ldc + j1);
+            auto r23 = vec_type::loadu(c + (i + 1) * ldc + j2);
+            auto r24 = vec_type::loadu(c + (i + 1) * ldc + j3);
+
+            for (size_t k = 0; k < K; ++k) {
+                auto a1 = vec_type::set(a[(i + 0) * lda + k]);
+                auto a2 = vec_type::set(a[(i + 1) * lda + k]);
+
+                auto b1 = vec_type::loadu(b + k * N + j);
+                auto b2 = vec_type::loadu(b + k * N + j1);
+                auto b3 = vec_type::loadu(b + k * N + j2);
+                auto b4 = vec_type::loadu(b + k * N + j3);
+
+                r11 = vec_type::fmadd(a1, b1, r11);
+                r12 = vec_type::fmadd(a1, b2, r12);
+                r13 = vec_type::fmadd(a1, b3, r13);
+                r14 = vec_type::fmadd(a1, b4, r14);
+
+                r21 = vec_type::fmadd(a2, b1, r21);
+                r22 = vec_type::fmadd(a2, b2, r22);
+                r23 = vec_type::fmadd(a2, b3, r23);
+                r24 = vec_type::fmadd(a2, b4, r24);
+            }
+
+            vec_type::storeu(c + (i + 0) * ldc + j, r11);
+            vec_type::storeu(c + (i + 0) * ldc + j1, r12);
+            vec_type::storeu(c + (i + 0) * ldc + j2, r13);
+            vec_type::storeu(c + (i + 0) * ldc + j3, r14);
+            vec_type::storeu(c + (i + 1) * ldc + j, r21);
+            vec_type::storeu(c + (i + 1) * ldc + j1, r22);
+            vec_type::storeu(c + (i + 1) * ldc + j2, r23);
+            vec_type::storeu(c + (i + 1) * ldc + j3, r24);
+        }
+
+        if (i < M) {
+            auto r1 = vec_type::loadu(c + i * ldc + j);
+            auto r2 = vec_type::loadu(c + i * ldc + j1);
+            auto r3 = vec_type::loadu(c + i * ldc + j2);
+            auto r4 = vec_type::loadu(c + i * ldc + j3);
+
+            for (size_t k = 0; k < K; ++k) {
+                auto a1 = vec_type::set(a[i * lda + k]);
+
+                r1 = vec_type::fmadd(a1, vec_type::loadu(b + k * N + j), r1);
+                r2 = vec_type::fmadd(a1, vec_type::loadu(b + k * N + j1), r2);
+                r3 = vec_type::fmadd(a1, vec_type::loadu(b + k * N + j2), r3);
+                r4 = vec_type::fmadd(a1, vec_type::loadu(b + k * N + j3), r4);
+            }
+
+            vec_type::storeu(c + i * ldc + j, r1);
+            vec_type::storeu(c + i * ldc + j1, r2);
+            vec_type::storeu(c + i * ldc + j2, r3);
+            vec_type::storeu(c + i * ldc + j3, r4);
+        }
+    }
+
+    for (; j + vec_size - 1 < N; j += vec_size) {
+        size_t i = 0;
+
+        for (; i + 1 < M; i += 2) {
+            auto r1 = vec_type::loadu(c + (i + 0) * ldc + j);
+            auto r2 = vec_type::loadu(c + (i + 1) * ldc + j);
+
+            for (size_t k = 0; k < K; ++k) {
+                auto b1 = vec_type::loadu(b + k * N + j);
+
+                r1 = vec_type::fmadd(vec_type::set(a[(i + 0) * lda + k]), b1, r1);
+                r2 = vec_type::fmadd(vec_type::set(a[(i + 1) * lda + k]), b1, r2);
+            }
+
+            vec_type::storeu(c + (i + 0) * ldc + j, r1);
+            vec_type::storeu(c + (i + 1) * ldc + j, r2);
+        }
+
+        if (i < M) {
+            auto r1 = vec_type::loadu(c + i * ldc + j);
+
+            for (size_t k = 0; k < K; ++k) {
+                r1 = vec_type::fmadd(vec_type::set(a[i * lda + k]), vec_type::loadu(b + k * N + j), r1);
+            }
+
+            vec_type::storeu(c + i * ldc + j, r1);
+        }
+    }
+
+    for (; j < N; ++j) {
+        for (size_t i = 0; i < M; ++i) {
+            auto value = c[i * ldc + j];
+
+            for (size_t k = 0; k < K; ++k) {
+                value += a[i * lda + k] * b[k * N + j];
+            }
+
+            c[i * ldc + j] = value;
+        }
+    }
+}
+
 /*!
  * \brief Vectorized implementation of row-major matrix - row-major matrix
  * multiplication and assignment into a row-major matrix.
@@ -353,8 +353,8 @@ void gemv_large_kernel_rr(const T* aa, size_t m, size_t n, const T* bb, T* cc) {
 
         // Remainder inner loop
         for (; remainder && k < n; ++k) {
-            cc[i + 0] += aa[i + 0 * n + k] * bb[k];
-            cc[i + 1] += aa[i + 1 * n + k] * bb[k];
+            cc[i + 0] += aa[(i + 0) * n + k] * bb[k];
+            cc[i + 1] += aa[(i + 1) * n + k] * bb[k];
         }
     }
 
@@ -383,24 +383,30 @@ void gemv_large_kernel_rr(const T* aa, size_t m, size_t n, const T* bb, T* cc) {
 
 /*!
  * \brief Optimized version of small GEMV for column major version
+ *
+ * Only the rows [first, last) of the result are computed.
+ *
  * \param aa The lhs matrix
  * \param bb The rhs vector
  * \param cc The result vector
+ * \param first The first row to compute
+ * \param last The end of the rows to compute
  */
 template <typename V, bool Padded, typename T>
-void gemv_small_kernel_cc(const T* aa, size_t m, size_t n, const T* bb, T* cc) {
+void gemv_small_kernel_cc(const T* aa, size_t m, size_t n, const T* bb, T* cc, size_t first, size_t last) {
     using vec_type = V;
 
     static constexpr size_t vec_size = vec_type::template traits<T>::size;
 
-    static constexpr bool remainder = !advanced_padding || !Padded;
-    const size_t last = remainder ? (m & size_t(-vec_size)) : m;
+    // The padding can only be used by the last rows
+    const bool remainder = !advanced_padding || !Padded || last != m;
+    const size_t vec_last = remainder ? first + ((last - first) & size_t(-vec_size)) : last;
 
-    size_t i = 0;
+    size_t i = first;
 
 #ifdef ETL_GEMV_SMALL_CC_8
     // Vectorized loop, unrolled 8x
-    for (; i + 8 * vec_size - 1 < last; i += 8 * vec_size) {
+    for (; i + 8 * vec_size - 1 < vec_last; i += 8 * vec_size) {
         auto r1 = vec_type::template zero<T>();
         auto r2 = vec_type::template zero<T>();
         auto r3 = vec_type::template zero<T>();
@@ -435,7 +441,7 @@ void gemv_small_kernel_cc(const T* aa, size_t m, size_t n, const T* bb, T* cc) {
 #endif
 
     // Vectorized loop, unrolled 4x
-    for (; i + 4 * vec_size - 1 < last; i += 4 * vec_size) {
+    for (; i + 4 * vec_size - 1 < vec_last; i += 4 * vec_size) {
         auto r1 = vec_type::template zero<T>();
         auto r2 = vec_type::template zero<T>();
         auto r3 = vec_type::template zero<T>();
@@ -457,7 +463,7 @@ void gemv_small_kernel_cc(const T* aa, size_t m, size_t n, const T* bb, T* cc) {
     }
 
     // Vectorized loop, unrolled 2x
-    for (; i + 2 * vec_size - 1 < last; i += 2 * vec_size) {
+    for (; i + 2 * vec_size - 1 < vec_last; i += 2 * vec_size) {
         auto r1 = vec_type::template zero<T>();
         auto r2 = vec_type::template zero<T>();
 
@@ -473,7 +479,7 @@ void gemv_small_kernel_cc(const T* aa, size_t m, size_t n, const T* bb, T* cc) {
     }
 
     // Vectorized loop, not unrolled
-    for (; i + vec_size - 1 < last; i += vec_size) {
+    for (; i + vec_size - 1 < vec_last; i += vec_size) {
         auto r1 = vec_type::template zero<T>();
 
         for (size_t j = 0; j < n; ++j) {
@@ -485,7 +491,7 @@ void gemv_small_kernel_cc(const T* aa, size_t m, size_t n, const T* bb, T* cc) {
     }
 
     // Normal loop
-    for (; remainder && i < m; ++i) {
+    for (; remainder && i < last; ++i) {
         T value(0);
 
         for (size_t j = 0; j < n; ++j) {
@@ -498,12 +504,18 @@ void gemv_small_kernel_cc(const T* aa, size_t m, size_t n, const T* bb, T* cc) {
 
 /*!
  * \brief Optimized version of large GEMV for column major version
+ *
+ * Only the rows [first, last) of the result are computed and they are
+ * accumulated into the result.
+ *
  * \param aa The lhs matrix
  * \param bb The rhs vector
  * \param cc The result vector
+ * \param first The first row to compute
+ * \param last The end of the rows to compute
  */
 template <typename V, bool Padded, typename T>
-void gemv_large_kernel_cc(const T* aa, size_t m, size_t n, const T* bb, T* cc) {
+void gemv_large_kernel_cc(const T* aa, size_t m, size_t n, const T* bb, T* cc, size_t first, size_t last) {
     using vec_type = V;
 
     static constexpr size_t vec_size = vec_type::template traits<T>::size;
@@ -511,9 +523,9 @@ void gemv_large_kernel_cc(const T* aa, size_t m, size_t n, const T* bb, T* cc) {
     const size_t m_block = (32 * 1024) / sizeof(T);
     const size_t n_block = (n < m_block) ? 8 : 4;
 
-    for (size_t block_i = 0U; block_i < m; block_i += m_block) {
+    for (size_t block_i = first; block_i < last; block_i += m_block) {
         for (size_t block_j = 0UL; block_j < n; block_j += n_block) {
-            const size_t m_end = std::min(block_i + m_block, m);
+            const size_t m_end = std::min(block_i + m_block, last);
             const size_t n_end = std::min(block_j + n_block, n);
 
             size_t i = block_i;
@@ -584,6 +596,69 @@ void gemv_large_kernel_cc(const T* aa, size_t m, size_t n, const T* bb, T* cc) {
     }
 }
 
+/*!
+ * \brief Compute the rows of a GEMV in parallel on the thread engine.
+ *
+ * The rows are split in chunks that are multiples of the vector size so
+ * that each thread only writes its own part of the result vector, with
+ * the same alignment as in the serial case.
+ *
+ * \param functor The kernel to call for each [first, last) range of rows
+ * \param m The number of rows of the result
+ * \param n The length of each row (columns of the matrix)
+ */
+template <typename V, typename T, typename Functor>
+void gemv_dispatch(Functor&& functor, size_t m, size_t n) {
+    static constexpr size_t vec_size = V::template traits<T>::size;
+
+    const size_t blocks = (m + vec_size - 1) / vec_size;
+
+    auto batch_fun = [&](const size_t first, const size_t last) {
+        functor(first * vec_size, std::min(last * vec_size, m));
+    };
+
+    engine_dispatch_1d(batch_fun, 0, blocks, engine_select_parallel(m * n, gemv_parallel_threshold) && blocks > 1);
+}
+
+/*!
+ * \brief Compute the row major GEMV c = A * b, with A of dimensions
+ * (m, n) in parallel
+ * \param aa The lhs matrix
+ * \param bb The rhs vector
+ * \param cc The result vector
+ * \param small Indicates if the small kernel must be used
+ */
+template <typename V, bool Padded, typename T>
+void gemv_rr(const T* aa, size_t m, size_t n, const T* bb, T* cc, bool small) {
+    gemv_dispatch<V, T>([&](size_t first, size_t last) {
+        if (small) {
+            gemv_small_kernel_rr<V, Padded>(aa + first * n, last - first, n, bb, cc + first);
+        } else {
+            gemv_large_kernel_rr<V, Padded>(aa + first * n, last - first, n, bb, cc + first);
+        }
+    }, m, n);
+}
+
+/*!
+ * \brief Compute the column major GEMV c = A * b, with A of dimensions
+ * (m, n) in parallel
+ * \param aa The lhs matrix
+ * \param bb The rhs vector
+ * \param cc The result vector
+ * \param small Indicates if the small kernel must be used
+ */
+template <typename V, bool Padded, typename T>
+void gemv_cc(const T* aa, size_t m, size_t n, const T* bb, T* cc, bool small) {
+    gemv_dispatch<V, T>([&](size_t first, size_t last) {
+        if (small) {
+            gemv_small_kernel_cc<V, Padded>(aa, m, n, bb, cc, first, last);
+        } else {
+            std::fill(cc + first, cc + last, T(0));
+            gemv_large_kernel_cc<V, Padded>(aa, m, n, bb, cc, first, last);
+        }
+    }, m, n);
+}
+
 /*!
  * \brief Optimized version of GEMV for row major version
  * \param a The lhs matrix
@@ -600,11 +675,7 @@ void gemv(A&& a, B&& b, C&& c) {
     const auto m = rows(a);
     const auto n = columns(a);
 
-    if (etl::size(a) < gemv_rm_small_threshold) {
-        gemv_small_kernel_rr<default_vec, all_padded<A, B, C>>(a.memory_start(), m, n, b.memory_start(), c.memory_start());
-    } else {
-        gemv_large_kernel_rr<default_vec, all_padded<A, B, C>>(a.memory_start(), m, n, b.memory_start(), c.memory_start());
-    }
+    gemv_rr<default_vec, all_padded<A, B, C>>(a.memory_start(), m, n, b.memory_start(), c.memory_start(), etl::size(a) < gemv_rm_small_threshold);
 
     c.invalidate_gpu();
 }
@@ -625,12 +696,7 @@ void gemv(A&& a, B&& b, C&& c) {
     const auto m = rows(a);
     const auto n = columns(a);
 
-    if (etl::size(a) < gemv_cm_small_threshold) {
-        gemv_small_kernel_cc<default_vec, all_padded<A, B, C>>(a.memory_start(), m, n, b.memory_start(), c.memory_start());
-    } else {
-        c = 0;
-        gemv_large_kernel_cc<default_vec, all_padded<A, B, C>>(a.memory_start(), m, n, b.memory_start(), c.memory_start());
-    }
+    gemv_cc<default_vec, all_padded<A, B, C>>(a.memory_start(), m, n, b.memory_start(), c.memory_start(), etl::size(a) < gemv_cm_small_threshold);
 
     c.invalidate_gpu();
 }
@@ -653,11 +719,7 @@ void gemv_t(A&& a, B&& b, C&& c) {
     const auto m = rows(a);
     const auto n = columns(a);
 
-    if (etl::size(a) < gemv_rm_small_threshold) {
-        gemv_small_kernel_cc<default_vec, all_padded<A, B, C>>(a.memory_start(), n, m, b.memory_start(), c.memory_start());
-    } else {
-        gemv_large_kernel_cc<default_vec, all_padded<A, B, C>>(a.memory_start(), n, m, b.memory_start(), c.memory_start());
-    }
+    gemv_cc<default_vec, all_padded<A, B, C>>(a.memory_start(), n, m, b.memory_start(), c.memory_start(), etl::size(a) < gemv_cm_small_threshold);
 
     c.invalidate_gpu();
 }
@@ -678,12 +740,7 @@ void gemv_t(A&& a, B&& b, C&& c) {
     const auto m = rows(a);
     const auto n = columns(a);
 
-    if (etl::size(a) < gemv_cm_small_threshold) {
-        gemv_small_kernel_rr<default_vec, all_padded<A, B, C>>(a.memory_start(), n, m, b.memory_start(), c.memory_start());
-    } else {
-        c = 0;
-        gemv_large_kernel_rr<default_vec, all_padded<A, B, C>>(a.memory_start(), n, m, b.memory_start(), c.memory_start());
-    }
+    gemv_rr<default_vec, all_padded<A, B, C>>(a.memory_start(), n, m, b.memory_start(), c.memory_start(), etl::size(a) < gemv_rm_small_threshold);
 
     c.invalidate_gpu();
 }
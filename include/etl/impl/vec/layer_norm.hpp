@@ -0,0 +1,284 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Vectorized implementation of the layer normalization and of the
+ * RMS normalization.
+ *
+ * The rows are split between the threads. The statistics of a row are
+ * computed in a first pass and the row is normalized, scaled and shifted
+ * in a second pass, from the cache.
+ */
+
+#pragma once
+
+#include "etl/impl/std/layer_norm.hpp"
+#include "etl/impl/vec/stats.hpp"
+
+namespace etl {
+
+namespace impl {
+
+namespace vec {
+
+/*!
+ * \brief Indicates if the layer normalization of X (with the errors DY)
+ * can be vectorized
+ */
+template <typename X, typename DY>
+constexpr bool layer_norm_possible =
+    vec_enabled && vectorize_impl && all_row_major<X, DY> && all_vectorizable<vector_mode, X, DY> && all_floating<X> && all_homogeneous<X, DY>;
+
+namespace layer_norm_detail {
+
+/*!
+ * \brief Compute the mean and the inverse of the standard deviation (or
+ * of the root mean square if Rms is true) of the row starting at base
+ */
+template <typename V, bool Rms, typename X, typename T>
+void row_moments(const X& x, size_t base, size_t K, T eps, T& mean, T& rstd) {
+    static constexpr size_t vec_size = V::template traits<T>::size;
+
+    if (Rms) {
+        auto r1 = V::template zero<T>();
+        auto r2 = V::template zero<T>();
+
+        size_t k = 0;
+
+        for (; k + 2 * vec_size - 1 < K; k += 2 * vec_size) {
+            auto x1 = x.template loadu<V>(base + k + 0 * vec_size);
+            auto x2 = x.template loadu<V>(base + k + 1 * vec_size);
+
+            r1 = V::fmadd(x1, x1, r1);
+            r2 = V::fmadd(x2, x2, r2);
+        }
+
+        for (; k + vec_size - 1 < K; k += vec_size) {
+            auto x1 = x.template loadu<V>(base + k);
+
+            r1 = V::fmadd(x1, x1, r1);
+        }
+
+        T ss = V::hadd(V::add(r1, r2));
+
+        for (; k < K; ++k) {
+            const T v = x.read_flat(base + k);
+            ss += v * v;
+        }
+
+        mean = T(0);
+        rstd = T(1) / std::sqrt(ss / T(K) + eps);
+    } else {
+        auto local = stats_detail::stats_kernel<V>(x, base, base + K);
+
+        mean = local.mean;
+        rstd = T(1) / std::sqrt(local.variance() + eps);
+    }
+}
+
+/*!
+ * \brief Normalize the rows [first, last) of x into y
+ */
+template <typename V, bool Rms, typename X, typename T>
+void layer_norm_kernel(const X& x, size_t K, const T* gamma, const T* beta, T eps, T* y, size_t first, size_t last) {
+    static constexpr size_t vec_size = V::template traits<T>::size;
+
+    for (size_t i = first; i < last; ++i) {
+        const size_t base = i * K;
+
+        T mean, rstd;
+        row_moments<V, Rms>(x, base, K, eps, mean, rstd);
+
+        auto vm = V::set(mean);
+        auto vr = V::set(rstd);
+
+        size_t k = 0;
+
+        for (; k + vec_size - 1 < K; k += vec_size) {
+            auto r = V::mul(V::sub(x.template loadu<V>(base + k), vm), vr);
+
+            if (Rms) {
+                V::storeu(y + base + k, V::mul(r, V::loadu(gamma + k)));
+            } else {
+                V::storeu(y + base + k, V::fmadd(r, V::loadu(gamma + k), V::loadu(beta + k)));
+            }
+        }
+
+        for (; k < K; ++k) {
+            y[base + k] = (x.read_flat(base + k) - mean) * rstd * gamma[k] + (Rms ? T(0) : beta[k]);
+        }
+    }
+}
+
+/*!
+ * \brief Compute the errors of the rows [first, last) of x into dx and
+ * accumulate the gradients of gamma and beta (not used if Rms is true)
+ * of these rows into dgamma and dbeta
+ */
+template <typename V, bool Rms, typename X, typename DY, typename T>
+void layer_norm_backward_kernel(const X& x, const DY& dy, size_t K, const T* gamma, T eps, T* dx, T* dgamma, T* dbeta, size_t first, size_t last) {
+    static constexpr size_t vec_size = V::template traits<T>::size;
+
+    for (size_t i = first; i < last; ++i) {
+        const size_t base = i * K;
+
+        T mean, rstd;
+        row_moments<V, Rms>(x, base, K, eps, mean, rstd);
+
+        auto vm = V::set(mean);
+
+        // First pass: sum of g = dy * gamma and of g * (x - mean)
+
+        auto s1 = V::template zero<T>();
+        auto d1 = V::template zero<T>();
+
+        size_t k = 0;
+
+        for (; k + vec_size - 1 < K; k += vec_size) {
+            auto g = V::mul(dy.template loadu<V>(base + k), V::loadu(gamma + k));
+
+            s1 = V::add(g, s1);
+            d1 = V::fmadd(g, V::sub(x.template loadu<V>(base + k), vm), d1);
+        }
+
+        T sg  = V::hadd(s1);
+        T sgx = V::hadd(d1);
+
+        for (; k < K; ++k) {
+            const T g = dy.read_flat(base + k) * gamma[k];
+
+            sg += g;
+            sgx += g * (x.read_flat(base + k) - mean);
+        }
+
+        // Second pass: dx = rstd * (g - c0 - x_hat * c1)
+
+        const T c0 = Rms ? T(0) : sg / T(K);
+        const T c1 = sgx * rstd / T(K);
+
+        auto vr  = V::set(rstd);
+        auto vc0 = V::set(-c0);
+        auto vc1 = V::set(c1);
+
+        for (k = 0; k + vec_size - 1 < K; k += vec_size) {
+            auto e     = dy.template loadu<V>(base + k);
+            auto x_hat = V::mul(V::sub(x.template loadu<V>(base + k), vm), vr);
+
+            auto t = V::sub(V::fmadd(e, V::loadu(gamma + k), vc0), V::mul(x_hat, vc1));
+
+            V::storeu(dx + base + k, V::mul(t, vr));
+            V::storeu(dgamma + k, V::fmadd(e, x_hat, V::loadu(dgamma + k)));
+
+            if (!Rms) {
+                V::storeu(dbeta + k, V::add(e, V::loadu(dbeta + k)));
+            }
+        }
+
+        for (; k < K; ++k) {
+            const T e     = dy.read_flat(base + k);
+            const T x_hat = (x.read_flat(base + k) - mean) * rstd;
+
+            dx[base + k] = rstd * (e * gamma[k] - c0 - x_hat * c1);
+
+            dgamma[k] += e * x_hat;
+
+            if (!Rms) {
+                dbeta[k] += e;
+            }
+        }
+    }
+}
+
+} //end of namespace layer_norm_detail
+
+/*!
+ * \copydoc etl::impl::standard::layer_norm
+ */
+template <bool Rms, typename X, typename T, cpp_enable_iff(layer_norm_possible<X, X>)>
+void layer_norm(const X& x, size_t N, size_t K, const T* gamma, const T* beta, T eps, T* y) {
+    auto batch_fun = [&](const size_t first, const size_t last) {
+        layer_norm_detail::layer_norm_kernel<default_vec, Rms>(x, K, gamma, beta, eps, y, first, last);
+    };
+
+    engine_dispatch_1d(batch_fun, 0, N, engine_select_parallel(N * K, parallel_threshold) && is_thread_safe<X>);
+}
+
+/*!
+ * \copydoc etl::impl::standard::layer_norm_backward
+ */
+template <bool Rms, typename X, typename DY, typename T, cpp_enable_iff(layer_norm_possible<X, DY>)>
+void layer_norm_backward(const X& x, const DY& dy, size_t N, size_t K, const T* gamma, T eps, T* dx, T* dgamma, T* dbeta) {
+    // The gradients of gamma and beta of each thread are stored contiguously in one vector
+    const size_t G = Rms ? K : 2 * K;
+
+    std::fill(dgamma, dgamma + K, T(0));
+
+    if (!Rms) {
+        std::fill(dbeta, dbeta + K, T(0));
+    }
+
+    auto acc_functor = [&](const std::vector<T>& local) {
+        for (size_t k = 0; k < K; ++k) {
+            dgamma[k] += local[k];
+        }
+
+        if (!Rms) {
+            for (size_t k = 0; k < K; ++k) {
+                dbeta[k] += local[K + k];
+            }
+        }
+    };
+
+    auto batch_fun = [&](const size_t first, const size_t last) {
+        std::vector<T> local(G);
+
+        layer_norm_detail::layer_norm_backward_kernel<default_vec, Rms>(x, dy, K, gamma, eps, dx, local.data(), local.data() + (Rms ? 0 : K), first, last);
+
+        return local;
+    };
+
+    const size_t threshold = (is_thread_safe<X> && is_thread_safe<DY>) ? std::max(size_t(1), parallel_threshold / K) : std::numeric_limits<size_t>::max();
+
+    engine_dispatch_1d_acc<std::vector<T>>(batch_fun, acc_functor, 0, N, threshold);
+}
+
+/*!
+ * \copydoc etl::impl::standard::layer_norm
+ */
+template <bool Rms, typename X, typename T, cpp_disable_iff(layer_norm_possible<X, X>)>
+void layer_norm(const X& x, size_t N, size_t K, const T* gamma, const T* beta, T eps, T* y) {
+    cpp_unused(x);
+    cpp_unused(N);
+    cpp_unused(K);
+    cpp_unused(gamma);
+    cpp_unused(beta);
+    cpp_unused(eps);
+    cpp_unused(y);
+    cpp_unreachable("vec::layer_norm called with invalid parameters");
+}
+
+/*!
+ * \copydoc etl::impl::standard::layer_norm_backward
+ */
+template <bool Rms, typename X, typename DY, typename T, cpp_disable_iff(layer_norm_possible<X, DY>)>
+void layer_norm_backward(const X& x, const DY& dy, size_t N, size_t K, const T* gamma, T eps, T* dx, T* dgamma, T* dbeta) {
+    cpp_unused(x);
+    cpp_unused(dy);
+    cpp_unused(N);
+    cpp_unused(K);
+    cpp_unused(gamma);
+    cpp_unused(eps);
+    cpp_unused(dx);
+    cpp_unused(dgamma);
+    cpp_unused(dbeta);
+    cpp_unreachable("vec::layer_norm_backward called with invalid parameters");
+}
+
+} //end of namespace vec
+} //end of namespace impl
+} //end of namespace etl
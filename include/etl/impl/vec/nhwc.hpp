@@ -0,0 +1,481 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Vectorized implementations of the channels-last (NHWC) operations
+ *
+ * In NHWC layout, the channels are the innermost dimension. For each output
+ * pixel, the convolution is a dot product over contiguous kernel rows and
+ * the pooling and bias addition are simply vectorized over the channels.
+ */
+
+#pragma once
+
+namespace etl {
+
+namespace impl {
+
+namespace vec {
+
+/*!
+ * \brief Traits indicating if vectorized NHWC operations are possible
+ * for the given configuration.
+ *
+ * \param V The vector mode
+ * \param E The types of the expressions
+ */
+template <vector_mode_t V, typename... E>
+constexpr bool nhwc_possible =
+                vec_enabled
+            &&  vectorize_impl
+            &&  all_homogeneous<E...>
+            &&  all_vectorizable<V, E...>
+            &&  all_row_major<E...>;
+
+/*!
+ * \brief Vectorized implementation of a 4D 'valid' cross-correlation in NHWC layout
+ *
+ * For each output pixel, the valid part of each kernel row is contiguous in
+ * memory, in both the input and the kernel. The dot products are computed
+ * for four kernels at once to reuse the loads of the input.
+ *
+ * \param input The input matrix [N, Hi, Wi, C]
+ * \param kernel The kernel matrix [K, Hk, Wk, C]
+ * \param conv The output matrix [N, Ho, Wo, K]
+ * \param s1 The first dimension stride
+ * \param s2 The second dimension stride
+ * \param p1 The first dimension padding
+ * \param p2 The second dimension padding
+ */
+template <typename V, typename I, typename KK, typename CC>
+void conv4_valid_flipped_nhwc_impl(const I& input, const KK& kernel, CC&& conv, size_t s1, size_t s2, size_t p1, size_t p2) {
+    using vec_type = V;
+    using T        = value_t<I>;
+
+    static constexpr size_t vec_size = vec_type::template traits<T>::size;
+
+    const size_t N  = etl::dim<0>(input);
+    const size_t Hi = etl::dim<1>(input);
+    const size_t Wi = etl::dim<2>(input);
+    const size_t C  = etl::dim<3>(input);
+
+    const size_t K  = etl::dim<0>(kernel);
+    const size_t k1 = etl::dim<1>(kernel);
+    const size_t k2 = etl::dim<2>(kernel);
+
+    const size_t Ho = etl::dim<1>(conv);
+    const size_t Wo = etl::dim<2>(conv);
+
+    input.ensure_cpu_up_to_date();
+    kernel.ensure_cpu_up_to_date();
+
+    const T* in  = input.memory_start();
+    const T* ker = kernel.memory_start();
+    T* out       = conv.memory_start();
+
+    auto batch_fun = [&](const size_t first, const size_t last) {
+        for (size_t nh = first; nh < last; ++nh) {
+            const size_t n  = nh / Ho;
+            const size_t oh = nh % Ho;
+
+            // Range of kernel rows falling inside the input
+            const size_t kh_first = oh * s1 < p1 ? p1 - oh * s1 : 0;
+            const size_t kh_last  = std::min(k1, Hi + p1 - oh * s1);
+
+            for (size_t ow = 0; ow < Wo; ++ow) {
+                // Range of kernel columns falling inside the input
+                const size_t kw_first = ow * s2 < p2 ? p2 - ow * s2 : 0;
+                const size_t kw_last  = std::min(k2, Wi + p2 - ow * s2);
+
+                T* out_p = out + ((n * Ho + oh) * Wo + ow) * K;
+
+                // Length of the contiguous segment of each kernel row
+                const size_t L = kw_last > kw_first ? (kw_last - kw_first) * C : 0;
+
+                size_t k = 0;
+
+                for (; k + 3 < K; k += 4) {
+                    auto r1 = vec_type::template zero<T>();
+                    auto r2 = vec_type::template zero<T>();
+                    auto r3 = vec_type::template zero<T>();
+                    auto r4 = vec_type::template zero<T>();
+
+                    T t1(0);
+                    T t2(0);
+                    T t3(0);
+                    T t4(0);
+
+                    for (size_t kh = kh_first; kh < kh_last; ++kh) {
+                        const T* in_p = in + ((n * Hi + oh * s1 + kh - p1) * Wi + ow * s2 + kw_first - p2) * C;
+
+                        const T* k1_p = ker + (((k + 0) * k1 + kh) * k2 + kw_first) * C;
+                        const T* k2_p = ker + (((k + 1) * k1 + kh) * k2 + kw_first) * C;
+                        const T* k3_p = ker + (((k + 2) * k1 + kh) * k2 + kw_first) * C;
+                        const T* k4_p = ker + (((k + 3) * k1 + kh) * k2 + kw_first) * C;
+
+                        size_t l = 0;
+
+                        for (; l + vec_size - 1 < L; l += vec_size) {
+                            auto x1 = vec_type::loadu(in_p + l);
+
+                            r1 = vec_type::fmadd(x1, vec_type::loadu(k1_p + l), r1);
+                            r2 = vec_type::fmadd(x1, vec_type::loadu(k2_p + l), r2);
+                            r3 = vec_type::fmadd(x1, vec_type::loadu(k3_p + l), r3);
+                            r4 = vec_type::fmadd(x1, vec_type::loadu(k4_p + l), r4);
+                        }
+
+                        for (; l < L; ++l) {
+                            t1 += in_p[l] * k1_p[l];
+                            t2 += in_p[l] * k2_p[l];
+                            t3 += in_p[l] * k3_p[l];
+                            t4 += in_p[l] * k4_p[l];
+                        }
+                    }
+
+                    out_p[k + 0] = t1 + vec_type::hadd(r1);
+                    out_p[k + 1] = t2 + vec_type::hadd(r2);
+                    out_p[k + 2] = t3 + vec_type::hadd(r3);
+                    out_p[k + 3] = t4 + vec_type::hadd(r4);
+                }
+
+                for (; k < K; ++k) {
+                    auto r1 = vec_type::template zero<T>();
+
+                    T t1(0);
+
+                    for (size_t kh = kh_first; kh < kh_last; ++kh) {
+                        const T* in_p = in + ((n * Hi + oh * s1 + kh - p1) * Wi + ow * s2 + kw_first - p2) * C;
+                        const T* k1_p = ker + ((k * k1 + kh) * k2 + kw_first) * C;
+
+                        size_t l = 0;
+
+                        for (; l + vec_size - 1 < L; l += vec_size) {
+                            r1 = vec_type::fmadd(vec_type::loadu(in_p + l), vec_type::loadu(k1_p + l), r1);
+                        }
+
+                        for (; l < L; ++l) {
+                            t1 += in_p[l] * k1_p[l];
+                        }
+                    }
+
+                    out_p[k] = t1 + vec_type::hadd(r1);
+                }
+            }
+        }
+    };
+
+    engine_dispatch_1d_serial(batch_fun, 0, N * Ho, 2UL);
+
+    conv.invalidate_gpu();
+}
+
+/*!
+ * \brief Vectorized implementation of a 4D 'valid' cross-correlation in NHWC layout
+ * \param input The input matrix [N, Hi, Wi, C]
+ * \param kernel The kernel matrix [K, Hk, Wk, C]
+ * \param conv The output matrix [N, Ho, Wo, K]
+ * \param s1 The first dimension stride
+ * \param s2 The second dimension stride
+ * \param p1 The first dimension padding
+ * \param p2 The second dimension padding
+ */
+template <typename I, typename KK, typename CC, cpp_enable_iff(nhwc_possible<vector_mode, I, KK, CC>)>
+void conv4_valid_flipped_nhwc(const I& input, const KK& kernel, CC&& conv, size_t s1, size_t s2, size_t p1, size_t p2) {
+    conv4_valid_flipped_nhwc_impl<default_vec>(input, kernel, conv, s1, s2, p1, p2);
+}
+
+/*!
+ * \brief Vectorized implementation of a 4D 'valid' cross-correlation in NHWC layout
+ * \param input The input matrix [N, Hi, Wi, C]
+ * \param kernel The kernel matrix [K, Hk, Wk, C]
+ * \param conv The output matrix [N, Ho, Wo, K]
+ * \param s1 The first dimension stride
+ * \param s2 The second dimension stride
+ * \param p1 The first dimension padding
+ * \param p2 The second dimension padding
+ */
+template <typename I, typename KK, typename CC, cpp_disable_iff(nhwc_possible<vector_mode, I, KK, CC>)>
+void conv4_valid_flipped_nhwc(const I& input, const KK& kernel, CC&& conv, size_t s1, size_t s2, size_t p1, size_t p2) {
+    cpp_unused(input);
+    cpp_unused(kernel);
+    cpp_unused(conv);
+    cpp_unused(s1);
+    cpp_unused(s2);
+    cpp_unused(p1);
+    cpp_unused(p2);
+    cpp_unreachable("Invalid call to vec::conv4_valid_flipped_nhwc");
+}
+
+/*!
+ * \brief Vectorized implementation of 2D pooling in NHWC layout
+ *
+ * Padded cells are considered to be zero, as in the NCHW pooling.
+ *
+ * \param x The input matrix [N, H, W, C]
+ * \param y The output matrix [N, Ho, Wo, C]
+ * \param c1 The first dimension pooling ratio
+ * \param c2 The second dimension pooling ratio
+ * \param s1 The first dimension stride
+ * \param s2 The second dimension stride
+ * \param p1 The first dimension padding
+ * \param p2 The second dimension padding
+ * \tparam Max true for max pooling, false for average pooling
+ */
+template <typename V, bool Max, typename X, typename Y>
+void pool_2d_nhwc_impl(const X& x, Y&& y, size_t c1, size_t c2, size_t s1, size_t s2, size_t p1, size_t p2) {
+    using vec_type = V;
+    using T        = value_t<X>;
+
+    static constexpr size_t vec_size = vec_type::template traits<T>::size;
+
+    const size_t N  = etl::dim<0>(x);
+    const size_t H  = etl::dim<1>(x);
+    const size_t W  = etl::dim<2>(x);
+    const size_t C  = etl::dim<3>(x);
+    const size_t Ho = etl::dim<1>(y);
+    const size_t Wo = etl::dim<2>(y);
+
+    x.ensure_cpu_up_to_date();
+
+    const T* in = x.memory_start();
+    T* out      = y.memory_start();
+
+    const T init  = Max ? std::numeric_limits<T>::lowest() : T(0);
+    const T scale = T(1) / T(c1 * c2);
+
+    auto batch_fun = [&](const size_t first, const size_t last) {
+        for (size_t nh = first; nh < last; ++nh) {
+            const size_t n  = nh / Ho;
+            const size_t oh = nh % Ho;
+
+            for (size_t ow = 0; ow < Wo; ++ow) {
+                T* out_p = out + ((n * Ho + oh) * Wo + ow) * C;
+
+                // Padded cells only matter for max pooling (zero)
+                bool padded = false;
+
+                size_t c = 0;
+
+                for (; c + vec_size - 1 < C; c += vec_size) {
+                    auto r1 = vec_type::set(init);
+
+                    for (size_t jj = 0; jj < c1; ++jj) {
+                        for (size_t kk = 0; kk < c2; ++kk) {
+                            if (oh * s1 + jj >= p1 && oh * s1 + jj - p1 < H && ow * s2 + kk >= p2 && ow * s2 + kk - p2 < W) {
+                                auto x1 = vec_type::loadu(in + ((n * H + oh * s1 + jj - p1) * W + ow * s2 + kk - p2) * C + c);
+
+                                r1 = Max ? vec_type::max(r1, x1) : vec_type::add(r1, x1);
+                            } else {
+                                padded = true;
+                            }
+                        }
+                    }
+
+                    if (Max) {
+                        if (padded) {
+                            r1 = vec_type::max(r1, vec_type::template zero<T>());
+                        }
+                    } else {
+                        r1 = vec_type::mul(r1, vec_type::set(scale));
+                    }
+
+                    vec_type::storeu(out_p + c, r1);
+                }
+
+                for (; c < C; ++c) {
+                    T r1 = init;
+
+                    for (size_t jj = 0; jj < c1; ++jj) {
+                        for (size_t kk = 0; kk < c2; ++kk) {
+                            if (oh * s1 + jj >= p1 && oh * s1 + jj - p1 < H && ow * s2 + kk >= p2 && ow * s2 + kk - p2 < W) {
+                                auto x1 = in[((n * H + oh * s1 + jj - p1) * W + ow * s2 + kk - p2) * C + c];
+
+                                r1 = Max ? std::max(r1, x1) : r1 + x1;
+                            } else {
+                                padded = true;
+                            }
+                        }
+                    }
+
+                    if (Max) {
+                        out_p[c] = padded ? std::max(r1, T(0)) : r1;
+                    } else {
+                        out_p[c] = r1 * scale;
+                    }
+                }
+            }
+        }
+    };
+
+    engine_dispatch_1d_serial(batch_fun, 0, N * Ho, 2UL);
+
+    y.invalidate_gpu();
+}
+
+/*!
+ * \brief Vectorized implementation of 2D max pooling in NHWC layout
+ * \param x The input matrix [N, H, W, C]
+ * \param y The output matrix [N, Ho, Wo, C]
+ * \param c1 The first dimension pooling ratio
+ * \param c2 The second dimension pooling ratio
+ * \param s1 The first dimension stride
+ * \param s2 The second dimension stride
+ * \param p1 The first dimension padding
+ * \param p2 The second dimension padding
+ */
+template <typename X, typename Y, cpp_enable_iff(nhwc_possible<vector_mode, X, Y>)>
+void max_pool_2d_nhwc(const X& x, Y&& y, size_t c1, size_t c2, size_t s1, size_t s2, size_t p1, size_t p2) {
+    pool_2d_nhwc_impl<default_vec, true>(x, y, c1, c2, s1, s2, p1, p2);
+}
+
+/*!
+ * \brief Vectorized implementation of 2D average pooling in NHWC layout
+ * \param x The input matrix [N, H, W, C]
+ * \param y The output matrix [N, Ho, Wo, C]
+ * \param c1 The first dimension pooling ratio
+ * \param c2 The second dimension pooling ratio
+ * \param s1 The first dimension stride
+ * \param s2 The second dimension stride
+ * \param p1 The first dimension padding
+ * \param p2 The second dimension padding
+ */
+template <typename X, typename Y, cpp_enable_iff(nhwc_possible<vector_mode, X, Y>)>
+void avg_pool_2d_nhwc(const X& x, Y&& y, size_t c1, size_t c2, size_t s1, size_t s2, size_t p1, size_t p2) {
+    pool_2d_nhwc_impl<default_vec, false>(x, y, c1, c2, s1, s2, p1, p2);
+}
+
+/*!
+ * \brief Vectorized implementation of 2D max pooling in NHWC layout
+ * \param x The input matrix [N, H, W, C]
+ * \param y The output matrix [N, Ho, Wo, C]
+ * \param c1 The first dimension pooling ratio
+ * \param c2 The second dimension pooling ratio
+ * \param s1 The first dimension stride
+ * \param s2 The second dimension stride
+ * \param p1 The first dimension padding
+ * \param p2 The second dimension padding
+ */
+template <typename X, typename Y, cpp_disable_iff(nhwc_possible<vector_mode, X, Y>)>
+void max_pool_2d_nhwc(const X& x, Y&& y, size_t c1, size_t c2, size_t s1, size_t s2, size_t p1, size_t p2) {
+    cpp_unused(x);
+    cpp_unused(y);
+    cpp_unused(c1);
+    cpp_unused(c2);
+    cpp_unused(s1);
+    cpp_unused(s2);
+    cpp_unused(p1);
+    cpp_unused(p2);
+    cpp_unreachable("Invalid call to vec::max_pool_2d_nhwc");
+}
+
+/*!
+ * \brief Vectorized implementation of 2D average pooling in NHWC layout
+ * \param x The input matrix [N, H, W, C]
+ * \param y The output matrix [N, Ho, Wo, C]
+ * \param c1 The first dimension pooling ratio
+ * \param c2 The second dimension pooling ratio
+ * \param s1 The first dimension stride
+ * \param s2 The second dimension stride
+ * \param p1 The first dimension padding
+ * \param p2 The second dimension padding
+ */
+template <typename X, typename Y, cpp_disable_iff(nhwc_possible<vector_mode, X, Y>)>
+void avg_pool_2d_nhwc(const X& x, Y&& y, size_t c1, size_t c2, size_t s1, size_t s2, size_t p1, size_t p2) {
+    cpp_unused(x);
+    cpp_unused(y);
+    cpp_unused(c1);
+    cpp_unused(c2);
+    cpp_unused(s1);
+    cpp_unused(s2);
+    cpp_unused(p1);
+    cpp_unused(p2);
+    cpp_unreachable("Invalid call to vec::avg_pool_2d_nhwc");
+}
+
+/*!
+ * \brief Compute the bias addition of b into the NHWC matrix x and store the result in y
+ * \param x The input matrix [N, H, W, C]
+ * \param b The biases [C]
+ * \param y The output matrix [N, H, W, C]
+ */
+template <typename V, typename L, typename R, typename C>
+void bias_add_4d_nhwc_impl(const L& x, const R& b, C&& y) {
+    using vec_type = V;
+    using T        = value_t<L>;
+
+    static constexpr size_t vec_size = vec_type::template traits<T>::size;
+
+    const size_t N   = etl::dim<0>(x);
+    const size_t HW  = etl::dim<1>(x) * etl::dim<2>(x);
+    const size_t CC  = etl::dim<3>(x);
+
+    x.ensure_cpu_up_to_date();
+    b.ensure_cpu_up_to_date();
+
+    const T* x_m = x.memory_start();
+    const T* b_m = b.memory_start();
+    T* y_m       = y.memory_start();
+
+    auto batch_fun = [&](const size_t first, const size_t last) {
+        for (size_t p = first * HW; p < last * HW; ++p) {
+            const T* x_s = x_m + p * CC;
+            T* y_s       = y_m + p * CC;
+
+            size_t c = 0;
+
+            for (; c + vec_size * 2 - 1 < CC; c += vec_size * 2) {
+                auto r1 = vec_type::add(vec_type::loadu(x_s + c + 0 * vec_size), vec_type::loadu(b_m + c + 0 * vec_size));
+                auto r2 = vec_type::add(vec_type::loadu(x_s + c + 1 * vec_size), vec_type::loadu(b_m + c + 1 * vec_size));
+
+                vec_type::storeu(y_s + c + 0 * vec_size, r1);
+                vec_type::storeu(y_s + c + 1 * vec_size, r2);
+            }
+
+            for (; c + vec_size - 1 < CC; c += vec_size) {
+                vec_type::storeu(y_s + c, vec_type::add(vec_type::loadu(x_s + c), vec_type::loadu(b_m + c)));
+            }
+
+            for (; c < CC; ++c) {
+                y_s[c] = x_s[c] + b_m[c];
+            }
+        }
+    };
+
+    engine_dispatch_1d_serial(batch_fun, 0, N, 2UL);
+
+    y.invalidate_gpu();
+}
+
+/*!
+ * \brief Compute the bias addition of b into the NHWC matrix x and store the result in y
+ * \param x The input matrix [N, H, W, C]
+ * \param b The biases [C]
+ * \param y The output matrix [N, H, W, C]
+ */
+template <typename A, typename B, typename C, cpp_enable_iff(nhwc_possible<vector_mode, A, B, C>)>
+void bias_add_4d_nhwc(const A& x, const B& b, C&& y) {
+    bias_add_4d_nhwc_impl<default_vec>(x, b, y);
+}
+
+/*!
+ * \brief Compute the bias addition of b into the NHWC matrix x and store the result in y
+ * \param x The input matrix [N, H, W, C]
+ * \param b The biases [C]
+ * \param y The output matrix [N, H, W, C]
+ */
+template <typename A, typename B, typename C, cpp_disable_iff(nhwc_possible<vector_mode, A, B, C>)>
+void bias_add_4d_nhwc(const A& x, const B& b, C&& y) {
+    cpp_unused(x);
+    cpp_unused(b);
+    cpp_unused(y);
+    cpp_unreachable("Invalid call to vec::bias_add_4d_nhwc");
+}
+
+} //end of namespace vec
+} //end of namespace impl
+} //end of namespace etl
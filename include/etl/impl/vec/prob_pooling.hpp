@@ -0,0 +1,238 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Vectorized implementation of the probabilistic max pooling.
+ *
+ * The images are processed one row of blocks at a time: the exponentials
+ * of the C1 rows are computed once, with SIMD, then summed once per block
+ * and finally normalized in place.
+ */
+
+#pragma once
+
+namespace etl {
+
+namespace impl {
+
+namespace vec {
+
+/*!
+ * \brief Indicates if the probabilistic max pooling of A into C can be
+ * vectorized
+ */
+template <typename A, typename C>
+constexpr bool pmp_possible =
+    vec_enabled && vectorize_impl && all_dma<A, C> && all_row_major<A, C> && all_vectorizable<vector_mode, A, C> && all_floating<A, C> && all_homogeneous<A, C>;
+
+namespace pmp_detail {
+
+/*!
+ * \brief Compute the exponentials of the n elements of x into e
+ */
+template <typename V, typename T>
+void exp_row(const T* x, T* e, size_t n) {
+    static constexpr size_t vec_size = V::template traits<T>::size;
+
+    size_t i = 0;
+
+    for (; i + 2 * vec_size - 1 < n; i += 2 * vec_size) {
+        V::storeu(e + i + 0 * vec_size, V::exp(V::loadu(x + i + 0 * vec_size)));
+        V::storeu(e + i + 1 * vec_size, V::exp(V::loadu(x + i + 1 * vec_size)));
+    }
+
+    for (; i + vec_size - 1 < n; i += vec_size) {
+        V::storeu(e + i, V::exp(V::loadu(x + i)));
+    }
+
+    for (; i < n; ++i) {
+        e[i] = std::exp(x[i]);
+    }
+}
+
+/*!
+ * \brief Compute the sums of the exponentials of the c1 x c2 blocks of a
+ * row of blocks
+ * \param e The exponentials of the c1 rows of the blocks
+ * \param sums The output sums, N / c2 elements
+ * \param N The length of the rows
+ */
+template <typename T>
+void block_sums(const T* e, T* sums, size_t N, size_t c1, size_t c2) {
+    const size_t NB = N / c2;
+
+    for (size_t nb = 0; nb < NB; ++nb) {
+        T s = 0;
+
+        for (size_t r = 0; r < c1; ++r) {
+            for (size_t j = 0; j < c2; ++j) {
+                s += e[r * N + nb * c2 + j];
+            }
+        }
+
+        sums[nb] = s;
+    }
+}
+
+/*!
+ * \brief Probabilistic max pooling (for hidden units) of the images
+ * [first, last) of a into c
+ */
+template <typename V, typename T>
+void pmp_h_kernel(const T* a, T* c, size_t M, size_t N, size_t c1, size_t c2, size_t first, size_t last) {
+    const size_t NB = N / c2;
+
+    std::vector<T> sums(NB);
+
+    for (size_t b = first; b < last; ++b) {
+        const T* x = a + b * M * N;
+        T* y       = c + b * M * N;
+
+        for (size_t mb = 0; mb < M / c1; ++mb) {
+            T* e = y + mb * c1 * N;
+
+            exp_row<V>(x + mb * c1 * N, e, c1 * N);
+
+            block_sums(e, sums.data(), N, c1, c2);
+
+            for (size_t nb = 0; nb < NB; ++nb) {
+                sums[nb] = T(1) / (T(1) + sums[nb]);
+            }
+
+            for (size_t r = 0; r < c1; ++r) {
+                for (size_t nb = 0; nb < NB; ++nb) {
+                    for (size_t j = 0; j < c2; ++j) {
+                        e[r * N + nb * c2 + j] *= sums[nb];
+                    }
+                }
+            }
+        }
+    }
+}
+
+/*!
+ * \brief Probabilistic max pooling (for pooling units) of the images
+ * [first, last) of a into c
+ */
+template <typename V, typename T>
+void pmp_p_kernel(const T* a, T* c, size_t M, size_t N, size_t c1, size_t c2, size_t first, size_t last) {
+    const size_t MB = M / c1;
+    const size_t NB = N / c2;
+
+    std::vector<T> e(c1 * N);
+    std::vector<T> sums(NB);
+
+    for (size_t b = first; b < last; ++b) {
+        const T* x = a + b * M * N;
+        T* y       = c + b * MB * NB;
+
+        for (size_t mb = 0; mb < MB; ++mb) {
+            exp_row<V>(x + mb * c1 * N, e.data(), c1 * N);
+
+            block_sums(e.data(), sums.data(), N, c1, c2);
+
+            for (size_t nb = 0; nb < NB; ++nb) {
+                y[mb * NB + nb] = T(1) / (T(1) + sums[nb]);
+            }
+        }
+    }
+}
+
+} //end of namespace pmp_detail
+
+/*!
+ * \brief Probabilistic max pooling (for hidden units) of each image of a
+ * (the last two dimensions) into c, in parallel over the images
+ * \param a The input
+ * \param c The output, of the same dimensions as a
+ * \param c1 The first dimension pooling ratio
+ * \param c2 The second dimension pooling ratio
+ */
+template <typename A, typename C, cpp_enable_iff(pmp_possible<A, C>)>
+void pmp_h(const A& a, C&& c, size_t c1, size_t c2) {
+    constexpr size_t D = decay_traits<A>::dimensions();
+
+    const size_t M = etl::dim(a, D - 2);
+    const size_t N = etl::dim(a, D - 1);
+    const size_t B = etl::size(a) / (M * N);
+
+    cpp_assert(M % c1 == 0 && N % c2 == 0, "pmp_h needs dimensions multiple of the pooling ratios");
+
+    a.ensure_cpu_up_to_date();
+
+    const auto* am = a.memory_start();
+    auto* cm       = c.memory_start();
+
+    auto batch_fun = [&](const size_t first, const size_t last) {
+        pmp_detail::pmp_h_kernel<default_vec>(am, cm, M, N, c1, c2, first, last);
+    };
+
+    engine_dispatch_1d(batch_fun, 0, B, engine_select_parallel(etl::size(a), parallel_threshold));
+
+    c.validate_cpu();
+    c.invalidate_gpu();
+}
+
+/*!
+ * \copydoc pmp_h
+ */
+template <typename A, typename C, cpp_disable_iff(pmp_possible<A, C>)>
+void pmp_h(const A& a, C&& c, size_t c1, size_t c2) {
+    cpp_unused(a);
+    cpp_unused(c);
+    cpp_unused(c1);
+    cpp_unused(c2);
+    cpp_unreachable("vec::pmp_h called with invalid parameters");
+}
+
+/*!
+ * \brief Probabilistic max pooling (for pooling units) of each image of a
+ * (the last two dimensions) into c, in parallel over the images
+ * \param a The input
+ * \param c The output, with the last two dimensions divided by the ratios
+ * \param c1 The first dimension pooling ratio
+ * \param c2 The second dimension pooling ratio
+ */
+template <typename A, typename C, cpp_enable_iff(pmp_possible<A, C>)>
+void pmp_p(const A& a, C&& c, size_t c1, size_t c2) {
+    constexpr size_t D = decay_traits<A>::dimensions();
+
+    const size_t M = etl::dim(a, D - 2);
+    const size_t N = etl::dim(a, D - 1);
+    const size_t B = etl::size(a) / (M * N);
+
+    a.ensure_cpu_up_to_date();
+
+    const auto* am = a.memory_start();
+    auto* cm       = c.memory_start();
+
+    auto batch_fun = [&](const size_t first, const size_t last) {
+        pmp_detail::pmp_p_kernel<default_vec>(am, cm, M, N, c1, c2, first, last);
+    };
+
+    engine_dispatch_1d(batch_fun, 0, B, engine_select_parallel(etl::size(a), parallel_threshold));
+
+    c.validate_cpu();
+    c.invalidate_gpu();
+}
+
+/*!
+ * \copydoc pmp_p
+ */
+template <typename A, typename C, cpp_disable_iff(pmp_possible<A, C>)>
+void pmp_p(const A& a, C&& c, size_t c1, size_t c2) {
+    cpp_unused(a);
+    cpp_unused(c);
+    cpp_unused(c1);
+    cpp_unused(c2);
+    cpp_unreachable("vec::pmp_p called with invalid parameters");
+}
+
+} //end of namespace vec
+} //end of namespace impl
+} //end of namespace etl
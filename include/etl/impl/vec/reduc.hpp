@@ -0,0 +1,389 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Vectorized implementation of the partial reductions (sum_r,
+ * mean_r, sum_l, mean_l, argmax and argmin)
+ *
+ * The input expression is seen as a row-major (M, K) matrix, where M is
+ * its first dimension. The input does not need direct memory access,
+ * it is only read through its vectorized interface.
+ */
+
+#pragma once
+
+namespace etl {
+
+namespace impl {
+
+namespace vec {
+
+/*!
+ * \brief Indicates if the partial reductions can be vectorized for
+ * the given input and output types
+ */
+template <typename A, typename C>
+constexpr bool reduc_possible =
+        vec_enabled
+    && all_vectorizable<vector_mode, A>
+    && all_floating<A, C>
+    && all_homogeneous<A, C>
+    && all_row_major<A>
+    && all_dma<C>;
+
+namespace reduc_detail {
+
+/*!
+ * \brief Dispatch the [first, last) ranges of [0, n) to the given
+ * functor, in parallel if the input is large enough.
+ *
+ * The ranges are multiples of the vector size.
+ *
+ * \param functor The functor to call for each range
+ * \param n The number of outputs
+ * \param parallel Indicates if the computation can be parallelized
+ */
+template <typename V, typename T, typename Functor>
+void dispatch(Functor&& functor, size_t n, bool parallel) {
+    static constexpr size_t vec_size = V::template traits<T>::size;
+
+    const size_t blocks = (n + vec_size - 1) / vec_size;
+
+    auto batch_fun = [&](const size_t first, const size_t last) {
+        functor(first * vec_size, std::min(last * vec_size, n));
+    };
+
+    engine_dispatch_1d(batch_fun, 0, blocks, parallel && blocks > 1);
+}
+
+/*!
+ * \brief Sum the rows [first, last) of the (M, K) input a
+ * \param a The input expression
+ * \param c The output memory
+ * \param K The length of each row
+ * \param first The first row to sum
+ * \param last The last row to sum (exclusive)
+ */
+template <typename V, bool Mean, typename A, typename T>
+void sum_r_kernel(const A& a, T* c, size_t K, size_t first, size_t last) {
+    static constexpr size_t vec_size = V::template traits<T>::size;
+
+    for (size_t i = first; i < last; ++i) {
+        const size_t base = i * K;
+
+        auto r1 = V::template zero<T>();
+        auto r2 = V::template zero<T>();
+        auto r3 = V::template zero<T>();
+        auto r4 = V::template zero<T>();
+
+        size_t k = 0;
+
+        for (; k + 4 * vec_size - 1 < K; k += 4 * vec_size) {
+            r1 = V::add(a.template loadu<V>(base + k + 0 * vec_size), r1);
+            r2 = V::add(a.template loadu<V>(base + k + 1 * vec_size), r2);
+            r3 = V::add(a.template loadu<V>(base + k + 2 * vec_size), r3);
+            r4 = V::add(a.template loadu<V>(base + k + 3 * vec_size), r4);
+        }
+
+        for (; k + vec_size - 1 < K; k += vec_size) {
+            r1 = V::add(a.template loadu<V>(base + k), r1);
+        }
+
+        T value = V::hadd(V::add(V::add(r1, r2), V::add(r3, r4)));
+
+        for (; k < K; ++k) {
+            value += a.read_flat(base + k);
+        }
+
+        if /*constexpr*/ (Mean) {
+            c[i] = value / T(K);
+        } else {
+            c[i] = value;
+        }
+    }
+}
+
+/*!
+ * \brief Sum the columns [first, last) of the (M, K) input a.
+ *
+ * The rows are accumulated four at a time into the output, which stays
+ * in cache while the input is streamed once, in memory order.
+ *
+ * \param a The input expression
+ * \param c The output memory
+ * \param M The number of rows
+ * \param K The length of each row
+ * \param first The first column to sum
+ * \param last The last column to sum (exclusive)
+ */
+template <typename V, bool Mean, typename A, typename T>
+void sum_l_kernel(const A& a, T* c, size_t M, size_t K, size_t first, size_t last) {
+    static constexpr size_t vec_size = V::template traits<T>::size;
+
+    std::fill(c + first, c + last, T(0));
+
+    size_t i = 0;
+
+    for (; i + 3 < M; i += 4) {
+        const size_t b1 = (i + 0) * K;
+        const size_t b2 = (i + 1) * K;
+        const size_t b3 = (i + 2) * K;
+        const size_t b4 = (i + 3) * K;
+
+        size_t j = first;
+
+        for (; j + vec_size - 1 < last; j += vec_size) {
+            auto r1 = V::add(a.template loadu<V>(b1 + j), a.template loadu<V>(b2 + j));
+            auto r2 = V::add(a.template loadu<V>(b3 + j), a.template loadu<V>(b4 + j));
+
+            V::storeu(c + j, V::add(V::loadu(c + j), V::add(r1, r2)));
+        }
+
+        for (; j < last; ++j) {
+            c[j] += (a.read_flat(b1 + j) + a.read_flat(b2 + j)) + (a.read_flat(b3 + j) + a.read_flat(b4 + j));
+        }
+    }
+
+    for (; i < M; ++i) {
+        const size_t b1 = i * K;
+
+        size_t j = first;
+
+        for (; j + vec_size - 1 < last; j += vec_size) {
+            V::storeu(c + j, V::add(V::loadu(c + j), a.template loadu<V>(b1 + j)));
+        }
+
+        for (; j < last; ++j) {
+            c[j] += a.read_flat(b1 + j);
+        }
+    }
+
+    if /*constexpr*/ (Mean) {
+        for (size_t j = first; j < last; ++j) {
+            c[j] /= T(M);
+        }
+    }
+}
+
+/*!
+ * \brief Compute the index of the maximum (or minimum) of the rows
+ * [first, last) of the (M, K) input a.
+ *
+ * Each lane keeps its best value and its index with a compare and a
+ * blend, on two independent chains. The lanes are then merged, the
+ * smallest index winning in case of ties, so that the first occurrence
+ * is always returned.
+ *
+ * The lane indices are only exact up to 2^digits in T, so the rows are
+ * processed in chunks of at most that many elements, with the indices
+ * relative to the chunk.
+ *
+ * \param a The input expression
+ * \param c The output memory
+ * \param K The length of each row
+ * \param first The first row to reduce
+ * \param last The last row to reduce (exclusive)
+ */
+template <typename V, bool Max, typename A, typename T>
+void argmax_kernel(const A& a, T* c, size_t K, size_t first, size_t last) {
+    static constexpr size_t vec_size = V::template traits<T>::size;
+    static constexpr size_t chunk    = (size_t(1) << std::min(std::numeric_limits<T>::digits, 62)) / (2 * vec_size) * (2 * vec_size);
+
+    auto better = [](T lhs, T rhs) {
+        return Max ? lhs > rhs : lhs < rhs;
+    };
+
+    T lanes[vec_size];
+    T values[2 * vec_size];
+    T indices[2 * vec_size];
+
+    for (size_t l = 0; l < vec_size; ++l) {
+        lanes[l] = T(l);
+    }
+
+    const auto iota = V::loadu(lanes);
+    const auto step = V::set(T(2 * vec_size));
+
+    for (size_t i = first; i < last; ++i) {
+        const size_t base = i * K;
+
+        T best_value      = a.read_flat(base);
+        size_t best_index = 0;
+
+        size_t k = 0;
+
+        while (K - k >= 2 * vec_size) {
+            const size_t chunk_last = k + std::min(chunk, (K - k) / (2 * vec_size) * (2 * vec_size));
+
+            auto vbest1 = a.template loadu<V>(base + k);
+            auto vbest2 = a.template loadu<V>(base + k + vec_size);
+
+            auto vcur1 = iota;
+            auto vcur2 = V::add(iota, V::set(T(vec_size)));
+
+            auto vindex1 = vcur1;
+            auto vindex2 = vcur2;
+
+            for (size_t j = k + 2 * vec_size; j < chunk_last; j += 2 * vec_size) {
+                vcur1 = V::add(vcur1, step);
+                vcur2 = V::add(vcur2, step);
+
+                auto x1 = a.template loadu<V>(base + j);
+                auto x2 = a.template loadu<V>(base + j + vec_size);
+
+                auto mask1 = Max ? V::greater(x1, vbest1) : V::less(x1, vbest1);
+                auto mask2 = Max ? V::greater(x2, vbest2) : V::less(x2, vbest2);
+
+                vbest1 = V::select(mask1, x1, vbest1);
+                vbest2 = V::select(mask2, x2, vbest2);
+
+                vindex1 = V::select(mask1, vcur1, vindex1);
+                vindex2 = V::select(mask2, vcur2, vindex2);
+            }
+
+            V::storeu(values, vbest1);
+            V::storeu(values + vec_size, vbest2);
+            V::storeu(indices, vindex1);
+            V::storeu(indices + vec_size, vindex2);
+
+            for (size_t l = 0; l < 2 * vec_size; ++l) {
+                const size_t index = k + size_t(indices[l]);
+
+                if (better(values[l], best_value) || (values[l] == best_value && index < best_index)) {
+                    best_value = values[l];
+                    best_index = index;
+                }
+            }
+
+            k = chunk_last;
+        }
+
+        for (; k < K; ++k) {
+            const T x = a.read_flat(base + k);
+
+            if (better(x, best_value)) {
+                best_value = x;
+                best_index = k;
+            }
+        }
+
+        c[i] = T(best_index);
+    }
+}
+
+} // end of namespace reduc_detail
+
+/*!
+ * \brief Compute the sum (or the mean) of each row of a into c
+ * \param a The input expression
+ * \param c The output expression
+ */
+template <bool Mean, typename A, typename C, cpp_enable_iff(reduc_possible<A, C>)>
+void sum_r(const A& a, C&& c) {
+    const size_t M = etl::dim<0>(a);
+
+    if (!M) {
+        return;
+    }
+
+    const size_t K = etl::size(a) / M;
+
+    auto* cc = c.memory_start();
+
+    auto batch_fun = [&](size_t first, size_t last) {
+        reduc_detail::sum_r_kernel<default_vec, Mean>(a, cc, K, first, last);
+    };
+
+    engine_dispatch_1d(batch_fun, 0, M, engine_select_parallel(etl::size(a), parallel_threshold) && is_thread_safe<A>);
+
+    c.invalidate_gpu();
+}
+
+/*!
+ * \brief Compute the sum (or the mean) of each column of a into c
+ * \param a The input expression
+ * \param c The output expression
+ */
+template <bool Mean, typename A, typename C, cpp_enable_iff(reduc_possible<A, C>)>
+void sum_l(const A& a, C&& c) {
+    using T = value_t<A>;
+
+    const size_t M = etl::dim<0>(a);
+    const size_t K = etl::size(a) / M;
+
+    auto* cc = c.memory_start();
+
+    auto batch_fun = [&](size_t first, size_t last) {
+        reduc_detail::sum_l_kernel<default_vec, Mean>(a, cc, M, K, first, last);
+    };
+
+    reduc_detail::dispatch<default_vec, T>(batch_fun, K, engine_select_parallel(etl::size(a), parallel_threshold) && is_thread_safe<A>);
+
+    c.invalidate_gpu();
+}
+
+/*!
+ * \brief Compute the index of the maximum (or minimum) of each row of
+ * a into c
+ * \param a The input expression
+ * \param c The output expression
+ */
+template <bool Max, typename A, typename C, cpp_enable_iff(reduc_possible<A, C>)>
+void argmax(const A& a, C&& c) {
+    const size_t M = etl::dim<0>(a);
+
+    if (!etl::size(a)) {
+        return;
+    }
+
+    const size_t K = etl::size(a) / M;
+
+    auto* cc = c.memory_start();
+
+    auto batch_fun = [&](size_t first, size_t last) {
+        reduc_detail::argmax_kernel<default_vec, Max>(a, cc, K, first, last);
+    };
+
+    engine_dispatch_1d(batch_fun, 0, M, engine_select_parallel(etl::size(a), parallel_threshold) && is_thread_safe<A>);
+
+    c.invalidate_gpu();
+}
+
+/*!
+ * \copydoc sum_r
+ */
+template <bool Mean, typename A, typename C, cpp_disable_iff(reduc_possible<A, C>)>
+void sum_r(const A& a, C&& c) {
+    cpp_unused(a);
+    cpp_unused(c);
+    cpp_unreachable("vec::sum_r called with invalid parameters");
+}
+
+/*!
+ * \copydoc sum_l
+ */
+template <bool Mean, typename A, typename C, cpp_disable_iff(reduc_possible<A, C>)>
+void sum_l(const A& a, C&& c) {
+    cpp_unused(a);
+    cpp_unused(c);
+    cpp_unreachable("vec::sum_l called with invalid parameters");
+}
+
+/*!
+ * \copydoc argmax
+ */
+template <bool Max, typename A, typename C, cpp_disable_iff(reduc_possible<A, C>)>
+void argmax(const A& a, C&& c) {
+    cpp_unused(a);
+    cpp_unused(c);
+    cpp_unreachable("vec::argmax called with invalid parameters");
+}
+
+} //end of namespace vec
+} //end of namespace impl
+} //end of namespace etl
@@ -0,0 +1,191 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Vectorized implementation of the batch softmax
+ */
+
+#pragma once
+
+namespace etl {
+
+namespace impl {
+
+namespace vec {
+
+/*!
+ * \brief Indicates if the batch softmax of A into C can be vectorized
+ */
+template <typename A, typename C>
+constexpr bool batch_softmax_possible =
+    vec_enabled && vectorize_impl && all_vectorizable<vector_mode, A, C> && all_floating<A, C> && all_homogeneous<A, C> && is_dma<C>;
+
+namespace softmax_detail {
+
+/*!
+ * \brief Compute the maximum of the row [first, last) of a
+ * \param a The input expression
+ * \param first The first element of the row
+ * \param last The last element of the row (exclusive)
+ * \return the maximum of the row
+ */
+template <typename V, typename A, typename T = value_t<A>>
+T row_max(const A& a, size_t first, size_t last) {
+    static constexpr size_t vec_size = V::template traits<T>::size;
+
+    T m = std::numeric_limits<T>::lowest();
+
+    size_t j = first;
+
+    if (last - first >= vec_size) {
+        auto m1 = V::set(m);
+        auto m2 = V::set(m);
+
+        for (; j + 2 * vec_size - 1 < last; j += 2 * vec_size) {
+            m1 = V::max(a.template loadu<V>(j + 0 * vec_size), m1);
+            m2 = V::max(a.template loadu<V>(j + 1 * vec_size), m2);
+        }
+
+        for (; j + vec_size - 1 < last; j += vec_size) {
+            m1 = V::max(a.template loadu<V>(j), m1);
+        }
+
+        T maxs[vec_size];
+
+        V::storeu(maxs, V::max(m1, m2));
+
+        for (size_t l = 0; l < vec_size; ++l) {
+            m = maxs[l] > m ? maxs[l] : m;
+        }
+    }
+
+    for (; j < last; ++j) {
+        const T x = a.read_flat(j);
+        m = x > m ? x : m;
+    }
+
+    return m;
+}
+
+/*!
+ * \brief Compute the softmax of the rows [first, last) of a into c.
+ *
+ * Each row is processed in three passes: the maximum (for the stable
+ * version), the exponentials stored in c and accumulated, and the
+ * scaling of the row of c, which is still in cache.
+ *
+ * \param a The input expression
+ * \param c The output memory
+ * \param K The length of each row
+ * \param first The first row
+ * \param last The last row (exclusive)
+ */
+template <typename V, bool Stable, typename A, typename T>
+void batch_softmax_kernel(const A& a, T* c, size_t K, size_t first, size_t last) {
+    static constexpr size_t vec_size = V::template traits<T>::size;
+
+    for (size_t i = first; i < last; ++i) {
+        const size_t base = i * K;
+
+        T* ci = c + base;
+
+        // 1. The maximum of the row
+
+        const T m = Stable ? row_max<V>(a, base, base + K) : T(0);
+
+        // 2. The exponentials and their sum
+
+        auto vm = V::set(m);
+        auto r1 = V::template zero<T>();
+        auto r2 = V::template zero<T>();
+
+        size_t j = 0;
+
+        for (; j + 2 * vec_size - 1 < K; j += 2 * vec_size) {
+            auto e1 = V::exp(V::sub(a.template loadu<V>(base + j + 0 * vec_size), vm));
+            auto e2 = V::exp(V::sub(a.template loadu<V>(base + j + 1 * vec_size), vm));
+
+            V::storeu(ci + j + 0 * vec_size, e1);
+            V::storeu(ci + j + 1 * vec_size, e2);
+
+            r1 = V::add(e1, r1);
+            r2 = V::add(e2, r2);
+        }
+
+        for (; j + vec_size - 1 < K; j += vec_size) {
+            auto e1 = V::exp(V::sub(a.template loadu<V>(base + j), vm));
+
+            V::storeu(ci + j, e1);
+
+            r1 = V::add(e1, r1);
+        }
+
+        T s = V::hadd(V::add(r1, r2));
+
+        for (; j < K; ++j) {
+            ci[j] = std::exp(a.read_flat(base + j) - m);
+            s += ci[j];
+        }
+
+        // 3. The normalization
+
+        const T inv = T(1) / s;
+
+        auto vinv = V::set(inv);
+
+        for (j = 0; j + vec_size - 1 < K; j += vec_size) {
+            V::storeu(ci + j, V::mul(V::loadu(ci + j), vinv));
+        }
+
+        for (; j < K; ++j) {
+            ci[j] *= inv;
+        }
+    }
+}
+
+} // end of namespace softmax_detail
+
+/*!
+ * \brief Compute the softmax of each row of a into c
+ * \param a The input expression
+ * \param c The output matrix
+ * \tparam Stable Indicates if the maximum of each row is subtracted before
+ * the exponentials
+ */
+template <bool Stable, typename A, typename C, cpp_enable_iff(batch_softmax_possible<A, C>)>
+void batch_softmax(const A& a, C&& c) {
+    const size_t N = etl::dim<0>(a);
+    const size_t K = etl::size(a) / N;
+
+    a.ensure_cpu_up_to_date();
+
+    auto* cc = c.memory_start();
+
+    auto batch_fun = [&](size_t first, size_t last) {
+        softmax_detail::batch_softmax_kernel<default_vec, Stable>(a, cc, K, first, last);
+    };
+
+    engine_dispatch_1d(batch_fun, 0, N, engine_select_parallel(etl::size(a), parallel_threshold) && is_thread_safe<A>);
+
+    c.validate_cpu();
+    c.invalidate_gpu();
+}
+
+/*!
+ * \copydoc batch_softmax
+ */
+template <bool Stable, typename A, typename C, cpp_disable_iff(batch_softmax_possible<A, C>)>
+void batch_softmax(const A& a, C&& c) {
+    cpp_unused(a);
+    cpp_unused(c);
+    cpp_unreachable("vec::batch_softmax called with invalid parameters");
+}
+
+} //end of namespace vec
+} //end of namespace impl
+} //end of namespace etl
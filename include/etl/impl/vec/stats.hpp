@@ -0,0 +1,349 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Vectorized implementation of the single-pass statistics
+ */
+
+#pragma once
+
+#include "etl/impl/vec/reduc.hpp"
+
+namespace etl {
+
+namespace impl {
+
+namespace vec {
+
+/*!
+ * \brief Indicates if the statistics of A can be vectorized
+ */
+template <typename A>
+constexpr bool stats_possible = vec_enabled && all_vectorizable<vector_mode, A> && all_floating<A>;
+
+/*!
+ * \brief Indicates if the row and column statistics of A into M and Var
+ * can be vectorized
+ */
+template <typename A, typename M, typename Var>
+constexpr bool stats_rl_possible = reduc_possible<A, M> && reduc_possible<A, Var>;
+
+namespace stats_detail {
+
+/*!
+ * \brief The number of elements of a block. The block is read a second
+ * time to compute the squared differences and should stay in the L1 cache.
+ */
+static constexpr size_t block_size = 1024;
+
+/*!
+ * \brief Compute the statistics of the range [first, last) of the flat
+ * input a.
+ *
+ * The statistics are computed by blocks. The mean, the minimum and the
+ * maximum of a block are computed in a first pass and its squared
+ * differences to its mean in a second pass, from the cache. The blocks
+ * are then merged together.
+ *
+ * \param a The input expression
+ * \param first The first element
+ * \param last The last element (exclusive)
+ * \return The statistics of the range
+ */
+template <typename V, typename A, typename T = value_t<A>>
+statistics<T> stats_kernel(const A& a, size_t first, size_t last) {
+    static constexpr size_t vec_size = V::template traits<T>::size;
+
+    statistics<T> acc;
+
+    T mins[vec_size];
+    T maxs[vec_size];
+
+    auto vmin = V::set(acc.min);
+    auto vmax = V::set(acc.max);
+
+    for (size_t block = first; block < last; block += block_size) {
+        const size_t block_last = std::min(block + block_size, last);
+
+        // First pass: sum, minimum and maximum
+
+        auto r1 = V::template zero<T>();
+        auto r2 = V::template zero<T>();
+        auto r3 = V::template zero<T>();
+        auto r4 = V::template zero<T>();
+
+        size_t i = block;
+
+        for (; i + 4 * vec_size - 1 < block_last; i += 4 * vec_size) {
+            auto x1 = a.template loadu<V>(i + 0 * vec_size);
+            auto x2 = a.template loadu<V>(i + 1 * vec_size);
+            auto x3 = a.template loadu<V>(i + 2 * vec_size);
+            auto x4 = a.template loadu<V>(i + 3 * vec_size);
+
+            r1 = V::add(x1, r1);
+            r2 = V::add(x2, r2);
+            r3 = V::add(x3, r3);
+            r4 = V::add(x4, r4);
+
+            vmin = V::min(V::min(x1, x2), V::min(V::min(x3, x4), vmin));
+            vmax = V::max(V::max(x1, x2), V::max(V::max(x3, x4), vmax));
+        }
+
+        for (; i + vec_size - 1 < block_last; i += vec_size) {
+            auto x1 = a.template loadu<V>(i);
+
+            r1   = V::add(x1, r1);
+            vmin = V::min(x1, vmin);
+            vmax = V::max(x1, vmax);
+        }
+
+        T sum = V::hadd(V::add(V::add(r1, r2), V::add(r3, r4)));
+
+        for (; i < block_last; ++i) {
+            const T x = a.read_flat(i);
+
+            sum += x;
+            acc.min = x < acc.min ? x : acc.min;
+            acc.max = x > acc.max ? x : acc.max;
+        }
+
+        statistics<T> local;
+
+        local.count = block_last - block;
+        local.mean  = sum / T(local.count);
+
+        // Second pass: squared differences to the mean of the block
+
+        auto vmean = V::set(local.mean);
+
+        r1 = V::template zero<T>();
+        r2 = V::template zero<T>();
+
+        for (i = block; i + 2 * vec_size - 1 < block_last; i += 2 * vec_size) {
+            auto d1 = V::sub(a.template loadu<V>(i + 0 * vec_size), vmean);
+            auto d2 = V::sub(a.template loadu<V>(i + 1 * vec_size), vmean);
+
+            r1 = V::fmadd(d1, d1, r1);
+            r2 = V::fmadd(d2, d2, r2);
+        }
+
+        for (; i + vec_size - 1 < block_last; i += vec_size) {
+            auto d1 = V::sub(a.template loadu<V>(i), vmean);
+
+            r1 = V::fmadd(d1, d1, r1);
+        }
+
+        local.m2 = V::hadd(V::add(r1, r2));
+
+        for (; i < block_last; ++i) {
+            const T d = a.read_flat(i) - local.mean;
+
+            local.m2 += d * d;
+        }
+
+        local.min = acc.min;
+        local.max = acc.max;
+
+        acc.merge(local);
+    }
+
+    V::storeu(mins, vmin);
+    V::storeu(maxs, vmax);
+
+    for (size_t l = 0; l < vec_size; ++l) {
+        acc.min = mins[l] < acc.min ? mins[l] : acc.min;
+        acc.max = maxs[l] > acc.max ? maxs[l] : acc.max;
+    }
+
+    return acc;
+}
+
+/*!
+ * \brief Compute the mean and the variance of the columns [first, last)
+ * of the (N, K) input a.
+ *
+ * The rows are streamed once, in memory order, and each column is
+ * updated with the Welford algorithm. The running means and squared
+ * differences are kept in the output, which stays in cache.
+ *
+ * \param a The input expression
+ * \param mean The output means
+ * \param variance The output variances
+ * \param N The number of rows
+ * \param K The length of each row
+ * \param first The first column
+ * \param last The last column (exclusive)
+ */
+template <typename V, typename A, typename T>
+void stats_l_kernel(const A& a, T* mean, T* variance, size_t N, size_t K, size_t first, size_t last) {
+    static constexpr size_t vec_size = V::template traits<T>::size;
+
+    std::fill(mean + first, mean + last, T(0));
+    std::fill(variance + first, variance + last, T(0));
+
+    for (size_t i = 0; i < N; ++i) {
+        const size_t base = i * K;
+
+        const T inv = T(1) / T(i + 1);
+
+        auto vinv = V::set(inv);
+
+        size_t j = first;
+
+        for (; j + vec_size - 1 < last; j += vec_size) {
+            auto x = a.template loadu<V>(base + j);
+            auto m = V::loadu(mean + j);
+            auto d = V::sub(x, m);
+
+            m = V::fmadd(d, vinv, m);
+
+            V::storeu(mean + j, m);
+            V::storeu(variance + j, V::fmadd(d, V::sub(x, m), V::loadu(variance + j)));
+        }
+
+        for (; j < last; ++j) {
+            const T x = a.read_flat(base + j);
+            const T d = x - mean[j];
+
+            mean[j] += d * inv;
+            variance[j] += d * (x - mean[j]);
+        }
+    }
+
+    for (size_t j = first; j < last; ++j) {
+        variance[j] /= T(N);
+    }
+}
+
+} // end of namespace stats_detail
+
+/*!
+ * \brief Compute the statistics of the values of the given expression
+ * \param a The input expression
+ * \return the statistics of the values of a
+ */
+template <typename A, cpp_enable_iff(stats_possible<A>)>
+statistics<value_t<A>> stats(const A& a) {
+    using T = value_t<A>;
+
+    safe_ensure_cpu_up_to_date(a);
+
+    statistics<T> acc;
+
+    auto acc_functor = [&acc](const statistics<T>& value) {
+        acc.merge(value);
+    };
+
+    auto batch_fun = [&a](const size_t first, const size_t last) {
+        return stats_detail::stats_kernel<default_vec>(a, first, last);
+    };
+
+    engine_dispatch_1d_acc<statistics<T>>(batch_fun, acc_functor, 0, etl::size(a), vec_sum_parallel_threshold);
+
+    return acc;
+}
+
+/*!
+ * \brief Compute the mean and the variance of each row of a
+ * \param a The input expression
+ * \param mean The output means
+ * \param variance The output variances
+ */
+template <typename A, typename M, typename Var, cpp_enable_iff(stats_rl_possible<A, M, Var>)>
+void stats_r(const A& a, M&& mean, Var&& variance) {
+    const size_t N = etl::dim<0>(a);
+
+    if (!N) {
+        return;
+    }
+
+    const size_t K = etl::size(a) / N;
+
+    auto* mm = mean.memory_start();
+    auto* vv = variance.memory_start();
+
+    auto batch_fun = [&](size_t first, size_t last) {
+        for (size_t i = first; i < last; ++i) {
+            auto local = stats_detail::stats_kernel<default_vec>(a, i * K, (i + 1) * K);
+
+            mm[i] = local.mean;
+            vv[i] = local.variance();
+        }
+    };
+
+    engine_dispatch_1d(batch_fun, 0, N, engine_select_parallel(etl::size(a), parallel_threshold) && is_thread_safe<A>);
+
+    mean.invalidate_gpu();
+    variance.invalidate_gpu();
+}
+
+/*!
+ * \brief Compute the mean and the variance of each column of a
+ * \param a The input expression
+ * \param mean The output means
+ * \param variance The output variances
+ */
+template <typename A, typename M, typename Var, cpp_enable_iff(stats_rl_possible<A, M, Var>)>
+void stats_l(const A& a, M&& mean, Var&& variance) {
+    using T = value_t<A>;
+
+    const size_t N = etl::dim<0>(a);
+
+    if (!N) {
+        return;
+    }
+
+    const size_t K = etl::size(a) / N;
+
+    auto* mm = mean.memory_start();
+    auto* vv = variance.memory_start();
+
+    auto batch_fun = [&](size_t first, size_t last) {
+        stats_detail::stats_l_kernel<default_vec>(a, mm, vv, N, K, first, last);
+    };
+
+    reduc_detail::dispatch<default_vec, T>(batch_fun, K, engine_select_parallel(etl::size(a), parallel_threshold) && is_thread_safe<A>);
+
+    mean.invalidate_gpu();
+    variance.invalidate_gpu();
+}
+
+/*!
+ * \copydoc stats
+ */
+template <typename A, cpp_disable_iff(stats_possible<A>)>
+statistics<value_t<A>> stats(const A& a) {
+    cpp_unused(a);
+    cpp_unreachable("vec::stats called with invalid parameters");
+}
+
+/*!
+ * \copydoc stats_r
+ */
+template <typename A, typename M, typename Var, cpp_disable_iff(stats_rl_possible<A, M, Var>)>
+void stats_r(const A& a, M&& mean, Var&& variance) {
+    cpp_unused(a);
+    cpp_unused(mean);
+    cpp_unused(variance);
+    cpp_unreachable("vec::stats_r called with invalid parameters");
+}
+
+/*!
+ * \copydoc stats_l
+ */
+template <typename A, typename M, typename Var, cpp_disable_iff(stats_rl_possible<A, M, Var>)>
+void stats_l(const A& a, M&& mean, Var&& variance) {
+    cpp_unused(a);
+    cpp_unused(mean);
+    cpp_unused(variance);
+    cpp_unreachable("vec::stats_l called with invalid parameters");
+}
+
+} //end of namespace vec
+} //end of namespace impl
+} //end of namespace etl
@@ -12,6 +12,8 @@
 
 #pragma once
 
+#include "etl/impl/std/sum.hpp"
+
 namespace etl {
 
 namespace impl {
@@ -151,6 +153,83 @@ value_t<L> asum_impl(const L& lhs) {
     return p1 + p2;
 }
 
+/*!
+ * \brief Vectorized compensated sum of the range [first, last)
+ *
+ * Each lane of two vector accumulators keeps the rounding errors of its
+ * additions (TwoSum) in a vector of compensations. The lanes, their
+ * compensations and the scalar tail are then summed in a fixed order, with
+ * compensation as well, so that the result only depends on the range.
+ *
+ * \param lhs The expression to compute the sum from
+ * \param first The first element of the range
+ * \param last The last element of the range (exclusive)
+ * \tparam V The vectorization type
+ * \return The compensated sum of the given range
+ */
+template <typename V, typename L>
+compensated_sum<value_t<L>> accurate_sum_impl(const L& lhs, size_t first, size_t last) {
+    using vec_type = V;
+    using T        = value_t<L>;
+
+    static constexpr size_t vec_size = vec_type::template traits<T>::size;
+
+    auto s1 = vec_type::template zero<T>();
+    auto s2 = vec_type::template zero<T>();
+    auto c1 = vec_type::template zero<T>();
+    auto c2 = vec_type::template zero<T>();
+
+    size_t i = first;
+
+    for (; i + (vec_size * 2) - 1 < last; i += 2 * vec_size) {
+        auto x1 = lhs.template loadu<vec_type>(i + 0 * vec_size);
+        auto x2 = lhs.template loadu<vec_type>(i + 1 * vec_size);
+
+        auto t1 = vec_type::add(s1, x1);
+        auto t2 = vec_type::add(s2, x2);
+
+        auto v1 = vec_type::sub(t1, s1);
+        auto v2 = vec_type::sub(t2, s2);
+
+        c1 = vec_type::add(c1, vec_type::add(vec_type::sub(s1, vec_type::sub(t1, v1)), vec_type::sub(x1, v1)));
+        c2 = vec_type::add(c2, vec_type::add(vec_type::sub(s2, vec_type::sub(t2, v2)), vec_type::sub(x2, v2)));
+
+        s1 = t1;
+        s2 = t2;
+    }
+
+    for (; i + vec_size - 1 < last; i += vec_size) {
+        auto x1 = lhs.template loadu<vec_type>(i);
+        auto t1 = vec_type::add(s1, x1);
+        auto v1 = vec_type::sub(t1, s1);
+
+        c1 = vec_type::add(c1, vec_type::add(vec_type::sub(s1, vec_type::sub(t1, v1)), vec_type::sub(x1, v1)));
+        s1 = t1;
+    }
+
+    compensated_sum<T> acc;
+
+    T lanes[4][vec_size];
+
+    vec_type::storeu(lanes[0], s1);
+    vec_type::storeu(lanes[1], s2);
+    vec_type::storeu(lanes[2], c1);
+    vec_type::storeu(lanes[3], c2);
+
+    for (size_t l = 0; l < vec_size; ++l) {
+        acc.add(lanes[0][l]);
+        acc.add(lanes[1][l]);
+        acc.add(lanes[2][l]);
+        acc.add(lanes[3][l]);
+    }
+
+    for (; i < last; ++i) {
+        acc.add(lhs.read_flat(i));
+    }
+
+    return acc;
+}
+
 /*!
  * \brief Compute the sum of lhs
  * \param lhs The lhs expression
@@ -209,6 +288,18 @@ value_t<L> asum(const L& lhs) {
     return acc;
 }
 
+/*!
+ * \brief Compute the compensated sum of the range [first, last) of lhs
+ * \param lhs The lhs expression
+ * \param first The first element of the range
+ * \param last The last element of the range (exclusive)
+ * \return the compensated sum of the range
+ */
+template <typename L, cpp_enable_iff(vec_enabled && all_vectorizable<vector_mode, L> && all_floating<L>)>
+compensated_sum<value_t<L>> accurate_sum(const L& lhs, size_t first, size_t last) {
+    return accurate_sum_impl<default_vec>(lhs, first, last);
+}
+
 /*!
  * \brief Compute the sum of lhs
  * \param lhs The lhs expression
@@ -231,6 +322,17 @@ value_t<L> asum(const L& lhs) {
     cpp_unreachable("vec::asum called with invalid parameters");
 }
 
+/*!
+ * \copydoc accurate_sum
+ */
+template <typename L, cpp_disable_iff(vec_enabled && all_vectorizable<vector_mode, L> && all_floating<L>)>
+compensated_sum<value_t<L>> accurate_sum(const L& lhs, size_t first, size_t last) {
+    cpp_unused(lhs);
+    cpp_unused(first);
+    cpp_unused(last);
+    cpp_unreachable("vec::accurate_sum called with invalid parameters");
+}
+
 } //end of namespace vec
 } //end of namespace impl
 } //end of namespace etl
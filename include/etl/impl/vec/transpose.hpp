@@ -0,0 +1,416 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Vectorized implementation of the "transpose" algorithm
+ *
+ * The matrices are transposed by blocks that fit in the L1 cache. Each
+ * block is transposed by tiles that are transposed in registers (8x8 for
+ * float and 4x4 for double with AVX, 4x4 and 2x2 with SSE).
+ */
+
+#pragma once
+
+#include "etl/impl/std/transpose.hpp"
+
+namespace etl {
+
+namespace impl {
+
+namespace vec {
+
+/*!
+ * \brief Indicates if the vectorized transposition of A into C is possible
+ */
+template <typename A, typename C>
+constexpr bool transpose_possible = vec_enabled && all_dma<A, C> && all_floating<A, C> && all_homogeneous<A, C>;
+
+namespace transpose_detail {
+
+/*!
+ * \brief The size (in elements) of the side of a cache block
+ */
+static constexpr size_t block_size = 64;
+
+#ifdef __AVX__
+
+/*!
+ * \brief The size of the side of a register tile
+ */
+template <typename T>
+constexpr size_t tile_size = 32 / sizeof(T);
+
+/*!
+ * \brief Transpose a 8x8 tile of in into out
+ * \param in The input tile
+ * \param is The row stride of the input
+ * \param out The output tile
+ * \param os The row stride of the output
+ */
+inline void transpose_tile(const float* in, size_t is, float* out, size_t os) {
+    __m256 r0 = _mm256_loadu_ps(in + 0 * is);
+    __m256 r1 = _mm256_loadu_ps(in + 1 * is);
+    __m256 r2 = _mm256_loadu_ps(in + 2 * is);
+    __m256 r3 = _mm256_loadu_ps(in + 3 * is);
+    __m256 r4 = _mm256_loadu_ps(in + 4 * is);
+    __m256 r5 = _mm256_loadu_ps(in + 5 * is);
+    __m256 r6 = _mm256_loadu_ps(in + 6 * is);
+    __m256 r7 = _mm256_loadu_ps(in + 7 * is);
+
+    __m256 t0 = _mm256_unpacklo_ps(r0, r1);
+    __m256 t1 = _mm256_unpackhi_ps(r0, r1);
+    __m256 t2 = _mm256_unpacklo_ps(r2, r3);
+    __m256 t3 = _mm256_unpackhi_ps(r2, r3);
+    __m256 t4 = _mm256_unpacklo_ps(r4, r5);
+    __m256 t5 = _mm256_unpackhi_ps(r4, r5);
+    __m256 t6 = _mm256_unpacklo_ps(r6, r7);
+    __m256 t7 = _mm256_unpackhi_ps(r6, r7);
+
+    r0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+    r1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+    r2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+    r3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+    r4 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(1, 0, 1, 0));
+    r5 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(3, 2, 3, 2));
+    r6 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(1, 0, 1, 0));
+    r7 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(3, 2, 3, 2));
+
+    _mm256_storeu_ps(out + 0 * os, _mm256_permute2f128_ps(r0, r4, 0x20));
+    _mm256_storeu_ps(out + 1 * os, _mm256_permute2f128_ps(r1, r5, 0x20));
+    _mm256_storeu_ps(out + 2 * os, _mm256_permute2f128_ps(r2, r6, 0x20));
+    _mm256_storeu_ps(out + 3 * os, _mm256_permute2f128_ps(r3, r7, 0x20));
+    _mm256_storeu_ps(out + 4 * os, _mm256_permute2f128_ps(r0, r4, 0x31));
+    _mm256_storeu_ps(out + 5 * os, _mm256_permute2f128_ps(r1, r5, 0x31));
+    _mm256_storeu_ps(out + 6 * os, _mm256_permute2f128_ps(r2, r6, 0x31));
+    _mm256_storeu_ps(out + 7 * os, _mm256_permute2f128_ps(r3, r7, 0x31));
+}
+
+/*!
+ * \brief Transpose a 4x4 tile of in into out
+ * \param in The input tile
+ * \param is The row stride of the input
+ * \param out The output tile
+ * \param os The row stride of the output
+ */
+inline void transpose_tile(const double* in, size_t is, double* out, size_t os) {
+    __m256d r0 = _mm256_loadu_pd(in + 0 * is);
+    __m256d r1 = _mm256_loadu_pd(in + 1 * is);
+    __m256d r2 = _mm256_loadu_pd(in + 2 * is);
+    __m256d r3 = _mm256_loadu_pd(in + 3 * is);
+
+    __m256d t0 = _mm256_unpacklo_pd(r0, r1);
+    __m256d t1 = _mm256_unpackhi_pd(r0, r1);
+    __m256d t2 = _mm256_unpacklo_pd(r2, r3);
+    __m256d t3 = _mm256_unpackhi_pd(r2, r3);
+
+    _mm256_storeu_pd(out + 0 * os, _mm256_permute2f128_pd(t0, t2, 0x20));
+    _mm256_storeu_pd(out + 1 * os, _mm256_permute2f128_pd(t1, t3, 0x20));
+    _mm256_storeu_pd(out + 2 * os, _mm256_permute2f128_pd(t0, t2, 0x31));
+    _mm256_storeu_pd(out + 3 * os, _mm256_permute2f128_pd(t1, t3, 0x31));
+}
+
+#elif defined(__SSE3__)
+
+/*!
+ * \brief The size of the side of a register tile
+ */
+template <typename T>
+constexpr size_t tile_size = 16 / sizeof(T);
+
+/*!
+ * \brief Transpose a 4x4 tile of in into out
+ * \param in The input tile
+ * \param is The row stride of the input
+ * \param out The output tile
+ * \param os The row stride of the output
+ */
+inline void transpose_tile(const float* in, size_t is, float* out, size_t os) {
+    __m128 r0 = _mm_loadu_ps(in + 0 * is);
+    __m128 r1 = _mm_loadu_ps(in + 1 * is);
+    __m128 r2 = _mm_loadu_ps(in + 2 * is);
+    __m128 r3 = _mm_loadu_ps(in + 3 * is);
+
+    _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+    _mm_storeu_ps(out + 0 * os, r0);
+    _mm_storeu_ps(out + 1 * os, r1);
+    _mm_storeu_ps(out + 2 * os, r2);
+    _mm_storeu_ps(out + 3 * os, r3);
+}
+
+/*!
+ * \brief Transpose a 2x2 tile of in into out
+ * \param in The input tile
+ * \param is The row stride of the input
+ * \param out The output tile
+ * \param os The row stride of the output
+ */
+inline void transpose_tile(const double* in, size_t is, double* out, size_t os) {
+    __m128d r0 = _mm_loadu_pd(in + 0 * is);
+    __m128d r1 = _mm_loadu_pd(in + 1 * is);
+
+    _mm_storeu_pd(out + 0 * os, _mm_unpacklo_pd(r0, r1));
+    _mm_storeu_pd(out + 1 * os, _mm_unpackhi_pd(r0, r1));
+}
+
+#else
+
+/*!
+ * \brief The size of the side of a register tile
+ */
+template <typename T>
+constexpr size_t tile_size = 1;
+
+/*!
+ * \brief Transpose a 1x1 tile of in into out
+ * \param in The input tile
+ * \param is The row stride of the input
+ * \param out The output tile
+ * \param os The row stride of the output
+ */
+template <typename T>
+void transpose_tile(const T* in, size_t is, T* out, size_t os) {
+    cpp_unused(is);
+    cpp_unused(os);
+
+    *out = *in;
+}
+
+#endif
+
+/*!
+ * \brief Transpose the (rows, cols) sub matrix of in into out, with scalar
+ * code
+ * \param in The input sub matrix
+ * \param is The row stride of the input
+ * \param out The output sub matrix
+ * \param os The row stride of the output
+ * \param rows The number of rows of the input sub matrix
+ * \param cols The number of columns of the input sub matrix
+ */
+template <typename T>
+void transpose_edge(const T* in, size_t is, T* out, size_t os, size_t rows, size_t cols) {
+    for (size_t i = 0; i < rows; ++i) {
+        for (size_t j = 0; j < cols; ++j) {
+            out[j * os + i] = in[i * is + j];
+        }
+    }
+}
+
+/*!
+ * \brief Transpose the rows [first, last) of the (R, C) row-major matrix
+ * in into the (C, R) row-major matrix out
+ * \param in The input matrix
+ * \param out The output matrix
+ * \param R The number of rows of the input
+ * \param C The number of columns of the input
+ * \param first The first row
+ * \param last The last row (exclusive)
+ */
+template <typename T>
+void transpose_kernel(const T* in, T* out, size_t R, size_t C, size_t first, size_t last) {
+    static constexpr size_t S = tile_size<T>;
+
+    for (size_t bi = first; bi < last; bi += block_size) {
+        const size_t i_end = std::min(bi + block_size, last);
+
+        for (size_t bj = 0; bj < C; bj += block_size) {
+            const size_t j_end = std::min(bj + block_size, C);
+
+            size_t i = bi;
+
+            for (; i + S - 1 < i_end; i += S) {
+                size_t j = bj;
+
+                for (; j + S - 1 < j_end; j += S) {
+                    transpose_tile(in + i * C + j, C, out + j * R + i, R);
+                }
+
+                transpose_edge(in + i * C + j, C, out + j * R + i, R, S, j_end - j);
+            }
+
+            transpose_edge(in + i * C + bj, C, out + bj * R + i, R, i_end - i, j_end - bj);
+        }
+    }
+}
+
+/*!
+ * \brief Transpose inplace the tile rows [first, last) of the (N, N)
+ * row-major matrix data.
+ *
+ * The tile row b swaps the tiles (b, j) and (j, b) for j >= b, which makes
+ * the tile rows independent.
+ *
+ * \param data The matrix
+ * \param N The dimension of the matrix
+ * \param first The first tile row
+ * \param last The last tile row (exclusive)
+ */
+template <typename T>
+void inplace_square_kernel(T* data, size_t N, size_t first, size_t last) {
+    static constexpr size_t S = tile_size<T>;
+
+    const size_t tiles = N / S;
+
+    T tmp[S * S];
+
+    for (size_t bi = first; bi < last; ++bi) {
+        const size_t i = bi * S;
+
+        // Diagonal tile
+
+        transpose_tile(data + i * N + i, N, tmp, S);
+
+        for (size_t k = 0; k < S; ++k) {
+            std::copy(tmp + k * S, tmp + (k + 1) * S, data + (i + k) * N + i);
+        }
+
+        // Pairs of off-diagonal tiles
+
+        for (size_t bj = bi + 1; bj < tiles; ++bj) {
+            const size_t j = bj * S;
+
+            transpose_tile(data + i * N + j, N, tmp, S);
+            transpose_tile(data + j * N + i, N, data + i * N + j, N);
+
+            for (size_t k = 0; k < S; ++k) {
+                std::copy(tmp + k * S, tmp + (k + 1) * S, data + (j + k) * N + i);
+            }
+        }
+    }
+}
+
+/*!
+ * \brief Transpose inplace the (N, N) row-major matrix data
+ * \param data The matrix
+ * \param N The dimension of the matrix
+ */
+template <typename T>
+void inplace_square(T* data, size_t N) {
+    static constexpr size_t S = tile_size<T>;
+
+    const size_t tiles = N / S;
+
+    auto batch_fun = [data, N](size_t first, size_t last) {
+        inplace_square_kernel(data, N, first, last);
+    };
+
+    engine_dispatch_1d_serial(batch_fun, 0, tiles, engine_select_parallel(N * N, parallel_threshold));
+
+    // The remaining columns and rows
+
+    using std::swap;
+
+    for (size_t i = 0; i < N; ++i) {
+        for (size_t j = std::max(i + 1, tiles * S); j < N; ++j) {
+            swap(data[i * N + j], data[j * N + i]);
+        }
+    }
+}
+
+} // end of namespace transpose_detail
+
+/*!
+ * \brief Transpose the square matrix c inplace
+ * \param c The matrix to transpose
+ */
+template <typename C, cpp_enable_iff(transpose_possible<C, C>)>
+void inplace_square_transpose(C&& c) {
+    c.ensure_cpu_up_to_date();
+
+    transpose_detail::inplace_square(c.memory_start(), etl::dim<0>(c));
+
+    c.invalidate_gpu();
+}
+
+/*!
+ * \brief Transpose the rectangular matrix c inplace
+ * \param c The matrix to transpose
+ */
+template <typename C, cpp_enable_iff(transpose_possible<C, C>)>
+void inplace_rectangular_transpose(C&& c) {
+    using T = value_t<C>;
+
+    // Both storage orders are the transposition of a row-major matrix
+    const bool row_major = decay_traits<C>::storage_order == order::RowMajor;
+
+    const size_t R = row_major ? etl::dim<0>(c) : etl::dim<1>(c);
+    const size_t K = row_major ? etl::dim<1>(c) : etl::dim<0>(c);
+
+    c.ensure_cpu_up_to_date();
+
+    auto square_transpose = [](T* block, size_t N) {
+        transpose_detail::inplace_square(block, N);
+    };
+
+    standard::transpose_detail::inplace_rectangular_transpose(c.memory_start(), R, K, square_transpose);
+
+    c.invalidate_gpu();
+}
+
+/*!
+ * \brief Transpose the matrix a and the store the result in c
+ * \param a The matrix to transpose
+ * \param c The target matrix
+ */
+template <typename A, typename C, cpp_enable_iff(transpose_possible<A, C>)>
+void transpose(A&& a, C&& c) {
+    a.ensure_cpu_up_to_date();
+
+    // Both storage orders are the transposition of a row-major matrix
+    const bool row_major = decay_traits<A>::storage_order == order::RowMajor;
+
+    const size_t R = row_major ? etl::dim<0>(a) : etl::dim<1>(a);
+    const size_t K = row_major ? etl::dim<1>(a) : etl::dim<0>(a);
+
+    const auto* in = a.memory_start();
+    auto* out      = c.memory_start();
+
+    const size_t blocks = (R + transpose_detail::block_size - 1) / transpose_detail::block_size;
+
+    auto batch_fun = [=](size_t first, size_t last) {
+        const size_t bs = transpose_detail::block_size;
+        transpose_detail::transpose_kernel(in, out, R, K, first * bs, std::min(last * bs, R));
+    };
+
+    engine_dispatch_1d_serial(batch_fun, 0, blocks, engine_select_parallel(R * K, parallel_threshold));
+
+    c.invalidate_gpu();
+}
+
+/*!
+ * \copydoc inplace_square_transpose
+ */
+template <typename C, cpp_disable_iff(transpose_possible<C, C>)>
+void inplace_square_transpose(C&& c) {
+    cpp_unused(c);
+    cpp_unreachable("vec::inplace_square_transpose called with invalid parameters");
+}
+
+/*!
+ * \copydoc inplace_rectangular_transpose
+ */
+template <typename C, cpp_disable_iff(transpose_possible<C, C>)>
+void inplace_rectangular_transpose(C&& c) {
+    cpp_unused(c);
+    cpp_unreachable("vec::inplace_rectangular_transpose called with invalid parameters");
+}
+
+/*!
+ * \copydoc transpose
+ */
+template <typename A, typename C, cpp_disable_iff(transpose_possible<A, C>)>
+void transpose(A&& a, C&& c) {
+    cpp_unused(a);
+    cpp_unused(c);
+    cpp_unreachable("vec::transpose called with invalid parameters");
+}
+
+} //end of namespace vec
+} //end of namespace impl
+} //end of namespace etl
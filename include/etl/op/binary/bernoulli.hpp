@@ -0,0 +1,142 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#pragma once
+
+namespace etl {
+
+/*!
+ * \brief Binary operator for Bernoulli sampling
+ *
+ * The right hand side is an uniform sample from [0, 1), 1.0 is
+ * returned if x is greater than the sample, 0 otherwise.
+ */
+template <typename T>
+struct bernoulli_binary_op {
+    static constexpr bool linear      = true; ///< Indicates if the operator is linear or not
+    static constexpr bool thread_safe = true; ///< Indicates if the operator is thread safe or not
+    static constexpr bool desc_func   = true; ///< Indicates if the description must be printed as function
+
+    /*!
+     * \brief Indicates if the expression is vectorizable using the
+     * given vector mode
+     * \tparam V The vector mode
+     */
+    template <vector_mode_t V>
+    static constexpr bool vectorizable =
+            (V == vector_mode_t::SSE3 || V == vector_mode_t::AVX || V == vector_mode_t::AVX512)
+        &&  is_floating_t<T>;
+
+    /*!
+     * The vectorization type for V
+     */
+    template <typename V = default_vec>
+    using vec_type       = typename V::template vec_type<T>;
+
+    /*!
+     * \brief Indicates if the operator can be computed on GPU
+     */
+    template<typename L, typename R>
+    static constexpr bool gpu_computable = false;
+
+    /*!
+     * \brief Apply the unary operator on lhs and rhs
+     * \param x The left hand side value on which to apply the operator
+     * \param u The uniform sample
+     * \return The result of applying the binary operator on lhs and rhs
+     */
+    static constexpr T apply(const T& x, const T& u) noexcept {
+        return x > u ? 1.0 : 0.0;
+    }
+
+    /*!
+     * \brief Compute several applications of the operator at a time
+     * \param lhs The left hand side vector
+     * \param rhs The right hand side vector
+     * \tparam V The vectorization mode
+     * \return a vector containing several results of the operator
+     */
+    template <typename V = default_vec>
+    static ETL_STRONG_INLINE(vec_type<V>) load(const vec_type<V>& lhs, const vec_type<V>& rhs) noexcept {
+        return V::select(V::greater(lhs, rhs), V::set(T(1)), V::template zero<T>());
+    }
+
+    /*!
+     * \brief Returns a textual representation of the operator
+     * \return a string representing the operator
+     */
+    static std::string desc() noexcept {
+        return "bernoulli";
+    }
+};
+
+/*!
+ * \brief Binary operator for Reverse Bernoulli sampling
+ *
+ * The right hand side is an uniform sample from [0, 1), 0 is
+ * returned if x is greater than the sample, 1.0 otherwise.
+ */
+template <typename T>
+struct reverse_bernoulli_binary_op {
+    static constexpr bool linear      = true; ///< Indicates if the operator is linear or not
+    static constexpr bool thread_safe = true; ///< Indicates if the operator is thread safe or not
+    static constexpr bool desc_func   = true; ///< Indicates if the description must be printed as function
+
+    /*!
+     * \brief Indicates if the expression is vectorizable using the
+     * given vector mode
+     * \tparam V The vector mode
+     */
+    template <vector_mode_t V>
+    static constexpr bool vectorizable =
+            (V == vector_mode_t::SSE3 || V == vector_mode_t::AVX || V == vector_mode_t::AVX512)
+        &&  is_floating_t<T>;
+
+    /*!
+     * The vectorization type for V
+     */
+    template <typename V = default_vec>
+    using vec_type       = typename V::template vec_type<T>;
+
+    /*!
+     * \brief Indicates if the operator can be computed on GPU
+     */
+    template<typename L, typename R>
+    static constexpr bool gpu_computable = false;
+
+    /*!
+     * \brief Apply the unary operator on lhs and rhs
+     * \param x The left hand side value on which to apply the operator
+     * \param u The uniform sample
+     * \return The result of applying the binary operator on lhs and rhs
+     */
+    static constexpr T apply(const T& x, const T& u) noexcept {
+        return x > u ? 0.0 : 1.0;
+    }
+
+    /*!
+     * \brief Compute several applications of the operator at a time
+     * \param lhs The left hand side vector
+     * \param rhs The right hand side vector
+     * \tparam V The vectorization mode
+     * \return a vector containing several results of the operator
+     */
+    template <typename V = default_vec>
+    static ETL_STRONG_INLINE(vec_type<V>) load(const vec_type<V>& lhs, const vec_type<V>& rhs) noexcept {
+        return V::select(V::greater(lhs, rhs), V::template zero<T>(), V::set(T(1)));
+    }
+
+    /*!
+     * \brief Returns a textual representation of the operator
+     * \return a string representing the operator
+     */
+    static std::string desc() noexcept {
+        return "reverse_bernoulli";
+    }
+};
+
+} //end of namespace etl
@@ -19,6 +19,7 @@ struct less_binary_op {
     static constexpr bool linear      = true;  ///< Indicates if the operator is linear or not
     static constexpr bool thread_safe = true;  ///< Indicates if the operator is thread safe or not
     static constexpr bool desc_func   = false; ///< Indicates if the description must be printed as function
+    static constexpr bool mask_op     = true;  ///< Indicates if the operator can be computed as vector masks
 
     /*!
      * \brief Indicates if the expression is vectorizable using the
@@ -28,6 +29,27 @@ struct less_binary_op {
     template <vector_mode_t V>
     static constexpr bool vectorizable = false;
 
+    /*!
+     * \brief The type of the compared values
+     */
+    template <typename L, typename R>
+    using mask_value_type = T;
+
+    /*!
+     * \brief Indicates if the expression can be computed as vector masks
+     * using the given vector mode
+     * \tparam V The vector mode
+     * \tparam L The type of the left hand side expression
+     * \tparam R The type of the right hand side expression
+     */
+    template <vector_mode_t V, typename L, typename R>
+    static constexpr bool mask_vectorizable =
+            (V == vector_mode_t::SSE3 || V == vector_mode_t::AVX || V == vector_mode_t::AVX512)
+        &&  is_floating_t<T>
+        &&  all_homogeneous<L, R>
+        &&  decay_traits<L>::template vectorizable<V>
+        &&  decay_traits<R>::template vectorizable<V>;
+
     /*!
      * \brief Indicates if the operator can be computed on GPU
      */
@@ -48,6 +70,19 @@ struct less_binary_op {
         return lhs < rhs;
     }
 
+    /*!
+     * \brief Compute several applications of the operator at a time
+     * \param lhs The left hand side expression
+     * \param rhs The right hand side expression
+     * \param i The index of the first element to compare
+     * \tparam V The vectorization mode
+     * \return a vector mask containing several results of the operator
+     */
+    template <typename V, typename L, typename R>
+    static auto load_mask(const L& lhs, const R& rhs, size_t i) noexcept {
+        return V::less(lhs.template loadu<V>(i), rhs.template loadu<V>(i));
+    }
+
     /*!
      * \brief Compute the result of the operation using the GPU
      *
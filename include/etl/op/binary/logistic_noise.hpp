@@ -0,0 +1,75 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#pragma once
+
+namespace etl {
+
+/*!
+ * \brief Binary operator for logistic noise
+ *
+ * The right hand side is a sample from N(0,1), which is scaled by
+ * sigmoid(x) and added to x.
+ */
+template <typename T>
+struct logistic_noise_binary_op {
+    static constexpr bool linear      = true; ///< Indicates if the operator is linear or not
+    static constexpr bool thread_safe = true; ///< Indicates if the operator is thread safe or not
+    static constexpr bool desc_func   = true; ///< Indicates if the description must be printed as function
+
+    /*!
+     * \brief Indicates if the expression is vectorizable using the
+     * given vector mode
+     * \tparam V The vector mode
+     */
+    template <vector_mode_t V>
+    static constexpr bool vectorizable = is_floating_t<T> && sigmoid_unary_op<T>::template vectorizable<V>;
+
+    /*!
+     * The vectorization type for V
+     */
+    template <typename V = default_vec>
+    using vec_type       = typename V::template vec_type<T>;
+
+    /*!
+     * \brief Indicates if the operator can be computed on GPU
+     */
+    template<typename L, typename R>
+    static constexpr bool gpu_computable = false;
+
+    /*!
+     * \brief Apply the unary operator on lhs and rhs
+     * \param x The left hand side value on which to apply the operator
+     * \param z The normal sample
+     * \return The result of applying the binary operator on lhs and rhs
+     */
+    static T apply(const T& x, const T& z) noexcept {
+        return x + sigmoid_unary_op<T>::apply(x) * z;
+    }
+
+    /*!
+     * \brief Compute several applications of the operator at a time
+     * \param lhs The left hand side vector
+     * \param rhs The right hand side vector
+     * \tparam V The vectorization mode
+     * \return a vector containing several results of the operator
+     */
+    template <typename V = default_vec>
+    static ETL_STRONG_INLINE(vec_type<V>) load(const vec_type<V>& lhs, const vec_type<V>& rhs) noexcept {
+        return V::fmadd(sigmoid_unary_op<T>::template load<V>(lhs), rhs, lhs);
+    }
+
+    /*!
+     * \brief Returns a textual representation of the operator
+     * \return a string representing the operator
+     */
+    static std::string desc() noexcept {
+        return "logistic_noise";
+    }
+};
+
+} //end of namespace etl
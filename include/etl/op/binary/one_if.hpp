@@ -24,7 +24,15 @@ struct one_if_binary_op {
      * \tparam V The vector mode
      */
     template <vector_mode_t V>
-    static constexpr bool vectorizable = false;
+    static constexpr bool vectorizable =
+            (V == vector_mode_t::SSE3 || V == vector_mode_t::AVX || V == vector_mode_t::AVX512)
+        &&  is_floating_t<T>;
+
+    /*!
+     * The vectorization type for V
+     */
+    template <typename V = default_vec>
+    using vec_type       = typename V::template vec_type<T>;
 
     /*!
      * \brief Indicates if the operator can be computed on GPU
@@ -42,6 +50,18 @@ struct one_if_binary_op {
         return x == value ? 1.0 : 0.0;
     }
 
+    /*!
+     * \brief Compute several applications of the operator at a time
+     * \param lhs The left hand side vector
+     * \param rhs The right hand side vector
+     * \tparam V The vectorization mode
+     * \return a vector containing several results of the operator
+     */
+    template <typename V = default_vec>
+    static ETL_STRONG_INLINE(vec_type<V>) load(const vec_type<V>& lhs, const vec_type<V>& rhs) noexcept {
+        return V::select(V::equal(lhs, rhs), V::set(T(1)), V::template zero<T>());
+    }
+
     /*!
      * \brief Returns a textual representation of the operator
      * \return a string representing the operator
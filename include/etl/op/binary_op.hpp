@@ -47,6 +47,8 @@
 #include "etl/op/binary/max.hpp"
 #include "etl/op/binary/one_if.hpp"
 #include "etl/op/binary/ranged_noise.hpp"
+#include "etl/op/binary/bernoulli.hpp"
+#include "etl/op/binary/logistic_noise.hpp"
 #include "etl/op/binary/sigmoid_derivative.hpp"
 #include "etl/op/binary/relu_derivative.hpp"
 #include "etl/op/binary/pow.hpp"
@@ -13,18 +13,44 @@
 #pragma once
 
 #include <chrono> //for std::time
+#include <cmath>  //for std::abs
 
 namespace etl {
 
 /*!
  * \brief Generator from a normal distribution
+ *
+ * The values are generated with the counter-based Philox generator and
+ * the Box-Muller transform. Each value only depends on its index,
+ * which makes the generator thread safe and vectorizable.
  */
 template <typename T = double>
 struct normal_generator_op {
     using value_type = T; ///< The value type
 
-    random_engine rand_engine;                         ///< The random engine
-    std::normal_distribution<value_type> distribution; ///< The used distribution
+    static constexpr bool thread_safe = true; ///< Indicates if the generator is thread safe or not
+
+    /*!
+     * \brief Indicates if the generator is vectorizable using the
+     * given vector mode
+     *
+     * There is no AVX-512 vectorized cosine, AVX is used instead.
+     *
+     * \tparam V The vector mode
+     */
+    template <vector_mode_t V>
+    static constexpr bool vectorizable = (V == vector_mode_t::SSE3 || V == vector_mode_t::AVX) && detail::philox_vectorizable<V, T>;
+
+    /*!
+     * The vectorization type for V
+     */
+    template <typename V = default_vec>
+    using vec_type = typename V::template vec_type<T>;
+
+    uint64_t key;    ///< The key of the counter-based generator
+    size_t current;  ///< The current index for sequential generation
+    T mean;          ///< The mean of the distribution
+    T stddev;        ///< The standard deviation of the distribution
 
     /*!
      * \brief Construct a new generator with the given mean and standard deviation
@@ -32,14 +58,36 @@ struct normal_generator_op {
      * \param stddev The standard deviation
      */
     normal_generator_op(T mean, T stddev)
-            : rand_engine(std::time(nullptr)), distribution(mean, stddev) {}
+            : key(detail::next_philox_key()), current(0), mean(mean), stddev(stddev) {}
 
     /*!
      * \brief Generate a new value
      * \return the newly generated value
      */
     value_type operator()() {
-        return distribution(rand_engine);
+        return (*this)(current++);
+    }
+
+    /*!
+     * \brief Generate the value at the given index
+     * \param i The index of the value
+     * \return the value at the given index
+     */
+    value_type operator()(size_t i) const {
+        return mean + stddev * detail::philox_normal<T>(key, i);
+    }
+
+    /*!
+     * \brief Generate several values at once
+     * \param i The index of the first value
+     * \tparam V The vectorization mode
+     * \return a vector containing several generated values
+     */
+    template <typename V = default_vec>
+    vec_type<V> load(size_t i) const {
+        auto u = detail::philox_simd<V, T>::uniform(key, i);
+        auto z = detail::box_muller<V, T>(u.first, u.second);
+        return V::add(V::set(mean), V::mul(V::set(stddev), z));
     }
 
     /*!
@@ -61,6 +109,16 @@ template <typename G, typename T = double>
 struct normal_generator_g_op {
     using value_type = T; ///< The value type
 
+    static constexpr bool thread_safe = false; ///< Indicates if the generator is thread safe or not
+
+    /*!
+     * \brief Indicates if the generator is vectorizable using the
+     * given vector mode
+     * \tparam V The vector mode
+     */
+    template <vector_mode_t V>
+    static constexpr bool vectorizable = false;
+
     G& rand_engine;                                    ///< The random engine
     std::normal_distribution<value_type> distribution; ///< The used distribution
 
@@ -93,14 +151,30 @@ struct normal_generator_g_op {
 };
 
 /*!
- * \brief Generator from a normal distribution
+ * \brief Generator from a truncated normal distribution
+ *
+ * The values farther than two standard deviations from the mean are
+ * rejected and drawn again from the next stream of the counter-based
+ * generator.
  */
 template <typename T = double>
 struct truncated_normal_generator_op {
     using value_type = T; ///< The value type
 
-    random_engine rand_engine;                         ///< The random engine
-    std::normal_distribution<value_type> distribution; ///< The used distribution
+    static constexpr bool thread_safe = true; ///< Indicates if the generator is thread safe or not
+
+    /*!
+     * \brief Indicates if the generator is vectorizable using the
+     * given vector mode
+     * \tparam V The vector mode
+     */
+    template <vector_mode_t V>
+    static constexpr bool vectorizable = false;
+
+    uint64_t key;    ///< The key of the counter-based generator
+    size_t current;  ///< The current index for sequential generation
+    T mean;          ///< The mean of the distribution
+    T stddev;        ///< The standard deviation of the distribution
 
     /*!
      * \brief Construct a new generator with the given mean and standard deviation
@@ -108,20 +182,31 @@ struct truncated_normal_generator_op {
      * \param stddev The standard deviation
      */
     truncated_normal_generator_op(T mean, T stddev)
-            : rand_engine(std::time(nullptr)), distribution(mean, stddev) {}
+            : key(detail::next_philox_key()), current(0), mean(mean), stddev(stddev) {}
 
     /*!
      * \brief Generate a new value
      * \return the newly generated value
      */
     value_type operator()() {
-        auto x = distribution(rand_engine);
+        return (*this)(current++);
+    }
 
-        while (std::abs(x - distribution.mean()) > 2.0 * distribution.stddev()) {
-            x = distribution(rand_engine);
+    /*!
+     * \brief Generate the value at the given index
+     * \param i The index of the value
+     * \return the value at the given index
+     */
+    value_type operator()(size_t i) const {
+        uint32_t stream = 0;
+
+        auto z = detail::philox_normal<T>(key, i, stream);
+
+        while (std::abs(z) > T(2)) {
+            z = detail::philox_normal<T>(key, i, ++stream);
         }
 
-        return x;
+        return mean + stddev * z;
     }
 
     /*!
@@ -143,6 +228,16 @@ template <typename G, typename T = double>
 struct truncated_normal_generator_g_op {
     using value_type = T; ///< The value type
 
+    static constexpr bool thread_safe = false; ///< Indicates if the generator is thread safe or not
+
+    /*!
+     * \brief Indicates if the generator is vectorizable using the
+     * given vector mode
+     * \tparam V The vector mode
+     */
+    template <vector_mode_t V>
+    static constexpr bool vectorizable = false;
+
     G& rand_engine;                                    ///< The random engine
     std::normal_distribution<value_type> distribution; ///< The used distribution
 
@@ -192,13 +287,35 @@ using uniform_distribution = std::conditional_t<
 
 /*!
  * \brief Generator from an uniform distribution
+ *
+ * The values are generated with the counter-based Philox generator.
+ * Each value only depends on its index, which makes the generator
+ * thread safe and vectorizable.
  */
 template <typename T = double>
 struct uniform_generator_op {
     using value_type = T; ///< The value type
 
-    random_engine rand_engine;                     ///< The random engine
-    uniform_distribution<value_type> distribution; ///< The used distribution
+    static constexpr bool thread_safe = true; ///< Indicates if the generator is thread safe or not
+
+    /*!
+     * \brief Indicates if the generator is vectorizable using the
+     * given vector mode
+     * \tparam V The vector mode
+     */
+    template <vector_mode_t V>
+    static constexpr bool vectorizable = detail::philox_vectorizable<V, T>;
+
+    /*!
+     * The vectorization type for V
+     */
+    template <typename V = default_vec>
+    using vec_type = typename V::template vec_type<T>;
+
+    uint64_t key;   ///< The key of the counter-based generator
+    size_t current; ///< The current index for sequential generation
+    T start;        ///< The beginning of the range
+    T end;          ///< The end of the range
 
     /*!
      * \brief Construct a new generator with the given start and end of the range
@@ -206,14 +323,35 @@ struct uniform_generator_op {
      * \param end The end of the range
      */
     uniform_generator_op(T start, T end)
-            : rand_engine(std::time(nullptr)), distribution(start, end) {}
+            : key(detail::next_philox_key()), current(0), start(start), end(end) {}
 
     /*!
      * \brief Generate a new value
      * \return the newly generated value
      */
     value_type operator()() {
-        return distribution(rand_engine);
+        return (*this)(current++);
+    }
+
+    /*!
+     * \brief Generate the value at the given index
+     * \param i The index of the value
+     * \return the value at the given index
+     */
+    value_type operator()(size_t i) const {
+        return detail::philox_uniform<T>(key, i, start, end);
+    }
+
+    /*!
+     * \brief Generate several values at once
+     * \param i The index of the first value
+     * \tparam V The vectorization mode
+     * \return a vector containing several generated values
+     */
+    template <typename V = default_vec>
+    vec_type<V> load(size_t i) const {
+        auto u = detail::philox_simd<V, T>::uniform(key, i);
+        return V::add(V::set(start), V::mul(V::set(end - start), u.first));
     }
 
     /*!
@@ -235,6 +373,16 @@ template <typename G, typename T = double>
 struct uniform_generator_g_op {
     using value_type = T; ///< The value type
 
+    static constexpr bool thread_safe = false; ///< Indicates if the generator is thread safe or not
+
+    /*!
+     * \brief Indicates if the generator is vectorizable using the
+     * given vector mode
+     * \tparam V The vector mode
+     */
+    template <vector_mode_t V>
+    static constexpr bool vectorizable = false;
+
     G& rand_engine;                                ///< The random engine
     uniform_distribution<value_type> distribution; ///< The used distribution
 
@@ -273,6 +421,16 @@ template <typename T = double>
 struct sequence_generator_op {
     using value_type = T; ///< The value type
 
+    static constexpr bool thread_safe = false; ///< Indicates if the generator is thread safe or not
+
+    /*!
+     * \brief Indicates if the generator is vectorizable using the
+     * given vector mode
+     * \tparam V The vector mode
+     */
+    template <vector_mode_t V>
+    static constexpr bool vectorizable = false;
+
     const value_type start; ///< The beginning of the sequence
     value_type current;     ///< The current sequence element
 
@@ -12,7 +12,6 @@
 //The transformers
 #include "etl/op/flip_transformers.hpp"
 #include "etl/op/rep_transformers.hpp"
-#include "etl/op/reduc_transformers.hpp"
 
 namespace etl {
 
@@ -9,50 +9,6 @@
 
 namespace etl {
 
-/*!
- * \brief Unary operation sampling with a Bernoulli distribution
- * \tparam T The type of value
- */
-template <typename T>
-struct bernoulli_unary_op {
-    static constexpr bool linear = true; ///< Indicates if the operator is linear
-    static constexpr bool thread_safe = false;  ///< Indicates if the operator is thread safe or not
-
-    /*!
-     * \brief Indicates if the expression is vectorizable using the
-     * given vector mode
-     * \tparam V The vector mode
-     */
-    template <vector_mode_t V>
-    static constexpr bool vectorizable = false;
-
-    /*!
-     * \brief Indicates if the operator can be computed on GPU
-     */
-    template <typename E>
-    static constexpr bool gpu_computable = false;
-
-    /*!
-     * \brief Apply the unary operator on x
-     * \param x The value on which to apply the operator
-     * \return The result of applying the unary operator on x
-     */
-    static T apply(const T& x) {
-        static random_engine rand_engine(std::time(nullptr));
-        static std::uniform_real_distribution<double> distribution(0.0, 1.0);
-
-        return x > distribution(rand_engine) ? 1.0 : 0.0;
-    }
-
-    /*!
-     * \brief Returns a textual representation of the operator
-     * \return a string representing the operator
-     */
-    static std::string desc() noexcept {
-        return "bernoulli";
-    }
-};
-
 /*!
  * \brief Unary operation sampling with a Bernoulli distribution
  * \tparam T The type of value
@@ -109,50 +65,6 @@ public:
     }
 };
 
-/*!
- * \brief Unary operation sampling with a reverse Bernoulli distribution
- * \tparam T The type of value
- */
-template <typename T>
-struct reverse_bernoulli_unary_op {
-    static constexpr bool linear = true; ///< Indicates if the operator is linear
-    static constexpr bool thread_safe = false;  ///< Indicates if the operator is thread safe or not
-
-    /*!
-     * \brief Indicates if the expression is vectorizable using the
-     * given vector mode
-     * \tparam V The vector mode
-     */
-    template <vector_mode_t V>
-    static constexpr bool vectorizable = false;
-
-    /*!
-     * \brief Indicates if the operator can be computed on GPU
-     */
-    template <typename E>
-    static constexpr bool gpu_computable = false;
-
-    /*!
-     * \brief Apply the unary operator on x
-     * \param x The value on which to apply the operator
-     * \return The result of applying the unary operator on x
-     */
-    static T apply(const T& x) {
-        static random_engine rand_engine(std::time(nullptr));
-        static std::uniform_real_distribution<double> distribution(0.0, 1.0);
-
-        return x > distribution(rand_engine) ? 0.0 : 1.0;
-    }
-
-    /*!
-     * \brief Returns a textual representation of the operator
-     * \return a string representing the operator
-     */
-    static std::string desc() noexcept {
-        return "bernoulli_reverse";
-    }
-};
-
 /*!
  * \brief Unary operation sampling with a reverse Bernoulli distribution
  * \tparam T The type of value
@@ -26,7 +26,7 @@ struct cos_unary_op {
      * \tparam V The vector mode
      */
     template <vector_mode_t V>
-    static constexpr bool vectorizable = (V == vector_mode_t::SSE3 || V == vector_mode_t::AVX) && is_single_precision_t<T>;
+    static constexpr bool vectorizable = (V == vector_mode_t::SSE3 || V == vector_mode_t::AVX || V == vector_mode_t::AVX512) && is_floating_t<T>;
 
     /*!
      * \brief Indicates if the operator can be computed on GPU
@@ -17,6 +17,12 @@ namespace etl {
  */
 template <typename T>
 struct cosh_unary_op {
+    /*!
+     * The vectorization type for V
+     */
+    template <typename V = default_vec>
+    using vec_type       = typename V::template vec_type<T>;
+
     static constexpr bool linear = true; ///< Indicates if the operator is linear
     static constexpr bool thread_safe = true;  ///< Indicates if the operator is thread safe or not
 
@@ -26,7 +32,7 @@ struct cosh_unary_op {
      * \tparam V The vector mode
      */
     template <vector_mode_t V>
-    static constexpr bool vectorizable = false;
+    static constexpr bool vectorizable = (V == vector_mode_t::SSE3 || V == vector_mode_t::AVX || V == vector_mode_t::AVX512) && is_floating_t<T>;
 
     /*!
      * \brief Indicates if the operator can be computed on GPU
@@ -47,6 +53,17 @@ struct cosh_unary_op {
         return std::cosh(x);
     }
 
+    /*!
+     * \brief Compute several applications of the operator at a time
+     * \param x The vector on which to operate
+     * \tparam V The vectorization mode
+     * \return a vector containing several results of the operator
+     */
+    template <typename V = default_vec>
+    static vec_type<V> load(const vec_type<V>& x) noexcept {
+        return V::cosh(x);
+    }
+
     /*!
      * \brief Compute the result of the operation using the GPU
      *
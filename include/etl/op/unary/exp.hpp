@@ -35,6 +35,7 @@ struct exp_unary_op {
     static constexpr bool vectorizable =
             (V == vector_mode_t::SSE3 && !is_complex_t<T>)
         ||  (V == vector_mode_t::AVX && !is_complex_t<T>)
+        ||  (V == vector_mode_t::AVX512 && is_floating_t<T>)
         ||  (intel_compiler && !is_complex_t<T>);
 
     /*!
@@ -9,50 +9,6 @@
 
 namespace etl {
 
-/*!
- * \brief Unary operation applying an uniform noise (0.0, 1.0(
- * \tparam T The type of value
- */
-template <typename T>
-struct uniform_noise_unary_op {
-    static constexpr bool linear = true; ///< Indicates if the operator is linear
-    static constexpr bool thread_safe = false;  ///< Indicates if the operator is thread safe or not
-
-    /*!
-     * \brief Indicates if the expression is vectorizable using the
-     * given vector mode
-     * \tparam V The vector mode
-     */
-    template <vector_mode_t V>
-    static constexpr bool vectorizable = false;
-
-    /*!
-     * \brief Indicates if the operator can be computed on GPU
-     */
-    template <typename E>
-    static constexpr bool gpu_computable = false;
-
-    /*!
-     * \brief Apply the unary operator on x
-     * \param x The value on which to apply the operator
-     * \return The result of applying the unary operator on x
-     */
-    static T apply(const T& x) {
-        static random_engine rand_engine(std::time(nullptr));
-        static std::uniform_real_distribution<double> real_distribution(0.0, 1.0);
-
-        return x + real_distribution(rand_engine);
-    }
-
-    /*!
-     * \brief Returns a textual representation of the operator
-     * \return a string representing the operator
-     */
-    static std::string desc() noexcept {
-        return "uniform_noise";
-    }
-};
-
 /*!
  * \brief Unary operation applying an uniform noise (0.0, 1.0(
  * \tparam T The type of value
@@ -109,50 +65,6 @@ public:
     }
 };
 
-/*!
- * \brief Unary operation applying a normal noise
- * \tparam T The type of value
- */
-template <typename T>
-struct normal_noise_unary_op {
-    static constexpr bool linear = true; ///< Indicates if the operator is linear
-    static constexpr bool thread_safe = false;  ///< Indicates if the operator is thread safe or not
-
-    /*!
-     * \brief Indicates if the expression is vectorizable using the
-     * given vector mode
-     * \tparam V The vector mode
-     */
-    template <vector_mode_t V>
-    static constexpr bool vectorizable = false;
-
-    /*!
-     * \brief Indicates if the operator can be computed on GPU
-     */
-    template <typename E>
-    static constexpr bool gpu_computable = false;
-
-    /*!
-     * \brief Apply the unary operator on x
-     * \param x The value on which to apply the operator
-     * \return The result of applying the unary operator on x
-     */
-    static T apply(const T& x) {
-        static random_engine rand_engine(std::time(nullptr));
-        static std::normal_distribution<double> normal_distribution(0.0, 1.0);
-
-        return x + normal_distribution(rand_engine);
-    }
-
-    /*!
-     * \brief Returns a textual representation of the operator
-     * \return a string representing the operator
-     */
-    static std::string desc() noexcept {
-        return "normal_noise";
-    }
-};
-
 /*!
  * \brief Unary operation applying a normal noise
  * \tparam T The type of value
@@ -209,51 +121,6 @@ public:
     }
 };
 
-/*!
- * \brief Unary operation applying a logistic noise
- * \tparam T The type of value
- */
-template <typename T>
-struct logistic_noise_unary_op {
-    static constexpr bool linear = true; ///< Indicates if the operator is linear
-    static constexpr bool thread_safe = false;  ///< Indicates if the operator is thread safe or not
-
-    /*!
-     * \brief Indicates if the expression is vectorizable using the
-     * given vector mode
-     * \tparam V The vector mode
-     */
-    template <vector_mode_t V>
-    static constexpr bool vectorizable = false;
-
-    /*!
-     * \brief Indicates if the operator can be computed on GPU
-     */
-    template <typename E>
-    static constexpr bool gpu_computable = false;
-
-    /*!
-     * \brief Apply the unary operator on x
-     * \param x The value on which to apply the operator
-     * \return The result of applying the unary operator on x
-     */
-    static T apply(const T& x) {
-        static random_engine rand_engine(std::time(nullptr));
-
-        std::normal_distribution<double> noise_distribution(0.0, math::logistic_sigmoid(x));
-
-        return x + noise_distribution(rand_engine);
-    }
-
-    /*!
-     * \brief Returns a textual representation of the operator
-     * \return a string representing the operator
-     */
-    static std::string desc() noexcept {
-        return "logistic_noise";
-    }
-};
-
 /*!
  * \brief Unary operation applying a logistic noise
  * \tparam T The type of value
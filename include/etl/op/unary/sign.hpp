@@ -26,7 +26,15 @@ struct sign_unary_op {
      * \tparam V The vector mode
      */
     template <vector_mode_t V>
-    static constexpr bool vectorizable = false;
+    static constexpr bool vectorizable =
+            (V == vector_mode_t::SSE3 || V == vector_mode_t::AVX || V == vector_mode_t::AVX512)
+        &&  is_floating_t<T>;
+
+    /*!
+     * The vectorization type for V
+     */
+    template <typename V = default_vec>
+    using vec_type       = typename V::template vec_type<T>;
 
     /*!
      * \brief Indicates if the operator can be computed on GPU
@@ -48,6 +56,21 @@ struct sign_unary_op {
         return math::sign(x);
     }
 
+    /*!
+     * \brief Compute several applications of the operator at a time
+     * \param x The vector on which to operate
+     * \tparam V The vectorization mode
+     * \return a vector containing several results of the operator
+     */
+    template <typename V = default_vec>
+    static ETL_STRONG_INLINE(vec_type<V>) load(const vec_type<V>& x) noexcept {
+        auto zero = V::template zero<T>();
+        auto one  = V::set(T(1));
+
+        // NaN are neither greater nor equal to zero and give -1 like math::sign
+        return V::select(V::greater(x, zero), one, V::select(V::equal(x, zero), zero, V::minus(one)));
+    }
+
     /*!
      * \brief Compute the result of the operation using the GPU
      *
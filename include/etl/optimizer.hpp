@@ -166,18 +166,20 @@ struct optimizable<etl::binary_expr<T, LeftExpr, BinaryOp, etl::scalar<T>>> {
 /*!
  * \copydoc optimizable
  *
- * Specialization for general binary_expr
+ * Specialization for general binary_expr. The expression is optimizable
+ * if both sides share a common sub expression. The sub expressions are
+ * optimized first.
  */
 template <typename T, typename LeftExpr, typename BinaryOp, typename RightExpr>
 struct optimizable<etl::binary_expr<T, LeftExpr, BinaryOp, RightExpr>> {
     /*! \copydoc optimizable::is */
-    static bool is(const etl::binary_expr<T, LeftExpr, BinaryOp, RightExpr>& /*unused*/) {
-        return false;
+    static bool is(const etl::binary_expr<T, LeftExpr, BinaryOp, RightExpr>& expr) {
+        return !is_optimizable_deep(expr.lhs) && !is_optimizable_deep(expr.rhs) && cse_traits<etl::binary_expr<T, LeftExpr, BinaryOp, RightExpr>>::is(expr);
     }
 
     /*! \copydoc optimizable::is_deep */
     static bool is_deep(const etl::binary_expr<T, LeftExpr, BinaryOp, RightExpr>& expr) {
-        return is_optimizable_deep(expr.lhs) || is_optimizable_deep(expr.rhs);
+        return is_optimizable_deep(expr.lhs) || is_optimizable_deep(expr.rhs) || is(expr);
     }
 };
 
@@ -346,6 +348,25 @@ struct transformer<etl::binary_expr<T, LeftExpr, BinaryOp, etl::scalar<T>>> {
     }
 };
 
+/*!
+ * \copydoc transformer
+ *
+ * Specialization for general binary_expr, eliminating the common sub
+ * expression of both sides
+ */
+template <typename T, typename LeftExpr, typename BinaryOp, typename RightExpr>
+struct transformer<etl::binary_expr<T, LeftExpr, BinaryOp, RightExpr>> {
+    /*!
+     * \brief Transform the expression using the given builder
+     * \param parent_builder The builder to use
+     * \param expr The expression to transform
+     */
+    template <typename Builder>
+    static void transform(Builder parent_builder, const etl::binary_expr<T, LeftExpr, BinaryOp, RightExpr>& expr) {
+        cse_traits<etl::binary_expr<T, LeftExpr, BinaryOp, RightExpr>>::transform(parent_builder, expr);
+    }
+};
+
 /*!
  * \brief Function to transform the expression into its optimized form
  * \param parent_builder The builder of its parent node
@@ -0,0 +1,599 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file philox.hpp
+ * \brief Counter-based Philox4x32-10 random number generation.
+ *
+ * Contrary to the standard random engines, a counter-based generator
+ * does not have any sequential state: the random numbers of the
+ * element i only depend on the key of the generator and on i. The
+ * elements can therefore be generated in any order, in parallel and
+ * several at once in vector registers and a key always produces the
+ * same stream of numbers, regardless of the number of threads.
+ *
+ * The implementation follows "Parallel Random Numbers: As Easy as 1,
+ * 2, 3" (Salmon et al., 2011).
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <ctime>
+#include <utility>
+
+namespace etl {
+
+namespace detail {
+
+constexpr uint32_t philox_m0     = 0xD2511F53; ///< The first Philox multiplier
+constexpr uint32_t philox_m1     = 0xCD9E8D57; ///< The second Philox multiplier
+constexpr uint32_t philox_w0     = 0x9E3779B9; ///< The first Weyl increment of the key
+constexpr uint32_t philox_w1     = 0xBB67AE85; ///< The second Weyl increment of the key
+constexpr size_t philox_rounds   = 10;         ///< The number of Philox rounds
+
+constexpr float philox_float_scale   = 1.0f / 8388608.0f;         ///< 2^-23
+constexpr double philox_double_high  = 67108864.0;                ///< 2^26
+constexpr double philox_double_scale = 1.0 / 4503599627370496.0;  ///< 2^-52
+constexpr double philox_two_pi       = 6.283185307179586476925;   ///< 2 * pi
+
+/*!
+ * \brief Return the sequence of seeds used by the counter-based generators
+ */
+inline std::atomic<uint64_t>& philox_seed_sequence() {
+    static std::atomic<uint64_t> seed(static_cast<uint64_t>(std::time(nullptr)));
+    return seed;
+}
+
+/*!
+ * \brief Compute the key for the next counter-based generator.
+ *
+ * Each generator takes the next seed of the sequence and the seed
+ * is mixed so that close seeds give unrelated keys.
+ *
+ * \return a new key
+ */
+inline uint64_t next_philox_key() {
+    uint64_t z = philox_seed_sequence()++ + 0x9E3779B97F4A7C15ULL;
+
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+
+    return z ^ (z >> 31);
+}
+
+} //end of namespace detail
+
+/*!
+ * \brief Seed the counter-based random generators.
+ *
+ * The generators created after this call (uniform_generator,
+ * normal_generator, the noise and the bernoulli expressions) use keys
+ * derived from this seed, in order of construction. This makes the
+ * generated values reproducible.
+ *
+ * \param seed The new seed
+ */
+inline void seed_generators(uint64_t seed) {
+    detail::philox_seed_sequence() = seed;
+}
+
+/*!
+ * \brief The four words generated by one block of Philox4x32
+ */
+using philox_words = std::array<uint32_t, 4>;
+
+/*!
+ * \brief Compute one block of Philox4x32-10
+ * \param counter The counter, the index of the element
+ * \param stream The stream, the third word of the counter
+ * \param key The key of the generator
+ * \return the four random words of the block
+ */
+inline philox_words philox4x32(uint64_t counter, uint32_t stream, uint64_t key) {
+    uint32_t c0 = uint32_t(counter);
+    uint32_t c1 = uint32_t(counter >> 32);
+    uint32_t c2 = stream;
+    uint32_t c3 = 0;
+
+    uint32_t k0 = uint32_t(key);
+    uint32_t k1 = uint32_t(key >> 32);
+
+    for (size_t r = 0; r < detail::philox_rounds; ++r) {
+        if (r) {
+            k0 += detail::philox_w0;
+            k1 += detail::philox_w1;
+        }
+
+        const uint64_t p0 = uint64_t(detail::philox_m0) * c0;
+        const uint64_t p1 = uint64_t(detail::philox_m1) * c2;
+
+        c0 = uint32_t(p1 >> 32) ^ c1 ^ k0;
+        c1 = uint32_t(p1);
+        c2 = uint32_t(p0 >> 32) ^ c3 ^ k1;
+        c3 = uint32_t(p0);
+    }
+
+    return {{c0, c1, c2, c3}};
+}
+
+namespace detail {
+
+/*!
+ * \brief Convert random words to a floating point number in the
+ * open interval (0, 1).
+ *
+ * Single-precision numbers use the 23 high bits of the first word and
+ * double-precision numbers 26 bits of each word. The vectorized
+ * conversions compute exactly the same values.
+ *
+ * \param a The first random word
+ * \param b The second random word
+ * \return a floating point number in (0, 1)
+ */
+template <typename T>
+T philox_to_uniform(uint32_t a, uint32_t b);
+
+/*!
+ * \copydoc philox_to_uniform
+ */
+template <>
+inline float philox_to_uniform<float>(uint32_t a, uint32_t b) {
+    cpp_unused(b);
+    return (float(a >> 9) + 0.5f) * philox_float_scale;
+}
+
+/*!
+ * \copydoc philox_to_uniform
+ */
+template <>
+inline double philox_to_uniform<double>(uint32_t a, uint32_t b) {
+    return (double(a >> 6) * philox_double_high + double(b >> 6) + 0.5) * philox_double_scale;
+}
+
+/*!
+ * \brief Generate the uniform number of the element i
+ * \param key The key of the generator
+ * \param i The index of the element
+ * \param start The beginning of the range
+ * \param end The end of the range
+ * \return a floating point number uniformly distributed in [start, end)
+ */
+template <typename T, cpp_enable_iff(std::is_floating_point<T>::value)>
+T philox_uniform(uint64_t key, size_t i, T start, T end) {
+    auto w = philox4x32(i, 0, key);
+    return start + (end - start) * philox_to_uniform<T>(w[0], w[1]);
+}
+
+/*!
+ * \brief Generate the uniform number of the element i
+ * \param key The key of the generator
+ * \param i The index of the element
+ * \param start The beginning of the range
+ * \param end The end of the range
+ * \return an integer uniformly distributed in [start, end]
+ */
+template <typename T, cpp_enable_iff(!std::is_floating_point<T>::value)>
+T philox_uniform(uint64_t key, size_t i, T start, T end) {
+    auto w = philox4x32(i, 0, key);
+
+    const uint64_t range = uint64_t(end - start) + 1;
+    const uint64_t r     = (uint64_t(w[1]) << 32) | w[0];
+
+    // With a 64-bit range, the modulo bias is negligible
+    return start + T(range ? r % range : r);
+}
+
+/*!
+ * \brief Generate the normal number of the element i with the
+ * Box-Muller transform
+ * \param key The key of the generator
+ * \param i The index of the element
+ * \param stream The stream of the element
+ * \return a number drawn from N(0, 1)
+ */
+template <typename T>
+T philox_normal(uint64_t key, size_t i, uint32_t stream = 0) {
+    auto w = philox4x32(i, stream, key);
+
+    const T u1 = philox_to_uniform<T>(w[0], w[1]);
+    const T u2 = philox_to_uniform<T>(w[2], w[3]);
+
+    return std::sqrt(T(-2) * std::log(u1)) * std::cos(T(philox_two_pi) * u2);
+}
+
+/*!
+ * \brief Vectorized Philox generation of uniform numbers for the
+ * given vector implementation and type.
+ *
+ * The lane j of the vectors generated at position i contains the
+ * numbers of the element i + j, exactly as the scalar generation.
+ *
+ * \tparam V The vector implementation
+ * \tparam T The type of the generated numbers
+ */
+template <typename V, typename T>
+struct philox_simd {
+    static constexpr bool available = false; ///< Indicates if the vectorized generation is available
+};
+
+#ifdef __SSE2__
+
+/*!
+ * \brief Integer operations used by the vectorized Philox rounds
+ * \tparam I The integer vector type
+ */
+template <typename I>
+struct philox_ops;
+
+/*!
+ * \brief Integer operations on SSE registers
+ */
+template <>
+struct philox_ops<__m128i> {
+    static constexpr size_t size = 4; ///< The number of 32-bit lanes
+
+    ETL_STATIC_INLINE(__m128i) set1(uint32_t v) { return _mm_set1_epi32(int32_t(v)); }
+    ETL_STATIC_INLINE(__m128i) lanes() { return _mm_setr_epi32(0, 1, 2, 3); }
+    ETL_STATIC_INLINE(__m128i) loadu(const uint32_t* m) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(m)); }
+    ETL_STATIC_INLINE(__m128i) low_mask() { return _mm_set1_epi64x(0xFFFFFFFFLL); }
+    ETL_STATIC_INLINE(__m128i) add(__m128i a, __m128i b) { return _mm_add_epi32(a, b); }
+    ETL_STATIC_INLINE(__m128i) bxor(__m128i a, __m128i b) { return _mm_xor_si128(a, b); }
+    ETL_STATIC_INLINE(__m128i) band(__m128i a, __m128i b) { return _mm_and_si128(a, b); }
+    ETL_STATIC_INLINE(__m128i) bandnot(__m128i a, __m128i b) { return _mm_andnot_si128(a, b); }
+    ETL_STATIC_INLINE(__m128i) bor(__m128i a, __m128i b) { return _mm_or_si128(a, b); }
+    ETL_STATIC_INLINE(__m128i) mul(__m128i a, __m128i b) { return _mm_mul_epu32(a, b); }
+    ETL_STATIC_INLINE(__m128i) srli64(__m128i a) { return _mm_srli_epi64(a, 32); }
+    ETL_STATIC_INLINE(__m128i) slli64(__m128i a) { return _mm_slli_epi64(a, 32); }
+};
+
+#endif //__SSE2__
+
+#ifdef __AVX2__
+
+/*!
+ * \brief Integer operations on AVX registers
+ */
+template <>
+struct philox_ops<__m256i> {
+    static constexpr size_t size = 8; ///< The number of 32-bit lanes
+
+    ETL_STATIC_INLINE(__m256i) set1(uint32_t v) { return _mm256_set1_epi32(int32_t(v)); }
+    ETL_STATIC_INLINE(__m256i) lanes() { return _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7); }
+    ETL_STATIC_INLINE(__m256i) loadu(const uint32_t* m) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(m)); }
+    ETL_STATIC_INLINE(__m256i) low_mask() { return _mm256_set1_epi64x(0xFFFFFFFFLL); }
+    ETL_STATIC_INLINE(__m256i) add(__m256i a, __m256i b) { return _mm256_add_epi32(a, b); }
+    ETL_STATIC_INLINE(__m256i) bxor(__m256i a, __m256i b) { return _mm256_xor_si256(a, b); }
+    ETL_STATIC_INLINE(__m256i) band(__m256i a, __m256i b) { return _mm256_and_si256(a, b); }
+    ETL_STATIC_INLINE(__m256i) bandnot(__m256i a, __m256i b) { return _mm256_andnot_si256(a, b); }
+    ETL_STATIC_INLINE(__m256i) bor(__m256i a, __m256i b) { return _mm256_or_si256(a, b); }
+    ETL_STATIC_INLINE(__m256i) mul(__m256i a, __m256i b) { return _mm256_mul_epu32(a, b); }
+    ETL_STATIC_INLINE(__m256i) srli64(__m256i a) { return _mm256_srli_epi64(a, 32); }
+    ETL_STATIC_INLINE(__m256i) slli64(__m256i a) { return _mm256_slli_epi64(a, 32); }
+};
+
+#endif //__AVX2__
+
+#ifdef __AVX512F__
+
+/*!
+ * \brief Integer operations on AVX-512 registers
+ */
+template <>
+struct philox_ops<__m512i> {
+    static constexpr size_t size = 16; ///< The number of 32-bit lanes
+
+    ETL_STATIC_INLINE(__m512i) set1(uint32_t v) { return _mm512_set1_epi32(int32_t(v)); }
+    ETL_STATIC_INLINE(__m512i) lanes() { return _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15); }
+    ETL_STATIC_INLINE(__m512i) loadu(const uint32_t* m) { return _mm512_loadu_si512(m); }
+    ETL_STATIC_INLINE(__m512i) low_mask() { return _mm512_set1_epi64(0xFFFFFFFFLL); }
+    ETL_STATIC_INLINE(__m512i) add(__m512i a, __m512i b) { return _mm512_add_epi32(a, b); }
+    ETL_STATIC_INLINE(__m512i) bxor(__m512i a, __m512i b) { return _mm512_xor_si512(a, b); }
+    ETL_STATIC_INLINE(__m512i) band(__m512i a, __m512i b) { return _mm512_and_si512(a, b); }
+    ETL_STATIC_INLINE(__m512i) bandnot(__m512i a, __m512i b) { return _mm512_andnot_si512(a, b); }
+    ETL_STATIC_INLINE(__m512i) bor(__m512i a, __m512i b) { return _mm512_or_si512(a, b); }
+    ETL_STATIC_INLINE(__m512i) mul(__m512i a, __m512i b) { return _mm512_mul_epu32(a, b); }
+    ETL_STATIC_INLINE(__m512i) srli64(__m512i a) { return _mm512_srli_epi64(a, 32); }
+    ETL_STATIC_INLINE(__m512i) slli64(__m512i a) { return _mm512_slli_epi64(a, 32); }
+};
+
+#endif //__AVX512F__
+
+#ifdef __SSE2__
+
+/*!
+ * \brief Compute several blocks of Philox4x32-10 at once, one per lane.
+ *
+ * The 32x32 -> 64 multiplications only exist for the even lanes, the
+ * odd lanes are multiplied separately after a shift and the high and
+ * low halves of the products are then merged back.
+ *
+ * \param first The counter of the first lane
+ * \param stream The stream
+ * \param key The key of the generator
+ * \param w The four vectors of random words
+ */
+template <typename I>
+inline void philox4x32_simd(size_t first, uint32_t stream, uint64_t key, I (&w)[4]) {
+    using ops = philox_ops<I>;
+
+    I c0 = ops::add(ops::set1(uint32_t(first)), ops::lanes());
+    I c1 = ops::set1(uint32_t(uint64_t(first) >> 32));
+    I c2 = ops::set1(stream);
+    I c3 = ops::set1(0);
+
+    // The low word of the counter overflows inside the vector
+    if (uint32_t(first) > 0xFFFFFFFFU - ops::size) {
+        alignas(64) uint32_t high[ops::size];
+
+        for (size_t l = 0; l < ops::size; ++l) {
+            high[l] = uint32_t((uint64_t(first) + l) >> 32);
+        }
+
+        c1 = ops::loadu(high);
+    }
+
+    const I m0   = ops::set1(philox_m0);
+    const I m1   = ops::set1(philox_m1);
+    const I mask = ops::low_mask();
+
+    uint32_t k0 = uint32_t(key);
+    uint32_t k1 = uint32_t(key >> 32);
+
+    for (size_t r = 0; r < philox_rounds; ++r) {
+        if (r) {
+            k0 += philox_w0;
+            k1 += philox_w1;
+        }
+
+        const I p0e = ops::mul(c0, m0);
+        const I p0o = ops::mul(ops::srli64(c0), m0);
+        const I p1e = ops::mul(c2, m1);
+        const I p1o = ops::mul(ops::srli64(c2), m1);
+
+        const I hi0 = ops::bor(ops::srli64(p0e), ops::bandnot(mask, p0o));
+        const I lo0 = ops::bor(ops::band(p0e, mask), ops::slli64(p0o));
+        const I hi1 = ops::bor(ops::srli64(p1e), ops::bandnot(mask, p1o));
+        const I lo1 = ops::bor(ops::band(p1e, mask), ops::slli64(p1o));
+
+        c0 = ops::bxor(ops::bxor(hi1, c1), ops::set1(k0));
+        c1 = lo1;
+        c2 = ops::bxor(ops::bxor(hi0, c3), ops::set1(k1));
+        c3 = lo0;
+    }
+
+    w[0] = c0;
+    w[1] = c1;
+    w[2] = c2;
+    w[3] = c3;
+}
+
+/*!
+ * \brief Convert random words to single-precision numbers in (0, 1)
+ * \param a The random words
+ * \return a vector of uniform numbers
+ */
+ETL_STATIC_INLINE(__m128) philox_to_uniform_ps(__m128i a) {
+    auto x = _mm_cvtepi32_ps(_mm_srli_epi32(a, 9));
+    return _mm_mul_ps(_mm_add_ps(x, _mm_set1_ps(0.5f)), _mm_set1_ps(philox_float_scale));
+}
+
+/*!
+ * \brief Convert the two first lanes of random words to
+ * double-precision numbers in (0, 1)
+ * \param a The first random words
+ * \param b The second random words
+ * \return a vector of uniform numbers
+ */
+ETL_STATIC_INLINE(__m128d) philox_to_uniform_pd(__m128i a, __m128i b) {
+    auto h = _mm_cvtepi32_pd(_mm_srli_epi32(a, 6));
+    auto l = _mm_cvtepi32_pd(_mm_srli_epi32(b, 6));
+    auto x = _mm_add_pd(_mm_add_pd(_mm_mul_pd(h, _mm_set1_pd(philox_double_high)), l), _mm_set1_pd(0.5));
+    return _mm_mul_pd(x, _mm_set1_pd(philox_double_scale));
+}
+
+#endif //__SSE2__
+
+#ifdef __SSE3__
+
+/*!
+ * \brief Vectorized Philox generation of single-precision numbers with SSE
+ */
+template <>
+struct philox_simd<sse_vec, float> {
+    static constexpr bool available = true; ///< Indicates if the vectorized generation is available
+
+    /*!
+     * \brief Generate two vectors of uniform numbers in (0, 1)
+     * \param key The key of the generator
+     * \param i The index of the first element
+     * \return a pair of vectors of uniform numbers
+     */
+    static std::pair<sse_simd_float, sse_simd_float> uniform(uint64_t key, size_t i) {
+        __m128i w[4];
+        philox4x32_simd(i, 0, key, w);
+
+        return {philox_to_uniform_ps(w[0]), philox_to_uniform_ps(w[2])};
+    }
+};
+
+/*!
+ * \brief Vectorized Philox generation of double-precision numbers with SSE
+ */
+template <>
+struct philox_simd<sse_vec, double> {
+    static constexpr bool available = true; ///< Indicates if the vectorized generation is available
+
+    /*!
+     * \copydoc philox_simd<sse_vec, float>::uniform
+     */
+    static std::pair<sse_simd_double, sse_simd_double> uniform(uint64_t key, size_t i) {
+        __m128i w[4];
+        philox4x32_simd(i, 0, key, w);
+
+        return {philox_to_uniform_pd(w[0], w[1]), philox_to_uniform_pd(w[2], w[3])};
+    }
+};
+
+#endif //__SSE3__
+
+#ifdef __AVX__
+
+/*!
+ * \brief Vectorized Philox generation of single-precision numbers with AVX
+ */
+template <>
+struct philox_simd<avx_vec, float> {
+    static constexpr bool available = true; ///< Indicates if the vectorized generation is available
+
+    /*!
+     * \copydoc philox_simd<sse_vec, float>::uniform
+     */
+    static std::pair<avx_simd_float, avx_simd_float> uniform(uint64_t key, size_t i) {
+#ifdef __AVX2__
+        __m256i w[4];
+        philox4x32_simd(i, 0, key, w);
+
+        auto scale = _mm256_set1_ps(philox_float_scale);
+        auto half  = _mm256_set1_ps(0.5f);
+
+        auto u1 = _mm256_mul_ps(_mm256_add_ps(_mm256_cvtepi32_ps(_mm256_srli_epi32(w[0], 9)), half), scale);
+        auto u2 = _mm256_mul_ps(_mm256_add_ps(_mm256_cvtepi32_ps(_mm256_srli_epi32(w[2], 9)), half), scale);
+
+        return {u1, u2};
+#else
+        // Without AVX2, there are no 256-bit integer operations
+        __m128i wl[4];
+        __m128i wh[4];
+        philox4x32_simd(i, 0, key, wl);
+        philox4x32_simd(i + 4, 0, key, wh);
+
+        auto u1 = _mm256_insertf128_ps(_mm256_castps128_ps256(philox_to_uniform_ps(wl[0])), philox_to_uniform_ps(wh[0]), 1);
+        auto u2 = _mm256_insertf128_ps(_mm256_castps128_ps256(philox_to_uniform_ps(wl[2])), philox_to_uniform_ps(wh[2]), 1);
+
+        return {u1, u2};
+#endif
+    }
+};
+
+/*!
+ * \brief Vectorized Philox generation of double-precision numbers with AVX
+ */
+template <>
+struct philox_simd<avx_vec, double> {
+    static constexpr bool available = true; ///< Indicates if the vectorized generation is available
+
+    /*!
+     * \copydoc philox_simd<sse_vec, float>::uniform
+     */
+    static std::pair<avx_simd_double, avx_simd_double> uniform(uint64_t key, size_t i) {
+        __m128i w[4];
+        philox4x32_simd(i, 0, key, w);
+
+        auto high  = _mm256_set1_pd(philox_double_high);
+        auto half  = _mm256_set1_pd(0.5);
+        auto scale = _mm256_set1_pd(philox_double_scale);
+
+        auto h1 = _mm256_cvtepi32_pd(_mm_srli_epi32(w[0], 6));
+        auto l1 = _mm256_cvtepi32_pd(_mm_srli_epi32(w[1], 6));
+        auto h2 = _mm256_cvtepi32_pd(_mm_srli_epi32(w[2], 6));
+        auto l2 = _mm256_cvtepi32_pd(_mm_srli_epi32(w[3], 6));
+
+        auto u1 = _mm256_mul_pd(_mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(h1, high), l1), half), scale);
+        auto u2 = _mm256_mul_pd(_mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(h2, high), l2), half), scale);
+
+        return {u1, u2};
+    }
+};
+
+#endif //__AVX__
+
+#ifdef __AVX512F__
+
+/*!
+ * \brief Vectorized Philox generation of single-precision numbers with AVX-512
+ */
+template <>
+struct philox_simd<avx512_vec, float> {
+    static constexpr bool available = true; ///< Indicates if the vectorized generation is available
+
+    /*!
+     * \copydoc philox_simd<sse_vec, float>::uniform
+     */
+    static std::pair<__m512, __m512> uniform(uint64_t key, size_t i) {
+        __m512i w[4];
+        philox4x32_simd(i, 0, key, w);
+
+        auto scale = _mm512_set1_ps(philox_float_scale);
+        auto half  = _mm512_set1_ps(0.5f);
+
+        auto u1 = _mm512_mul_ps(_mm512_add_ps(_mm512_cvtepi32_ps(_mm512_srli_epi32(w[0], 9)), half), scale);
+        auto u2 = _mm512_mul_ps(_mm512_add_ps(_mm512_cvtepi32_ps(_mm512_srli_epi32(w[2], 9)), half), scale);
+
+        return {u1, u2};
+    }
+};
+
+/*!
+ * \brief Vectorized Philox generation of double-precision numbers with AVX-512
+ */
+template <>
+struct philox_simd<avx512_vec, double> {
+    static constexpr bool available = true; ///< Indicates if the vectorized generation is available
+
+    /*!
+     * \copydoc philox_simd<sse_vec, float>::uniform
+     */
+    static std::pair<__m512d, __m512d> uniform(uint64_t key, size_t i) {
+        __m256i w[4];
+        philox4x32_simd(i, 0, key, w);
+
+        auto high  = _mm512_set1_pd(philox_double_high);
+        auto half  = _mm512_set1_pd(0.5);
+        auto scale = _mm512_set1_pd(philox_double_scale);
+
+        auto h1 = _mm512_cvtepi32_pd(_mm256_srli_epi32(w[0], 6));
+        auto l1 = _mm512_cvtepi32_pd(_mm256_srli_epi32(w[1], 6));
+        auto h2 = _mm512_cvtepi32_pd(_mm256_srli_epi32(w[2], 6));
+        auto l2 = _mm512_cvtepi32_pd(_mm256_srli_epi32(w[3], 6));
+
+        auto u1 = _mm512_mul_pd(_mm512_add_pd(_mm512_add_pd(_mm512_mul_pd(h1, high), l1), half), scale);
+        auto u2 = _mm512_mul_pd(_mm512_add_pd(_mm512_add_pd(_mm512_mul_pd(h2, high), l2), half), scale);
+
+        return {u1, u2};
+    }
+};
+
+#endif //__AVX512F__
+
+/*!
+ * \brief Traits indicating if the vectorized Philox generation is
+ * available for the given vector mode and type
+ * \tparam V The vector mode
+ * \tparam T The type of the generated numbers
+ */
+template <vector_mode_t V, typename T>
+constexpr bool philox_vectorizable = philox_simd<typename get_vector_impl<V>::type, T>::available;
+
+/*!
+ * \brief Vectorized Box-Muller transform
+ * \param u1 The first vector of uniform numbers in (0, 1)
+ * \param u2 The second vector of uniform numbers in (0, 1)
+ * \tparam V The vector implementation
+ * \return a vector of numbers drawn from N(0, 1)
+ */
+template <typename V, typename T, typename VT>
+inline VT box_muller(VT u1, VT u2) {
+    auto r = V::sqrt(V::mul(V::set(T(-2)), V::log(u1)));
+    return V::mul(r, V::cos(V::mul(V::set(T(philox_two_pi)), u2)));
+}
+
+} //end of namespace detail
+
+} //end of namespace etl
@@ -19,8 +19,9 @@ namespace etl {
  * pooling
  */
 enum class pool_impl {
-    STD,  ///< Standard implementation
-    CUDNN ///< CUDNN (GPU) implementation
+    STD,   ///< Standard implementation
+    VEC,   ///< Vectorized implementation (NHWC only)
+    CUDNN  ///< CUDNN (GPU) implementation
 };
 
 } //end of namespace etl
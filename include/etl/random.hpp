@@ -14,6 +14,8 @@
 
 #include <random>
 
+#include "etl/philox.hpp"
+
 namespace etl {
 
 /*!
@@ -0,0 +1,235 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Row-sparse matrix, used for the gradients of the embeddings.
+ *
+ * Only the rows of the vocabulary touched by a batch are stored, in a
+ * dense block, so that neither computing nor applying the gradients
+ * depends on the size of the vocabulary.
+ */
+
+#pragma once
+
+#include "etl/impl/std/embedding.hpp"
+
+namespace etl {
+
+/*!
+ * \brief A matrix of which only some rows are non-zero.
+ *
+ * The non-zero rows are stored in a dense matrix, along with their row
+ * indices, in increasing order.
+ *
+ * \tparam T The value type
+ */
+template <typename T>
+struct sparse_rows {
+    using value_type = T; ///< The value type
+
+    /*!
+     * \brief Construct an empty row-sparse matrix of the given dimensions
+     * \param n The number of rows of the matrix
+     * \param m The number of columns of the matrix
+     */
+    sparse_rows(size_t n, size_t m) : n(n), m(m), _values(0, m) {
+        //Nothing else to init
+    }
+
+    /*!
+     * \brief Returns the number of rows of the matrix
+     */
+    size_t rows() const {
+        return n;
+    }
+
+    /*!
+     * \brief Returns the number of columns of the matrix
+     */
+    size_t columns() const {
+        return m;
+    }
+
+    /*!
+     * \brief Returns the number of non-zero rows of the matrix
+     */
+    size_t non_zero_rows() const {
+        return _indices.size();
+    }
+
+    /*!
+     * \brief Returns the indices of the non-zero rows, in increasing order
+     */
+    const std::vector<size_t>& indices() const {
+        return _indices;
+    }
+
+    /*!
+     * \brief Returns the values of the non-zero rows, the kth row being
+     * the row indices()[k] of the matrix
+     */
+    dyn_matrix<T, 2>& values() {
+        return _values;
+    }
+
+    /*!
+     * \copydoc values
+     */
+    const dyn_matrix<T, 2>& values() const {
+        return _values;
+    }
+
+    /*!
+     * \brief Add alpha times this matrix to the given dense matrix.
+     *
+     * Only the non-zero rows of w are touched, each by a single thread.
+     *
+     * \param w The dense matrix
+     * \param alpha The factor
+     */
+    template <typename W>
+    void add_to(W&& w, T alpha = T(1)) const {
+        static_assert(is_dma<W> && decay_traits<W>::dimensions() == 2, "sparse_rows can only be added to 2D matrices with direct memory access");
+        static_assert(std::is_same<value_t<W>, T>::value, "sparse_rows can only be added to matrices of the same type");
+        static_assert(is_row_major<W>, "sparse_rows can only be added to row-major matrices");
+
+        cpp_assert(etl::dim<0>(w) == n && etl::dim<1>(w) == m, "Invalid dimensions for sparse_rows::add_to");
+
+        w.ensure_cpu_up_to_date();
+
+        auto* wm       = w.memory_start();
+        const auto* vm = _values.memory_start();
+
+        auto batch_fun = [&](const size_t first, const size_t last) {
+            for (size_t k = first; k < last; ++k) {
+                T* row         = wm + _indices[k] * m;
+                const T* value = vm + k * m;
+
+                for (size_t j = 0; j < m; ++j) {
+                    row[j] += alpha * value[j];
+                }
+            }
+        };
+
+        engine_dispatch_1d(batch_fun, 0, _indices.size(), engine_select_parallel(etl::size(_values), parallel_threshold));
+
+        w.validate_cpu();
+        w.invalidate_gpu();
+    }
+
+    /*!
+     * \brief Assign this matrix to the given dense matrix
+     * \param w The dense matrix
+     */
+    template <typename W>
+    void assign_to(W&& w) const {
+        w = T(0);
+        add_to(w);
+    }
+
+    /*!
+     * \brief Reset the matrix from the buckets of an input sequence and
+     * the errors of each position of the sequence
+     * \param buckets The buckets of the input sequence
+     * \param b The errors
+     */
+    template <typename B>
+    void accumulate(impl::standard::embedding_buckets&& buckets, const B& b) {
+        static_assert(is_row_major<B>, "sparse_rows can only accumulate row-major errors");
+
+        _values.resize(buckets.rows.size(), m);
+
+        b.ensure_cpu_up_to_date();
+
+        impl::standard::embedding_accumulate<true>(buckets, b, m, _values.memory_start());
+
+        _values.validate_cpu();
+        _values.invalidate_gpu();
+
+        _indices = std::move(buckets.rows);
+    }
+
+private:
+    size_t n;                     ///< The number of rows
+    size_t m;                     ///< The number of columns
+    std::vector<size_t> _indices; ///< The indices of the non-zero rows
+    dyn_matrix<T, 2> _values;     ///< The values of the non-zero rows
+};
+
+/*!
+ * \brief Returns the gradients of the embeddings as a row-sparse matrix,
+ * containing only the rows of the vocabulary present in the sequence.
+ *
+ * This is the same as embedding_gradients(value, errors, vocab), without
+ * clearing nor storing the rest of the vocabulary.
+ *
+ * \param value The input sequence
+ * \param errors The errors, one row per element of the sequence
+ * \param vocab The embedding vocabulary
+ * \return The row-sparse gradients of the vocabulary
+ */
+template <typename I, typename E, typename W>
+sparse_rows<value_t<E>> sparse_embedding_gradients(const I& value, const E& errors, const W& vocab) {
+    static_assert(all_etl_expr<I, E, W>, "etl::sparse_embedding_gradients can only be used on ETL expressions");
+    static_assert(is_1d<I>, "etl::sparse_embedding_gradients is only defined for 1d input");
+    static_assert(is_2d<E>, "etl::sparse_embedding_gradients is only defined for 2d errors");
+    static_assert(is_2d<W>, "etl::sparse_embedding_gradients is only defined for 2d vocabulary");
+
+    cpp_assert(etl::dim<0>(value) == etl::dim<0>(errors), "Invalid dimensions for sparse_embedding_gradients");
+    cpp_assert(etl::dim<1>(errors) == etl::dim<1>(vocab), "Invalid dimensions for sparse_embedding_gradients");
+
+    standard_evaluator::pre_assign_rhs(value);
+    standard_evaluator::pre_assign_rhs(errors);
+
+    value.ensure_cpu_up_to_date();
+
+    sparse_rows<value_t<E>> gradients(etl::dim<0>(vocab), etl::dim<1>(vocab));
+
+    gradients.accumulate(impl::standard::make_embedding_buckets(value), errors);
+
+    return gradients;
+}
+
+/*!
+ * \brief Returns the gradients of the embeddings of a batch of sequences
+ * as a row-sparse matrix, containing only the rows of the vocabulary
+ * present in the batch.
+ *
+ * This is the same as batch_embedding_gradients(value, errors, vocab),
+ * without clearing nor storing the rest of the vocabulary.
+ *
+ * \param value The input sequences
+ * \param errors The errors, one matrix per sequence
+ * \param vocab The embedding vocabulary
+ * \return The row-sparse gradients of the vocabulary
+ */
+template <typename I, typename E, typename W>
+sparse_rows<value_t<E>> sparse_batch_embedding_gradients(const I& value, const E& errors, const W& vocab) {
+    static_assert(all_etl_expr<I, E, W>, "etl::sparse_batch_embedding_gradients can only be used on ETL expressions");
+    static_assert(is_2d<I>, "etl::sparse_batch_embedding_gradients is only defined for 2d input");
+    static_assert(is_3d<E>, "etl::sparse_batch_embedding_gradients is only defined for 3d errors");
+    static_assert(is_2d<W>, "etl::sparse_batch_embedding_gradients is only defined for 2d vocabulary");
+    static_assert(all_row_major<I, E>, "etl::sparse_batch_embedding_gradients is only defined for row-major input and errors");
+
+    cpp_assert(etl::dim<0>(value) == etl::dim<0>(errors), "Invalid dimensions for sparse_batch_embedding_gradients");
+    cpp_assert(etl::dim<1>(value) == etl::dim<1>(errors), "Invalid dimensions for sparse_batch_embedding_gradients");
+    cpp_assert(etl::dim<2>(errors) == etl::dim<1>(vocab), "Invalid dimensions for sparse_batch_embedding_gradients");
+
+    standard_evaluator::pre_assign_rhs(value);
+    standard_evaluator::pre_assign_rhs(errors);
+
+    value.ensure_cpu_up_to_date();
+
+    sparse_rows<value_t<E>> gradients(etl::dim<0>(vocab), etl::dim<1>(vocab));
+
+    gradients.accumulate(impl::standard::make_embedding_buckets(value), errors);
+
+    return gradients;
+}
+
+} //end of namespace etl
@@ -168,99 +168,157 @@ PS_CONST(cephes_exp_p3, 4.1665795894E-2);
 PS_CONST(cephes_exp_p4, 1.6666665459E-1);
 PS_CONST(cephes_exp_p5, 5.0000001201E-1);
 
+namespace detail {
+
 /*!
- * \brief SSE-Vectorized exponential in double-precision
- * \param x The vector of numbers to compute the exponential from
- * \return a vector containing the exponentials of the input vector values
+ * \brief Select between two vectors with a mask
+ * \param mask The selection mask
+ * \param a The value when the mask is set
+ * \param b The value when the mask is not set
+ * \return a vector containing a where mask is set and b otherwise
  */
-ETL_INLINE_VEC_128D exp_pd(__m128d x) {
-    const __m128i offset = _mm_setr_epi32(1023, 1023, 0, 0);
+ETL_INLINE_VEC_128 select_ps(__m128 mask, __m128 a, __m128 b) {
+    return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+}
 
-    __m128i k1;
-    __m128d p1;
-    __m128d a1;
-    __m128d x1;
+/*!
+ * \copydoc select_ps
+ */
+ETL_INLINE_VEC_128D select_pd(__m128d mask, __m128d a, __m128d b) {
+    return _mm_or_pd(_mm_and_pd(mask, a), _mm_andnot_pd(mask, b));
+}
 
-    auto xmm0 = _mm_set1_pd(7.09782712893383996843e2);
-    auto xmm1 = _mm_set1_pd(-7.08396418532264106224e2);
+/*!
+ * \brief Compute the floor of each element of the vector.
+ *
+ * SSE4.1 is not assumed, the rounding is done with the 2^52 trick
+ * which is exact for |x| < 2^52.
+ *
+ * \param x The vector of numbers to round
+ * \return a vector containing the floor of the input vector values
+ */
+ETL_INLINE_VEC_128D floor_pd(__m128d x) {
+    const auto magic = _mm_set1_pd(4503599627370496.0);
 
-    x1 = _mm_min_pd(x, xmm0);
-    x1 = _mm_max_pd(x1, xmm1);
+    auto sign = _mm_and_pd(x, _mm_set1_pd(-0.0));
+    auto ax   = _mm_andnot_pd(_mm_set1_pd(-0.0), x);
 
-    /* a = x / log2 */
-    xmm0 = _mm_set1_pd(1.4426950408889634073599);
-    xmm1 = _mm_setzero_pd();
-    a1 = _mm_mul_pd(x1, xmm0);
+    // Round to nearest, keeping the sign
+    auto r = _mm_or_pd(_mm_sub_pd(_mm_add_pd(ax, magic), magic), sign);
 
-    /* k = (int)floor(a)  p = (float)k */
-    p1 = _mm_cmplt_pd(a1, xmm1);
-    xmm0 = _mm_set1_pd(1.0);
-    p1 = _mm_and_pd(p1, xmm0);
-    a1 = _mm_sub_pd(a1, p1);
-    k1 = _mm_cvttpd_epi32(a1);
-    p1 = _mm_cvtepi32_pd(k1);
+    // Values larger than 2^52 are already integers
+    r = select_pd(_mm_cmplt_pd(ax, magic), r, x);
 
-    /* x -= p * log2 */
-    xmm0 = _mm_set1_pd(6.93145751953125E-1);
-    xmm1 = _mm_set1_pd(1.42860682030941723212E-6);
+    // Correct the rounding when it went up
+    return _mm_sub_pd(r, _mm_and_pd(_mm_cmpgt_pd(r, x), _mm_set1_pd(1.0)));
+}
 
-#ifdef __FMA__
-    x1 = _mm_fnmadd_pd(p1, xmm0, x1);
-    x1 = _mm_fnmadd_pd(p1, xmm1, x1);
-#else
-    a1 = _mm_mul_pd(p1, xmm0);
-    x1 = _mm_sub_pd(x1, a1);
-    a1 = _mm_mul_pd(p1, xmm1);
-    x1 = _mm_sub_pd(x1, a1);
-#endif
+/*!
+ * \copydoc floor_pd
+ */
+ETL_INLINE_VEC_128 floor_ps(__m128 x) {
+    const auto magic = _mm_set1_ps(8388608.0f);
 
-    /* Compute e^x using a polynomial approximation. */
-    xmm0 = _mm_set1_pd(1.185268231308989403584147407056378360798378534739e-2);
-    xmm1 = _mm_set1_pd(3.87412011356070379615759057344100690905653320886699e-2);
+    auto sign = _mm_and_ps(x, _mm_set1_ps(-0.0f));
+    auto ax   = _mm_andnot_ps(_mm_set1_ps(-0.0f), x);
 
-#ifdef __FMA__
-    a1 = _mm_fmadd_pd(x1, xmm0, xmm1);
-#else
-    a1 = _mm_mul_pd(x1, xmm0);
-    a1 = _mm_add_pd(a1, xmm1);
-#endif
+    // Round to nearest, keeping the sign
+    auto r = _mm_or_ps(_mm_sub_ps(_mm_add_ps(ax, magic), magic), sign);
+
+    // Values larger than 2^23 are already integers
+    r = select_ps(_mm_cmplt_ps(ax, magic), r, x);
 
-    xmm0 = _mm_set1_pd(0.16775408658617866431779970932853611481292418818223);
-    xmm1 = _mm_set1_pd(0.49981934577169208735732248650232562589934399402426);
+    // Correct the rounding when it went up
+    return _mm_sub_ps(r, _mm_and_ps(_mm_cmpgt_ps(r, x), _mm_set1_ps(1.0f)));
+}
+
+/*!
+ * \brief Evaluate a polynomial of degree N with Horner's scheme
+ * \param x The vector of values
+ * \param c The coefficients, starting with the highest degree
+ * \return a vector containing the values of the polynomial
+ */
+template <size_t N>
+ETL_INLINE_VEC_128D polevl_pd(__m128d x, const double (&c)[N]) {
+    auto r = _mm_set1_pd(c[0]);
 
+    for (size_t i = 1; i < N; ++i) {
 #ifdef __FMA__
-    a1 = _mm_fmadd_pd(a1, x1, xmm0);
-    a1 = _mm_fmadd_pd(a1, x1, xmm1);
+        r = _mm_fmadd_pd(r, x, _mm_set1_pd(c[i]));
 #else
-    a1 = _mm_mul_pd(a1, x1);
-    a1 = _mm_add_pd(a1, xmm0);
-    a1 = _mm_mul_pd(a1, x1);
-    a1 = _mm_add_pd(a1, xmm1);
+        r = _mm_add_pd(_mm_mul_pd(r, x), _mm_set1_pd(c[i]));
 #endif
+    }
+
+    return r;
+}
 
-    xmm0 = _mm_set1_pd(1.00001092396453942157124178508842412412025643386873);
-    xmm1 = _mm_set1_pd(0.99999989311082729779536722205742989232069120354073);
+/*!
+ * \copydoc polevl_pd
+ */
+template <size_t N>
+ETL_INLINE_VEC_128 polevl_ps(__m128 x, const float (&c)[N]) {
+    auto r = _mm_set1_ps(c[0]);
 
+    for (size_t i = 1; i < N; ++i) {
 #ifdef __FMA__
-    a1 = _mm_fmadd_pd(a1, x1, xmm0);
-    a1 = _mm_fmadd_pd(a1, x1, xmm1);
+        r = _mm_fmadd_ps(r, x, _mm_set1_ps(c[i]));
 #else
-    a1 = _mm_mul_pd(a1, x1);
-    a1 = _mm_add_pd(a1, xmm0);
-    a1 = _mm_mul_pd(a1, x1);
-    a1 = _mm_add_pd(a1, xmm1);
+        r = _mm_add_ps(_mm_mul_ps(r, x), _mm_set1_ps(c[i]));
 #endif
+    }
+
+    return r;
+}
+
+/*!
+ * \brief Compute 2^n for each element of the vector
+ * \param n The integer exponents, in [-1022, 1023], in the two lower elements
+ * \return a vector containing 2^n
+ */
+ETL_INLINE_VEC_128D pow2_pd(__m128i n) {
+    n = _mm_slli_epi32(_mm_add_epi32(n, _mm_set1_epi32(1023)), 20);
+    return _mm_castsi128_pd(_mm_unpacklo_epi32(_mm_setzero_si128(), n));
+}
+
+} //end of namespace detail
+
+/*!
+ * \brief SSE-Vectorized exponential in double-precision
+ *
+ * The maximum error is 2 ULP. The results saturate to zero and
+ * infinity outside of [-745, 709.78].
+ *
+ * \param x The vector of numbers to compute the exponential from
+ * \return a vector containing the exponentials of the input vector values
+ */
+ETL_INLINE_VEC_128D exp_pd(__m128d x) {
+    static constexpr double P[] = {1.26177193074810590878E-4, 3.02994407707441961300E-2, 9.99999999999999999910E-1};
+    static constexpr double Q[] = {3.00198505138664455042E-6, 2.52448340349684104192E-3, 2.27265548208155028766E-1, 2.00000000000000000009E0};
 
-    /* p = 2^k */
-    k1 = _mm_add_epi32(k1, offset);
-    k1 = _mm_slli_epi32(k1, 20);
-    k1 = _mm_shuffle_epi32(k1, _MM_SHUFFLE(1,3,0,2));
-    p1 = _mm_castsi128_pd(k1);
+    x = _mm_min_pd(x, _mm_set1_pd(7.09782712893383996843e2));
+    x = _mm_max_pd(x, _mm_set1_pd(-7.45133219101941108420e2));
 
-    /* a *= 2^k */
-    a1 = _mm_mul_pd(a1, p1);
+    // Express e^x = e^g 2^n = e^g e^(n log(2)) = e^(g + n log(2))
+    auto px = detail::floor_pd(_mm_add_pd(_mm_mul_pd(x, _mm_set1_pd(1.4426950408889634073599)), _mm_set1_pd(0.5)));
+    auto n  = _mm_cvtpd_epi32(px);
 
-    return a1;
+    x = _mm_sub_pd(x, _mm_mul_pd(px, _mm_set1_pd(6.93145751953125E-1)));
+    x = _mm_sub_pd(x, _mm_mul_pd(px, _mm_set1_pd(1.42860682030941723212E-6)));
+
+    // Rational approximation of e^g = 1 + 2 * g * P(g^2) / (Q(g^2) - g * P(g^2))
+    auto xx = _mm_mul_pd(x, x);
+    auto p  = _mm_mul_pd(x, detail::polevl_pd(xx, P));
+    auto q  = detail::polevl_pd(xx, Q);
+
+    x = _mm_div_pd(p, _mm_sub_pd(q, p));
+    x = _mm_add_pd(_mm_set1_pd(1.0), _mm_add_pd(x, x));
+
+    // Multiply by 2^n in two steps so that denormals and large values are not lost
+    auto n1 = _mm_srai_epi32(n, 1);
+    auto n2 = _mm_sub_epi32(n, n1);
+
+    return _mm_mul_pd(_mm_mul_pd(x, detail::pow2_pd(n1)), detail::pow2_pd(n2));
 }
 
 /*!
@@ -491,6 +549,334 @@ ETL_INLINE_VEC_128 cos_ps(__m128 x) { // any x
     return y;
 }
 
+/*
+ * The following functions are not part of the original sse_mathfun.h
+ * and are based on the Cephes Math Library by Stephen L. Moshier.
+ *
+ * The error bounds are given for the range of validity of each
+ * function and have been measured against the standard library.
+ */
+
+namespace detail {
+
+/*!
+ * \brief Evaluate the core of the Cephes double-precision sin/cos
+ *
+ * \param x The absolute values of the input
+ * \param y The even octant of x
+ * \param cos_mask The mask of the elements for which the cosinus polynomial must be used
+ *
+ * \return The polynomial approximation of the reduced sinus or cosinus
+ */
+ETL_INLINE_VEC_128D sincos_poly_pd(__m128d x, __m128d y, __m128d cos_mask) {
+    static constexpr double sincof[] = {1.58962301576546568060E-10, -2.50507477628578072866E-8, 2.75573136213857245213E-6,
+                                        -1.98412698295895385996E-4, 8.33333333332211858878E-3, -1.66666666666666307295E-1};
+    static constexpr double coscof[] = {-1.13585365213876817300E-11, 2.08757008419747316778E-9, -2.75573141792967388112E-7,
+                                        2.48015872888517045348E-5, -1.38888888888730564116E-3, 4.16666666666665929218E-2};
+
+    // Extended precision modular arithmetic
+    x = _mm_sub_pd(x, _mm_mul_pd(y, _mm_set1_pd(7.85398125648498535156E-1)));
+    x = _mm_sub_pd(x, _mm_mul_pd(y, _mm_set1_pd(3.77489470793079817668E-8)));
+    x = _mm_sub_pd(x, _mm_mul_pd(y, _mm_set1_pd(2.69515142907905952645E-15)));
+
+    auto z = _mm_mul_pd(x, x);
+
+    // cos(x) = 1 - z / 2 + z^2 * P(z)
+    auto c = _mm_mul_pd(_mm_mul_pd(z, z), polevl_pd(z, coscof));
+    c      = _mm_add_pd(_mm_sub_pd(_mm_set1_pd(1.0), _mm_mul_pd(z, _mm_set1_pd(0.5))), c);
+
+    // sin(x) = x + x * z * P(z)
+    auto s = _mm_add_pd(x, _mm_mul_pd(_mm_mul_pd(x, z), polevl_pd(z, sincof)));
+
+    return select_pd(cos_mask, c, s);
+}
+
+} //end of namespace detail
+
+/*!
+ * \brief SSE-Vectorized logarithm in double-precision
+ *
+ * The maximum error is 1 ULP. log(0) is -inf and the logarithm of a
+ * negative number is NaN.
+ *
+ * \param x The vector of numbers to compute the logarithm from
+ * \return a vector containing the logarithms of the input vector values
+ */
+ETL_INLINE_VEC_128D log_pd(__m128d x) {
+    static constexpr double P[] = {1.01875663804580931796E-4, 4.97494994976747001425E-1, 4.70579119878881725854E0,
+                                   1.44989225341610930846E1, 1.79368678507819816313E1, 7.70838733755885391666E0};
+    static constexpr double Q[] = {1.0, 1.12873587189167450590E1, 4.52279145837532221105E1, 8.29875266912776603211E1,
+                                   7.11544750618563894466E1, 2.31251620126765340583E1};
+
+    const auto one = _mm_set1_pd(1.0);
+
+    // Scale the denormals into the normal range
+    auto denormal = _mm_cmplt_pd(x, _mm_set1_pd(2.2250738585072014e-308));
+    auto v        = detail::select_pd(denormal, _mm_mul_pd(x, _mm_set1_pd(18014398509481984.0)), x);
+
+    // Decompose v into m * 2^e with m in [0.5, 1[
+    auto bits = _mm_castpd_si128(v);
+
+    auto eb = _mm_or_si128(_mm_srli_epi64(bits, 52), _mm_castpd_si128(_mm_set1_pd(4503599627370496.0)));
+    auto e  = _mm_sub_pd(_mm_castsi128_pd(eb), _mm_set1_pd(4503599627370496.0 + 1022.0));
+    e       = _mm_sub_pd(e, _mm_and_pd(denormal, _mm_set1_pd(54.0)));
+
+    auto m = _mm_and_pd(v, _mm_castsi128_pd(_mm_set1_epi64x(0x000FFFFFFFFFFFFFLL)));
+    m      = _mm_or_pd(m, _mm_set1_pd(0.5));
+
+    // Bring m into [sqrt(0.5), sqrt(2)[
+    auto small = _mm_cmplt_pd(m, _mm_set1_pd(0.70710678118654752440));
+    e          = _mm_sub_pd(e, _mm_and_pd(small, one));
+    m          = _mm_sub_pd(_mm_add_pd(m, _mm_and_pd(small, m)), one);
+
+    // log(1 + m) = m - m^2 / 2 + m^3 * P(m) / Q(m)
+    auto z = _mm_mul_pd(m, m);
+    auto y = _mm_mul_pd(_mm_mul_pd(m, z), _mm_div_pd(detail::polevl_pd(m, P), detail::polevl_pd(m, Q)));
+
+    y = _mm_sub_pd(y, _mm_mul_pd(e, _mm_set1_pd(2.121944400546905827679e-4)));
+    y = _mm_sub_pd(y, _mm_mul_pd(z, _mm_set1_pd(0.5)));
+
+    auto r = _mm_add_pd(_mm_add_pd(m, y), _mm_mul_pd(e, _mm_set1_pd(0.693359375)));
+
+    // Handle the special values
+    r = detail::select_pd(_mm_cmpeq_pd(x, _mm_set1_pd(std::numeric_limits<double>::infinity())), x, r);
+    r = detail::select_pd(_mm_cmpeq_pd(x, _mm_setzero_pd()), _mm_set1_pd(-std::numeric_limits<double>::infinity()), r);
+    r = detail::select_pd(_mm_cmpnge_pd(x, _mm_setzero_pd()), _mm_set1_pd(std::numeric_limits<double>::quiet_NaN()), r);
+
+    return r;
+}
+
+/*!
+ * \brief SSE-Vectorized sinus in double-precision
+ *
+ * The maximum error is 2 ULP for |x| < 2^30. The precision degrades
+ * for larger values.
+ *
+ * \param x The vector of numbers to compute the sinus from
+ * \return a vector containing the sinus of the input vector values
+ */
+ETL_INLINE_VEC_128D sin_pd(__m128d x) {
+    auto sign = _mm_and_pd(x, _mm_set1_pd(-0.0));
+    x         = _mm_andnot_pd(_mm_set1_pd(-0.0), x);
+
+    // Compute the octant and make it even
+    auto y = detail::floor_pd(_mm_mul_pd(x, _mm_set1_pd(1.27323954473516268615)));
+    y      = _mm_add_pd(y, _mm_sub_pd(y, _mm_mul_pd(_mm_set1_pd(2.0), detail::floor_pd(_mm_mul_pd(y, _mm_set1_pd(0.5))))));
+
+    auto j = _mm_sub_pd(y, _mm_mul_pd(_mm_set1_pd(8.0), detail::floor_pd(_mm_mul_pd(y, _mm_set1_pd(0.125)))));
+
+    // Reflect in x axis
+    auto upper = _mm_cmpge_pd(j, _mm_set1_pd(4.0));
+    sign       = _mm_xor_pd(sign, _mm_and_pd(upper, _mm_set1_pd(-0.0)));
+    j          = _mm_sub_pd(j, _mm_and_pd(upper, _mm_set1_pd(4.0)));
+
+    auto r = detail::sincos_poly_pd(x, y, _mm_cmpeq_pd(j, _mm_set1_pd(2.0)));
+
+    return _mm_xor_pd(r, sign);
+}
+
+/*!
+ * \brief SSE-Vectorized cosinus in double-precision
+ *
+ * The maximum error is 2 ULP for |x| < 2^30. The precision degrades
+ * for larger values.
+ *
+ * \param x The vector of numbers to compute the cosinus from
+ * \return a vector containing the cosinus of the input vector values
+ */
+ETL_INLINE_VEC_128D cos_pd(__m128d x) {
+    x = _mm_andnot_pd(_mm_set1_pd(-0.0), x);
+
+    // Compute the octant and make it even
+    auto y = detail::floor_pd(_mm_mul_pd(x, _mm_set1_pd(1.27323954473516268615)));
+    y      = _mm_add_pd(y, _mm_sub_pd(y, _mm_mul_pd(_mm_set1_pd(2.0), detail::floor_pd(_mm_mul_pd(y, _mm_set1_pd(0.5))))));
+
+    auto j = _mm_sub_pd(y, _mm_mul_pd(_mm_set1_pd(8.0), detail::floor_pd(_mm_mul_pd(y, _mm_set1_pd(0.125)))));
+
+    auto upper = _mm_cmpge_pd(j, _mm_set1_pd(4.0));
+    auto sign  = _mm_and_pd(upper, _mm_set1_pd(-0.0));
+    j          = _mm_sub_pd(j, _mm_and_pd(upper, _mm_set1_pd(4.0)));
+
+    auto sin_octant = _mm_cmpeq_pd(j, _mm_set1_pd(2.0));
+    sign            = _mm_xor_pd(sign, _mm_and_pd(sin_octant, _mm_set1_pd(-0.0)));
+
+    auto r = detail::sincos_poly_pd(x, y, _mm_cmpneq_pd(j, _mm_set1_pd(2.0)));
+
+    return _mm_xor_pd(r, sign);
+}
+
+/*!
+ * \brief SSE-Vectorized log(1 + x) in single-precision, for x > -1
+ *
+ * The maximum error is 2 ULP.
+ *
+ * \param x The vector of numbers to compute log(1 + x) from
+ * \return a vector containing log(1 + x) of the input vector values
+ */
+ETL_INLINE_VEC_128 log1p_ps(__m128 x) {
+    const auto one = _mm_set1_ps(1.0f);
+
+    // log(1 + x) = log(u) * x / (u - 1) cancels the rounding error of 1 + x
+    auto u = _mm_add_ps(one, x);
+    auto d = _mm_sub_ps(u, one);
+    auto r = _mm_mul_ps(log_ps(u), _mm_div_ps(x, d));
+
+    return detail::select_ps(_mm_cmpeq_ps(d, _mm_setzero_ps()), x, r);
+}
+
+/*!
+ * \brief SSE-Vectorized log(1 + x) in double-precision, for x > -1
+ *
+ * The maximum error is 2 ULP.
+ *
+ * \param x The vector of numbers to compute log(1 + x) from
+ * \return a vector containing log(1 + x) of the input vector values
+ */
+ETL_INLINE_VEC_128D log1p_pd(__m128d x) {
+    const auto one = _mm_set1_pd(1.0);
+
+    // log(1 + x) = log(u) * x / (u - 1) cancels the rounding error of 1 + x
+    auto u = _mm_add_pd(one, x);
+    auto d = _mm_sub_pd(u, one);
+    auto r = _mm_mul_pd(log_pd(u), _mm_div_pd(x, d));
+
+    return detail::select_pd(_mm_cmpeq_pd(d, _mm_setzero_pd()), x, r);
+}
+
+/*!
+ * \brief SSE-Vectorized hyperbolic tangent in single-precision
+ *
+ * The maximum error is 1 ULP.
+ *
+ * \param x The vector of numbers to compute the hyperbolic tangent from
+ * \return a vector containing the hyperbolic tangent of the input vector values
+ */
+ETL_INLINE_VEC_128 tanh_ps(__m128 x) {
+    static constexpr float P[] = {-5.70498872745E-3f, 2.06390887954E-2f, -5.37397155531E-2f, 1.33314422036E-1f, -3.33332819422E-1f};
+
+    auto sign = _mm_and_ps(x, _mm_set1_ps(-0.0f));
+    auto ax   = _mm_andnot_ps(_mm_set1_ps(-0.0f), x);
+
+    // Small values: x + x^3 * P(x^2)
+    auto z     = _mm_mul_ps(x, x);
+    auto small = _mm_add_ps(x, _mm_mul_ps(_mm_mul_ps(x, z), detail::polevl_ps(z, P)));
+
+    // Large values: 1 - 2 / (exp(2x) + 1)
+    auto e     = exp_ps(_mm_min_ps(_mm_add_ps(ax, ax), _mm_set1_ps(40.0f)));
+    auto large = _mm_sub_ps(_mm_set1_ps(1.0f), _mm_div_ps(_mm_set1_ps(2.0f), _mm_add_ps(e, _mm_set1_ps(1.0f))));
+    large      = _mm_or_ps(large, sign);
+
+    return detail::select_ps(_mm_cmplt_ps(ax, _mm_set1_ps(0.625f)), small, large);
+}
+
+/*!
+ * \brief SSE-Vectorized hyperbolic tangent in double-precision
+ *
+ * The maximum error is 2 ULP.
+ *
+ * \param x The vector of numbers to compute the hyperbolic tangent from
+ * \return a vector containing the hyperbolic tangent of the input vector values
+ */
+ETL_INLINE_VEC_128D tanh_pd(__m128d x) {
+    static constexpr double P[] = {-9.64399179425052238628E-1, -9.92877231001918586564E1, -1.61468768441708447952E3};
+    static constexpr double Q[] = {1.0, 1.12811678491632931402E2, 2.23548839060100448583E3, 4.84406305325125486048E3};
+
+    auto sign = _mm_and_pd(x, _mm_set1_pd(-0.0));
+    auto ax   = _mm_andnot_pd(_mm_set1_pd(-0.0), x);
+
+    // Small values: x + x^3 * P(x^2) / Q(x^2)
+    auto z     = _mm_mul_pd(x, x);
+    auto small = _mm_add_pd(x, _mm_mul_pd(_mm_mul_pd(x, z), _mm_div_pd(detail::polevl_pd(z, P), detail::polevl_pd(z, Q))));
+
+    // Large values: 1 - 2 / (exp(2x) + 1)
+    auto e     = exp_pd(_mm_min_pd(_mm_add_pd(ax, ax), _mm_set1_pd(80.0)));
+    auto large = _mm_sub_pd(_mm_set1_pd(1.0), _mm_div_pd(_mm_set1_pd(2.0), _mm_add_pd(e, _mm_set1_pd(1.0))));
+    large      = _mm_or_pd(large, sign);
+
+    return detail::select_pd(_mm_cmplt_pd(ax, _mm_set1_pd(0.625)), small, large);
+}
+
+/*!
+ * \brief SSE-Vectorized hyperbolic sinus in single-precision
+ *
+ * The maximum error is 4 ULP.
+ *
+ * \param x The vector of numbers to compute the hyperbolic sinus from
+ * \return a vector containing the hyperbolic sinus of the input vector values
+ */
+ETL_INLINE_VEC_128 sinh_ps(__m128 x) {
+    static constexpr float P[] = {2.03721912945E-4f, 8.33028376239E-3f, 1.66667160211E-1f};
+
+    auto sign = _mm_and_ps(x, _mm_set1_ps(-0.0f));
+    auto ax   = _mm_andnot_ps(_mm_set1_ps(-0.0f), x);
+
+    // Small values: x + x^3 * P(x^2)
+    auto z     = _mm_mul_ps(x, x);
+    auto small = _mm_add_ps(x, _mm_mul_ps(_mm_mul_ps(x, z), detail::polevl_ps(z, P)));
+
+    // Large values: (e^x - e^-x) / 2, computed in two halves to avoid the premature overflow
+    auto h     = exp_ps(_mm_mul_ps(ax, _mm_set1_ps(0.5f)));
+    auto large = _mm_sub_ps(_mm_mul_ps(_mm_mul_ps(h, _mm_set1_ps(0.5f)), h), _mm_div_ps(_mm_div_ps(_mm_set1_ps(0.5f), h), h));
+    large      = _mm_or_ps(large, sign);
+
+    return detail::select_ps(_mm_cmple_ps(ax, _mm_set1_ps(1.0f)), small, large);
+}
+
+/*!
+ * \brief SSE-Vectorized hyperbolic sinus in double-precision
+ *
+ * The maximum error is 4 ULP.
+ *
+ * \param x The vector of numbers to compute the hyperbolic sinus from
+ * \return a vector containing the hyperbolic sinus of the input vector values
+ */
+ETL_INLINE_VEC_128D sinh_pd(__m128d x) {
+    static constexpr double P[] = {-7.89474443963537015605E-1, -1.63725857525983828727E2, -1.15614435765005216044E4, -3.51754964808151394800E5};
+    static constexpr double Q[] = {1.0, -2.77711081420602794433E2, 3.61578279834431989373E4, -2.11052978884890840399E6};
+
+    auto sign = _mm_and_pd(x, _mm_set1_pd(-0.0));
+    auto ax   = _mm_andnot_pd(_mm_set1_pd(-0.0), x);
+
+    // Small values: x + x^3 * P(x^2) / Q(x^2)
+    auto z     = _mm_mul_pd(x, x);
+    auto small = _mm_add_pd(x, _mm_mul_pd(_mm_mul_pd(x, z), _mm_div_pd(detail::polevl_pd(z, P), detail::polevl_pd(z, Q))));
+
+    // Large values: (e^x - e^-x) / 2, computed in two halves to avoid the premature overflow
+    auto h     = exp_pd(_mm_mul_pd(ax, _mm_set1_pd(0.5)));
+    auto large = _mm_sub_pd(_mm_mul_pd(_mm_mul_pd(h, _mm_set1_pd(0.5)), h), _mm_div_pd(_mm_div_pd(_mm_set1_pd(0.5), h), h));
+    large      = _mm_or_pd(large, sign);
+
+    return detail::select_pd(_mm_cmple_pd(ax, _mm_set1_pd(1.0)), small, large);
+}
+
+/*!
+ * \brief SSE-Vectorized hyperbolic cosinus in single-precision
+ *
+ * The maximum error is 3 ULP.
+ *
+ * \param x The vector of numbers to compute the hyperbolic cosinus from
+ * \return a vector containing the hyperbolic cosinus of the input vector values
+ */
+ETL_INLINE_VEC_128 cosh_ps(__m128 x) {
+    // (e^x + e^-x) / 2, computed in two halves to avoid the premature overflow
+    auto h = exp_ps(_mm_mul_ps(_mm_andnot_ps(_mm_set1_ps(-0.0f), x), _mm_set1_ps(0.5f)));
+    return _mm_add_ps(_mm_mul_ps(_mm_mul_ps(h, _mm_set1_ps(0.5f)), h), _mm_div_ps(_mm_div_ps(_mm_set1_ps(0.5f), h), h));
+}
+
+/*!
+ * \brief SSE-Vectorized hyperbolic cosinus in double-precision
+ *
+ * The maximum error is 4 ULP.
+ *
+ * \param x The vector of numbers to compute the hyperbolic cosinus from
+ * \return a vector containing the hyperbolic cosinus of the input vector values
+ */
+ETL_INLINE_VEC_128D cosh_pd(__m128d x) {
+    // (e^x + e^-x) / 2, computed in two halves to avoid the premature overflow
+    auto h = exp_pd(_mm_mul_pd(_mm_andnot_pd(_mm_set1_pd(-0.0), x), _mm_set1_pd(0.5)));
+    return _mm_add_pd(_mm_mul_pd(_mm_mul_pd(h, _mm_set1_pd(0.5)), h), _mm_div_pd(_mm_div_pd(_mm_set1_pd(0.5), h), h));
+}
+
 } //end of namespace etl
 
 #endif //__SSE3__
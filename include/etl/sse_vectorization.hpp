@@ -14,6 +14,8 @@
 
 #ifdef __SSE3__
 
+#include <cstring>
+
 #include <immintrin.h>
 #include <emmintrin.h>
 #include <xmmintrin.h>
@@ -708,14 +710,212 @@ struct sse_vec {
      * \brief Round up each values of the vector and return them
      */
     ETL_STATIC_INLINE(sse_simd_float) round_up(sse_simd_float x) {
+#ifdef __SSE4_1__
         return _mm_round_ps(x.value, (_MM_FROUND_TO_POS_INF |_MM_FROUND_NO_EXC));
+#else
+        return _mm_xor_ps(etl::detail::floor_ps(_mm_xor_ps(x.value, _mm_set1_ps(-0.0f))), _mm_set1_ps(-0.0f));
+#endif
     }
 
     /*!
      * \brief Round up each values of the vector and return them
      */
     ETL_STATIC_INLINE(sse_simd_double) round_up(sse_simd_double x) {
+#ifdef __SSE4_1__
         return _mm_round_pd(x.value, (_MM_FROUND_TO_POS_INF |_MM_FROUND_NO_EXC));
+#else
+        return _mm_xor_pd(etl::detail::floor_pd(_mm_xor_pd(x.value, _mm_set1_pd(-0.0))), _mm_set1_pd(-0.0));
+#endif
+    }
+
+    /*!
+     * \brief Round down each values of the vector and return them
+     */
+    ETL_STATIC_INLINE(sse_simd_float) round_down(sse_simd_float x) {
+#ifdef __SSE4_1__
+        return _mm_round_ps(x.value, (_MM_FROUND_TO_NEG_INF |_MM_FROUND_NO_EXC));
+#else
+        return etl::detail::floor_ps(x.value);
+#endif
+    }
+
+    /*!
+     * \brief Round down each values of the vector and return them
+     */
+    ETL_STATIC_INLINE(sse_simd_double) round_down(sse_simd_double x) {
+#ifdef __SSE4_1__
+        return _mm_round_pd(x.value, (_MM_FROUND_TO_NEG_INF |_MM_FROUND_NO_EXC));
+#else
+        return etl::detail::floor_pd(x.value);
+#endif
+    }
+
+    // Comparisons
+    //
+    // The comparisons return masks in the same vector type as their
+    // operands, with all the bits of a lane set when the comparison
+    // holds.
+
+    /*!
+     * \brief Compare each element of the two vectors for equality
+     */
+    ETL_STATIC_INLINE(sse_simd_float) equal(sse_simd_float lhs, sse_simd_float rhs) {
+        return _mm_cmpeq_ps(lhs.value, rhs.value);
+    }
+
+    /*!
+     * \brief Compare each element of the two vectors for equality
+     */
+    ETL_STATIC_INLINE(sse_simd_double) equal(sse_simd_double lhs, sse_simd_double rhs) {
+        return _mm_cmpeq_pd(lhs.value, rhs.value);
+    }
+
+    /*!
+     * \brief Compare each element of the two vectors for inequality
+     */
+    ETL_STATIC_INLINE(sse_simd_float) not_equal(sse_simd_float lhs, sse_simd_float rhs) {
+        return _mm_cmpneq_ps(lhs.value, rhs.value);
+    }
+
+    /*!
+     * \brief Compare each element of the two vectors for inequality
+     */
+    ETL_STATIC_INLINE(sse_simd_double) not_equal(sse_simd_double lhs, sse_simd_double rhs) {
+        return _mm_cmpneq_pd(lhs.value, rhs.value);
+    }
+
+    /*!
+     * \brief Test if each element of lhs is less than the element of rhs
+     */
+    ETL_STATIC_INLINE(sse_simd_float) less(sse_simd_float lhs, sse_simd_float rhs) {
+        return _mm_cmplt_ps(lhs.value, rhs.value);
+    }
+
+    /*!
+     * \brief Test if each element of lhs is less than the element of rhs
+     */
+    ETL_STATIC_INLINE(sse_simd_double) less(sse_simd_double lhs, sse_simd_double rhs) {
+        return _mm_cmplt_pd(lhs.value, rhs.value);
+    }
+
+    /*!
+     * \brief Test if each element of lhs is less than or equal to the element of rhs
+     */
+    ETL_STATIC_INLINE(sse_simd_float) less_equal(sse_simd_float lhs, sse_simd_float rhs) {
+        return _mm_cmple_ps(lhs.value, rhs.value);
+    }
+
+    /*!
+     * \brief Test if each element of lhs is less than or equal to the element of rhs
+     */
+    ETL_STATIC_INLINE(sse_simd_double) less_equal(sse_simd_double lhs, sse_simd_double rhs) {
+        return _mm_cmple_pd(lhs.value, rhs.value);
+    }
+
+    /*!
+     * \brief Test if each element of lhs is greater than the element of rhs
+     */
+    ETL_STATIC_INLINE(sse_simd_float) greater(sse_simd_float lhs, sse_simd_float rhs) {
+        return _mm_cmpgt_ps(lhs.value, rhs.value);
+    }
+
+    /*!
+     * \brief Test if each element of lhs is greater than the element of rhs
+     */
+    ETL_STATIC_INLINE(sse_simd_double) greater(sse_simd_double lhs, sse_simd_double rhs) {
+        return _mm_cmpgt_pd(lhs.value, rhs.value);
+    }
+
+    /*!
+     * \brief Test if each element of lhs is greater than or equal to the element of rhs
+     */
+    ETL_STATIC_INLINE(sse_simd_float) greater_equal(sse_simd_float lhs, sse_simd_float rhs) {
+        return _mm_cmpge_ps(lhs.value, rhs.value);
+    }
+
+    /*!
+     * \brief Test if each element of lhs is greater than or equal to the element of rhs
+     */
+    ETL_STATIC_INLINE(sse_simd_double) greater_equal(sse_simd_double lhs, sse_simd_double rhs) {
+        return _mm_cmpge_pd(lhs.value, rhs.value);
+    }
+
+    /*!
+     * \brief Compute the logical and of two masks
+     */
+    ETL_STATIC_INLINE(sse_simd_float) mask_and(sse_simd_float lhs, sse_simd_float rhs) {
+        return _mm_and_ps(lhs.value, rhs.value);
+    }
+
+    /*!
+     * \brief Compute the logical and of two masks
+     */
+    ETL_STATIC_INLINE(sse_simd_double) mask_and(sse_simd_double lhs, sse_simd_double rhs) {
+        return _mm_and_pd(lhs.value, rhs.value);
+    }
+
+    /*!
+     * \brief Compute the logical or of two masks
+     */
+    ETL_STATIC_INLINE(sse_simd_float) mask_or(sse_simd_float lhs, sse_simd_float rhs) {
+        return _mm_or_ps(lhs.value, rhs.value);
+    }
+
+    /*!
+     * \brief Compute the logical or of two masks
+     */
+    ETL_STATIC_INLINE(sse_simd_double) mask_or(sse_simd_double lhs, sse_simd_double rhs) {
+        return _mm_or_pd(lhs.value, rhs.value);
+    }
+
+    /*!
+     * \brief Compute the logical xor of two masks
+     */
+    ETL_STATIC_INLINE(sse_simd_float) mask_xor(sse_simd_float lhs, sse_simd_float rhs) {
+        return _mm_xor_ps(lhs.value, rhs.value);
+    }
+
+    /*!
+     * \brief Compute the logical xor of two masks
+     */
+    ETL_STATIC_INLINE(sse_simd_double) mask_xor(sse_simd_double lhs, sse_simd_double rhs) {
+        return _mm_xor_pd(lhs.value, rhs.value);
+    }
+
+    /*!
+     * \brief Select the elements of a where the mask is set and the elements of b elsewhere
+     */
+    ETL_STATIC_INLINE(sse_simd_float) select(sse_simd_float mask, sse_simd_float a, sse_simd_float b) {
+        return etl::detail::select_ps(mask.value, a.value, b.value);
+    }
+
+    /*!
+     * \brief Select the elements of a where the mask is set and the elements of b elsewhere
+     */
+    ETL_STATIC_INLINE(sse_simd_double) select(sse_simd_double mask, sse_simd_double a, sse_simd_double b) {
+        return etl::detail::select_pd(mask.value, a.value, b.value);
+    }
+
+    /*!
+     * \brief Store a mask as booleans at the given (unaligned) memory position
+     */
+    ETL_STATIC_INLINE(void) store_mask(bool* memory, sse_simd_float mask) {
+        // Narrow the 32-bit lanes to bytes and keep only the lowest bit
+        auto m = _mm_packs_epi32(_mm_castps_si128(mask.value), _mm_setzero_si128());
+        m      = _mm_and_si128(_mm_packs_epi16(m, _mm_setzero_si128()), _mm_set1_epi8(1));
+
+        int bytes = _mm_cvtsi128_si32(m);
+        std::memcpy(memory, &bytes, 4);
+    }
+
+    /*!
+     * \brief Store a mask as booleans at the given (unaligned) memory position
+     */
+    ETL_STATIC_INLINE(void) store_mask(bool* memory, sse_simd_double mask) {
+        int bits = _mm_movemask_pd(mask.value);
+
+        memory[0] = bits & 1;
+        memory[1] = bits & 2;
     }
 
     /*!
@@ -1184,6 +1384,13 @@ struct sse_vec {
         return etl::cos_ps(x.value);
     }
 
+    /*!
+     * \brief Compute the cosinus of each element of the given vector
+     */
+    ETL_STATIC_INLINE(sse_simd_double) cos(sse_simd_double x) {
+        return etl::cos_pd(x.value);
+    }
+
     // Sinus
 
     /*!
@@ -1193,6 +1400,73 @@ struct sse_vec {
         return etl::sin_ps(x.value);
     }
 
+    /*!
+     * \brief Compute the sinus of each element of the given vector
+     */
+    ETL_STATIC_INLINE(sse_simd_double) sin(sse_simd_double x) {
+        return etl::sin_pd(x.value);
+    }
+
+    // Hyperbolic functions
+
+    /*!
+     * \brief Compute the hyperbolic tangent of each element of the given vector
+     */
+    ETL_STATIC_INLINE(sse_simd_float) tanh(sse_simd_float x) {
+        return etl::tanh_ps(x.value);
+    }
+
+    /*!
+     * \brief Compute the hyperbolic tangent of each element of the given vector
+     */
+    ETL_STATIC_INLINE(sse_simd_double) tanh(sse_simd_double x) {
+        return etl::tanh_pd(x.value);
+    }
+
+    /*!
+     * \brief Compute the hyperbolic sinus of each element of the given vector
+     */
+    ETL_STATIC_INLINE(sse_simd_float) sinh(sse_simd_float x) {
+        return etl::sinh_ps(x.value);
+    }
+
+    /*!
+     * \brief Compute the hyperbolic sinus of each element of the given vector
+     */
+    ETL_STATIC_INLINE(sse_simd_double) sinh(sse_simd_double x) {
+        return etl::sinh_pd(x.value);
+    }
+
+    /*!
+     * \brief Compute the hyperbolic cosinus of each element of the given vector
+     */
+    ETL_STATIC_INLINE(sse_simd_float) cosh(sse_simd_float x) {
+        return etl::cosh_ps(x.value);
+    }
+
+    /*!
+     * \brief Compute the hyperbolic cosinus of each element of the given vector
+     */
+    ETL_STATIC_INLINE(sse_simd_double) cosh(sse_simd_double x) {
+        return etl::cosh_pd(x.value);
+    }
+
+    // log(1 + x)
+
+    /*!
+     * \brief Compute log(1 + x) of each element of the given vector
+     */
+    ETL_STATIC_INLINE(sse_simd_float) log1p(sse_simd_float x) {
+        return etl::log1p_ps(x.value);
+    }
+
+    /*!
+     * \brief Compute log(1 + x) of each element of the given vector
+     */
+    ETL_STATIC_INLINE(sse_simd_double) log1p(sse_simd_double x) {
+        return etl::log1p_pd(x.value);
+    }
+
 //The Intel C++ Compiler (icc) has more intrinsics.
 //ETL uses them when compiled with icc
 
@@ -1219,6 +1493,13 @@ struct sse_vec {
         return etl::log_ps(x.value);
     }
 
+    /*!
+     * \brief Compute the logarithm of each element of the given vector
+     */
+    ETL_STATIC_INLINE(sse_simd_double) log(sse_simd_double x) {
+        return etl::log_pd(x.value);
+    }
+
 #else //__INTEL_COMPILER
 
     //Exponential
@@ -0,0 +1,111 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Descriptive statistics computed in a single pass
+ */
+
+#pragma once
+
+#include <cmath>
+#include <limits>
+
+namespace etl {
+
+/*!
+ * \brief The descriptive statistics (count, mean, variance, minimum and
+ * maximum) of a set of values.
+ *
+ * The values are accumulated with the Welford algorithm and two sets of
+ * statistics can be merged together (Chan et al.), which makes it
+ * possible to compute them in parallel or by blocks.
+ *
+ * \tparam T The type of the values
+ */
+template <typename T>
+struct statistics {
+    size_t count = 0;                                ///< The number of values
+    T mean       = T(0);                             ///< The mean of the values
+    T m2         = T(0);                             ///< The sum of the squared differences to the mean
+    T min        = std::numeric_limits<T>::max();    ///< The minimum value
+    T max        = std::numeric_limits<T>::lowest(); ///< The maximum value
+
+    /*!
+     * \brief Returns the sum of the values
+     */
+    T sum() const noexcept {
+        return mean * T(count);
+    }
+
+    /*!
+     * \brief Returns the (population) variance of the values
+     */
+    T variance() const noexcept {
+        return count ? m2 / T(count) : T(0);
+    }
+
+    /*!
+     * \brief Returns the sample variance of the values
+     */
+    T sample_variance() const noexcept {
+        return count > 1 ? m2 / T(count - 1) : T(0);
+    }
+
+    /*!
+     * \brief Returns the (population) standard deviation of the values
+     */
+    T stddev() const noexcept {
+        using std::sqrt;
+        return sqrt(variance());
+    }
+
+    /*!
+     * \brief Add a value to the statistics
+     * \param value The value to add
+     */
+    void push(T value) noexcept {
+        ++count;
+
+        const T delta = value - mean;
+
+        mean += delta / T(count);
+        m2 += delta * (value - mean);
+
+        min = value < min ? value : min;
+        max = value > max ? value : max;
+    }
+
+    /*!
+     * \brief Merge the given statistics into these statistics
+     * \param rhs The statistics of another set of values
+     */
+    void merge(const statistics& rhs) noexcept {
+        if (!rhs.count) {
+            return;
+        }
+
+        if (!count) {
+            *this = rhs;
+            return;
+        }
+
+        const size_t n = count + rhs.count;
+        const T delta  = rhs.mean - mean;
+        const T rhs_r  = T(rhs.count) / T(n);
+
+        mean += delta * rhs_r;
+        m2 += rhs.m2 + delta * delta * T(count) * rhs_r;
+
+        count = n;
+
+        min = rhs.min < min ? rhs.min : min;
+        max = rhs.max > max ? rhs.max : max;
+    }
+};
+
+} //end of namespace etl
@@ -30,6 +30,8 @@ constexpr size_t gevm_cm_small_threshold = 1000; ///< The number of elements of
 constexpr size_t gemv_rm_small_threshold = 1000; ///< The number of elements of A after which we use BLAS-like kernel
 constexpr size_t gemv_cm_small_threshold = 1000; ///< The number of elements of A after which we use BLAS-like kernel
 
+constexpr size_t gemv_parallel_threshold = 1000; ///< The number of elements of A after which GEMV and GEVM are parallelized
+
 constexpr size_t parallel_threshold = 2 * 1024; ///< The minimum number of elements before considering parallel implementation
 
 constexpr size_t sum_parallel_threshold = 1024 * 2; ///< The minimum number of elements before considering parallel acc implementation
@@ -55,11 +57,13 @@ constexpr size_t gemm_rr_small_threshold    = 10000;     ///< The number of elem
 constexpr size_t gemm_nt_rr_small_threshold = 500 * 500; ///< The number of elements of B after which we use BLAS-like kernel (for GEMM)
 constexpr size_t gemm_cc_small_threshold    = 40000;     ///< The number of elements of B after which we use BLAS-like kernel (for GEMM)
 
-constexpr size_t gevm_rm_small_threshold = 72000;   ///< The number of elements of b after which we use BLAS-like kernel
-constexpr size_t gevm_cm_small_threshold = 4000000; ///< The number of elements of b after which we use BLAS-like kernel
+constexpr size_t gevm_rm_small_threshold = 512 * 1024; ///< The number of elements of b after which we use BLAS-like kernel
+constexpr size_t gevm_cm_small_threshold = 32 * 1024;  ///< The number of elements of b after which we use BLAS-like kernel
+
+constexpr size_t gemv_rm_small_threshold = 32 * 1024;  ///< The number of elements of A after which we use BLAS-like kernel
+constexpr size_t gemv_cm_small_threshold = 512 * 1024; ///< The number of elements of A after which we use BLAS-like kernel
 
-constexpr size_t gemv_rm_small_threshold = 4500000; ///< The number of elements of A after which we use BLAS-like kernel
-constexpr size_t gemv_cm_small_threshold = 2400000; ///< The number of elements of A after which we use BLAS-like kernel
+constexpr size_t gemv_parallel_threshold = 256 * 1024; ///< The number of elements of A after which GEMV and GEVM are parallelized
 
 constexpr size_t parallel_threshold = 128 * 1024; ///< The minimum number of elements before considering parallel implementation
 
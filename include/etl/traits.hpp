@@ -888,6 +888,45 @@ constexpr bool all_gpu_computable = and_v<(decay_traits<E>::gpu_computable)...>;
 template <typename... E>
 constexpr bool all_homogeneous = cpp::is_homogeneous_v<value_t<E>...>;
 
+/*!
+ * \brief Traits to know if a boolean expression can be computed as
+ * vector masks.
+ *
+ * By default, an expression cannot be computed as a mask. This is
+ * specialized for the binary expressions of comparison and logical
+ * operators.
+ *
+ * \tparam E The ETL expression type
+ */
+template <typename E, typename Enable = void>
+struct mask_traits {
+    using value_type = void; ///< The type of the compared values
+
+    /*!
+     * \brief Indicates if the expression can be computed as vector
+     * masks with the given vector mode
+     * \tparam V The vector mode
+     */
+    template <vector_mode_t V>
+    static constexpr bool vectorizable = false;
+};
+
+/*!
+ * \brief Traits indicating if the given boolean expression can be
+ * computed as vector masks with the given vector mode
+ * \tparam V The vector mode
+ * \tparam E The ETL expression type
+ */
+template <vector_mode_t V, typename E>
+constexpr bool is_mask_vectorizable = mask_traits<std::decay_t<E>>::template vectorizable<V>;
+
+/*!
+ * \brief The type of the values compared by the given boolean expression
+ * \tparam E The ETL expression type
+ */
+template <typename E>
+using mask_value_t = typename mask_traits<std::decay_t<E>>::value_type;
+
 /*!
  * \brief Simple utility traits indicating if a light subview can be created out
  * of this type.
@@ -271,6 +271,56 @@ struct VectorizedAssignDiv : vectorized_base<V> {
     }
 };
 
+/*!
+ * \brief Functor for vectorized assign of a boolean expression
+ *
+ * The comparisons are computed in a vectorized fashion as vector masks
+ * and the masks are then stored as booleans in the memory of lhs.
+ */
+template <vector_mode_t V>
+struct VectorizedMaskAssign {
+    using vect_impl = typename get_vector_impl<V>::type; ///< The vectorization type
+
+    /*!
+     * \brief Compute the elements [first, last) of the boolean expression
+     * \param lhs The boolean container
+     * \param rhs The boolean expression
+     * \param first The first element to compute
+     * \param last The end of the range to compute
+     */
+    template <typename L_Expr, typename R_Expr>
+    static void apply(L_Expr&& lhs, R_Expr&& rhs, size_t first, size_t last) {
+        using IT = typename get_intrinsic_traits<V>::template type<mask_value_t<R_Expr>>;
+
+        auto* lhs_mem = lhs.memory_start();
+
+        size_t i = first;
+
+        for (; i + (IT::size * 2) - 1 < last; i += 2 * IT::size) {
+            vect_impl::store_mask(lhs_mem + i + 0 * IT::size, rhs.template load_mask<vect_impl>(i + 0 * IT::size));
+            vect_impl::store_mask(lhs_mem + i + 1 * IT::size, rhs.template load_mask<vect_impl>(i + 1 * IT::size));
+        }
+
+        for (; i + IT::size - 1 < last; i += IT::size) {
+            vect_impl::store_mask(lhs_mem + i, rhs.template load_mask<vect_impl>(i));
+        }
+
+        for (; i < last; ++i) {
+            lhs_mem[i] = rhs[i];
+        }
+    }
+
+    /*!
+     * \brief Compute all the elements of the boolean expression
+     * \param lhs The boolean container
+     * \param rhs The boolean expression
+     */
+    template <typename L_Expr, typename R_Expr>
+    static void apply(L_Expr&& lhs, R_Expr&& rhs) {
+        apply(lhs, rhs, 0, etl::size(lhs));
+    }
+};
+
 } //end of namespace detail
 
 } //end of namespace etl
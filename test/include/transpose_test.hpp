@@ -5,6 +5,14 @@
 //  http://opensource.org/licenses/MIT)
 //=======================================================================
 
+#ifdef ETL_VECTORIZE_IMPL
+#ifdef __AVX__
+#define TEST_VEC
+#elif defined(__SSE3__)
+#define TEST_VEC
+#endif
+#endif
+
 #define TRANSPOSE_FUNCTOR(name, ...)      \
     struct name {                         \
         template <typename A, typename C> \
@@ -33,6 +41,17 @@ INPLACE_TRANSPOSE_FUNCTOR(std_inplace_trans, SELECTED_SECTION(etl::transpose_imp
 #define INPLACE_TRANSPOSE_TEST_CASE_SECTION_DEFAULT TRANSPOSE_TEST_CASE_SECTIONS(default_inplace_trans, default_inplace_trans)
 #define INPLACE_TRANSPOSE_TEST_CASE_SECTION_STD TRANSPOSE_TEST_CASE_SECTIONS(std_inplace_trans, std_inplace_trans)
 
+#ifdef TEST_VEC
+TRANSPOSE_FUNCTOR(vec_transpose, c = selected_helper(etl::transpose_impl::VEC, transpose(a)))
+INPLACE_TRANSPOSE_FUNCTOR(vec_inplace_trans, SELECTED_SECTION(etl::transpose_impl::VEC) { a.transpose_inplace(); })
+
+#define TRANSPOSE_TEST_CASE_SECTION_VEC TRANSPOSE_TEST_CASE_SECTIONS(vec_transpose, vec_transpose)
+#define INPLACE_TRANSPOSE_TEST_CASE_SECTION_VEC TRANSPOSE_TEST_CASE_SECTIONS(vec_inplace_trans, vec_inplace_trans)
+#else
+#define TRANSPOSE_TEST_CASE_SECTION_VEC
+#define INPLACE_TRANSPOSE_TEST_CASE_SECTION_VEC
+#endif
+
 #ifdef ETL_MKL_MODE
 TRANSPOSE_FUNCTOR(blas_transpose, c = selected_helper(etl::transpose_impl::MKL, transpose(a)))
 INPLACE_TRANSPOSE_FUNCTOR(blas_inplace_trans, SELECTED_SECTION(etl::transpose_impl::MKL) { a.transpose_inplace(); })
@@ -77,6 +96,7 @@ INPLACE_TRANSPOSE_FUNCTOR(cublas_inplace_trans, SELECTED_SECTION(etl::transpose_
     TRANSPOSE_TEST_CASE_DECL(name, description) { \
         TRANSPOSE_TEST_CASE_SECTION_DEFAULT       \
         TRANSPOSE_TEST_CASE_SECTION_STD           \
+        TRANSPOSE_TEST_CASE_SECTION_VEC           \
         TRANSPOSE_TEST_CASE_SECTION_BLAS          \
         TRANSPOSE_TEST_CASE_SECTION_CUBLAS        \
     }                                             \
@@ -86,6 +106,7 @@ INPLACE_TRANSPOSE_FUNCTOR(cublas_inplace_trans, SELECTED_SECTION(etl::transpose_
     TRANSPOSE_TEST_CASE_DECL(name, description) {      \
         INPLACE_TRANSPOSE_TEST_CASE_SECTION_DEFAULT    \
         INPLACE_TRANSPOSE_TEST_CASE_SECTION_STD        \
+        INPLACE_TRANSPOSE_TEST_CASE_SECTION_VEC        \
         INPLACE_TRANSPOSE_TEST_CASE_SECTION_BLAS       \
         INPLACE_TRANSPOSE_TEST_CASE_SECTION_CUBLAS     \
     }                                                  \
@@ -0,0 +1,100 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#include "test_light.hpp"
+
+TEMPLATE_TEST_CASE_2("assign_many/0", "[assign_many]", Z, float, double) {
+    etl::fast_vector<Z, 3> a{1.0, 2.0, 3.0};
+    etl::fast_vector<Z, 3> b{4.0, 5.0, 6.0};
+
+    etl::fast_vector<Z, 3> c;
+    etl::fast_vector<Z, 3> d;
+
+    etl::assign_many(etl::assign(c, a + b), etl::assign(d, a >> b));
+
+    REQUIRE_EQUALS(c[0], Z(5.0));
+    REQUIRE_EQUALS(c[1], Z(7.0));
+    REQUIRE_EQUALS(c[2], Z(9.0));
+
+    REQUIRE_EQUALS(d[0], Z(4.0));
+    REQUIRE_EQUALS(d[1], Z(10.0));
+    REQUIRE_EQUALS(d[2], Z(18.0));
+}
+
+// The later expressions must see the results of the previous ones
+TEMPLATE_TEST_CASE_2("assign_many/1", "[assign_many]", Z, float, double) {
+    etl::dyn_vector<Z> a{1.0, 2.0, 3.0, 4.0, 5.0};
+    etl::dyn_vector<Z> b(5);
+    etl::dyn_vector<Z> c(5);
+
+    etl::assign_many(etl::assign(b, a * Z(2.0)), etl::assign(c, b + a), etl::assign(a, c - b));
+
+    for (size_t i = 0; i < 5; ++i) {
+        REQUIRE_EQUALS(b[i], Z(2.0 * (i + 1)));
+        REQUIRE_EQUALS(c[i], Z(3.0 * (i + 1)));
+        REQUIRE_EQUALS(a[i], Z(1.0 * (i + 1)));
+    }
+}
+
+// Adam update, compared to the separate assignments
+TEMPLATE_TEST_CASE_2("assign_many/2", "[assign_many]", Z, float, double) {
+    const size_t n = 10003;
+
+    const Z beta1 = 0.9;
+    const Z beta2 = 0.999;
+    const Z lr    = 0.001;
+    const Z eps   = 1e-8;
+
+    etl::dyn_vector<Z> g(n);
+    etl::dyn_vector<Z> m(n);
+    etl::dyn_vector<Z> v(n);
+    etl::dyn_vector<Z> w(n);
+
+    g = etl::uniform_generator(-1.0, 1.0);
+    m = etl::uniform_generator(-1.0, 1.0);
+    v = etl::uniform_generator(0.0, 1.0);
+    w = etl::uniform_generator(-1.0, 1.0);
+
+    etl::dyn_vector<Z> m_ref(m);
+    etl::dyn_vector<Z> v_ref(v);
+    etl::dyn_vector<Z> w_ref(w);
+
+    m_ref = beta1 * m_ref + (Z(1) - beta1) * g;
+    v_ref = beta2 * v_ref + (Z(1) - beta2) * (g >> g);
+    w_ref = w_ref - lr * (m_ref / (etl::sqrt(v_ref) + eps));
+
+    etl::assign_many(
+        etl::assign(m, beta1 * m + (Z(1) - beta1) * g),
+        etl::assign(v, beta2 * v + (Z(1) - beta2) * (g >> g)),
+        etl::assign(w, w - lr * (m / (etl::sqrt(v) + eps))));
+
+    for (size_t i = 0; i < n; ++i) {
+        REQUIRE_EQUALS_APPROX(m[i], m_ref[i]);
+        REQUIRE_EQUALS_APPROX(v[i], v_ref[i]);
+        REQUIRE_EQUALS_APPROX(w[i], w_ref[i]);
+    }
+}
+
+// Sub views and non-vectorizable expressions
+TEMPLATE_TEST_CASE_2("assign_many/3", "[assign_many]", Z, float, double) {
+    etl::dyn_matrix<Z> a(3, 1029);
+    etl::dyn_matrix<Z> b(3, 1029);
+
+    a = etl::sequence_generator(1.0);
+    b = Z(0);
+
+    etl::dyn_vector<Z> c(1029);
+
+    etl::assign_many(etl::assign(b(1), etl::abs(a(1)) + Z(1)), etl::assign(c, etl::log(b(1))));
+
+    for (size_t i = 0; i < 1029; ++i) {
+        REQUIRE_EQUALS(b(0, i), Z(0));
+        REQUIRE_EQUALS(b(1, i), a(1, i) + Z(1));
+        REQUIRE_EQUALS(b(2, i), Z(0));
+        REQUIRE_EQUALS_APPROX(c[i], std::log(a(1, i) + Z(1)));
+    }
+}
@@ -142,6 +142,41 @@ TEMPLATE_TEST_CASE_2("big/sum/2", "[big][sum]", Z, double, float) {
     REQUIRE_EQUALS(etl::asum(b), 2.5 * (etl::sum_parallel_threshold + 100));
 }
 
+TEMPLATE_TEST_CASE_2("big/accurate_sum/1", "[big][sum]", Z, double, float) {
+    etl::dyn_vector<Z> a(1000 * 1000 + 17);
+
+    double ref = 0.0;
+
+    for (size_t i = 0; i < a.size(); ++i) {
+        a[i] = Z(0.1) + Z(i % 7) * Z(0.01);
+        ref += double(a[i]);
+    }
+
+    Z value = etl::accurate_sum(a);
+
+    REQUIRE_EQUALS_APPROX_E(value, Z(ref), 1e-6);
+
+    SERIAL_SECTION {
+        REQUIRE_EQUALS(etl::accurate_sum(a), value);
+    }
+
+    ACCURATE_SECTION {
+        REQUIRE_EQUALS(etl::sum(a), value);
+        REQUIRE_EQUALS_APPROX_E(etl::mean(a), Z(ref / a.size()), 1e-6);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("big/accurate_sum/2", "[big][sum]", Z, double, float) {
+    etl::dyn_vector<Z> a(etl::sum_parallel_threshold + 100);
+
+    a = 1.0;
+    a[3] = 1e8;
+    a[a.size() - 3] = -1e8;
+
+    REQUIRE_EQUALS(etl::accurate_sum(a), Z(etl::sum_parallel_threshold + 98));
+    REQUIRE_EQUALS(etl::accurate_sum(a + a), Z(2 * (etl::sum_parallel_threshold + 98)));
+}
+
 TEMPLATE_TEST_CASE_2("big/exp", "[big][exp]", Z, double, float) {
     etl::dyn_matrix<Z> a(1024UL, 2UL);
     etl::dyn_matrix<Z> c(1024UL, 2UL);
@@ -323,3 +323,144 @@ CONV4_VALID_FILTER_FLIPPED_TEST_CASE("conv/4d/stride/valid/filter/flipped/1", "[
         REQUIRE_EQUALS_APPROX_E(c[i], ref[i], 0.1);
     }
 }
+
+// Strided and padded convolutions, compared to the standard implementation
+
+TEMPLATE_TEST_CASE_2("conv/4d/stride/valid/flipped/5", "[conv][conv4][valid]", T, float, double) {
+    etl::dyn_matrix<T, 4> I(3, 4, 13, 11);
+    etl::dyn_matrix<T, 4> K(5, 4, 3, 3);
+
+    I = etl::uniform_generator(-1.0, 1.0);
+    K = etl::uniform_generator(-1.0, 1.0);
+
+    etl::dyn_matrix<T, 4> ref(3, 5, 7, 5);
+    etl::dyn_matrix<T, 4> c(3, 5, 7, 5);
+
+    SELECTED_SECTION(etl::conv4_impl::STD) {
+        ref = etl::conv_4d_valid_flipped(I, K, 2, 3, 1, 2);
+    }
+
+    SELECTED_SECTION(etl::conv4_impl::VEC) {
+        c = etl::conv_4d_valid_flipped(I, K, 2, 3, 1, 2);
+
+        REQUIRE_DIRECT(approx_equals(c, ref, base_eps_etl_large));
+    }
+
+    SELECTED_SECTION(etl::conv4_impl::BLAS_VEC) {
+        c = etl::conv_4d_valid_flipped(I, K, 2, 3, 1, 2);
+
+        REQUIRE_DIRECT(approx_equals(c, ref, base_eps_etl_large));
+    }
+
+    SELECTED_SECTION(etl::conv4_impl::BLAS_MKL) {
+        c = etl::conv_4d_valid_flipped(I, K, 2, 3, 1, 2);
+
+        REQUIRE_DIRECT(approx_equals(c, ref, base_eps_etl_large));
+    }
+}
+
+// Dilated convolutions, compared to the convolution by the dilated kernels
+
+TEMPLATE_TEST_CASE_2("conv/4d/dilated/valid/1", "[conv][conv4][valid]", T, float, double) {
+    etl::dyn_matrix<T, 4> I(2, 3, 12, 12);
+    etl::dyn_matrix<T, 4> K(4, 3, 3, 3);
+    etl::dyn_matrix<T, 4> KD(4, 3, 5, 5);
+
+    I = etl::uniform_generator(-1.0, 1.0);
+    K = etl::uniform_generator(-1.0, 1.0);
+
+    KD = T(0);
+
+    for (size_t k = 0; k < 4; ++k) {
+        for (size_t c = 0; c < 3; ++c) {
+            for (size_t a = 0; a < 3; ++a) {
+                for (size_t b = 0; b < 3; ++b) {
+                    KD(k, c, a * 2, b * 2) = K(k, c, a, b);
+                }
+            }
+        }
+    }
+
+    etl::dyn_matrix<T, 4> ref(2, 4, 8, 8);
+    etl::dyn_matrix<T, 4> c(2, 4, 8, 8);
+
+    SELECTED_SECTION(etl::conv4_impl::STD) {
+        ref = etl::conv_4d_valid(I, KD, 1, 1, 0, 0);
+    }
+
+    SELECTED_SECTION(etl::conv4_impl::STD) {
+        c = etl::conv_4d_valid(I, K, 1, 1, 0, 0, 2, 2);
+
+        REQUIRE_DIRECT(approx_equals(c, ref, base_eps_etl_large));
+    }
+
+    SELECTED_SECTION(etl::conv4_impl::VEC) {
+        c = etl::conv_4d_valid(I, K, 1, 1, 0, 0, 2, 2);
+
+        REQUIRE_DIRECT(approx_equals(c, ref, base_eps_etl_large));
+    }
+
+    SELECTED_SECTION(etl::conv4_impl::BLAS_VEC) {
+        c = etl::conv_4d_valid(I, K, 1, 1, 0, 0, 2, 2);
+
+        REQUIRE_DIRECT(approx_equals(c, ref, base_eps_etl_large));
+    }
+
+    SELECTED_SECTION(etl::conv4_impl::BLAS_MKL) {
+        c = etl::conv_4d_valid(I, K, 1, 1, 0, 0, 2, 2);
+
+        REQUIRE_DIRECT(approx_equals(c, ref, base_eps_etl_large));
+    }
+}
+
+TEMPLATE_TEST_CASE_2("conv/4d/dilated/valid/flipped/1", "[conv][conv4][valid]", T, float, double) {
+    etl::dyn_matrix<T, 4> I(3, 2, 15, 14);
+    etl::dyn_matrix<T, 4> K(5, 2, 3, 2);
+    etl::dyn_matrix<T, 4> KD(5, 2, 7, 4);
+
+    I = etl::uniform_generator(-1.0, 1.0);
+    K = etl::uniform_generator(-1.0, 1.0);
+
+    KD = T(0);
+
+    for (size_t k = 0; k < 5; ++k) {
+        for (size_t c = 0; c < 2; ++c) {
+            for (size_t a = 0; a < 3; ++a) {
+                for (size_t b = 0; b < 2; ++b) {
+                    KD(k, c, a * 3, b * 3) = K(k, c, a, b);
+                }
+            }
+        }
+    }
+
+    etl::dyn_matrix<T, 4> ref(3, 5, 6, 7);
+    etl::dyn_matrix<T, 4> c(3, 5, 6, 7);
+
+    SELECTED_SECTION(etl::conv4_impl::STD) {
+        ref = etl::ml::convolution_forward(I, KD, 2, 2, 1, 1);
+    }
+
+    SELECTED_SECTION(etl::conv4_impl::STD) {
+        c = etl::ml::convolution_forward(I, K, 2, 2, 1, 1, 3, 3);
+
+        REQUIRE_DIRECT(approx_equals(c, ref, base_eps_etl_large));
+    }
+
+    SELECTED_SECTION(etl::conv4_impl::VEC) {
+        c = etl::ml::convolution_forward(I, K, 2, 2, 1, 1, 3, 3);
+
+        REQUIRE_DIRECT(approx_equals(c, ref, base_eps_etl_large));
+    }
+
+    SELECTED_SECTION(etl::conv4_impl::BLAS_VEC) {
+        c = etl::ml::convolution_forward(I, K, 2, 2, 1, 1, 3, 3);
+
+        REQUIRE_DIRECT(approx_equals(c, ref, base_eps_etl_large));
+    }
+
+    SELECTED_SECTION(etl::conv4_impl::BLAS_MKL) {
+        c = etl::ml::convolution_forward(I, K, 2, 2, 1, 1, 3, 3);
+
+        REQUIRE_DIRECT(approx_equals(c, ref, base_eps_etl_large));
+    }
+}
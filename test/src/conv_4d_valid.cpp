@@ -175,3 +175,31 @@ CONV4_VALID_FLIPPED_TEST_CASE("conv_4d/valid_6", "[conv][conv4][valid]") {
         REQUIRE_EQUALS_APPROX_E(c[i], ref[i], 0.1);
     }
 }
+
+CONV4_VALID_TEST_CASE("conv_4d/valid_7", "[conv][conv4][valid]") {
+    etl::fast_matrix<T, 2, 16, 23, 21> I;
+    etl::fast_matrix<T, 5, 16, 3, 3> K;
+
+    I = etl::uniform_generator(-1.0, 1.0);
+    K = etl::uniform_generator(-1.0, 1.0);
+
+    etl::fast_matrix<T, 2, 5, 21, 19> ref;
+    etl::fast_matrix<T, 2, 5, 21, 19> c;
+
+    SELECTED_SECTION(etl::conv_impl::STD) {
+        ref = 0.0;
+        for (size_t i = 0; i < etl::dim<0>(I); ++i) {
+            for (size_t c = 0; c < etl::dim<1>(K); ++c) {
+                for (size_t k = 0; k < etl::dim<0>(K); ++k) {
+                    ref(i)(k) += conv_2d_valid(I(i)(c), K(k)(c));
+                }
+            }
+        }
+    }
+
+    Impl::apply(I, K, c);
+
+    for (size_t i = 0; i < ref.size(); ++i) {
+        REQUIRE_EQUALS_APPROX_E(c[i], ref[i], 0.1);
+    }
+}
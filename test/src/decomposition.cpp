@@ -57,3 +57,283 @@ TEMPLATE_TEST_CASE_2("globals/qr/1", "[globals][QR]", Z, float, double) {
     // and the large difference in computation around zero
     REQUIRE_DIRECT(approx_equals(QR, A, 100 * base_eps_etl));
 }
+
+TEMPLATE_TEST_CASE_2("globals/qr/2", "[globals][QR]", Z, float, double) {
+    etl::dyn_matrix<Z> A(97, 71);
+    etl::dyn_matrix<Z> Q(97, 97);
+    etl::dyn_matrix<Z> R(97, 71);
+
+    A = etl::uniform_generator<Z>(-1.0, 1.0);
+
+    etl::qr(A, Q, R);
+
+    etl::dyn_matrix<Z> QR;
+    QR = Q * R;
+
+    REQUIRE_DIRECT(etl::max(etl::abs(QR - A)) < 1e-4);
+
+    etl::dyn_matrix<Z> QtQ;
+    QtQ = etl::transpose(Q) * Q;
+
+    for (size_t i = 0; i < 97; ++i) {
+        for (size_t j = 0; j < 97; ++j) {
+            REQUIRE_DIRECT(std::abs(QtQ(i, j) - (i == j ? 1.0 : 0.0)) < 1e-3);
+        }
+    }
+
+    for (size_t i = 0; i < 97; ++i) {
+        for (size_t j = 0; j < i && j < 71; ++j) {
+            REQUIRE_EQUALS(R(i, j), Z(0));
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("globals/lu/3", "[globals][LU]", Z, float, double) {
+    etl::dyn_matrix<Z> A(131, 131);
+    etl::dyn_matrix<Z> L(131, 131);
+    etl::dyn_matrix<Z> U(131, 131);
+    etl::dyn_matrix<Z> P(131, 131);
+
+    A = etl::uniform_generator<Z>(-1.0, 1.0);
+
+    etl::lu(A, L, U, P);
+
+    etl::dyn_matrix<Z> PA;
+    etl::dyn_matrix<Z> LU;
+    PA = P * A;
+    LU = L * U;
+
+    REQUIRE_DIRECT(etl::max(etl::abs(PA - LU)) < 1e-4);
+
+    for (size_t i = 0; i < 131; ++i) {
+        REQUIRE_EQUALS(L(i, i), Z(1));
+
+        for (size_t j = i + 1; j < 131; ++j) {
+            REQUIRE_EQUALS(L(i, j), Z(0));
+            REQUIRE_EQUALS(U(j, i), Z(0));
+
+            // Partial pivoting
+            REQUIRE_DIRECT(std::abs(L(j, i)) <= Z(1));
+        }
+    }
+}
+
+/* cholesky */
+
+TEMPLATE_TEST_CASE_2("globals/cholesky/1", "[globals][cholesky]", Z, float, double) {
+    etl::fast_matrix<Z, 3, 3> A{4, 12, -16, 12, 37, -43, -16, -43, 98};
+    etl::fast_matrix<Z, 3, 3> L;
+
+    REQUIRE_DIRECT(etl::cholesky(A, L));
+
+    REQUIRE_EQUALS_APPROX(L(0, 0), Z(2));
+    REQUIRE_EQUALS_APPROX(L(1, 0), Z(6));
+    REQUIRE_EQUALS_APPROX(L(1, 1), Z(1));
+    REQUIRE_EQUALS_APPROX(L(2, 0), Z(-8));
+    REQUIRE_EQUALS_APPROX(L(2, 1), Z(5));
+    REQUIRE_EQUALS_APPROX(L(2, 2), Z(3));
+
+    REQUIRE_EQUALS(L(0, 1), Z(0));
+    REQUIRE_EQUALS(L(0, 2), Z(0));
+    REQUIRE_EQUALS(L(1, 2), Z(0));
+}
+
+TEMPLATE_TEST_CASE_2("globals/cholesky/2", "[globals][cholesky]", Z, float, double) {
+    etl::dyn_matrix<Z> M(149, 149);
+    etl::dyn_matrix<Z> A(149, 149);
+    etl::dyn_matrix<Z> L(149, 149);
+
+    M = etl::uniform_generator<Z>(-1.0, 1.0);
+    A = M * etl::transpose(M);
+
+    for (size_t i = 0; i < 149; ++i) {
+        A(i, i) += 149;
+    }
+
+    REQUIRE_DIRECT(etl::cholesky(A, L));
+
+    etl::dyn_matrix<Z> LLt;
+    LLt = L * etl::transpose(L);
+
+    REQUIRE_DIRECT(etl::max(etl::abs(A - LLt)) < 1e-2);
+
+    for (size_t i = 0; i < 149; ++i) {
+        REQUIRE_DIRECT(L(i, i) > Z(0));
+
+        for (size_t j = i + 1; j < 149; ++j) {
+            REQUIRE_EQUALS(L(i, j), Z(0));
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("globals/cholesky/3", "[globals][cholesky]", Z, float, double) {
+    etl::fast_matrix<Z, 3, 3> A{1, 2, 3, 2, 1, 4, 3, 4, 1};
+    etl::fast_matrix<Z, 3, 3> L;
+
+    REQUIRE_DIRECT(!etl::cholesky(A, L));
+}
+
+/* solve */
+
+TEMPLATE_TEST_CASE_2("solve/1", "[solve]", Z, float, double) {
+    etl::fast_matrix<Z, 3, 3> A{2, 1, -1, -3, -1, 2, -2, 1, 2};
+    etl::fast_vector<Z, 3> b{8, -11, -3};
+    etl::fast_vector<Z, 3> x;
+
+    x = etl::solve(A, b);
+
+    REQUIRE_EQUALS_APPROX(x[0], Z(2));
+    REQUIRE_EQUALS_APPROX(x[1], Z(3));
+    REQUIRE_EQUALS_APPROX(x[2], Z(-1));
+}
+
+TEMPLATE_TEST_CASE_2("solve/2", "[solve]", Z, float, double) {
+    etl::dyn_matrix<Z> A(157, 157);
+    etl::dyn_matrix<Z> X(157, 13);
+    etl::dyn_matrix<Z> B(157, 13);
+
+    A = etl::uniform_generator<Z>(-1.0, 1.0);
+    X = etl::uniform_generator<Z>(-1.0, 1.0);
+    B = A * X;
+
+    etl::dyn_matrix<Z> Y;
+    Y = etl::solve(A, B);
+
+    REQUIRE_EQUALS(etl::dim<0>(Y), 157UL);
+    REQUIRE_EQUALS(etl::dim<1>(Y), 13UL);
+
+    etl::dyn_matrix<Z> AY;
+    AY = A * Y;
+
+    REQUIRE_DIRECT(etl::max(etl::abs(AY - B)) < 1e-2);
+}
+
+TEMPLATE_TEST_CASE_2("solve/3", "[solve]", Z, float, double) {
+    // Least-squares fit of a line
+    etl::dyn_matrix<Z> A(100, 2);
+    etl::dyn_vector<Z> b(100);
+
+    for (size_t i = 0; i < 100; ++i) {
+        A(i, 0) = 1.0;
+        A(i, 1) = i * 0.01;
+        b[i]    = 3.0 - 2.0 * i * 0.01 + (i % 2 ? 0.01 : -0.01);
+    }
+
+    etl::dyn_vector<Z> x(2);
+    x = etl::solve(A, b);
+
+    REQUIRE_DIRECT(std::abs(x[0] - Z(3)) < 1e-3);
+    REQUIRE_DIRECT(std::abs(x[1] - Z(-2)) < 1e-2);
+
+    // The residual must be orthogonal to the columns of A
+    etl::dyn_vector<Z> r;
+    r = b - A * x;
+
+    etl::dyn_vector<Z> Atr;
+    Atr = etl::transpose(A) * r;
+
+    REQUIRE_DIRECT(std::abs(Atr[0]) < 1e-3);
+    REQUIRE_DIRECT(std::abs(Atr[1]) < 1e-3);
+}
+
+TEMPLATE_TEST_CASE_2("solve/4", "[solve]", Z, float, double) {
+    etl::dyn_matrix<Z> A(83, 83);
+    etl::dyn_matrix<Z> I(83, 83);
+
+    A = etl::uniform_generator<Z>(-1.0, 1.0);
+
+    etl::dyn_matrix<Z> C;
+    C = etl::inv(A);
+
+    I = A * C;
+
+    for (size_t i = 0; i < 83; ++i) {
+        for (size_t j = 0; j < 83; ++j) {
+            REQUIRE_DIRECT(std::abs(I(i, j) - (i == j ? 1.0 : 0.0)) < 1e-2);
+        }
+    }
+}
+
+/* cholesky_solve */
+
+TEMPLATE_TEST_CASE_2("cholesky_solve/1", "[solve][cholesky]", Z, float, double) {
+    etl::fast_matrix<Z, 3, 3> A{4, 12, -16, 12, 37, -43, -16, -43, 98};
+    etl::fast_vector<Z, 3> b{-36, -105, 168};
+    etl::fast_vector<Z, 3> x;
+
+    x = etl::cholesky_solve(A, b);
+
+    REQUIRE_DIRECT(std::abs(x[0] - Z(1)) < 1e-3);
+    REQUIRE_DIRECT(std::abs(x[1] - Z(-2)) < 1e-3);
+    REQUIRE_DIRECT(std::abs(x[2] - Z(1)) < 1e-3);
+}
+
+TEMPLATE_TEST_CASE_2("cholesky_solve/2", "[solve][cholesky]", Z, float, double) {
+    etl::dyn_matrix<Z> M(141, 141);
+    etl::dyn_matrix<Z> A(141, 141);
+    etl::dyn_matrix<Z> X(141, 7);
+    etl::dyn_matrix<Z> B(141, 7);
+
+    M = etl::uniform_generator<Z>(-1.0, 1.0);
+    A = M * etl::transpose(M);
+
+    for (size_t i = 0; i < 141; ++i) {
+        A(i, i) += 141;
+    }
+    X = etl::uniform_generator<Z>(-1.0, 1.0);
+    B = A * X;
+
+    etl::dyn_matrix<Z> Y;
+    Y = etl::cholesky_solve(A, B);
+
+    REQUIRE_DIRECT(etl::max(etl::abs(X - Y)) < 1e-3);
+}
+
+TEMPLATE_TEST_CASE_2("cholesky_solve/3", "[solve][cholesky]", Z, float, double) {
+    // Not positive definite, solved with LU
+    etl::fast_matrix<Z, 3, 3> A{1, 2, 3, 2, 1, 4, 3, 4, 1};
+    etl::fast_vector<Z, 3> x{1, 2, 3};
+    etl::fast_vector<Z, 3> b;
+    etl::fast_vector<Z, 3> y;
+
+    b = A * x;
+    y = etl::cholesky_solve(A, b);
+
+    REQUIRE_DIRECT(std::abs(y[0] - Z(1)) < 1e-3);
+    REQUIRE_DIRECT(std::abs(y[1] - Z(2)) < 1e-3);
+    REQUIRE_DIRECT(std::abs(y[2] - Z(3)) < 1e-3);
+}
+
+TEMPLATE_TEST_CASE_2("cholesky_solve/4", "[solve][cholesky]", Z, float, double) {
+    etl::dyn_matrix<Z> M(97, 97);
+    etl::dyn_matrix<Z> S(97, 97);
+
+    M = etl::uniform_generator<Z>(-1.0, 1.0);
+    S = M * etl::transpose(M);
+
+    for (size_t i = 0; i < 97; ++i) {
+        S(i, i) += 97;
+    }
+
+    // Make sure it is exactly symmetric
+    for (size_t i = 0; i < 97; ++i) {
+        for (size_t j = 0; j < i; ++j) {
+            S(j, i) = S(i, j);
+        }
+    }
+
+    etl::symmetric_matrix<etl::dyn_matrix<Z>> A(97UL);
+    A = S;
+
+    etl::dyn_matrix<Z> C;
+    C = etl::inv(A);
+
+    etl::dyn_matrix<Z> I;
+    I = S * C;
+
+    for (size_t i = 0; i < 97; ++i) {
+        for (size_t j = 0; j < 97; ++j) {
+            REQUIRE_DIRECT(std::abs(I(i, j) - (i == j ? 1.0 : 0.0)) < 1e-3);
+        }
+    }
+}
@@ -194,3 +194,37 @@ TEMPLATE_TEST_CASE_2("dyn_p_max_pool_p_6", "p_max_pool_p_2d", Z, float, double)
     REQUIRE_EQUALS_APPROX(b(1, 1, 0), 0.19151);
     REQUIRE_EQUALS_APPROX(b(1, 1, 1), 0.00054);
 }
+
+// Larger batches, compared to the definition
+TEMPLATE_TEST_CASE_2("dyn_p_max_pool_8", "p_max_pool_3d", Z, float, double) {
+    etl::dyn_matrix<Z, 3> a(7, 16, 36);
+    etl::dyn_matrix<Z, 3> h(7, 16, 36);
+    etl::dyn_matrix<Z, 3> p(7, 4, 9);
+
+    a = etl::uniform_generator(-2.0, 2.0);
+
+    h = etl::p_max_pool_h(a, 4, 4);
+    p = etl::p_max_pool_p(a, 4, 4);
+
+    for (size_t l = 0; l < 7; ++l) {
+        for (size_t i = 0; i < 4; ++i) {
+            for (size_t j = 0; j < 9; ++j) {
+                Z s = 0;
+
+                for (size_t ii = 0; ii < 4; ++ii) {
+                    for (size_t jj = 0; jj < 4; ++jj) {
+                        s += std::exp(a(l, i * 4 + ii, j * 4 + jj));
+                    }
+                }
+
+                REQUIRE_EQUALS_APPROX(p(l, i, j), Z(1) / (Z(1) + s));
+
+                for (size_t ii = 0; ii < 4; ++ii) {
+                    for (size_t jj = 0; jj < 4; ++jj) {
+                        REQUIRE_EQUALS_APPROX(h(l, i * 4 + ii, j * 4 + jj), std::exp(a(l, i * 4 + ii, j * 4 + jj)) / (Z(1) + s));
+                    }
+                }
+            }
+        }
+    }
+}
@@ -411,3 +411,78 @@ TEMPLATE_TEST_CASE_2("elt_compare/greater_equal/3", "[compare]", Z, float, doubl
     REQUIRE_EQUALS(c(2, 1, 0), false);
     REQUIRE_EQUALS(c(2, 1, 1), true);
 }
+
+TEMPLATE_TEST_CASE_2("elt_compare/large/1", "[compare]", Z, float, double) {
+    etl::dyn_vector<Z> a(1037);
+    etl::dyn_vector<Z> b(1037);
+    etl::dyn_vector<bool> c(1037);
+
+    a = etl::uniform_generator(-10.0, 10.0);
+    b = etl::uniform_generator(-10.0, 10.0);
+
+    for (size_t i = 0; i < 1037; i += 7) {
+        b[i] = a[i];
+    }
+
+    c = equal(a, b);
+
+    for (size_t i = 0; i < 1037; ++i) {
+        REQUIRE_EQUALS(c[i], a[i] == b[i]);
+    }
+
+    c = not_equal(a, b);
+
+    for (size_t i = 0; i < 1037; ++i) {
+        REQUIRE_EQUALS(c[i], a[i] != b[i]);
+    }
+
+    c = less(a, b);
+
+    for (size_t i = 0; i < 1037; ++i) {
+        REQUIRE_EQUALS(c[i], a[i] < b[i]);
+    }
+
+    c = less_equal(a, b);
+
+    for (size_t i = 0; i < 1037; ++i) {
+        REQUIRE_EQUALS(c[i], a[i] <= b[i]);
+    }
+
+    c = greater(a, b);
+
+    for (size_t i = 0; i < 1037; ++i) {
+        REQUIRE_EQUALS(c[i], a[i] > b[i]);
+    }
+
+    c = greater_equal(a, b);
+
+    for (size_t i = 0; i < 1037; ++i) {
+        REQUIRE_EQUALS(c[i], a[i] >= b[i]);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("elt_compare/large/2", "[compare]", Z, float, double) {
+    etl::dyn_matrix<Z> a(33, 31);
+    etl::dyn_matrix<bool> c(33, 31);
+
+    a = etl::uniform_generator(-10.0, 10.0);
+    a[3] = std::numeric_limits<Z>::quiet_NaN();
+
+    c = less(a, Z(1.0));
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        REQUIRE_EQUALS(c[i], a[i] < Z(1.0));
+    }
+
+    c = not_equal(a, Z(1.0));
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        REQUIRE_EQUALS(c[i], a[i] != Z(1.0));
+    }
+
+    c = greater_equal(Z(1.0), a);
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        REQUIRE_EQUALS(c[i], Z(1.0) >= a[i]);
+    }
+}
@@ -47,3 +47,30 @@ TEST_CASE("elt_logical/xor/1", "[compare]") {
     REQUIRE_EQUALS(c(1, 0), false);
     REQUIRE_EQUALS(c(1, 1), true);
 }
+
+TEMPLATE_TEST_CASE_2("elt_logical/compare/1", "[compare]", Z, float, double) {
+    etl::dyn_vector<Z> a(1029);
+    etl::dyn_vector<Z> b(1029);
+    etl::dyn_vector<bool> c(1029);
+
+    a = etl::uniform_generator(-10.0, 10.0);
+    b = etl::uniform_generator(-10.0, 10.0);
+
+    c = logical_and(less(a, b), greater(a, Z(0.0)));
+
+    for (size_t i = 0; i < 1029; ++i) {
+        REQUIRE_EQUALS(c[i], a[i] < b[i] && a[i] > Z(0.0));
+    }
+
+    c = logical_or(less(a, b), greater(a, Z(0.0)));
+
+    for (size_t i = 0; i < 1029; ++i) {
+        REQUIRE_EQUALS(c[i], a[i] < b[i] || a[i] > Z(0.0));
+    }
+
+    c = logical_xor(less(a, b), logical_and(greater(a, Z(0.0)), less_equal(b, Z(5.0))));
+
+    for (size_t i = 0; i < 1029; ++i) {
+        REQUIRE_EQUALS(c[i], (a[i] < b[i]) != (a[i] > Z(0.0) && b[i] <= Z(5.0)));
+    }
+}
@@ -213,3 +213,189 @@ TEMPLATE_TEST_CASE_2("batch_embedding_gradients/0", "[batch_embedding_gradients]
     REQUIRE_EQUALS(c(7, 1), 0);
     REQUIRE_EQUALS(c(7, 2), 0);
 }
+
+// Repeated rows, accumulated in the order of the sequence
+TEMPLATE_TEST_CASE_2("embedding_gradients/1", "[embedding_gradients]", T, float, double) {
+    etl::dyn_vector<T> a(2049);
+    etl::dyn_matrix<T> b(2049, 33);
+    etl::dyn_matrix<T> c(311, 33);
+    etl::dyn_matrix<T> ref(311, 33);
+
+    for (size_t i = 0; i < 2049; ++i) {
+        a[i] = (i * 17) % 257;
+    }
+
+    b   = etl::uniform_generator(-1.0, 1.0);
+    ref = 0;
+
+    for (size_t i = 0; i < 2049; ++i) {
+        for (size_t j = 0; j < 33; ++j) {
+            ref(a[i], j) += b(i, j);
+        }
+    }
+
+    c = embedding_gradients(a, b, c);
+
+    for (size_t i = 0; i < etl::size(c); ++i) {
+        REQUIRE_EQUALS(c[i], ref[i]);
+    }
+}
+
+// Column-major gradients and errors
+TEMPLATE_TEST_CASE_2("embedding_gradients/2", "[embedding_gradients]", T, float, double) {
+    etl::dyn_vector<T> a({1, 3, 1});
+    etl::dyn_matrix_cm<T, 2> b(3, 2);
+    etl::dyn_matrix_cm<T, 2> c(4, 2);
+
+    b(0, 0) = 1;
+    b(0, 1) = 2;
+    b(1, 0) = 3;
+    b(1, 1) = 4;
+    b(2, 0) = 5;
+    b(2, 1) = 6;
+
+    c = embedding_gradients(a, b, c);
+
+    REQUIRE_EQUALS(c(0, 0), T(0));
+    REQUIRE_EQUALS(c(0, 1), T(0));
+    REQUIRE_EQUALS(c(1, 0), T(6));
+    REQUIRE_EQUALS(c(1, 1), T(8));
+    REQUIRE_EQUALS(c(2, 0), T(0));
+    REQUIRE_EQUALS(c(2, 1), T(0));
+    REQUIRE_EQUALS(c(3, 0), T(3));
+    REQUIRE_EQUALS(c(3, 1), T(4));
+}
+
+TEMPLATE_TEST_CASE_2("batch_embedding_gradients/1", "[batch_embedding_gradients]", T, float, double) {
+    etl::dyn_matrix_cm<T, 2> a(3, 17);
+    etl::dyn_matrix_cm<T, 3> b(3, 17, 5);
+    etl::dyn_matrix_cm<T, 2> c(23, 5);
+    etl::dyn_matrix<T> ref(23, 5);
+
+    for (size_t i = 0; i < 3; ++i) {
+        for (size_t j = 0; j < 17; ++j) {
+            a(i, j) = (i * 17 + j) % 23;
+        }
+    }
+
+    b   = etl::uniform_generator(-1.0, 1.0);
+    ref = 0;
+
+    for (size_t i = 0; i < 3; ++i) {
+        for (size_t j = 0; j < 17; ++j) {
+            for (size_t k = 0; k < 5; ++k) {
+                ref(a(i, j), k) += b(i, j, k);
+            }
+        }
+    }
+
+    c = batch_embedding_gradients(a, b, c);
+
+    for (size_t i = 0; i < 23; ++i) {
+        for (size_t k = 0; k < 5; ++k) {
+            REQUIRE_EQUALS_APPROX(c(i, k), ref(i, k));
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("sparse_embedding_gradients/0", "[embedding_gradients]", T, float, double) {
+    etl::fast_matrix<T, 6> a({1, 2, 3, 2, 6, 0});
+    etl::fast_matrix<T, 6, 3> b{ 1, 2, 3,  4, 5, 6,  0.1, 0.2, 0.3,  -1.0, -1.0, 0.0,  1, 1, 1,  2, 2, 2 };
+    etl::fast_matrix<T, 8, 3> c;
+
+    auto g = etl::sparse_embedding_gradients(a, b, c);
+
+    REQUIRE_EQUALS(g.rows(), 8UL);
+    REQUIRE_EQUALS(g.columns(), 3UL);
+    REQUIRE_EQUALS(g.non_zero_rows(), 5UL);
+
+    REQUIRE_EQUALS(g.indices()[0], 0UL);
+    REQUIRE_EQUALS(g.indices()[1], 1UL);
+    REQUIRE_EQUALS(g.indices()[2], 2UL);
+    REQUIRE_EQUALS(g.indices()[3], 3UL);
+    REQUIRE_EQUALS(g.indices()[4], 6UL);
+
+    REQUIRE_EQUALS(g.values()(0, 0), T(2));
+    REQUIRE_EQUALS(g.values()(1, 2), T(3));
+    REQUIRE_EQUALS(g.values()(2, 0), T(3.0));
+    REQUIRE_EQUALS(g.values()(2, 1), T(4.0));
+    REQUIRE_EQUALS(g.values()(3, 1), T(0.2));
+    REQUIRE_EQUALS(g.values()(4, 2), T(1));
+
+    etl::fast_matrix<T, 8, 3> d;
+    c = embedding_gradients(a, b, c);
+
+    g.assign_to(d);
+
+    REQUIRE_DIRECT(approx_equals(c, d, base_eps));
+}
+
+// Sparse update of a vocabulary
+TEMPLATE_TEST_CASE_2("sparse_embedding_gradients/1", "[embedding_gradients]", T, float, double) {
+    etl::dyn_matrix<T> a(4, 129);
+    etl::dyn_matrix<T, 3> b(4, 129, 17);
+    etl::dyn_matrix<T> w(1031, 17);
+    etl::dyn_matrix<T> ref(1031, 17);
+    etl::dyn_matrix<T> c(1031, 17);
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        a[i] = (i * 13) % 1031;
+    }
+
+    b = etl::uniform_generator(-1.0, 1.0);
+    w = etl::uniform_generator(-1.0, 1.0);
+
+    c   = batch_embedding_gradients(a, b, w);
+    ref = w - T(0.1) * c;
+
+    auto g = etl::sparse_batch_embedding_gradients(a, b, w);
+
+    REQUIRE_EQUALS(g.non_zero_rows(), 516UL);
+
+    g.add_to(w, T(-0.1));
+
+    REQUIRE_DIRECT(approx_equals(w, ref, base_eps));
+}
+
+// Large lookups, with rows of several vectors and a remainder
+TEMPLATE_TEST_CASE_2("embedding_lookup/2", "[embedding_lookup]", T, float, double) {
+    etl::dyn_vector<T> a(1537);
+    etl::dyn_matrix<T> b(513, 37);
+    etl::dyn_matrix<T> c(1537, 37);
+
+    for (size_t i = 0; i < 1537; ++i) {
+        a[i] = (i * 31) % 513;
+    }
+
+    b = etl::uniform_generator(-1.0, 1.0);
+
+    c = embedding_lookup(a, b);
+
+    for (size_t i = 0; i < 1537; ++i) {
+        for (size_t j = 0; j < 37; ++j) {
+            REQUIRE_EQUALS(c(i, j), b(a[i], j));
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("batch_embedding_lookup/1", "[batch_embedding_lookup]", T, float, double) {
+    etl::dyn_matrix<T> a(7, 311);
+    etl::dyn_matrix<T> b(1029, 64);
+    etl::dyn_matrix<T, 3> c(7, 311, 64);
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        a[i] = (i * 11) % 1029;
+    }
+
+    b = etl::uniform_generator(-1.0, 1.0);
+
+    c = batch_embedding_lookup(a, b);
+
+    for (size_t bb = 0; bb < 7; ++bb) {
+        for (size_t i = 0; i < 311; ++i) {
+            for (size_t j = 0; j < 64; ++j) {
+                REQUIRE_EQUALS(c(bb, i, j), b(a(bb, i), j));
+            }
+        }
+    }
+}
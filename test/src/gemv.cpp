@@ -206,3 +206,28 @@ TEMPLATE_TEST_CASE_2("gemv/7", "[gemv]", T, float, double) {
         REQUIRE_EQUALS_APPROX(c[i], 1.0 - c_ref[i]);
     }
 }
+
+GEMV_TEST_CASE("gemv/8", "[gemv]") {
+    etl::dyn_matrix<T> a(263, 517);
+    etl::dyn_vector<T> b(517);
+
+    etl::dyn_vector<T> c(263);
+    etl::dyn_vector<T> c_ref(263);
+
+    a = etl::uniform_generator(-1.0, 1.0);
+    b = etl::uniform_generator(-1.0, 1.0);
+
+    Impl::apply(a, b, c);
+
+    c_ref = 0;
+
+    for (size_t i = 0; i < 263; i++) {
+        for (size_t k = 0; k < 517; k++) {
+            c_ref(i) += a(i, k) * b(k);
+        }
+    }
+
+    for(size_t i = 0; i < etl::size(c); ++i){
+        REQUIRE_DIRECT(std::abs(c[i] - c_ref[i]) < 1e-3);
+    }
+}
@@ -202,3 +202,117 @@ TEMPLATE_TEST_CASE_2("generators/uniform/2", "uniform", Z, float, double) {
         REQUIRE_DIRECT(value <= 8.0);
     }
 }
+
+/// Counter-based generation
+
+TEST_CASE("generators/philox/kat", "[philox]") {
+    auto w1 = etl::philox4x32(0, 0, 0);
+
+    REQUIRE_EQUALS(w1[0], 0x6627e8d5U);
+    REQUIRE_EQUALS(w1[1], 0xe169c58dU);
+    REQUIRE_EQUALS(w1[2], 0xbc57ac4cU);
+    REQUIRE_EQUALS(w1[3], 0x9b00dbd8U);
+
+    // The counter, the stream and the key must all change the block
+    REQUIRE_DIRECT(etl::philox4x32(1, 0, 0) != w1);
+    REQUIRE_DIRECT(etl::philox4x32(1UL << 32, 0, 0) != w1);
+    REQUIRE_DIRECT(etl::philox4x32(0, 1, 0) != w1);
+    REQUIRE_DIRECT(etl::philox4x32(0, 0, 1) != w1);
+    REQUIRE_DIRECT(etl::philox4x32(0, 0, 1UL << 32) != w1);
+}
+
+TEMPLATE_TEST_CASE_2("generators/uniform/3", "uniform", Z, float, double) {
+    etl::dyn_vector<Z> a(10001);
+    etl::dyn_vector<Z> b(10001);
+
+    etl::seed_generators(42);
+    a = etl::uniform_generator<Z>(-1.0, 3.0);
+
+    etl::seed_generators(42);
+    b = etl::uniform_generator<Z>(-1.0, 3.0);
+
+    for (size_t i = 0; i < a.size(); ++i) {
+        REQUIRE_EQUALS(a[i], b[i]);
+        REQUIRE_DIRECT(a[i] >= Z(-1.0));
+        REQUIRE_DIRECT(a[i] <= Z(3.0));
+    }
+
+    REQUIRE_DIRECT(std::abs(etl::mean(a) - 1.0) < 0.05);
+}
+
+TEMPLATE_TEST_CASE_2("generators/uniform/4", "uniform", Z, float, double) {
+    etl::dyn_vector<Z> a(1027);
+
+    etl::seed_generators(7);
+    auto gen = etl::uniform_generator<Z>(2.0, 4.0);
+
+    a = gen;
+
+    // The vectorized values must be the same as the sequential ones
+    etl::seed_generators(7);
+    auto seq = etl::uniform_generator<Z>(2.0, 4.0);
+
+    for (size_t i = 0; i < a.size(); ++i) {
+        REQUIRE_EQUALS_APPROX(a[i], seq());
+    }
+}
+
+TEMPLATE_TEST_CASE_2("normal/dyn_vector_2", "generator", Z, float, double) {
+    etl::dyn_vector<Z> a(20001);
+    etl::dyn_vector<Z> b(20001);
+
+    etl::seed_generators(3);
+    a = etl::normal_generator<Z>(1.0, 2.0);
+
+    etl::seed_generators(3);
+    b = etl::normal_generator<Z>(1.0, 2.0);
+
+    for (size_t i = 0; i < a.size(); ++i) {
+        REQUIRE_EQUALS_APPROX(a[i], b[i]);
+    }
+
+    REQUIRE_DIRECT(std::abs(etl::mean(a) - 1.0) < 0.1);
+    REQUIRE_DIRECT(std::abs(etl::stddev(a) - 2.0) < 0.1);
+
+    // The vectorized values must be the same as the sequential ones
+    etl::seed_generators(3);
+    auto seq = etl::normal_generator<Z>(1.0, 2.0);
+
+    for (size_t i = 0; i < a.size(); ++i) {
+        REQUIRE_DIRECT(std::abs(a[i] - seq()) < 1e-3);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("truncated_normal/dyn_vector_2", "generator", Z, float, double) {
+    etl::dyn_vector<Z> a(10001);
+
+    a = etl::truncated_normal_generator<Z>(0.0, 1.0);
+
+    for (auto value : a) {
+        REQUIRE_DIRECT(value >= Z(-2.0));
+        REQUIRE_DIRECT(value <= Z(2.0));
+    }
+}
+
+TEMPLATE_TEST_CASE_2("generators/noise/1", "[noise]", Z, float, double) {
+    etl::dyn_vector<Z> a(10001);
+    etl::dyn_vector<Z> b(10001);
+    etl::dyn_vector<Z> c(10001);
+
+    a = 1.0;
+
+    b = etl::uniform_noise(a);
+    c = etl::bernoulli(etl::uniform_noise(a) - 1.5);
+
+    for (size_t i = 0; i < a.size(); ++i) {
+        REQUIRE_DIRECT(b[i] >= Z(1.0));
+        REQUIRE_DIRECT(b[i] <= Z(2.0));
+        REQUIRE_DIRECT(c[i] == Z(0.0) || c[i] == Z(1.0));
+    }
+
+    REQUIRE_DIRECT(std::abs(etl::mean(c) - 0.125) < 0.02);
+
+    b = etl::normal_noise(a);
+
+    REQUIRE_DIRECT(std::abs(etl::mean(b) - 1.0) < 0.05);
+}
@@ -107,6 +107,31 @@ GEVM_TEST_CASE("gevm/4", "[gevm]") {
     }
 }
 
+GEVM_TEST_CASE("gevm/5", "[gevm]") {
+    etl::dyn_matrix<T> a(517, 263);
+    etl::dyn_vector<T> b(517);
+
+    etl::dyn_vector<T> c(263);
+    etl::dyn_vector<T> c_ref(263);
+
+    a = etl::uniform_generator(-1.0, 1.0);
+    b = etl::uniform_generator(-1.0, 1.0);
+
+    Impl::apply(b, a, c);
+
+    c_ref = 0;
+
+    for (size_t k = 0; k < 517; k++) {
+        for (size_t j = 0; j < 263; j++) {
+            c_ref(j) += b(k) * a(k, j);
+        }
+    }
+
+    for(size_t i = 0; i < etl::size(c); ++i){
+        REQUIRE_DIRECT(std::abs(c[i] - c_ref[i]) < 1e-3);
+    }
+}
+
 GEVM_T_TEST_CASE("gevm_t/1", "[gevm][gevm_t]") {
     etl::dyn_matrix<T> a(512, 368);
     etl::dyn_vector<T> b(368);
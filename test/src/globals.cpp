@@ -745,3 +745,27 @@ ETL_TEST_CASE("globals/parallel_shuffle/3", "[globals]") {
     REQUIRE_DIRECT(a == c);
     REQUIRE_DIRECT(b == c);
 }
+
+ETL_TEST_CASE("globals/determinant/4", "[globals]") {
+    // Two swaps are necessary
+    etl::fast_matrix<double, 4, 4> a{0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 2, 0, 0, 3, 0};
+
+    REQUIRE_EQUALS_APPROX(determinant(a), 6.0);
+
+    etl::dyn_matrix<double> b(150, 150);
+    b = etl::uniform_generator(-1.0, 1.0);
+
+    etl::dyn_matrix<double> L(150, 150);
+    etl::dyn_matrix<double> U(150, 150);
+    etl::dyn_matrix<double> P(150, 150);
+
+    etl::lu(b, L, U, P);
+
+    double det = 1.0;
+
+    for (size_t i = 0; i < 150; ++i) {
+        det *= U(i, i);
+    }
+
+    REQUIRE_DIRECT(std::abs(std::abs(determinant(b)) - std::abs(det)) <= 1e-6 * std::abs(det));
+}
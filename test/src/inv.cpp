@@ -121,3 +121,105 @@ ETL_TEST_CASE("inv/7", "[inv]") {
     REQUIRE_EQUALS_APPROX(c[7], 1.0);
     REQUIRE_EQUALS_APPROX(c[8], -1.33333);
 }
+
+ETL_TEST_CASE("inv/8", "[inv]") {
+    // Not a permutation matrix (two ones in the first row)
+    etl::fast_matrix<double, 3, 3> a{1.0, 1.0, 0.0, 0.0, 1.0, 0.0, 1.0, 0.0, 1.0};
+    etl::fast_matrix<double, 3, 3> c;
+
+    c = inv(a);
+
+    REQUIRE_EQUALS_APPROX(c[0], 1.0);
+    REQUIRE_EQUALS_APPROX(c[1], -1.0);
+    REQUIRE_EQUALS_APPROX(c[2], 0.0);
+
+    REQUIRE_EQUALS_APPROX(c[3], 0.0);
+    REQUIRE_EQUALS_APPROX(c[4], 1.0);
+    REQUIRE_EQUALS_APPROX(c[5], 0.0);
+
+    REQUIRE_EQUALS_APPROX(c[6], -1.0);
+    REQUIRE_EQUALS_APPROX(c[7], 1.0);
+    REQUIRE_EQUALS_APPROX(c[8], 1.0);
+}
+
+TEMPLATE_TEST_CASE_2("inv/9", "[inv]", Z, float, double) {
+    etl::dyn_matrix<Z> a(157, 157);
+    etl::dyn_matrix<Z> c;
+    etl::dyn_matrix<Z> I;
+
+    a = 0;
+
+    for (size_t i = 0; i < 157; ++i) {
+        for (size_t j = 0; j < i; ++j) {
+            a(i, j) = ((i * 7 + j * 13) % 19) / (19.0 * 157.0);
+        }
+
+        a(i, i) = 1.0 + (i % 5) * 0.25;
+    }
+
+    c = inv(a);
+    I = a * c;
+
+    for (size_t i = 0; i < 157; ++i) {
+        for (size_t j = 0; j < 157; ++j) {
+            REQUIRE_DIRECT(std::abs(I(i, j) - (i == j ? 1.0 : 0.0)) < 1e-4);
+
+            if (j > i) {
+                REQUIRE_EQUALS(c(i, j), Z(0));
+            }
+        }
+    }
+
+    etl::dyn_matrix<Z> b;
+    b = etl::transpose(a);
+
+    c = inv(b);
+    I = b * c;
+
+    for (size_t i = 0; i < 157; ++i) {
+        for (size_t j = 0; j < 157; ++j) {
+            REQUIRE_DIRECT(std::abs(I(i, j) - (i == j ? 1.0 : 0.0)) < 1e-4);
+
+            if (j < i) {
+                REQUIRE_EQUALS(c(i, j), Z(0));
+            }
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("inv/10", "[inv]", Z, float, double) {
+    etl::lower_matrix<etl::fast_matrix<Z, 3, 3>> a;
+    etl::upper_matrix<etl::fast_matrix<Z, 3, 3>> b;
+    etl::diagonal_matrix<etl::fast_matrix<Z, 3, 3>> d;
+    etl::fast_matrix<Z, 3, 3> c;
+
+    a = etl::fast_matrix<Z, 3, 3>{1.0, 0.0, 0.0, 2.0, 3.0, 0.0, 4.0, 5.0, 6.0};
+
+    c = inv(a);
+
+    REQUIRE_EQUALS_APPROX(c(1, 0), Z(-0.66667));
+    REQUIRE_EQUALS_APPROX(c(2, 1), Z(-0.2777778));
+    REQUIRE_EQUALS_APPROX(c(2, 2), Z(0.1666667));
+    REQUIRE_EQUALS(c(0, 1), Z(0));
+
+    b = etl::fast_matrix<Z, 3, 3>{1.0, 2.0, 4.0, 0.0, 3.0, 5.0, 0.0, 0.0, 6.0};
+
+    c = inv(b);
+
+    REQUIRE_EQUALS_APPROX(c(0, 1), Z(-0.66667));
+    REQUIRE_EQUALS_APPROX(c(1, 2), Z(-0.2777778));
+    REQUIRE_EQUALS_APPROX(c(2, 2), Z(0.1666667));
+    REQUIRE_EQUALS(c(1, 0), Z(0));
+
+    d(0, 0) = 2.0;
+    d(1, 1) = 4.0;
+    d(2, 2) = -0.5;
+
+    c = inv(d);
+
+    REQUIRE_EQUALS_APPROX(c(0, 0), Z(0.5));
+    REQUIRE_EQUALS_APPROX(c(1, 1), Z(0.25));
+    REQUIRE_EQUALS_APPROX(c(2, 2), Z(-2.0));
+    REQUIRE_EQUALS(c(0, 1), Z(0));
+    REQUIRE_EQUALS(c(2, 1), Z(0));
+}
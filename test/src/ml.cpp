@@ -80,3 +80,811 @@ TEMPLATE_TEST_CASE_2("ml/cce/error/2", "[ml]", Z, double, float) {
 
     REQUIRE_EQUALS_APPROX(error, Z(0.71875));
 }
+
+TEMPLATE_TEST_CASE_2("ml/softmax_cce/loss/1", "[ml]", Z, double, float) {
+    etl::dyn_matrix<Z> o(37, 21);
+    etl::dyn_matrix<Z> l(37, 21);
+
+    o = etl::uniform_generator(-5.0, 5.0);
+    l = etl::uniform_generator(0.0, 1.0);
+
+    etl::dyn_matrix<Z> s(37, 21);
+    s = etl::softmax(o);
+
+    auto loss = etl::ml::softmax_cross_entropy(o, l, Z(1.0 / 37));
+
+    REQUIRE_EQUALS_APPROX(loss, etl::ml::cce_loss(s, l, Z(1.0 / 37)));
+}
+
+TEMPLATE_TEST_CASE_2("ml/softmax_cce/gradient/1", "[ml]", Z, double, float) {
+    etl::dyn_matrix<Z> o(37, 21);
+    etl::dyn_matrix<Z> l(37, 21);
+    etl::dyn_matrix<Z> g(37, 21);
+
+    o = etl::uniform_generator(-5.0, 5.0);
+    l = etl::uniform_generator(0.0, 1.0);
+
+    auto loss = etl::ml::softmax_cross_entropy(o, l, Z(-1.0), g);
+
+    etl::dyn_matrix<Z> s(37, 21);
+    etl::dyn_matrix<Z> ref(37, 21);
+
+    s   = etl::softmax(o);
+    ref = s - l;
+
+    REQUIRE_EQUALS_APPROX(loss, etl::ml::cce_loss(s, l, Z(-1.0)));
+
+    for (size_t i = 0; i < etl::size(g); ++i) {
+        REQUIRE_EQUALS_APPROX(g[i], ref[i]);
+    }
+}
+
+// Large logits must not overflow
+TEMPLATE_TEST_CASE_2("ml/softmax_cce/gradient/2", "[ml]", Z, double, float) {
+    etl::fast_matrix<Z, 2, 3> o{1000.0, 1001.0, 1002.0, -1000.0, -1001.0, -1002.0};
+    etl::fast_matrix<Z, 2, 3> l{0.0, 0.0, 1.0, 1.0, 0.0, 0.0};
+    etl::fast_matrix<Z, 2, 3> g;
+
+    auto loss = etl::ml::softmax_cross_entropy(o, l, Z(1.0), g);
+
+    etl::fast_matrix<Z, 2, 3> r{0.0, 1.0, 2.0, 0.0, -1.0, -2.0};
+    etl::fast_matrix<Z, 2, 3> ref;
+
+    ref = etl::softmax(r);
+    ref = ref - l;
+
+    REQUIRE_EQUALS_APPROX(loss, Z(2.0) * std::log(Z(1.0) / (Z(1.0) + std::exp(Z(-1.0)) + std::exp(Z(-2.0)))));
+
+    for (size_t i = 0; i < etl::size(g); ++i) {
+        REQUIRE_EQUALS_APPROX(g[i], ref[i]);
+    }
+}
+
+// Sparse labels are the same as their one-hot encoding
+TEMPLATE_TEST_CASE_2("ml/softmax_cce/sparse/1", "[ml]", Z, double, float) {
+    etl::dyn_matrix<Z> o(33, 19);
+    etl::dyn_matrix<Z> l(33, 19);
+    etl::dyn_vector<size_t> y(33);
+
+    etl::dyn_matrix<Z> g1(33, 19);
+    etl::dyn_matrix<Z> g2(33, 19);
+
+    o = etl::uniform_generator(-5.0, 5.0);
+    l = Z(0);
+
+    for (size_t i = 0; i < 33; ++i) {
+        y[i]       = (i * 7) % 19;
+        l(i, y[i]) = Z(1);
+    }
+
+    auto loss_dense  = etl::ml::softmax_cross_entropy(o, l, Z(-1.0 / 33), g1);
+    auto loss_sparse = etl::ml::softmax_cross_entropy(o, y, Z(-1.0 / 33), g2);
+
+    REQUIRE_EQUALS_APPROX(loss_sparse, loss_dense);
+    REQUIRE_EQUALS_APPROX(etl::ml::softmax_cross_entropy(o, y, Z(-1.0 / 33)), loss_dense);
+
+    for (size_t i = 0; i < etl::size(g1); ++i) {
+        REQUIRE_EQUALS_APPROX(g2[i], g1[i]);
+    }
+}
+
+namespace {
+
+// Reference batch normalization of x, seen as [B, C, S]
+template <typename X, typename Y, typename M, typename Var, typename G, typename Beta>
+void batch_norm_ref(const X& x, Y& y, M& mean, Var& var, const G& gamma, const Beta& beta, size_t B, size_t C, size_t S, bool train) {
+    using Z = etl::value_t<X>;
+
+    for (size_t c = 0; c < C; ++c) {
+        if (train) {
+            Z m = 0;
+            Z v = 0;
+
+            for (size_t b = 0; b < B; ++b) {
+                for (size_t s = 0; s < S; ++s) {
+                    m += x[(b * C + c) * S + s];
+                }
+            }
+
+            m /= Z(B * S);
+
+            for (size_t b = 0; b < B; ++b) {
+                for (size_t s = 0; s < S; ++s) {
+                    v += (x[(b * C + c) * S + s] - m) * (x[(b * C + c) * S + s] - m);
+                }
+            }
+
+            mean[c] = m;
+            var[c]  = v / Z(B * S);
+        }
+
+        for (size_t b = 0; b < B; ++b) {
+            for (size_t s = 0; s < S; ++s) {
+                const size_t i = (b * C + c) * S + s;
+
+                y[i] = gamma[c] * (x[i] - mean[c]) / std::sqrt(var[c] + Z(1e-5)) + beta[c];
+            }
+        }
+    }
+}
+
+// Reference backward batch normalization of x, seen as [B, C, S]
+template <typename X, typename M, typename Var, typename G>
+void batch_norm_backward_ref(const X& x, const X& dy, const M& mean, const Var& var, const G& gamma, X& dx, M& dgamma, M& dbeta, size_t B, size_t C, size_t S) {
+    using Z = etl::value_t<X>;
+
+    const Z n = Z(B * S);
+
+    for (size_t c = 0; c < C; ++c) {
+        const Z inv_std = Z(1) / std::sqrt(var[c] + Z(1e-5));
+
+        Z sdy  = 0;
+        Z sdyx = 0;
+
+        for (size_t b = 0; b < B; ++b) {
+            for (size_t s = 0; s < S; ++s) {
+                const size_t i = (b * C + c) * S + s;
+
+                sdy += dy[i];
+                sdyx += dy[i] * (x[i] - mean[c]) * inv_std;
+            }
+        }
+
+        dbeta[c]  = sdy;
+        dgamma[c] = sdyx;
+
+        for (size_t b = 0; b < B; ++b) {
+            for (size_t s = 0; s < S; ++s) {
+                const size_t i = (b * C + c) * S + s;
+
+                const Z x_hat = (x[i] - mean[c]) * inv_std;
+
+                dx[i] = gamma[c] * inv_std / n * (n * dy[i] - sdy - x_hat * sdyx);
+            }
+        }
+    }
+}
+
+} // end of anonymous namespace
+
+TEMPLATE_TEST_CASE_2("ml/batch_norm_2d/train/1", "[ml]", Z, double, float) {
+    etl::dyn_matrix<Z> x(17, 13);
+    etl::dyn_vector<Z> gamma(13);
+    etl::dyn_vector<Z> beta(13);
+
+    x     = etl::uniform_generator(-2.0, 5.0);
+    gamma = etl::uniform_generator(0.5, 1.5);
+    beta  = etl::uniform_generator(-1.0, 1.0);
+
+    etl::dyn_matrix<Z> y(17, 13);
+    etl::dyn_vector<Z> mean(13);
+    etl::dyn_vector<Z> var(13);
+
+    etl::ml::batch_norm_2d_train(x, gamma, beta, y, mean, var);
+
+    etl::dyn_matrix<Z> y_ref(17, 13);
+    etl::dyn_vector<Z> mean_ref(13);
+    etl::dyn_vector<Z> var_ref(13);
+
+    batch_norm_ref(x, y_ref, mean_ref, var_ref, gamma, beta, 17, 13, 1, true);
+
+    for (size_t c = 0; c < 13; ++c) {
+        REQUIRE_EQUALS_APPROX(mean[c], mean_ref[c]);
+        REQUIRE_EQUALS_APPROX(var[c], var_ref[c]);
+    }
+
+    for (size_t i = 0; i < etl::size(y); ++i) {
+        REQUIRE_EQUALS_APPROX(y[i], y_ref[i]);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("ml/batch_norm_2d/forward/1", "[ml]", Z, double, float) {
+    etl::fast_matrix<Z, 3, 2> x{1.0, 2.0, 3.0, 4.0, 5.0, 6.0};
+    etl::fast_vector<Z, 2> gamma{2.0, 0.5};
+    etl::fast_vector<Z, 2> beta{1.0, -1.0};
+    etl::fast_vector<Z, 2> mean{1.0, 2.0};
+    etl::fast_vector<Z, 2> var{4.0, 1.0};
+
+    etl::fast_matrix<Z, 3, 2> y;
+
+    etl::ml::batch_norm_2d_forward(x, gamma, beta, mean, var, y, Z(0));
+
+    REQUIRE_EQUALS_APPROX(y(0, 0), Z(1.0));
+    REQUIRE_EQUALS_APPROX(y(0, 1), Z(-1.0));
+    REQUIRE_EQUALS_APPROX(y(1, 0), Z(3.0));
+    REQUIRE_EQUALS_APPROX(y(1, 1), Z(0.0));
+    REQUIRE_EQUALS_APPROX(y(2, 0), Z(5.0));
+    REQUIRE_EQUALS_APPROX(y(2, 1), Z(1.0));
+}
+
+TEMPLATE_TEST_CASE_2("ml/batch_norm_2d/backward/1", "[ml]", Z, double, float) {
+    etl::dyn_matrix<Z> x(19, 11);
+    etl::dyn_matrix<Z> dy(19, 11);
+    etl::dyn_vector<Z> gamma(11);
+    etl::dyn_vector<Z> beta(11);
+
+    x     = etl::uniform_generator(-2.0, 5.0);
+    dy    = etl::uniform_generator(-1.0, 1.0);
+    gamma = etl::uniform_generator(0.5, 1.5);
+    beta  = etl::uniform_generator(-1.0, 1.0);
+
+    etl::dyn_matrix<Z> y(19, 11);
+    etl::dyn_vector<Z> mean(11);
+    etl::dyn_vector<Z> var(11);
+
+    etl::ml::batch_norm_2d_train(x, gamma, beta, y, mean, var);
+
+    etl::dyn_matrix<Z> dx(19, 11);
+    etl::dyn_vector<Z> dgamma(11);
+    etl::dyn_vector<Z> dbeta(11);
+
+    etl::ml::batch_norm_2d_backward(x, dy, gamma, mean, var, dx, dgamma, dbeta);
+
+    etl::dyn_matrix<Z> dx_ref(19, 11);
+    etl::dyn_vector<Z> dgamma_ref(11);
+    etl::dyn_vector<Z> dbeta_ref(11);
+
+    batch_norm_backward_ref(x, dy, mean, var, gamma, dx_ref, dgamma_ref, dbeta_ref, 19, 11, 1);
+
+    for (size_t c = 0; c < 11; ++c) {
+        REQUIRE_EQUALS_APPROX(dgamma[c], dgamma_ref[c]);
+        REQUIRE_EQUALS_APPROX(dbeta[c], dbeta_ref[c]);
+    }
+
+    for (size_t i = 0; i < etl::size(dx); ++i) {
+        REQUIRE_EQUALS_APPROX_E(dx[i], dx_ref[i], 1e-4);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("ml/batch_norm_4d/train/1", "[ml]", Z, double, float) {
+    etl::dyn_matrix<Z, 4> x(5, 3, 7, 9);
+    etl::dyn_vector<Z> gamma(3);
+    etl::dyn_vector<Z> beta(3);
+
+    x     = etl::uniform_generator(-2.0, 5.0);
+    gamma = etl::uniform_generator(0.5, 1.5);
+    beta  = etl::uniform_generator(-1.0, 1.0);
+
+    etl::dyn_matrix<Z, 4> y(5, 3, 7, 9);
+    etl::dyn_vector<Z> mean(3);
+    etl::dyn_vector<Z> var(3);
+
+    etl::ml::batch_norm_4d_train(x, gamma, beta, y, mean, var);
+
+    etl::dyn_matrix<Z, 4> y_ref(5, 3, 7, 9);
+    etl::dyn_vector<Z> mean_ref(3);
+    etl::dyn_vector<Z> var_ref(3);
+
+    batch_norm_ref(x, y_ref, mean_ref, var_ref, gamma, beta, 5, 3, 63, true);
+
+    for (size_t c = 0; c < 3; ++c) {
+        REQUIRE_EQUALS_APPROX(mean[c], mean_ref[c]);
+        REQUIRE_EQUALS_APPROX(var[c], var_ref[c]);
+    }
+
+    for (size_t i = 0; i < etl::size(y); ++i) {
+        REQUIRE_EQUALS_APPROX(y[i], y_ref[i]);
+    }
+
+    etl::dyn_matrix<Z, 4> y2(5, 3, 7, 9);
+
+    etl::ml::batch_norm_4d_forward(x, gamma, beta, mean, var, y2);
+
+    for (size_t i = 0; i < etl::size(y); ++i) {
+        REQUIRE_EQUALS_APPROX(y2[i], y_ref[i]);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("ml/batch_norm_4d/backward/1", "[ml]", Z, double, float) {
+    etl::dyn_matrix<Z, 4> x(4, 5, 6, 5);
+    etl::dyn_matrix<Z, 4> dy(4, 5, 6, 5);
+    etl::dyn_vector<Z> gamma(5);
+    etl::dyn_vector<Z> beta(5);
+
+    x     = etl::uniform_generator(-2.0, 5.0);
+    dy    = etl::uniform_generator(-1.0, 1.0);
+    gamma = etl::uniform_generator(0.5, 1.5);
+    beta  = etl::uniform_generator(-1.0, 1.0);
+
+    etl::dyn_matrix<Z, 4> y(4, 5, 6, 5);
+    etl::dyn_vector<Z> mean(5);
+    etl::dyn_vector<Z> var(5);
+
+    etl::ml::batch_norm_4d_train(x, gamma, beta, y, mean, var);
+
+    etl::dyn_matrix<Z, 4> dx(4, 5, 6, 5);
+    etl::dyn_vector<Z> dgamma(5);
+    etl::dyn_vector<Z> dbeta(5);
+
+    etl::ml::batch_norm_4d_backward(x, dy, gamma, mean, var, dx, dgamma, dbeta);
+
+    etl::dyn_matrix<Z, 4> dx_ref(4, 5, 6, 5);
+    etl::dyn_vector<Z> dgamma_ref(5);
+    etl::dyn_vector<Z> dbeta_ref(5);
+
+    batch_norm_backward_ref(x, dy, mean, var, gamma, dx_ref, dgamma_ref, dbeta_ref, 4, 5, 30);
+
+    for (size_t c = 0; c < 5; ++c) {
+        REQUIRE_EQUALS_APPROX(dgamma[c], dgamma_ref[c]);
+        REQUIRE_EQUALS_APPROX(dbeta[c], dbeta_ref[c]);
+    }
+
+    for (size_t i = 0; i < etl::size(dx); ++i) {
+        REQUIRE_EQUALS_APPROX_E(dx[i], dx_ref[i], 1e-4);
+    }
+}
+
+// Large batches are normalized by several blocks of columns
+TEMPLATE_TEST_CASE_2("ml/batch_norm_2d/backward/2", "[ml]", Z, double, float) {
+    etl::dyn_matrix<Z> x(700, 37);
+    etl::dyn_matrix<Z> dy(700, 37);
+    etl::dyn_vector<Z> gamma(37);
+    etl::dyn_vector<Z> beta(37);
+
+    x     = etl::uniform_generator(-2.0, 5.0);
+    dy    = etl::uniform_generator(-1.0, 1.0);
+    gamma = etl::uniform_generator(0.5, 1.5);
+    beta  = etl::uniform_generator(-1.0, 1.0);
+
+    etl::dyn_matrix<Z> y(700, 37);
+    etl::dyn_vector<Z> mean(37);
+    etl::dyn_vector<Z> var(37);
+
+    etl::dyn_matrix<Z> dx(700, 37);
+    etl::dyn_vector<Z> dgamma(37);
+    etl::dyn_vector<Z> dbeta(37);
+
+    etl::ml::batch_norm_2d_train(x, gamma, beta, y, mean, var);
+    etl::ml::batch_norm_2d_backward(x, dy, gamma, mean, var, dx, dgamma, dbeta);
+
+    etl::dyn_matrix<Z> y_ref(700, 37);
+    etl::dyn_vector<Z> mean_ref(37);
+    etl::dyn_vector<Z> var_ref(37);
+
+    etl::dyn_matrix<Z> dx_ref(700, 37);
+    etl::dyn_vector<Z> dgamma_ref(37);
+    etl::dyn_vector<Z> dbeta_ref(37);
+
+    batch_norm_ref(x, y_ref, mean_ref, var_ref, gamma, beta, 700, 37, 1, true);
+    batch_norm_backward_ref(x, dy, mean_ref, var_ref, gamma, dx_ref, dgamma_ref, dbeta_ref, 700, 37, 1);
+
+    for (size_t c = 0; c < 37; ++c) {
+        REQUIRE_EQUALS_APPROX_E(mean[c], mean_ref[c], 1e-4);
+        REQUIRE_EQUALS_APPROX_E(var[c], var_ref[c], 1e-4);
+        REQUIRE_EQUALS_APPROX_E(dgamma[c], dgamma_ref[c], 1e-3);
+        REQUIRE_EQUALS_APPROX_E(dbeta[c], dbeta_ref[c], 1e-3);
+    }
+
+    for (size_t i = 0; i < etl::size(y); ++i) {
+        REQUIRE_EQUALS_APPROX_E(y[i], y_ref[i], 1e-4);
+        REQUIRE_EQUALS_APPROX_E(dx[i], dx_ref[i], 1e-3);
+    }
+}
+
+namespace {
+
+// Reference layer normalization (or RMS normalization) of the rows of x
+template <typename X, typename G, typename B, typename Y>
+void layer_norm_ref(const X& x, const G& gamma, const B& beta, Y& y, size_t N, size_t K, bool rms) {
+    using Z = etl::value_t<X>;
+
+    for (size_t i = 0; i < N; ++i) {
+        Z m = 0;
+        Z v = 0;
+
+        if (!rms) {
+            for (size_t k = 0; k < K; ++k) {
+                m += x[i * K + k];
+            }
+
+            m /= Z(K);
+        }
+
+        for (size_t k = 0; k < K; ++k) {
+            v += (x[i * K + k] - m) * (x[i * K + k] - m);
+        }
+
+        v /= Z(K);
+
+        for (size_t k = 0; k < K; ++k) {
+            y[i * K + k] = gamma[k] * (x[i * K + k] - m) / std::sqrt(v + Z(1e-5)) + (rms ? Z(0) : beta[k]);
+        }
+    }
+}
+
+// The loss sum(y * dy) of the layer normalization, for finite differences
+template <typename X, typename G, typename B>
+double layer_norm_loss(const X& x, const X& dy, const G& gamma, const B& beta, bool rms) {
+    X y(x);
+
+    if (rms) {
+        y = etl::ml::rms_norm(x, gamma);
+    } else {
+        y = etl::ml::layer_norm(x, gamma, beta);
+    }
+
+    return etl::sum(y >> dy);
+}
+
+} // end of anonymous namespace
+
+TEMPLATE_TEST_CASE_2("ml/layer_norm/1", "[ml]", Z, double, float) {
+    etl::dyn_matrix<Z> x(13, 37);
+    etl::dyn_vector<Z> gamma(37);
+    etl::dyn_vector<Z> beta(37);
+
+    x     = etl::uniform_generator(-2.0, 5.0);
+    gamma = etl::uniform_generator(0.5, 1.5);
+    beta  = etl::uniform_generator(-1.0, 1.0);
+
+    etl::dyn_matrix<Z> y(13, 37);
+    etl::dyn_matrix<Z> y_ref(13, 37);
+
+    y = etl::ml::layer_norm(x, gamma, beta);
+
+    layer_norm_ref(x, gamma, beta, y_ref, 13, 37, false);
+
+    for (size_t i = 0; i < etl::size(y); ++i) {
+        REQUIRE_EQUALS_APPROX(y[i], y_ref[i]);
+    }
+}
+
+// The rows are the last dimension
+TEMPLATE_TEST_CASE_2("ml/layer_norm/2", "[ml]", Z, double, float) {
+    etl::fast_matrix<Z, 2, 3, 4> x;
+    etl::fast_vector<Z, 4> gamma{1.0, 2.0, 0.5, 1.0};
+    etl::fast_vector<Z, 4> beta{0.0, 1.0, -1.0, 0.5};
+
+    x = etl::sequence_generator(1.0);
+
+    etl::fast_matrix<Z, 2, 3, 4> y;
+    etl::fast_matrix<Z, 2, 3, 4> y_ref;
+
+    y = etl::ml::layer_norm(x, gamma, beta);
+
+    layer_norm_ref(x, gamma, beta, y_ref, 6, 4, false);
+
+    for (size_t i = 0; i < etl::size(y); ++i) {
+        REQUIRE_EQUALS_APPROX(y[i], y_ref[i]);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("ml/rms_norm/1", "[ml]", Z, double, float) {
+    etl::dyn_matrix<Z> x(11, 29);
+    etl::dyn_vector<Z> gamma(29);
+
+    x     = etl::uniform_generator(-2.0, 5.0);
+    gamma = etl::uniform_generator(0.5, 1.5);
+
+    etl::dyn_matrix<Z> y(11, 29);
+    etl::dyn_matrix<Z> y_ref(11, 29);
+
+    y = etl::ml::rms_norm(x, gamma);
+
+    layer_norm_ref(x, gamma, gamma, y_ref, 11, 29, true);
+
+    for (size_t i = 0; i < etl::size(y); ++i) {
+        REQUIRE_EQUALS_APPROX(y[i], y_ref[i]);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("ml/layer_norm/backward/1", "[ml]", Z, double, float) {
+    etl::dyn_matrix<Z> x(17, 23);
+    etl::dyn_matrix<Z> dy(17, 23);
+    etl::dyn_vector<Z> gamma(23);
+
+    x     = etl::uniform_generator(-2.0, 5.0);
+    dy    = etl::uniform_generator(-1.0, 1.0);
+    gamma = etl::uniform_generator(0.5, 1.5);
+
+    etl::dyn_matrix<Z> dx(17, 23);
+    etl::dyn_vector<Z> dgamma(23);
+    etl::dyn_vector<Z> dbeta(23);
+
+    etl::ml::layer_norm_backward(x, dy, gamma, dx, dgamma, dbeta);
+
+    etl::dyn_matrix<Z> x_hat(17, 23);
+    etl::dyn_vector<Z> ones(23);
+    etl::dyn_vector<Z> zeros(23);
+
+    ones  = Z(1);
+    zeros = Z(0);
+
+    layer_norm_ref(x, ones, zeros, x_hat, 17, 23, false);
+
+    for (size_t k = 0; k < 23; ++k) {
+        Z dg = 0;
+        Z db = 0;
+
+        for (size_t i = 0; i < 17; ++i) {
+            dg += dy(i, k) * x_hat(i, k);
+            db += dy(i, k);
+        }
+
+        REQUIRE_EQUALS_APPROX(dgamma[k], dg);
+        REQUIRE_EQUALS_APPROX(dbeta[k], db);
+    }
+
+    for (size_t i = 0; i < 17; ++i) {
+        Z m = etl::mean(x(i));
+        Z v = 0;
+
+        for (size_t k = 0; k < 23; ++k) {
+            v += (x(i, k) - m) * (x(i, k) - m);
+        }
+
+        const Z rstd = Z(1) / std::sqrt(v / Z(23) + Z(1e-5));
+
+        Z mg  = 0;
+        Z mgx = 0;
+
+        for (size_t k = 0; k < 23; ++k) {
+            mg += dy(i, k) * gamma[k] / Z(23);
+            mgx += dy(i, k) * gamma[k] * x_hat(i, k) / Z(23);
+        }
+
+        for (size_t k = 0; k < 23; ++k) {
+            REQUIRE_EQUALS_APPROX_E(dx(i, k), rstd * (dy(i, k) * gamma[k] - mg - x_hat(i, k) * mgx), 1e-4);
+        }
+    }
+}
+
+// The errors of the input are the gradients of sum(y * dy)
+TEST_CASE("ml/layer_norm/backward/2", "[ml]") {
+    for (bool rms : {false, true}) {
+        etl::dyn_matrix<double> x(5, 19);
+        etl::dyn_matrix<double> dy(5, 19);
+        etl::dyn_vector<double> gamma(19);
+        etl::dyn_vector<double> beta(19);
+
+        x     = etl::uniform_generator(-2.0, 5.0);
+        dy    = etl::uniform_generator(-1.0, 1.0);
+        gamma = etl::uniform_generator(0.5, 1.5);
+        beta  = etl::uniform_generator(-1.0, 1.0);
+
+        etl::dyn_matrix<double> dx(5, 19);
+        etl::dyn_vector<double> dgamma(19);
+        etl::dyn_vector<double> dbeta(19);
+
+        if (rms) {
+            etl::ml::rms_norm_backward(x, dy, gamma, dx, dgamma);
+        } else {
+            etl::ml::layer_norm_backward(x, dy, gamma, dx, dgamma, dbeta);
+        }
+
+        const double h = 1e-6;
+
+        for (size_t i = 0; i < etl::size(x); ++i) {
+            const double v = x[i];
+
+            x[i]          = v + h;
+            const double a = layer_norm_loss(x, dy, gamma, beta, rms);
+            x[i]          = v - h;
+            const double b = layer_norm_loss(x, dy, gamma, beta, rms);
+            x[i]          = v;
+
+            REQUIRE_EQUALS_APPROX_E(dx[i], (a - b) / (2 * h), 1e-5);
+        }
+
+        for (size_t k = 0; k < 19; ++k) {
+            const double v = gamma[k];
+
+            gamma[k]       = v + h;
+            const double a = layer_norm_loss(x, dy, gamma, beta, rms);
+            gamma[k]       = v - h;
+            const double b = layer_norm_loss(x, dy, gamma, beta, rms);
+            gamma[k]       = v;
+
+            REQUIRE_EQUALS_APPROX_E(dgamma[k], (a - b) / (2 * h), 1e-5);
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("ml/rms_norm/backward/1", "[ml]", Z, double, float) {
+    etl::dyn_matrix<Z> x(9, 41);
+    etl::dyn_matrix<Z> dy(9, 41);
+    etl::dyn_vector<Z> gamma(41);
+
+    x     = etl::uniform_generator(-2.0, 5.0);
+    dy    = etl::uniform_generator(-1.0, 1.0);
+    gamma = etl::uniform_generator(0.5, 1.5);
+
+    etl::dyn_matrix<Z> dx(9, 41);
+    etl::dyn_vector<Z> dgamma(41);
+
+    etl::ml::rms_norm_backward(x, dy, gamma, dx, dgamma);
+
+    for (size_t i = 0; i < 9; ++i) {
+        Z ss = 0;
+
+        for (size_t k = 0; k < 41; ++k) {
+            ss += x(i, k) * x(i, k);
+        }
+
+        const Z rstd = Z(1) / std::sqrt(ss / Z(41) + Z(1e-5));
+
+        Z mgx = 0;
+
+        for (size_t k = 0; k < 41; ++k) {
+            mgx += dy(i, k) * gamma[k] * x(i, k) * rstd / Z(41);
+        }
+
+        for (size_t k = 0; k < 41; ++k) {
+            REQUIRE_EQUALS_APPROX_E(dx(i, k), rstd * (dy(i, k) * gamma[k] - x(i, k) * rstd * mgx), 1e-4);
+        }
+    }
+
+    for (size_t k = 0; k < 41; ++k) {
+        Z dg = 0;
+
+        for (size_t i = 0; i < 9; ++i) {
+            Z ss = 0;
+
+            for (size_t j = 0; j < 41; ++j) {
+                ss += x(i, j) * x(i, j);
+            }
+
+            dg += dy(i, k) * x(i, k) / std::sqrt(ss / Z(41) + Z(1e-5));
+        }
+
+        REQUIRE_EQUALS_APPROX(dgamma[k], dg);
+    }
+}
+
+// The queries and the keys span several blocks and tiles
+TEMPLATE_TEST_CASE_2("ml/attention/1", "[ml]", Z, double, float) {
+    etl::dyn_matrix<Z> q(37, 16);
+    etl::dyn_matrix<Z> k(300, 16);
+    etl::dyn_matrix<Z> v(300, 24);
+
+    q = etl::uniform_generator(-1.0, 1.0);
+    k = etl::uniform_generator(-1.0, 1.0);
+    v = etl::uniform_generator(-1.0, 1.0);
+
+    etl::dyn_matrix<Z> y(37, 24);
+    etl::dyn_matrix<Z> y_ref(37, 24);
+    etl::dyn_matrix<Z> p(37, 300);
+
+    y     = etl::ml::attention(q, k, v);
+    p     = etl::stable_softmax((q * etl::trans(k)) / Z(4));
+    y_ref = p * v;
+
+    for (size_t i = 0; i < etl::size(y); ++i) {
+        REQUIRE_EQUALS_APPROX(y[i], y_ref[i]);
+    }
+}
+
+// The heads are computed independently
+TEMPLATE_TEST_CASE_2("ml/attention/2", "[ml]", Z, double, float) {
+    etl::fast_matrix<Z, 3, 5, 4> q;
+    etl::fast_matrix<Z, 3, 7, 4> k;
+    etl::fast_matrix<Z, 3, 7, 2> v;
+
+    q = etl::uniform_generator(-2.0, 2.0);
+    k = etl::uniform_generator(-2.0, 2.0);
+    v = etl::uniform_generator(-2.0, 2.0);
+
+    etl::fast_matrix<Z, 3, 5, 2> y;
+    y = etl::ml::attention(q, k, v);
+
+    for (size_t h = 0; h < 3; ++h) {
+        etl::fast_matrix<Z, 5, 7> p;
+        etl::fast_matrix<Z, 5, 2> y_ref;
+
+        p     = etl::stable_softmax((q(h) * etl::trans(k(h))) / Z(2));
+        y_ref = p * v(h);
+
+        for (size_t i = 0; i < 5; ++i) {
+            for (size_t j = 0; j < 2; ++j) {
+                REQUIRE_EQUALS_APPROX(y(h, i, j), y_ref(i, j));
+            }
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("ml/attention/backward/1", "[ml]", Z, double, float) {
+    etl::dyn_matrix<Z> q(45, 16);
+    etl::dyn_matrix<Z> k(520, 16);
+    etl::dyn_matrix<Z> v(520, 8);
+    etl::dyn_matrix<Z> dy(45, 8);
+
+    q  = etl::uniform_generator(-1.0, 1.0);
+    k  = etl::uniform_generator(-1.0, 1.0);
+    v  = etl::uniform_generator(-1.0, 1.0);
+    dy = etl::uniform_generator(-1.0, 1.0);
+
+    etl::dyn_matrix<Z> o(45, 8);
+    o = etl::ml::attention(q, k, v);
+
+    etl::dyn_matrix<Z> dq(45, 16);
+    etl::dyn_matrix<Z> dk(520, 16);
+    etl::dyn_matrix<Z> dv(520, 8);
+
+    etl::ml::attention_backward(q, k, v, o, dy, dq, dk, dv);
+
+    etl::dyn_matrix<Z> p(45, 520);
+    etl::dyn_matrix<Z> ds(45, 520);
+
+    p  = etl::stable_softmax((q * etl::trans(k)) / Z(4));
+    ds = dy * etl::trans(v);
+
+    for (size_t i = 0; i < 45; ++i) {
+        Z delta = 0;
+
+        for (size_t j = 0; j < 520; ++j) {
+            delta += p(i, j) * ds(i, j);
+        }
+
+        for (size_t j = 0; j < 520; ++j) {
+            ds(i, j) = p(i, j) * (ds(i, j) - delta) / Z(4);
+        }
+    }
+
+    etl::dyn_matrix<Z> dq_ref(45, 16);
+    etl::dyn_matrix<Z> dk_ref(520, 16);
+    etl::dyn_matrix<Z> dv_ref(520, 8);
+
+    dq_ref = ds * k;
+    dk_ref = etl::trans(ds) * q;
+    dv_ref = etl::trans(p) * dy;
+
+    for (size_t i = 0; i < etl::size(dq); ++i) {
+        REQUIRE_EQUALS_APPROX(dq[i], dq_ref[i]);
+    }
+
+    for (size_t i = 0; i < etl::size(dk); ++i) {
+        REQUIRE_EQUALS_APPROX(dk[i], dk_ref[i]);
+    }
+
+    for (size_t i = 0; i < etl::size(dv); ++i) {
+        REQUIRE_EQUALS_APPROX(dv[i], dv_ref[i]);
+    }
+}
+
+// The errors are the gradients of sum(y * dy)
+TEST_CASE("ml/attention/backward/2", "[ml]") {
+    etl::dyn_matrix<double, 3> q(2, 34, 4);
+    etl::dyn_matrix<double, 3> k(2, 260, 4);
+    etl::dyn_matrix<double, 3> v(2, 260, 3);
+    etl::dyn_matrix<double, 3> dy(2, 34, 3);
+
+    q  = etl::uniform_generator(-1.0, 1.0);
+    k  = etl::uniform_generator(-1.0, 1.0);
+    v  = etl::uniform_generator(-1.0, 1.0);
+    dy = etl::uniform_generator(-1.0, 1.0);
+
+    etl::dyn_matrix<double, 3> o(2, 34, 3);
+    o = etl::ml::attention(q, k, v);
+
+    etl::dyn_matrix<double, 3> dq(2, 34, 4);
+    etl::dyn_matrix<double, 3> dk(2, 260, 4);
+    etl::dyn_matrix<double, 3> dv(2, 260, 3);
+
+    etl::ml::attention_backward(q, k, v, o, dy, dq, dk, dv);
+
+    auto loss = [&]() {
+        etl::dyn_matrix<double, 3> y(2, 34, 3);
+        y = etl::ml::attention(q, k, v);
+        return etl::sum(y >> dy);
+    };
+
+    auto check = [&](auto& x, auto& dx) {
+        const double h = 1e-6;
+
+        for (size_t i = 0; i < etl::size(x); ++i) {
+            const double value = x[i];
+
+            x[i]           = value + h;
+            const double a = loss();
+            x[i]           = value - h;
+            const double b = loss();
+            x[i]           = value;
+
+            REQUIRE_EQUALS_APPROX_E(dx[i], (a - b) / (2 * h), 1e-5);
+        }
+    };
+
+    check(q, dq);
+    check(k, dk);
+    check(v, dv);
+}
@@ -0,0 +1,229 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#include "test.hpp"
+
+// Tests for the channels-last (NHWC) operations
+// All the results are validated against the NCHW operations
+
+TEMPLATE_TEST_CASE_2("nhwc/layout/0", "[nhwc]", T, float, double) {
+    etl::fast_matrix<T, 2, 3, 4, 5> a;
+    a = etl::sequence_generator(1.0);
+
+    etl::dyn_matrix<T, 4> b;
+    b = etl::nchw_to_nhwc(a);
+
+    REQUIRE_EQUALS(etl::dim<0>(b), 2UL);
+    REQUIRE_EQUALS(etl::dim<1>(b), 4UL);
+    REQUIRE_EQUALS(etl::dim<2>(b), 5UL);
+    REQUIRE_EQUALS(etl::dim<3>(b), 3UL);
+
+    for (size_t n = 0; n < 2; ++n) {
+        for (size_t c = 0; c < 3; ++c) {
+            for (size_t h = 0; h < 4; ++h) {
+                for (size_t w = 0; w < 5; ++w) {
+                    REQUIRE_EQUALS(b(n, h, w, c), a(n, c, h, w));
+                }
+            }
+        }
+    }
+
+    etl::fast_matrix<T, 2, 3, 4, 5> c;
+    c = etl::nhwc_to_nchw(b);
+
+    REQUIRE_DIRECT(approx_equals(c, a, 0.0));
+}
+
+TEMPLATE_TEST_CASE_2("nhwc/layout/1", "[nhwc]", T, float, double) {
+    etl::dyn_matrix<T, 4> a(3, 17, 19, 21);
+    a = etl::uniform_generator(-10.0, 10.0);
+
+    etl::dyn_matrix<T, 4> b(3, 19, 21, 17);
+    b = etl::nchw_to_nhwc(a);
+
+    etl::dyn_matrix<T, 4> c(3, 17, 19, 21);
+    c = etl::nhwc_to_nchw(b);
+
+    REQUIRE_DIRECT(approx_equals(c, a, 0.0));
+}
+
+TEMPLATE_TEST_CASE_2("nhwc/conv/0", "[nhwc][conv]", T, float, double) {
+    etl::dyn_matrix<T, 4> I(3, 6, 11, 10);
+    etl::dyn_matrix<T, 4> K(9, 6, 3, 3);
+
+    I = etl::uniform_generator(-1.0, 1.0);
+    K = etl::uniform_generator(-1.0, 1.0);
+
+    etl::dyn_matrix<T, 4> ref;
+    ref = etl::conv_4d_valid_flipped(I, K, 1, 1, 0, 0);
+
+    auto I_nhwc = etl::force_temporary(etl::nchw_to_nhwc(I));
+    auto K_nhwc = etl::force_temporary(etl::nchw_to_nhwc(K));
+
+    etl::dyn_matrix<T, 4> c_nhwc(3, 9, 8, 9);
+    etl::dyn_matrix<T, 4> c(3, 9, 9, 8);
+
+    SELECTED_SECTION(etl::conv4_impl::STD) {
+        c_nhwc = etl::conv_4d_valid_flipped_nhwc(I_nhwc, K_nhwc, 1, 1, 0, 0);
+        c      = etl::nhwc_to_nchw(c_nhwc);
+
+        REQUIRE_DIRECT(approx_equals(c, ref, base_eps_etl_large));
+    }
+
+    SELECTED_SECTION(etl::conv4_impl::VEC) {
+        c_nhwc = etl::conv_4d_valid_flipped_nhwc(I_nhwc, K_nhwc, 1, 1, 0, 0);
+        c      = etl::nhwc_to_nchw(c_nhwc);
+
+        REQUIRE_DIRECT(approx_equals(c, ref, base_eps_etl_large));
+    }
+}
+
+TEMPLATE_TEST_CASE_2("nhwc/conv/1", "[nhwc][conv]", T, float, double) {
+    etl::dyn_matrix<T, 4> I(2, 5, 12, 13);
+    etl::dyn_matrix<T, 4> K(7, 5, 4, 3);
+
+    I = etl::uniform_generator(-1.0, 1.0);
+    K = etl::uniform_generator(-1.0, 1.0);
+
+    etl::dyn_matrix<T, 4> ref;
+    ref = etl::conv_4d_valid(I, K, 2, 3, 1, 2);
+
+    auto I_nhwc = etl::force_temporary(etl::nchw_to_nhwc(I));
+    auto K_nhwc = etl::force_temporary(etl::nchw_to_nhwc(K));
+
+    etl::dyn_matrix<T, 4> c_nhwc(2, 6, 5, 7);
+    etl::dyn_matrix<T, 4> c(2, 7, 6, 5);
+
+    SELECTED_SECTION(etl::conv4_impl::STD) {
+        c_nhwc = etl::conv_4d_valid_nhwc(I_nhwc, K_nhwc, 2, 3, 1, 2);
+        c      = etl::nhwc_to_nchw(c_nhwc);
+
+        REQUIRE_DIRECT(approx_equals(c, ref, base_eps_etl_large));
+    }
+
+    SELECTED_SECTION(etl::conv4_impl::VEC) {
+        c_nhwc = etl::conv_4d_valid_nhwc(I_nhwc, K_nhwc, 2, 3, 1, 2);
+        c      = etl::nhwc_to_nchw(c_nhwc);
+
+        REQUIRE_DIRECT(approx_equals(c, ref, base_eps_etl_large));
+    }
+}
+
+TEMPLATE_TEST_CASE_2("nhwc/conv/2", "[nhwc][conv]", T, float, double) {
+    etl::dyn_matrix<T, 4> I(2, 3, 8, 8);
+    etl::dyn_matrix<T, 4> K(4, 3, 3, 3);
+
+    I = etl::uniform_generator(-1.0, 1.0);
+    K = etl::uniform_generator(-1.0, 1.0);
+
+    etl::dyn_matrix<T, 4> ref;
+    ref = etl::ml::convolution_forward(I, K, 1, 1, 1, 1);
+
+    etl::dyn_matrix<T, 4> c_nhwc(2, 8, 8, 4);
+    c_nhwc = etl::ml::convolution_forward_nhwc(etl::nchw_to_nhwc(I), etl::nchw_to_nhwc(K), 1, 1, 1, 1);
+
+    etl::dyn_matrix<T, 4> c(2, 4, 8, 8);
+    c = etl::nhwc_to_nchw(c_nhwc);
+
+    REQUIRE_DIRECT(approx_equals(c, ref, base_eps_etl_large));
+}
+
+TEMPLATE_TEST_CASE_2("nhwc/max_pool/0", "[nhwc][pooling]", T, float, double) {
+    etl::dyn_matrix<T, 4> a(2, 11, 9, 9);
+    a = etl::uniform_generator(-10.0, 10.0);
+
+    etl::dyn_matrix<T, 4> ref;
+    ref = etl::max_pool_2d(a, 3, 3, 2, 2, 1, 1);
+
+    auto a_nhwc = etl::force_temporary(etl::nchw_to_nhwc(a));
+
+    etl::dyn_matrix<T, 4> b_nhwc(2, 5, 5, 11);
+    etl::dyn_matrix<T, 4> b(2, 11, 5, 5);
+
+    SELECTED_SECTION(etl::pool_impl::STD) {
+        b_nhwc = etl::max_pool_2d_nhwc(a_nhwc, 3, 3, 2, 2, 1, 1);
+        b      = etl::nhwc_to_nchw(b_nhwc);
+
+        REQUIRE_DIRECT(approx_equals(b, ref, base_eps_etl_large));
+    }
+
+    SELECTED_SECTION(etl::pool_impl::VEC) {
+        b_nhwc = etl::max_pool_2d_nhwc(a_nhwc, 3, 3, 2, 2, 1, 1);
+        b      = etl::nhwc_to_nchw(b_nhwc);
+
+        REQUIRE_DIRECT(approx_equals(b, ref, base_eps_etl_large));
+    }
+}
+
+TEMPLATE_TEST_CASE_2("nhwc/avg_pool/0", "[nhwc][pooling]", T, float, double) {
+    etl::dyn_matrix<T, 4> a(2, 19, 8, 10);
+    a = etl::uniform_generator(-10.0, 10.0);
+
+    etl::dyn_matrix<T, 4> ref;
+    ref = etl::avg_pool_2d(a, 2, 2);
+
+    auto a_nhwc = etl::force_temporary(etl::nchw_to_nhwc(a));
+
+    etl::dyn_matrix<T, 4> b_nhwc(2, 4, 5, 19);
+    etl::dyn_matrix<T, 4> b(2, 19, 4, 5);
+
+    SELECTED_SECTION(etl::pool_impl::STD) {
+        b_nhwc = etl::avg_pool_2d_nhwc(a_nhwc, 2, 2);
+        b      = etl::nhwc_to_nchw(b_nhwc);
+
+        REQUIRE_DIRECT(approx_equals(b, ref, base_eps_etl_large));
+    }
+
+    SELECTED_SECTION(etl::pool_impl::VEC) {
+        b_nhwc = etl::avg_pool_2d_nhwc(a_nhwc, 2, 2);
+        b      = etl::nhwc_to_nchw(b_nhwc);
+
+        REQUIRE_DIRECT(approx_equals(b, ref, base_eps_etl_large));
+    }
+}
+
+TEMPLATE_TEST_CASE_2("nhwc/avg_pool/1", "[nhwc][pooling]", T, float, double) {
+    etl::dyn_matrix<T, 4> a(3, 5, 7, 7);
+    a = etl::uniform_generator(-10.0, 10.0);
+
+    etl::dyn_matrix<T, 4> ref;
+    ref = etl::avg_pool_2d(a, 3, 3, 2, 2, 1, 1);
+
+    etl::dyn_matrix<T, 4> b_nhwc(3, 4, 4, 5);
+    b_nhwc = etl::avg_pool_2d_nhwc(etl::nchw_to_nhwc(a), 3, 3, 2, 2, 1, 1);
+
+    etl::dyn_matrix<T, 4> b(3, 5, 4, 4);
+    b = etl::nhwc_to_nchw(b_nhwc);
+
+    REQUIRE_DIRECT(approx_equals(b, ref, base_eps_etl_large));
+}
+
+TEMPLATE_TEST_CASE_2("nhwc/bias_add/0", "[nhwc][bias_add]", T, float, double) {
+    etl::dyn_matrix<T, 4> a(3, 4, 5, 19);
+    etl::dyn_matrix<T, 1> b(19);
+
+    a = etl::uniform_generator(-10.0, 10.0);
+    b = etl::uniform_generator(-10.0, 10.0);
+
+    etl::dyn_matrix<T, 4> c(3, 4, 5, 19);
+
+    SELECTED_SECTION(etl::bias_add_impl::STD) {
+        c = etl::bias_add_4d_nhwc(a, b);
+
+        for (size_t i = 0; i < etl::size(c); ++i) {
+            REQUIRE_EQUALS_APPROX(c[i], a[i] + b[i % 19]);
+        }
+    }
+
+    SELECTED_SECTION(etl::bias_add_impl::VEC) {
+        c = etl::bias_add_4d_nhwc(a, b);
+
+        for (size_t i = 0; i < etl::size(c); ++i) {
+            REQUIRE_EQUALS_APPROX(c[i], a[i] + b[i % 19]);
+        }
+    }
+}
@@ -0,0 +1,105 @@
+//=======================================================================
+// Copyright (c) 2014-2017 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#include "test_light.hpp"
+
+// Tests for the common sub expression elimination
+
+TEMPLATE_TEST_CASE_2("optimize/cse/0", "[optimizer][cse]", Z, float, double) {
+    etl::dyn_vector<Z> a(1031);
+    etl::dyn_vector<Z> b(1031);
+
+    a = etl::uniform_generator(-2.0, 2.0);
+
+    auto expr = etl::sigmoid(a) >> (Z(1) - etl::sigmoid(a));
+
+    static_assert(std::is_same<typename etl::cse_traits<decltype(expr)>::shared_t, decltype(etl::sigmoid(a))>::value, "Invalid shared expression");
+
+    REQUIRE_DIRECT(etl::is_optimizable(expr));
+
+    b = opt(expr);
+
+    for (size_t i = 0; i < 1031; ++i) {
+        const Z s = Z(1) / (Z(1) + std::exp(-a[i]));
+        REQUIRE_EQUALS_APPROX(b[i], s * (Z(1) - s));
+    }
+}
+
+// The same sub expression types over different operands are not shared
+TEMPLATE_TEST_CASE_2("optimize/cse/1", "[optimizer][cse]", Z, float, double) {
+    etl::dyn_vector<Z> a(1031);
+    etl::dyn_vector<Z> c(1031);
+    etl::dyn_vector<Z> b(1031);
+
+    a = etl::uniform_generator(-2.0, 2.0);
+    c = etl::uniform_generator(-2.0, 2.0);
+
+    auto expr = etl::exp(a) / (Z(1) + etl::exp(c));
+
+    REQUIRE_DIRECT(!etl::is_optimizable(expr));
+
+    b = opt(expr);
+
+    for (size_t i = 0; i < 1031; ++i) {
+        REQUIRE_EQUALS_APPROX(b[i], std::exp(a[i]) / (Z(1) + std::exp(c[i])));
+    }
+}
+
+// The largest shared sub expression is selected
+TEMPLATE_TEST_CASE_2("optimize/cse/2", "[optimizer][cse]", Z, float, double) {
+    etl::dyn_matrix<Z> a(17, 33);
+    etl::dyn_matrix<Z> c(17, 33);
+    etl::dyn_matrix<Z> b(17, 33);
+
+    a = etl::uniform_generator(-1.0, 1.0);
+    c = etl::uniform_generator(-1.0, 1.0);
+
+    auto expr = etl::exp(a + c) >> (etl::exp(a + c) - Z(2));
+
+    static_assert(std::is_same<typename etl::cse_traits<decltype(expr)>::shared_t, decltype(etl::exp(a + c))>::value, "Invalid shared expression");
+
+    REQUIRE_DIRECT(etl::is_optimizable(expr));
+
+    b = opt(expr);
+
+    for (size_t i = 0; i < etl::size(b); ++i) {
+        const Z e = std::exp(a[i] + c[i]);
+        REQUIRE_EQUALS_APPROX(b[i], e * (e - Z(2)));
+    }
+}
+
+// The scalars of the shared sub expressions must be the same
+TEMPLATE_TEST_CASE_2("optimize/cse/3", "[optimizer][cse]", Z, float, double) {
+    etl::dyn_vector<Z> a(103);
+    etl::dyn_vector<Z> b(103);
+
+    a = etl::uniform_generator(-1.0, 1.0);
+
+    REQUIRE_DIRECT(etl::is_optimizable(etl::exp(a * Z(2)) + etl::exp(a * Z(2))));
+    REQUIRE_DIRECT(!etl::is_optimizable(etl::exp(a * Z(2)) + etl::exp(a * Z(3))));
+
+    b = opt(etl::exp(a * Z(2)) + etl::exp(a * Z(3)));
+
+    for (size_t i = 0; i < 103; ++i) {
+        REQUIRE_EQUALS_APPROX(b[i], std::exp(a[i] * Z(2)) + std::exp(a[i] * Z(3)));
+    }
+}
+
+// The other optimizations are applied before the elimination
+TEMPLATE_TEST_CASE_2("optimize/cse/4", "[optimizer][cse]", Z, float, double) {
+    etl::fast_matrix<Z, 3, 5> a;
+    etl::fast_matrix<Z, 3, 5> b;
+
+    a = etl::sequence_generator(-1.0) * 0.25;
+
+    b = opt(etl::tanh(a * Z(1)) >> (Z(1) - etl::tanh(a)) >> (Z(1) + etl::tanh(a)));
+
+    for (size_t i = 0; i < etl::size(b); ++i) {
+        const Z t = std::tanh(a[i]);
+        REQUIRE_EQUALS_APPROX(b[i], t * (Z(1) - t) * (Z(1) + t));
+    }
+}
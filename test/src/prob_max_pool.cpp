@@ -276,3 +276,39 @@ TEMPLATE_TEST_CASE_2("p_max_pool_p_7", "p_max_pool_p_2d", Z, float, double) {
     REQUIRE_EQUALS_APPROX(b(1, 1, 1, 0), 0.19151);
     REQUIRE_EQUALS_APPROX(b(1, 1, 1, 1), 0.00054);
 }
+
+// Larger batches, compared to the definition
+TEMPLATE_TEST_CASE_2("p_max_pool_8", "p_max_pool_4d", Z, float, double) {
+    etl::fast_matrix<Z, 3, 5, 12, 22> a;
+    etl::fast_matrix<Z, 3, 5, 12, 22> h;
+    etl::fast_matrix<Z, 3, 5, 4, 11> p;
+
+    a = etl::uniform_generator(-2.0, 2.0);
+
+    h = etl::p_max_pool_h<3, 2>(a);
+    p = etl::p_max_pool_p<3, 2>(a);
+
+    for (size_t k = 0; k < 3; ++k) {
+        for (size_t l = 0; l < 5; ++l) {
+            for (size_t i = 0; i < 4; ++i) {
+                for (size_t j = 0; j < 11; ++j) {
+                    Z s = 0;
+
+                    for (size_t ii = 0; ii < 3; ++ii) {
+                        for (size_t jj = 0; jj < 2; ++jj) {
+                            s += std::exp(a(k, l, i * 3 + ii, j * 2 + jj));
+                        }
+                    }
+
+                    REQUIRE_EQUALS_APPROX(p(k, l, i, j), Z(1) / (Z(1) + s));
+
+                    for (size_t ii = 0; ii < 3; ++ii) {
+                        for (size_t jj = 0; jj < 2; ++jj) {
+                            REQUIRE_EQUALS_APPROX(h(k, l, i * 3 + ii, j * 2 + jj), std::exp(a(k, l, i * 3 + ii, j * 2 + jj)) / (Z(1) + s));
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
@@ -223,6 +223,72 @@ TEMPLATE_TEST_CASE_2("sum_l/fast_matrix_6", "sum_l", Z, float, double) {
     REQUIRE_EQUALS_APPROX(b(3, 1), 48.0);
 }
 
+TEMPLATE_TEST_CASE_2("sum_l/large", "sum_l", Z, float, double) {
+    etl::dyn_matrix<Z, 3> a(13, 7, 19);
+    etl::dyn_matrix<Z, 2> b(7, 19);
+    etl::dyn_matrix<Z, 2> c(7, 19);
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        a[i] = Z((i * 7) % 23) - Z(11);
+    }
+
+    b = etl::sum_l(a);
+    c = etl::mean_l(a + a);
+
+    for (size_t j = 0; j < 7 * 19; ++j) {
+        Z sum = 0;
+
+        for (size_t i = 0; i < 13; ++i) {
+            sum += a[i * 7 * 19 + j];
+        }
+
+        REQUIRE_EQUALS_APPROX(b[j], sum);
+        REQUIRE_EQUALS_APPROX(c[j], Z(2) * sum / Z(13));
+    }
+}
+
+TEMPLATE_TEST_CASE_2("sum_r/large", "sum_r", Z, float, double) {
+    etl::dyn_matrix<Z, 2> a(37, 131);
+    etl::dyn_vector<Z> b(37);
+    etl::dyn_vector<Z> c(37);
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        a[i] = Z((i * 7) % 23) - Z(11);
+    }
+
+    b = etl::sum_r(a);
+    c = etl::mean_r(a * Z(2));
+
+    for (size_t i = 0; i < 37; ++i) {
+        Z sum = 0;
+
+        for (size_t k = 0; k < 131; ++k) {
+            sum += a(i, k);
+        }
+
+        REQUIRE_EQUALS_APPROX(b[i], sum);
+        REQUIRE_EQUALS_APPROX(c[i], Z(2) * sum / Z(131));
+    }
+}
+
+TEMPLATE_TEST_CASE_2("sum_r/cm", "sum_r", Z, float, double) {
+    etl::fast_matrix_cm<Z, 3, 4> a({1, 0, 4, 2, 0, 5, 3, 1, 6, 4, 1, 7});
+    etl::fast_matrix<Z, 3> b;
+    etl::fast_matrix<Z, 4> c;
+
+    b = etl::sum_r(a);
+    c = etl::sum_l(a);
+
+    REQUIRE_EQUALS(b(0), Z(10));
+    REQUIRE_EQUALS(b(1), Z(2));
+    REQUIRE_EQUALS(b(2), Z(22));
+
+    REQUIRE_EQUALS(c(0), Z(5));
+    REQUIRE_EQUALS(c(1), Z(7));
+    REQUIRE_EQUALS(c(2), Z(10));
+    REQUIRE_EQUALS(c(3), Z(12));
+}
+
 // Tests for bias_batch_mean_2d
 
 TEMPLATE_TEST_CASE_2("bias_batch_mean_2d/0", "[mean]", Z, float, double) {
@@ -422,3 +488,220 @@ TEMPLATE_TEST_CASE_2("argmin/2", "[mean]", Z, float, double) {
 
     REQUIRE_EQUALS(etl::argmin(a), 8UL);
 }
+
+TEMPLATE_TEST_CASE_2("argmax/3", "[mean]", Z, float, double) {
+    etl::dyn_matrix<Z, 2> a(17, 67);
+    etl::dyn_vector<Z> b(17);
+    etl::dyn_vector<Z> c(17);
+
+    for (size_t i = 0; i < 17; ++i) {
+        for (size_t k = 0; k < 67; ++k) {
+            a(i, k) = Z(((i + 3) * (k + 1)) % (i + 7));
+        }
+    }
+
+    b = etl::argmax(a);
+    c = etl::argmin(-a);
+
+    for (size_t i = 0; i < 17; ++i) {
+        size_t m = 0;
+
+        for (size_t k = 1; k < 67; ++k) {
+            if (a(i, k) > a(i, m)) {
+                m = k;
+            }
+        }
+
+        REQUIRE_EQUALS(b[i], Z(m));
+        REQUIRE_EQUALS(c[i], Z(m));
+    }
+}
+
+TEMPLATE_TEST_CASE_2("argmax/4", "[mean]", Z, float, double) {
+    etl::fast_matrix<Z, 2, 19> a;
+    etl::fast_matrix<Z, 2> b;
+
+    a = 1.0;
+
+    a(0, 13) = 2.0;
+    a(0, 17) = 2.0;
+    a(0, 5)  = 2.0;
+
+    b = etl::argmax(a);
+
+    REQUIRE_EQUALS(b(0), Z(5));
+    REQUIRE_EQUALS(b(1), Z(0));
+}
+
+// Rows longer than the chunks of exact float indices
+TEST_CASE("argmax/5", "[mean]") {
+    const size_t K = (size_t(1) << 24) + 67;
+
+    etl::dyn_matrix<float, 2> a(1, K);
+    etl::dyn_vector<float> b(1);
+    etl::dyn_vector<float> c(1);
+
+    a = 1.0;
+
+    a(0, K - 65) = 2.0;
+    a(0, K - 1)  = 2.0;
+
+    a(0, 3)      = 0.0;
+    a(0, K - 61) = 0.0;
+
+    b = etl::argmax(a);
+    c = etl::argmin(a);
+
+    REQUIRE_EQUALS(b(0), float(K - 65));
+    REQUIRE_EQUALS(c(0), float(3));
+}
+
+TEMPLATE_TEST_CASE_2("reduc/empty", "[mean]", Z, float, double) {
+    etl::dyn_matrix<Z, 2> a(0, 5);
+    etl::dyn_vector<Z> b(0);
+
+    b = etl::sum_r(a);
+    b = etl::mean_r(a);
+    b = etl::argmax(a);
+
+    REQUIRE_EQUALS(b.size(), 0UL);
+}
+
+// Tests for stats
+
+TEMPLATE_TEST_CASE_2("stats/0", "[stats]", Z, float, double) {
+    etl::fast_vector<Z, 3> a = {-1.5, 2.5, 8.0};
+
+    auto s = etl::stats(a);
+
+    REQUIRE_EQUALS(s.count, 3UL);
+    REQUIRE_EQUALS_APPROX(s.mean, Z(3.0));
+    REQUIRE_EQUALS_APPROX(s.variance(), Z(15.16667));
+    REQUIRE_EQUALS_APPROX(s.stddev(), Z(3.89444));
+    REQUIRE_EQUALS(s.min, Z(-1.5));
+    REQUIRE_EQUALS(s.max, Z(8.0));
+}
+
+TEMPLATE_TEST_CASE_2("stats/1", "[stats]", Z, float, double) {
+    etl::dyn_vector<Z> a(10007);
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        a[i] = Z((i * 17) % 101) * Z(0.25) - Z(3.0);
+    }
+
+    a[4711] = 100.0;
+    a[9999] = -100.0;
+
+    auto s = etl::stats(a + a);
+
+    double sum = 0;
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        sum += 2.0 * a[i];
+    }
+
+    double mean = sum / etl::size(a);
+
+    double var = 0;
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        var += (2.0 * a[i] - mean) * (2.0 * a[i] - mean);
+    }
+
+    var /= etl::size(a);
+
+    REQUIRE_EQUALS(s.count, 10007UL);
+    REQUIRE_EQUALS_APPROX(s.mean, Z(mean));
+    REQUIRE_EQUALS_APPROX(s.variance(), Z(var));
+    REQUIRE_EQUALS(s.min, Z(-200.0));
+    REQUIRE_EQUALS(s.max, Z(200.0));
+}
+
+TEMPLATE_TEST_CASE_2("stats/2", "[stats]", Z, float, double) {
+    etl::dyn_vector<Z> a(4099);
+
+    // A large offset makes the naive sum of squares unusable
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        a[i] = Z(10000.0) + ((i % 2) ? Z(1.0) : Z(-1.0));
+    }
+
+    auto s = etl::stats(a);
+
+    REQUIRE_EQUALS_APPROX(s.mean, Z(10000.0 - 1.0 / 4099.0));
+    REQUIRE_EQUALS_APPROX_E(s.variance(), Z(1.0), 1e-3);
+    REQUIRE_EQUALS_APPROX(etl::stddev(a), Z(1.0));
+}
+
+TEMPLATE_TEST_CASE_2("stats_r/0", "[stats]", Z, float, double) {
+    etl::dyn_matrix<Z, 2> a(33, 45);
+    etl::dyn_vector<Z> mean(33);
+    etl::dyn_vector<Z> variance(33);
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        a[i] = Z((i * 7) % 23) * Z(0.5) - Z(4.0);
+    }
+
+    etl::stats_r(a, mean, variance);
+
+    for (size_t i = 0; i < 33; ++i) {
+        Z m = 0;
+        for (size_t j = 0; j < 45; ++j) {
+            m += a(i, j);
+        }
+
+        m /= Z(45);
+
+        Z v = 0;
+        for (size_t j = 0; j < 45; ++j) {
+            v += (a(i, j) - m) * (a(i, j) - m);
+        }
+
+        v /= Z(45);
+
+        REQUIRE_EQUALS_APPROX(mean[i], m);
+        REQUIRE_EQUALS_APPROX(variance[i], v);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("stats_l/0", "[stats]", Z, float, double) {
+    etl::dyn_matrix<Z, 3> a(33, 5, 9);
+    etl::dyn_matrix<Z, 2> mean(5, 9);
+    etl::dyn_matrix<Z, 2> variance(5, 9);
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        a[i] = Z((i * 7) % 23) * Z(0.5) - Z(4.0);
+    }
+
+    etl::stats_l(a, mean, variance);
+
+    for (size_t j = 0; j < 45; ++j) {
+        Z m = 0;
+        for (size_t i = 0; i < 33; ++i) {
+            m += a[i * 45 + j];
+        }
+
+        m /= Z(33);
+
+        Z v = 0;
+        for (size_t i = 0; i < 33; ++i) {
+            v += (a[i * 45 + j] - m) * (a[i * 45 + j] - m);
+        }
+
+        v /= Z(33);
+
+        REQUIRE_EQUALS_APPROX(mean[j], m);
+        REQUIRE_EQUALS_APPROX(variance[j], v);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("stats_rl/empty", "[stats]", Z, float, double) {
+    etl::dyn_matrix<Z, 2> a(0, 5);
+    etl::dyn_vector<Z> mean_r(0);
+    etl::dyn_vector<Z> variance_r(0);
+    etl::dyn_vector<Z> mean_l(5);
+    etl::dyn_vector<Z> variance_l(5);
+
+    etl::stats_r(a, mean_r, variance_r);
+    etl::stats_l(a, mean_l, variance_l);
+
+    REQUIRE_EQUALS(mean_r.size(), 0UL);
+    REQUIRE_EQUALS(mean_l.size(), 5UL);
+}
@@ -106,3 +106,67 @@ TEMPLATE_TEST_CASE_2("stable_softmax/2", "fast_vector::softmax", Z, float, doubl
         REQUIRE_EQUALS_APPROX(c[i], c_ref[i]);
     }
 }
+
+TEMPLATE_TEST_CASE_2("softmax/6", "[softmax]", Z, float, double) {
+    etl::dyn_matrix<Z> a(7, 1031);
+    etl::dyn_matrix<Z> c(7, 1031);
+
+    a = etl::uniform_generator(-5.0, 5.0);
+
+    c = etl::softmax(a);
+
+    for (size_t i = 0; i < 7; ++i) {
+        Z sum = 0;
+
+        for (size_t j = 0; j < 1031; ++j) {
+            sum += std::exp(a(i, j));
+        }
+
+        for (size_t j = 0; j < 1031; ++j) {
+            REQUIRE_EQUALS_APPROX(c(i, j), std::exp(a(i, j)) / sum);
+        }
+
+        REQUIRE_EQUALS_APPROX(etl::sum(c(i)), Z(1));
+    }
+}
+
+TEMPLATE_TEST_CASE_2("stable_softmax/3", "[softmax]", Z, float, double) {
+    etl::dyn_matrix<Z> a(5, 1029);
+    etl::dyn_matrix<Z> c(5, 1029);
+
+    // exp(x) overflows without the subtraction of the maximum
+    a = etl::uniform_generator(-5.0, 5.0) + 1000.0;
+
+    c = etl::stable_softmax(a + a - 1000.0);
+
+    for (size_t i = 0; i < 5; ++i) {
+        Z m = a(i, 0) + a(i, 0) - Z(1000);
+
+        for (size_t j = 0; j < 1029; ++j) {
+            m = std::max(m, a(i, j) + a(i, j) - Z(1000));
+        }
+
+        Z sum = 0;
+
+        for (size_t j = 0; j < 1029; ++j) {
+            sum += std::exp(a(i, j) + a(i, j) - Z(1000) - m);
+        }
+
+        for (size_t j = 0; j < 1029; ++j) {
+            REQUIRE_EQUALS_APPROX(c(i, j), std::exp(a(i, j) + a(i, j) - Z(1000) - m) / sum);
+        }
+
+        REQUIRE_EQUALS_APPROX(etl::sum(c(i)), Z(1));
+    }
+}
+
+TEMPLATE_TEST_CASE_2("stable_softmax/4", "[softmax]", Z, float, double) {
+    etl::fast_matrix<Z, 2, 3> a = {1.0, 2.0, 3.0, 1001.0, 1002.0, 1003.0};
+    etl::fast_matrix<Z, 2, 3> c;
+
+    c = etl::stable_softmax(a);
+
+    for (size_t j = 0; j < 3; ++j) {
+        REQUIRE_EQUALS_APPROX(c(0, j), c(1, j));
+    }
+}
@@ -179,6 +179,129 @@ INPLACE_TRANSPOSE_TEST_CASE("transpose/inplace/4", "transpose") {
     REQUIRE_EQUALS(a(4, 2), 15.0);
 }
 
+TRANSPOSE_TEST_CASE("transpose/large/1", "[transpose]") {
+    etl::dyn_matrix<T> a(67, 133);
+    etl::dyn_matrix<T> b(133, 67);
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        a[i] = T(i);
+    }
+
+    Impl::apply(a, b);
+
+    for (size_t i = 0; i < 67; ++i) {
+        for (size_t j = 0; j < 133; ++j) {
+            REQUIRE_EQUALS(b(j, i), a(i, j));
+        }
+    }
+}
+
+TRANSPOSE_TEST_CASE("transpose/large/2", "[transpose]") {
+    etl::dyn_matrix_cm<T> a(67, 133);
+    etl::dyn_matrix_cm<T> b(133, 67);
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        a[i] = T(i);
+    }
+
+    Impl::apply(a, b);
+
+    for (size_t i = 0; i < 67; ++i) {
+        for (size_t j = 0; j < 133; ++j) {
+            REQUIRE_EQUALS(b(j, i), a(i, j));
+        }
+    }
+}
+
+INPLACE_TRANSPOSE_TEST_CASE("transpose/inplace/large/1", "[transpose]") {
+    etl::dyn_matrix<T> a(75, 75);
+    etl::dyn_matrix<T> ref(75, 75);
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        a[i] = T(i);
+    }
+
+    ref = a;
+
+    Impl::apply(a);
+
+    for (size_t i = 0; i < 75; ++i) {
+        for (size_t j = 0; j < 75; ++j) {
+            REQUIRE_EQUALS(a(j, i), ref(i, j));
+        }
+    }
+}
+
+INPLACE_TRANSPOSE_TEST_CASE("transpose/inplace/large/2", "[transpose]") {
+    etl::dyn_matrix<T> a(37, 91);
+    etl::dyn_matrix<T> ref(37, 91);
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        a[i] = T(i);
+    }
+
+    ref = a;
+
+    Impl::apply(a);
+
+    REQUIRE_EQUALS(etl::dim<0>(a), 91UL);
+    REQUIRE_EQUALS(etl::dim<1>(a), 37UL);
+
+    for (size_t i = 0; i < 37; ++i) {
+        for (size_t j = 0; j < 91; ++j) {
+            REQUIRE_EQUALS(a(j, i), ref(i, j));
+        }
+    }
+}
+
+INPLACE_TRANSPOSE_TEST_CASE("transpose/inplace/large/3", "[transpose]") {
+    etl::dyn_matrix_cm<T> a(37, 91);
+    etl::dyn_matrix_cm<T> ref(37, 91);
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        a[i] = T(i);
+    }
+
+    ref = a;
+
+    Impl::apply(a);
+
+    REQUIRE_EQUALS(etl::dim<0>(a), 91UL);
+    REQUIRE_EQUALS(etl::dim<1>(a), 37UL);
+
+    for (size_t i = 0; i < 37; ++i) {
+        for (size_t j = 0; j < 91; ++j) {
+            REQUIRE_EQUALS(a(j, i), ref(i, j));
+        }
+    }
+}
+
+INPLACE_TRANSPOSE_TEST_CASE("transpose/inplace/large/4", "[transpose]") {
+    const size_t shapes[][2] = {{40, 64}, {96, 160}, {18, 12}, {3, 1000}, {256, 33}};
+
+    for (auto& shape : shapes) {
+        etl::dyn_matrix<T> a(shape[0], shape[1]);
+        etl::dyn_matrix<T> ref(shape[0], shape[1]);
+
+        for (size_t i = 0; i < etl::size(a); ++i) {
+            a[i] = T(i);
+        }
+
+        ref = a;
+
+        Impl::apply(a);
+
+        REQUIRE_EQUALS(etl::dim<0>(a), shape[1]);
+        REQUIRE_EQUALS(etl::dim<1>(a), shape[0]);
+
+        for (size_t i = 0; i < shape[0]; ++i) {
+            for (size_t j = 0; j < shape[1]; ++j) {
+                REQUIRE_EQUALS(a(j, i), ref(i, j));
+            }
+        }
+    }
+}
+
 TEMPLATE_TEST_CASE_2("transpose/expr_1", "transpose", Z, float, double) {
     etl::dyn_matrix<Z, 3> a(3, 3, 3, std::initializer_list<Z>({1, 2, 3, 4, 5, 6, 7, 8, 9, 1, 2, 3, 4, 5, 6, 7, 8, 9, 1, 2, 3, 4, 5, 6, 7, 8, 9}));
 
@@ -216,3 +216,63 @@ TEMPLATE_TEST_CASE_2("trigo/cosh/3", "[trigo][cosh]", Z, etl::complex<float>, et
         REQUIRE_EQUALS_APPROX(b[i].imag, etl::cosh(a[i]).imag);
     }
 }
+
+TEMPLATE_TEST_CASE_2("trigo/sin/4", "[trigo][sin]", Z, double, float) {
+    etl::dyn_vector<Z> a(1037);
+    etl::dyn_vector<Z> b;
+
+    a = etl::uniform_generator(-100.0, 100.0);
+    b = etl::sin(a);
+
+    for (size_t i = 0; i < b.size(); ++i) {
+        REQUIRE_EQUALS_APPROX_E(b[i], std::sin(a[i]), base_eps * 10);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("trigo/cos/4", "[trigo][cos]", Z, double, float) {
+    etl::dyn_vector<Z> a(1037);
+    etl::dyn_vector<Z> b;
+
+    a = etl::uniform_generator(-100.0, 100.0);
+    b = etl::cos(a);
+
+    for (size_t i = 0; i < b.size(); ++i) {
+        REQUIRE_EQUALS_APPROX_E(b[i], std::cos(a[i]), base_eps * 10);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("trigo/tanh/4", "[trigo][tanh]", Z, double, float) {
+    etl::dyn_vector<Z> a(1037);
+    etl::dyn_vector<Z> b;
+
+    a = etl::uniform_generator(-10.0, 10.0);
+    b = etl::tanh(a);
+
+    for (size_t i = 0; i < b.size(); ++i) {
+        REQUIRE_EQUALS_APPROX(b[i], std::tanh(a[i]));
+    }
+}
+
+TEMPLATE_TEST_CASE_2("trigo/sinh/4", "[trigo][sinh]", Z, double, float) {
+    etl::dyn_vector<Z> a(1037);
+    etl::dyn_vector<Z> b;
+
+    a = etl::uniform_generator(-20.0, 20.0);
+    b = etl::sinh(a);
+
+    for (size_t i = 0; i < b.size(); ++i) {
+        REQUIRE_EQUALS_APPROX(b[i], std::sinh(a[i]));
+    }
+}
+
+TEMPLATE_TEST_CASE_2("trigo/cosh/4", "[trigo][cosh]", Z, double, float) {
+    etl::dyn_vector<Z> a(1037);
+    etl::dyn_vector<Z> b;
+
+    a = etl::uniform_generator(-20.0, 20.0);
+    b = etl::cosh(a);
+
+    for (size_t i = 0; i < b.size(); ++i) {
+        REQUIRE_EQUALS_APPROX(b[i], std::cosh(a[i]));
+    }
+}
@@ -544,6 +544,59 @@ TEMPLATE_TEST_CASE_2("fast_matrix/sign", "fast_matrix::sign", Z, float, double)
     REQUIRE_EQUALS(d[2], 0.0);
 }
 
+TEMPLATE_TEST_CASE_2("unary/sign/large", "[unary]", Z, float, double) {
+    etl::dyn_vector<Z> a(1031);
+    a = etl::uniform_generator(-10.0, 10.0);
+
+    a[1] = Z(0.0);
+    a[2] = Z(-0.0);
+    a[7] = std::numeric_limits<Z>::quiet_NaN();
+
+    etl::dyn_vector<Z> d(1031);
+    d = sign(a);
+
+    for (size_t i = 0; i < 1031; ++i) {
+        REQUIRE_EQUALS(d[i], etl::math::sign(a[i]));
+    }
+}
+
+TEMPLATE_TEST_CASE_2("unary/floor_ceil/large", "[unary]", Z, float, double) {
+    etl::dyn_vector<Z> a(1031);
+    a = etl::uniform_generator(-1000.0, 1000.0);
+
+    a[1] = Z(-0.5);
+    a[2] = Z(-3.0);
+    a[3] = Z(1e10);
+    a[4] = Z(-1e10);
+
+    etl::dyn_vector<Z> d(1031);
+
+    d = floor(a);
+
+    for (size_t i = 0; i < 1031; ++i) {
+        REQUIRE_EQUALS(d[i], std::floor(a[i]));
+    }
+
+    d = ceil(a);
+
+    for (size_t i = 0; i < 1031; ++i) {
+        REQUIRE_EQUALS(d[i], std::ceil(a[i]));
+    }
+}
+
+TEMPLATE_TEST_CASE_2("unary/one_if/large", "[unary]", Z, float, double) {
+    etl::dyn_vector<Z> a(1031);
+    a = etl::uniform_generator(-3.0, 3.0);
+    a = floor(a);
+
+    etl::dyn_vector<Z> d(1031);
+    d = etl::one_if(a, 1.0);
+
+    for (size_t i = 0; i < 1031; ++i) {
+        REQUIRE_EQUALS(d[i], a[i] == Z(1.0) ? Z(1.0) : Z(0.0));
+    }
+}
+
 TEMPLATE_TEST_CASE_2("fast_matrix/unary_unary", "fast_matrix::abs", Z, float, double) {
     etl::fast_matrix<Z, 2, 2> a = {-1.0, 2.0, 0.0, 3.0};
 
@@ -614,6 +667,18 @@ TEMPLATE_TEST_CASE_2("fast_matrix/softplus", "fast_matrix::softplus", Z, float,
     REQUIRE_EQUALS_APPROX(d[3], etl::math::softplus(Z(1.0)));
 }
 
+TEMPLATE_TEST_CASE_2("softplus/1", "[softplus]", Z, float, double) {
+    etl::dyn_vector<Z> a(1037);
+    etl::dyn_vector<Z> d;
+
+    a = etl::uniform_generator(-30.0, 30.0);
+    d = softplus(a);
+
+    for (size_t i = 0; i < d.size(); ++i) {
+        REQUIRE_EQUALS_APPROX(d[i], Z(std::log1p(std::exp(double(a[i])))));
+    }
+}
+
 TEMPLATE_TEST_CASE_2("exp/0", "[exp]", Z, float, double) {
     etl::fast_matrix<Z, 2, 2> a = {-1.0, 2.0, 0.0, 1.0};
 